@@ -60,10 +60,10 @@ namespace catapult { namespace eventsource {
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				const auto& config = state.config();
-				auto connectionSettings = extensions::GetConnectionSettings(config);
+				auto connectionSettings = extensions::GetConnectionSettings(config, state.socketWorkingBufferPool());
 				auto pServiceGroup = state.pool().pushServiceGroup("api");
 				auto pWriters = pServiceGroup->pushService(net::CreatePacketWriters, locator.keyPair(), connectionSettings);
-				extensions::BootServer(*pServiceGroup, config.Node.ApiPort, config, [&acceptor = *pWriters](
+				extensions::BootServer(*pServiceGroup, config.Node.ApiPort, config, state.socketWorkingBufferPool(), [&acceptor = *pWriters](
 						const auto& socketInfo,
 						const auto& callback) {
 					acceptor.accept(socketInfo.socket(), callback);
@@ -33,6 +33,7 @@ namespace catapult { namespace eventsource {
 		struct ApiNetworkPacketWritersServiceTraits {
 			static constexpr auto Counter_Name = "B WRITERS";
 			static constexpr auto Num_Expected_Services = 1;
+			static constexpr auto Num_Expected_Counters = 1;
 
 			static auto GetWriters(const extensions::ServiceLocator& locator) {
 				return locator.service<net::PacketWriters>("api.writers");
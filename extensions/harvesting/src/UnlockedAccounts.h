@@ -55,7 +55,7 @@ namespace catapult { namespace harvesting {
 		/// Creates a view around \a keyPairs with lock context \a readLock.
 		explicit UnlockedAccountsView(
 				const std::vector<crypto::KeyPair>& keyPairs,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+				utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 				: m_keyPairs(keyPairs)
 				, m_readLock(std::move(readLock))
 		{}
@@ -79,7 +79,7 @@ namespace catapult { namespace harvesting {
 
 	private:
 		const std::vector<crypto::KeyPair>& m_keyPairs;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// A write only view on top of unlocked accounts.
@@ -92,7 +92,7 @@ namespace catapult { namespace harvesting {
 		UnlockedAccountsModifier(
 				size_t maxUnlockedAccounts,
 				std::vector<crypto::KeyPair>& keyPairs,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+				utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 				: m_maxUnlockedAccounts(maxUnlockedAccounts)
 				, m_keyPairs(keyPairs)
 				, m_readLock(std::move(readLock))
@@ -112,8 +112,8 @@ namespace catapult { namespace harvesting {
 	private:
 		size_t m_maxUnlockedAccounts;
 		std::vector<crypto::KeyPair>& m_keyPairs;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::WriterLockGuard m_writeLock;
 	};
 
 	/// Container of all unlocked (harvesting candidate) accounts.
@@ -133,6 +133,6 @@ namespace catapult { namespace harvesting {
 	private:
 		size_t m_maxUnlockedAccounts;
 		std::vector<crypto::KeyPair> m_keyPairs;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ReaderWriterLock m_lock;
 	};
 }}
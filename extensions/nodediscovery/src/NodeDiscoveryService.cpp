@@ -96,7 +96,7 @@ namespace catapult { namespace nodediscovery {
 				auto pushNodeConsumer = CreatePushNodeConsumer(state);
 
 				// register services
-				auto connectionSettings = extensions::GetConnectionSettings(state.config());
+				auto connectionSettings = extensions::GetConnectionSettings(state.config(), state.socketWorkingBufferPool());
 				auto pServiceGroup = state.pool().pushServiceGroup("node_discovery");
 				auto pNodePingRequestor = pServiceGroup->pushService(
 						CreateNodePingRequestor,
@@ -61,9 +61,9 @@ namespace catapult { namespace packetserver {
 						net::CreatePacketReaders,
 						state.packetHandlers(),
 						locator.keyPair(),
-						extensions::GetConnectionSettings(config),
+						extensions::GetConnectionSettings(config, state.socketWorkingBufferPool()),
 						extensions::GetMaxIncomingConnectionsPerIdentity(config.Node.Local.Roles));
-				extensions::BootServer(*pServiceGroup, config.Node.Port, config, [&acceptor = *pReaders](
+				extensions::BootServer(*pServiceGroup, config.Node.Port, config, state.socketWorkingBufferPool(), [&acceptor = *pReaders](
 						const auto& socketInfo,
 						const auto& callback) {
 					acceptor.accept(socketInfo, callback);
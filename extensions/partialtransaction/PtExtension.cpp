@@ -46,7 +46,7 @@ namespace catapult { namespace partialtransaction {
 			// register other services
 			extensionManager.addServiceRegistrar(CreatePtDispatcherServiceRegistrar());
 			extensionManager.addServiceRegistrar(CreatePtSyncSourceServiceRegistrar());
-			extensionManager.addServiceRegistrar(CreatePtServiceRegistrar());
+			extensionManager.addServiceRegistrar(CreatePtServiceRegistrar(config));
 		}
 	}
 }}
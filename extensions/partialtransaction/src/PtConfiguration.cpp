@@ -36,8 +36,9 @@ namespace catapult { namespace partialtransaction {
 
 		LOAD_PROPERTY(CacheMaxResponseSize);
 		LOAD_PROPERTY(CacheMaxSize);
+		LOAD_PROPERTY(ReconciliationMaxDifference);
 
-		utils::VerifyBagSizeLte(bag, 2);
+		utils::VerifyBagSizeLte(bag, 3);
 		return config;
 	}
 
@@ -35,6 +35,11 @@ namespace catapult { namespace partialtransaction {
 		/// Maximum size of the partial transactions cache.
 		uint32_t CacheMaxSize;
 
+		/// Maximum number of transaction and cosignature short hashes that can differ when reconciling partial transactions
+		/// with a peer (0 disables reconciliation).
+		/// \note This should only be enabled when all api peers support partial transactions reconciliation.
+		uint32_t ReconciliationMaxDifference;
+
 	private:
 		PtConfiguration() = default;
 
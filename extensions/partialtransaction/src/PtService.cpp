@@ -49,11 +49,14 @@ namespace catapult { namespace partialtransaction {
 		thread::Task CreatePullPtTask(
 				extensions::ServiceLocator& locator,
 				const extensions::ServiceState& state,
-				net::PacketWriters& packetWriters) {
+				net::PacketWriters& packetWriters,
+				uint32_t maxReconciliationDifference) {
 			const auto& ptCache = GetMemoryPtCache(locator);
 			const auto& serverHooks = GetPtServerHooks(locator);
 			auto ptSynchronizer = chain::CreatePtSynchronizer(
 					[&ptCache]() { return ptCache.view().shortHashPairs(); },
+					[&ptCache](auto numCells) { return ptCache.view().shortHashesIblt(numCells); },
+					maxReconciliationDifference,
 					serverHooks.cosignedTransactionInfosConsumer());
 
 			thread::Task task;
@@ -69,6 +72,9 @@ namespace catapult { namespace partialtransaction {
 
 		class PtServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
+			explicit PtServiceRegistrar(const PtConfiguration& config) : m_config(config)
+			{}
+
 			extensions::ServiceRegistrarInfo info() const override {
 				return { "Pt", extensions::ServiceRegistrarPhase::Post_Extended_Range_Consumers };
 			}
@@ -80,7 +86,7 @@ namespace catapult { namespace partialtransaction {
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
-				auto connectionSettings = extensions::GetConnectionSettings(state.config());
+				auto connectionSettings = extensions::GetConnectionSettings(state.config(), state.socketWorkingBufferPool());
 				auto pServiceGroup = state.pool().pushServiceGroup("partial");
 				auto pWriters = pServiceGroup->pushService(net::CreatePacketWriters, locator.keyPair(), connectionSettings);
 
@@ -89,12 +95,15 @@ namespace catapult { namespace partialtransaction {
 
 				// add tasks
 				state.tasks().push_back(CreateConnectPeersTask(state, *pWriters));
-				state.tasks().push_back(CreatePullPtTask(locator, state, *pWriters));
+				state.tasks().push_back(CreatePullPtTask(locator, state, *pWriters, m_config.ReconciliationMaxDifference));
 			}
+
+		private:
+			PtConfiguration m_config;
 		};
 	}
 
-	DECLARE_SERVICE_REGISTRAR(Pt)() {
-		return std::make_unique<PtServiceRegistrar>();
+	DECLARE_SERVICE_REGISTRAR(Pt)(const PtConfiguration& config) {
+		return std::make_unique<PtServiceRegistrar>(config);
 	}
 }}
@@ -19,11 +19,12 @@
 **/
 
 #pragma once
+#include "PtConfiguration.h"
 #include "catapult/extensions/ServiceRegistrar.h"
 
 namespace catapult { namespace partialtransaction {
 
-	/// Creates a registrar for a partial transactions service.
+	/// Creates a registrar for a partial transactions service around \a config.
 	/// \note This service is responsible for sending partial transactions between api nodes.
-	DECLARE_SERVICE_REGISTRAR(Pt)();
+	DECLARE_SERVICE_REGISTRAR(Pt)(const PtConfiguration& config);
 }}
@@ -53,6 +53,12 @@ namespace catapult { namespace partialtransaction {
 					return ptCache.view().unknownTransactions(shortHashPairs);
 				});
 
+				handlers::RegisterPullPartialTransactionInfosReconciliationHandler(
+						state.packetHandlers(),
+						[&ptCache](const auto& shortHashesIblt, auto& transactionInfos) {
+							return ptCache.view().tryGetUnknownTransactions(shortHashesIblt, transactionInfos);
+						});
+
 				handlers::RegisterPushCosignaturesHandler(state.packetHandlers(), hooks.cosignatureRangeConsumer());
 			}
 		};
@@ -21,6 +21,7 @@
 #pragma once
 #include "catapult/cache/ShortHashPair.h"
 #include "catapult/model/CosignedTransactionInfo.h"
+#include "catapult/utils/ShortHashIblt.h"
 #include "catapult/functions.h"
 #include <vector>
 
@@ -32,9 +33,18 @@ namespace catapult { namespace partialtransaction {
 	/// Prototype for a function that retrieves partial transaction infos given a set of short hash pairs.
 	using CosignedTransactionInfosRetriever = std::function<CosignedTransactionInfos (const cache::ShortHashPairMap&)>;
 
+	/// Prototype for a function that retrieves partial transaction infos that are unknown to a peer
+	/// given a table of the peer's transaction and cosignature short hashes.
+	/// \note The function returns \c false if the short hashes set difference could not be decoded.
+	using CosignedTransactionInfosReconciliationRetriever = std::function<bool (const utils::ShortHashIblt&, CosignedTransactionInfos&)>;
+
 	/// Function signature for consuming a vector of cosigned transaction infos.
 	using CosignedTransactionInfosConsumer = consumer<CosignedTransactionInfos&&>;
 
 	/// Function signature for supplying a range of short hash pairs.
 	using ShortHashPairsSupplier = supplier<cache::ShortHashPairRange>;
+
+	/// Prototype for a function that retrieves a table with the specified number of cells composed of
+	/// the short hashes of all partial transactions and cosignatures.
+	using ShortHashesIbltRetriever = std::function<utils::ShortHashIblt (size_t)>;
 }}
@@ -82,8 +82,12 @@ namespace catapult { namespace api {
 	}
 
 	CosignedTransactionInfos ExtractCosignedTransactionInfosFromPacket(const ionet::Packet& packet, const TransactionPredicate& isValid) {
-		CosignedTransactionInfos transactionInfos;
 		auto reader = ionet::PacketReader(packet);
+		return ExtractCosignedTransactionInfos(reader, isValid);
+	}
+
+	CosignedTransactionInfos ExtractCosignedTransactionInfos(ionet::PacketReader& reader, const TransactionPredicate& isValid) {
+		CosignedTransactionInfos transactionInfos;
 		while (!reader.empty()) {
 			model::CosignedTransactionInfo transactionInfo;
 			if (!ReadCosignedTransactionInfo(reader, isValid, transactionInfo))
@@ -23,7 +23,12 @@
 #include "catapult/functions.h"
 #include <vector>
 
-namespace catapult { namespace ionet { struct Packet; } }
+namespace catapult {
+	namespace ionet {
+		class PacketReader;
+		struct Packet;
+	}
+}
 
 namespace catapult { namespace api {
 
@@ -32,4 +37,10 @@ namespace catapult { namespace api {
 	std::vector<model::CosignedTransactionInfo> ExtractCosignedTransactionInfosFromPacket(
 			const ionet::Packet& packet,
 			const predicate<const model::Transaction&>& isValid);
+
+	/// Extracts cosigned transaction infos from all remaining data in \a reader with a validity check (\a isValid).
+	/// \note If the data is invalid and/or contains partial infos, the returned vector will be empty.
+	std::vector<model::CosignedTransactionInfo> ExtractCosignedTransactionInfos(
+			ionet::PacketReader& reader,
+			const predicate<const model::Transaction&>& isValid);
 }}
@@ -23,6 +23,8 @@
 #include "catapult/api/RemoteApiUtils.h"
 #include "catapult/api/RemoteRequestDispatcher.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/ionet/PacketReader.h"
+#include "catapult/ionet/TransactionPackets.h"
 
 namespace catapult { namespace api {
 
@@ -48,6 +50,38 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct TransactionInfosReconciliationTraits : public RegistryDependentTraits<model::Transaction> {
+		public:
+			using ResultType = PartialTransactionInfosReconciliationResult;
+			static constexpr auto PacketType() { return ionet::PacketType::Pull_Partial_Transaction_Infos_Reconciliation; }
+			static constexpr auto FriendlyName() { return "reconcile partial transaction infos"; }
+
+			static auto CreateRequestPacketPayload(model::ShortHashIbltCellRange&& knownShortHashesIbltCells) {
+				return ionet::PacketPayloadFactory::FromFixedSizeRange(PacketType(), std::move(knownShortHashesIbltCells));
+			}
+
+		public:
+			using RegistryDependentTraits::RegistryDependentTraits;
+
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				auto reader = ionet::PacketReader(packet);
+				const auto* pHeader = reader.readFixed<ionet::PullTransactionsReconciliationResponseHeader>();
+				if (!pHeader)
+					return false;
+
+				result.IsDecoded = 0 != pHeader->IsDecoded;
+				if (reader.empty())
+					return true;
+
+				// transaction infos are only expected when the set difference was decoded
+				if (!result.IsDecoded)
+					return false;
+
+				result.TransactionInfos = ExtractCosignedTransactionInfos(reader, *this);
+				return !result.TransactionInfos.empty();
+			}
+		};
+
 		// endregion
 
 		class DefaultRemotePtApi : public RemotePtApi {
@@ -66,6 +100,11 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(TransactionInfosTraits(m_registry), std::move(knownShortHashPairs));
 			}
 
+			FutureType<TransactionInfosReconciliationTraits> reconcileTransactionInfos(
+					model::ShortHashIbltCellRange&& knownShortHashesIbltCells) const override {
+				return m_impl.dispatch(TransactionInfosReconciliationTraits(m_registry), std::move(knownShortHashesIbltCells));
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
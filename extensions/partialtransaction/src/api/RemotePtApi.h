@@ -21,12 +21,22 @@
 #pragma once
 #include "partialtransaction/src/PtTypes.h"
 #include "catapult/cache/ShortHashPair.h"
+#include "catapult/model/RangeTypes.h"
 #include "catapult/thread/Future.h"
 
 namespace catapult { namespace ionet { class PacketIo; } }
 
 namespace catapult { namespace api {
 
+	/// Result of reconciling partial transaction infos with a remote node.
+	struct PartialTransactionInfosReconciliationResult {
+		/// \c true if the remote node was able to decode the short hashes set difference.
+		bool IsDecoded;
+
+		/// Partial transaction infos containing transactions and/or cosignatures that are unknown to the local node.
+		partialtransaction::CosignedTransactionInfos TransactionInfos;
+	};
+
 	/// An api for retrieving partial transaction information from a remote node.
 	class RemotePtApi {
 	public:
@@ -36,6 +46,11 @@ namespace catapult { namespace api {
 		/// Gets all partial transaction infos from the remote excluding those with all hashes in \a knownShortHashPairs.
 		virtual thread::future<partialtransaction::CosignedTransactionInfos> transactionInfos(
 				cache::ShortHashPairRange&& knownShortHashPairs) const = 0;
+
+		/// Gets all partial transaction infos from the remote excluding transactions and cosignatures with short hashes
+		/// in the set encoded by the invertible bloom lookup table composed of \a knownShortHashesIbltCells.
+		virtual thread::future<PartialTransactionInfosReconciliationResult> reconcileTransactionInfos(
+				model::ShortHashIbltCellRange&& knownShortHashesIbltCells) const = 0;
 	};
 
 	/// Creates a partial transaction api for interacting with a remote node with the specified \a io
@@ -33,22 +33,56 @@ namespace catapult { namespace chain {
 		public:
 			explicit PtTraits(
 					const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
+					const partialtransaction::ShortHashesIbltRetriever& shortHashesIbltRetriever,
+					uint32_t maxReconciliationDifference,
 					const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer)
 					: m_shortHashPairsSupplier(shortHashPairsSupplier)
+					, m_shortHashesIbltRetriever(shortHashesIbltRetriever)
+					, m_numReconciliationCells(0 == maxReconciliationDifference
+							? 0
+							: utils::ShortHashIblt::CalculateNumCells(maxReconciliationDifference))
 					, m_transactionInfosConsumer(transactionInfosConsumer)
 			{}
 
 		public:
 			thread::future<partialtransaction::CosignedTransactionInfos> apiCall(const RemoteApiType& api) const {
-				return api.transactionInfos(m_shortHashPairsSupplier());
+				auto shortHashPairs = m_shortHashPairsSupplier();
+				if (!shouldReconcile(shortHashPairs.size()))
+					return api.transactionInfos(std::move(shortHashPairs));
+
+				auto shortHashesIblt = m_shortHashesIbltRetriever(m_numReconciliationCells);
+				const auto& cells = shortHashesIblt.cells();
+				auto shortHashesIbltCells = model::ShortHashIbltCellRange::CopyFixed(
+						reinterpret_cast<const uint8_t*>(cells.data()),
+						cells.size());
+				auto pShortHashPairs = std::make_shared<cache::ShortHashPairRange>(std::move(shortHashPairs));
+				return thread::compose(
+						api.reconcileTransactionInfos(std::move(shortHashesIbltCells)),
+						[&api, pShortHashPairs](auto&& reconciliationFuture) {
+							auto result = reconciliationFuture.get();
+							if (result.IsDecoded)
+								return thread::make_ready_future(std::move(result.TransactionInfos));
+
+							CATAPULT_LOG(debug) << "falling back to pulling partial transaction infos with all short hash pairs";
+							return api.transactionInfos(std::move(*pShortHashPairs));
+						});
 			}
 
 			void consume(partialtransaction::CosignedTransactionInfos&& transactionInfos) const {
 				m_transactionInfosConsumer(std::move(transactionInfos));
 			}
 
+		private:
+			bool shouldReconcile(size_t numShortHashPairs) const {
+				// only reconcile when the table is smaller than the short hash pairs it replaces
+				return 0 != m_numReconciliationCells
+						&& m_numReconciliationCells * sizeof(utils::ShortHashIbltCell) < numShortHashPairs * sizeof(cache::ShortHashPair);
+			}
+
 		private:
 			partialtransaction::ShortHashPairsSupplier m_shortHashPairsSupplier;
+			partialtransaction::ShortHashesIbltRetriever m_shortHashesIbltRetriever;
+			size_t m_numReconciliationCells;
 			partialtransaction::CosignedTransactionInfosConsumer m_transactionInfosConsumer;
 		};
 	}
@@ -56,7 +90,15 @@ namespace catapult { namespace chain {
 	RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSynchronizer(
 			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
 			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer) {
-		auto traits = PtTraits(shortHashPairsSupplier, transactionInfosConsumer);
+		return CreatePtSynchronizer(shortHashPairsSupplier, partialtransaction::ShortHashesIbltRetriever(), 0, transactionInfosConsumer);
+	}
+
+	RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSynchronizer(
+			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
+			const partialtransaction::ShortHashesIbltRetriever& shortHashesIbltRetriever,
+			uint32_t maxReconciliationDifference,
+			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer) {
+		auto traits = PtTraits(shortHashPairsSupplier, shortHashesIbltRetriever, maxReconciliationDifference, transactionInfosConsumer);
 		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<PtTraits>>(std::move(traits));
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
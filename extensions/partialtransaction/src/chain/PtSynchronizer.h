@@ -32,4 +32,14 @@ namespace catapult { namespace chain {
 	RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSynchronizer(
 			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
 			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer);
+
+	/// Creates a partial transactions synchronizer around the specified short hash pairs supplier (\a shortHashPairsSupplier),
+	/// short hashes table retriever (\a shortHashesIbltRetriever), maximum number of short hashes that can be
+	/// reconciled (\a maxReconciliationDifference) and partial transaction infos consumer (\a transactionInfosConsumer).
+	/// \note Reconciliation is disabled when \a maxReconciliationDifference is zero.
+	RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSynchronizer(
+			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
+			const partialtransaction::ShortHashesIbltRetriever& shortHashesIbltRetriever,
+			uint32_t maxReconciliationDifference,
+			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer);
 }}
@@ -168,8 +168,12 @@ namespace catapult { namespace chain {
 			updateContext.Cosignatures = std::move(cosignatures);
 			updateContext.pExtractedAddresses = transactionInfo.OptionalExtractedAddresses;
 			m_pPool->service().post([pThis = shared_from_this(), updateContext, pPromise]() {
-				pThis->updateImpl(updateContext).then([pPromise](auto&& resultFuture) {
-					pPromise->set_value(resultFuture.get());
+				pThis->updateImpl(updateContext).on_complete([pPromise](auto&& resultFuture) {
+					try {
+						pPromise->set_value(resultFuture.get());
+					} catch (...) {
+						pPromise->set_exception(std::current_exception());
+					}
 				});
 			});
 
@@ -69,10 +69,10 @@ namespace catapult { namespace chain {
 				// 1. missing cosigners failures are ignored
 				// 2. custom stateful validators are ignored
 				auto weakEntityInfo = transactionInfo.cast<model::VerifiableEntity>();
-				auto result = m_transactionValidator.validate(weakEntityInfo);
+				auto result = m_transactionValidator.validate(weakEntityInfo, validators::CancellationToken());
 				if (IsValidationResultSuccess(result)) {
 					// - check custom stateless validators
-					result = m_statelessTransactionValidator.validate(weakEntityInfo);
+					result = m_statelessTransactionValidator.validate(weakEntityInfo, validators::CancellationToken());
 					if (IsValidationResultSuccess(result))
 						return { result, true };
 				}
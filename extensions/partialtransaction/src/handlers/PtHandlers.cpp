@@ -23,6 +23,7 @@
 #include "catapult/handlers/HandlerUtils.h"
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadBuilder.h"
+#include "catapult/ionet/TransactionPackets.h"
 #include "catapult/model/RangeTypes.h"
 
 using namespace catapult::partialtransaction;
@@ -104,6 +105,35 @@ namespace catapult { namespace handlers {
 				context.response(BuildPacket(transactionInfos));
 			};
 		}
+
+		auto CreatePullTransactionsReconciliationHandler(
+				const CosignedTransactionInfosReconciliationRetriever& transactionInfosReconciliationRetriever) {
+			return [transactionInfosReconciliationRetriever](const auto& packet, auto& context) {
+				if (ionet::PacketType::Pull_Partial_Transaction_Infos_Reconciliation != packet.Type)
+					return;
+
+				auto range = ionet::ExtractFixedSizeStructuresFromPacket<utils::ShortHashIbltCell>(packet);
+				if (!utils::ShortHashIblt::IsValidNumCells(range.size()))
+					return;
+
+				utils::ShortHashIblt shortHashesIblt(std::vector<utils::ShortHashIbltCell>(range.cbegin(), range.cend()));
+
+				CosignedTransactionInfos transactionInfos;
+				auto isDecoded = transactionInfosReconciliationRetriever(shortHashesIblt, transactionInfos);
+
+				ionet::PullTransactionsReconciliationResponseHeader header;
+				header.IsDecoded = isDecoded ? 1 : 0;
+
+				ionet::PacketPayloadBuilder builder(ionet::PacketType::Pull_Partial_Transaction_Infos_Reconciliation);
+				builder.appendValue(header);
+				if (isDecoded) {
+					for (const auto& transactionInfo : transactionInfos)
+						AppendTransactionInfo(builder, transactionInfo);
+				}
+
+				context.response(builder.build());
+			};
+		}
 	}
 
 	void RegisterPushPartialTransactionsHandler(
@@ -124,4 +154,12 @@ namespace catapult { namespace handlers {
 				ionet::PacketType::Pull_Partial_Transaction_Infos,
 				CreatePullTransactionsHandler(transactionInfosRetriever));
 	}
+
+	void RegisterPullPartialTransactionInfosReconciliationHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const CosignedTransactionInfosReconciliationRetriever& transactionInfosReconciliationRetriever) {
+		handlers.registerHandler(
+				ionet::PacketType::Pull_Partial_Transaction_Infos_Reconciliation,
+				CreatePullTransactionsReconciliationHandler(transactionInfosReconciliationRetriever));
+	}
 }}
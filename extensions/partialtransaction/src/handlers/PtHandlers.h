@@ -37,4 +37,10 @@ namespace catapult { namespace handlers {
 	void RegisterPullPartialTransactionInfosHandler(
 			ionet::ServerPacketHandlers& handlers,
 			const partialtransaction::CosignedTransactionInfosRetriever& transactionInfosRetriever);
+
+	/// Registers a pull partial transactions reconciliation handler in \a handlers that responds with partial transactions
+	/// returned by the retriever (\a transactionInfosReconciliationRetriever).
+	void RegisterPullPartialTransactionInfosReconciliationHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const partialtransaction::CosignedTransactionInfosReconciliationRetriever& transactionInfosReconciliationRetriever);
 }}
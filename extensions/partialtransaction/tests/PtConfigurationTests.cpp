@@ -37,6 +37,7 @@ namespace catapult { namespace partialtransaction {
 						{
 							{ "cacheMaxResponseSize", "234KB" },
 							{ "cacheMaxSize", "98'763" },
+							{ "reconciliationMaxDifference", "321" },
 						}
 					}
 				};
@@ -50,12 +51,14 @@ namespace catapult { namespace partialtransaction {
 				// Assert:
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheMaxResponseSize);
 				EXPECT_EQ(0u, config.CacheMaxSize);
+				EXPECT_EQ(0u, config.ReconciliationMaxDifference);
 			}
 
 			static void AssertCustom(const PtConfiguration& config) {
 				// Assert:
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.CacheMaxResponseSize);
 				EXPECT_EQ(98'763u, config.CacheMaxSize);
+				EXPECT_EQ(321u, config.ReconciliationMaxDifference);
 			}
 		};
 	}
@@ -76,6 +79,7 @@ namespace catapult { namespace partialtransaction {
 		// Assert:
 		EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.CacheMaxResponseSize);
 		EXPECT_EQ(1'000'000u, config.CacheMaxSize);
+		EXPECT_EQ(0u, config.ReconciliationMaxDifference);
 	}
 
 	// endregion
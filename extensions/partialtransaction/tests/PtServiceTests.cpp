@@ -37,13 +37,14 @@ namespace catapult { namespace partialtransaction {
 		struct PtServiceTraits {
 			static constexpr auto Counter_Name = "PT WRITERS";
 			static constexpr auto Num_Expected_Services = 3; // writers (1) + dependent services (2)
+			static constexpr auto Num_Expected_Counters = 1;
 
 			static auto GetWriters(const extensions::ServiceLocator& locator) {
 				return locator.service<net::PacketWriters>("api.partial");
 			}
 
 			static auto CreateRegistrar() {
-				return CreatePtServiceRegistrar();
+				return CreatePtServiceRegistrar(PtConfiguration::Uninitialized());
 			}
 		};
 
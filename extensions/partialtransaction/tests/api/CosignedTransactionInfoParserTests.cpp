@@ -20,6 +20,7 @@
 
 #include "partialtransaction/src/api/CosignedTransactionInfoParser.h"
 #include "catapult/ionet/PacketPayloadBuilder.h"
+#include "catapult/ionet/PacketReader.h"
 #include "tests/test/core/PacketTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/TestHarness.h"
@@ -211,6 +212,29 @@ namespace catapult { namespace api {
 		generator4.assertInfo(extractedInfos[3]);
 	}
 
+	TEST(TEST_CLASS, CanExtractEntriesFollowingOtherDataFromReader) {
+		// Arrange: prepend a value to the infos and consume it
+		auto generator1 = TransactionGenerator(2);
+		auto generator2 = HashGenerator(3);
+
+		ionet::PacketPayloadBuilder builder(Default_Packet_Type);
+		builder.appendValue<uint64_t>(0x0123'4567'89AB'CDEF);
+		generator1.addData(builder);
+		generator2.addData(builder);
+		auto pPacket = BuildPacket(builder);
+
+		auto reader = ionet::PacketReader(*pPacket);
+		reader.readFixed<uint64_t>();
+
+		// Act:
+		auto extractedInfos = ExtractCosignedTransactionInfos(reader, [](const auto&) { return true; });
+
+		// Assert:
+		ASSERT_EQ(2u, extractedInfos.size());
+		generator1.assertInfo(extractedInfos[0]);
+		generator2.assertInfo(extractedInfos[1]);
+	}
+
 	// endregion
 
 	// region insufficient / invalid data (notice that all cause failure of *second* entry)
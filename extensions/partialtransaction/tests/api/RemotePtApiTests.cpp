@@ -19,6 +19,7 @@
 **/
 
 #include "partialtransaction/src/api/RemotePtApi.h"
+#include "catapult/ionet/TransactionPackets.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/other/RemoteApiFactory.h"
 #include "tests/test/other/RemoteApiTestUtils.h"
@@ -119,6 +120,88 @@ namespace catapult { namespace api {
 			}
 		};
 
+		constexpr auto Response_Header_Size = sizeof(ionet::PullTransactionsReconciliationResponseHeader);
+
+		struct TransactionInfosReconciliationTraits {
+			static constexpr uint32_t Num_Cells = 6;
+			static constexpr uint32_t Request_Data_Size = Num_Cells * sizeof(utils::ShortHashIbltCell);
+
+			static std::vector<utils::ShortHashIbltCell> KnownCells() {
+				std::vector<utils::ShortHashIbltCell> cells(Num_Cells);
+				for (auto i = 0u; i < Num_Cells; ++i) {
+					cells[i].Count = static_cast<int32_t>(i);
+					cells[i].KeySum = utils::ShortHash(100 + i);
+					cells[i].CheckSum = 200 + i;
+				}
+
+				return cells;
+			}
+
+			static model::ShortHashIbltCellRange KnownShortHashesIbltCells() {
+				return model::ShortHashIbltCellRange::CopyFixed(reinterpret_cast<const uint8_t*>(KnownCells().data()), Num_Cells);
+			}
+
+			static auto Invoke(const RemotePtApi& api) {
+				return api.reconcileTransactionInfos(KnownShortHashesIbltCells());
+			}
+
+			static auto CreateResponsePacket(uint8_t isDecoded, uint16_t numTransactions) {
+				// prepend a response header to a transaction infos packet
+				auto pTransactionInfosPacket = CreatePacketWithTransactionInfos(numTransactions);
+				auto transactionInfosSize = pTransactionInfosPacket->Size - sizeof(ionet::PacketHeader);
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(Response_Header_Size + transactionInfosSize);
+				pResponsePacket->Type = ionet::PacketType::Pull_Partial_Transaction_Infos_Reconciliation;
+				pResponsePacket->Data()[0] = isDecoded;
+				std::memcpy(pResponsePacket->Data() + Response_Header_Size, pTransactionInfosPacket->Data(), transactionInfosSize);
+				return pResponsePacket;
+			}
+
+			static auto CreateValidResponsePacket() {
+				return CreateResponsePacket(1, 3);
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it has an incorrect tag specifying no transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				reinterpret_cast<uint16_t&>(*(pResponsePacket->Data() + Response_Header_Size)) = 0x0000;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Pull_Partial_Transaction_Infos_Reconciliation, packet.Type);
+				EXPECT_EQ(sizeof(ionet::Packet) + Request_Data_Size, packet.Size);
+				EXPECT_TRUE(0 == std::memcmp(packet.Data(), KnownCells().data(), Request_Data_Size));
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const PartialTransactionInfosReconciliationResult& result) {
+				EXPECT_TRUE(result.IsDecoded);
+				ASSERT_EQ(3u, result.TransactionInfos.size());
+
+				auto pExpectedData = response.Data() + Response_Header_Size;
+				auto parsedIter = result.TransactionInfos.cbegin();
+				for (auto i = 0u; i < result.TransactionInfos.size(); ++i) {
+					std::string message = "comparing info at " + std::to_string(i);
+
+					// - skip tag
+					pExpectedData += sizeof(uint16_t);
+
+					// - transaction
+					const auto& expectedTransaction = reinterpret_cast<const TransactionType&>(*pExpectedData);
+					const auto& actualTransaction = *parsedIter->pTransaction;
+					ASSERT_EQ(expectedTransaction.Size, actualTransaction.Size) << message;
+					EXPECT_EQ(Timestamp(5 * i), actualTransaction.Deadline) << message;
+					EXPECT_EQ(expectedTransaction, actualTransaction) << message;
+					pExpectedData += expectedTransaction.Size;
+
+					// - hash and cosignatures
+					EXPECT_EQ(Hash256(), parsedIter->EntityHash);
+					EXPECT_TRUE(parsedIter->Cosignatures.empty());
+
+					++parsedIter;
+				}
+			}
+		};
+
 		struct RemotePtApiTraits {
 			static auto Create(const std::shared_ptr<ionet::PacketIo>& pPacketIo) {
 				return test::CreateLifetimeExtendedApi(CreateRemotePtApi, *pPacketIo, mocks::CreateDefaultTransactionRegistry());
@@ -127,4 +210,54 @@ namespace catapult { namespace api {
 	}
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemotePtApi, TransactionInfos)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemotePtApi, TransactionInfosReconciliation)
+
+	namespace {
+		template<typename TAction>
+		void RunReconciliationResponseTest(const std::shared_ptr<ionet::Packet>& pResponsePacket, TAction action) {
+			// Arrange:
+			auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+			pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+			pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pResponsePacket](const auto*) { return pResponsePacket; });
+			auto pApi = RemotePtApiTraits::Create(pPacketIo);
+
+			// Act:
+			auto resultFuture = TransactionInfosReconciliationTraits::Invoke(*pApi);
+
+			// Assert:
+			action(resultFuture);
+			EXPECT_EQ(1u, pPacketIo->numWrites());
+			EXPECT_EQ(1u, pPacketIo->numReads());
+		}
+	}
+
+	TEST(RemotePtApiTests, ReconcileTransactionInfosAcceptsDecodedResponseWithoutTransactionInfos) {
+		// Arrange:
+		RunReconciliationResponseTest(TransactionInfosReconciliationTraits::CreateResponsePacket(1, 0), [](auto& resultFuture) {
+			auto result = resultFuture.get();
+
+			// Assert:
+			EXPECT_TRUE(result.IsDecoded);
+			EXPECT_TRUE(result.TransactionInfos.empty());
+		});
+	}
+
+	TEST(RemotePtApiTests, ReconcileTransactionInfosAcceptsUndecodedResponseWithoutTransactionInfos) {
+		// Arrange:
+		RunReconciliationResponseTest(TransactionInfosReconciliationTraits::CreateResponsePacket(0, 0), [](auto& resultFuture) {
+			auto result = resultFuture.get();
+
+			// Assert:
+			EXPECT_FALSE(result.IsDecoded);
+			EXPECT_TRUE(result.TransactionInfos.empty());
+		});
+	}
+
+	TEST(RemotePtApiTests, ReconcileTransactionInfosRejectsUndecodedResponseWithTransactionInfos) {
+		// Arrange:
+		RunReconciliationResponseTest(TransactionInfosReconciliationTraits::CreateResponsePacket(0, 3), [](auto& resultFuture) {
+			// Assert:
+			EXPECT_THROW(resultFuture.get(), catapult_api_error);
+		});
+	}
 }}
@@ -25,6 +25,8 @@
 
 namespace catapult { namespace chain {
 
+#define TEST_CLASS PtSynchronizerTests
+
 	namespace {
 		using MockRemoteApi = mocks::MockPtApi;
 
@@ -102,4 +104,142 @@ namespace catapult { namespace chain {
 	}
 
 	DEFINE_ENTITIES_SYNCHRONIZER_TESTS(PtSynchronizer)
+
+	// region reconciliation
+
+	namespace {
+		// 51 cells * 12 bytes/cell is smaller than 500 short hash pairs * 8 bytes/short hash pair but larger than 50 short hash pairs
+		constexpr uint32_t Max_Reconciliation_Difference = 10;
+		constexpr size_t Num_Reconciliation_Cells = 51;
+
+		utils::ShortHashIblt CreateShortHashesIblt(size_t numCells) {
+			utils::ShortHashIblt shortHashesIblt(numCells);
+			for (auto i = 0u; i < 20; ++i)
+				shortHashesIblt.insert(utils::ShortHash(i * i + 1));
+
+			return shortHashesIblt;
+		}
+
+		struct ReconciliationTestContext {
+		public:
+			ReconciliationTestContext(uint32_t numShortHashPairs, uint32_t maxReconciliationDifference)
+					: ShortHashPairs(PtSynchronizerTraits::CreateRequestRange(numShortHashPairs))
+					, TransactionInfos(PtSynchronizerTraits::CreateResponseContainer(3))
+					, RemoteApi(TransactionInfos)
+					, NumConsumerCalls(0) {
+				Synchronizer = CreatePtSynchronizer(
+						[&shortHashPairs = ShortHashPairs]() { return cache::ShortHashPairRange::CopyRange(shortHashPairs); },
+						[&retrieverNumCells = RetrieverNumCells](auto numCells) {
+							retrieverNumCells.push_back(numCells);
+							return CreateShortHashesIblt(numCells);
+						},
+						maxReconciliationDifference,
+						[&numConsumerCalls = NumConsumerCalls, &consumedTransactionInfos = ConsumedTransactionInfos](auto&& infos) {
+							++numConsumerCalls;
+							consumedTransactionInfos = std::move(infos);
+						});
+			}
+
+		public:
+			cache::ShortHashPairRange ShortHashPairs;
+			partialtransaction::CosignedTransactionInfos TransactionInfos;
+			mocks::MockPtApi RemoteApi;
+			RemoteNodeSynchronizer<api::RemotePtApi> Synchronizer;
+
+			std::vector<size_t> RetrieverNumCells;
+			size_t NumConsumerCalls;
+			partialtransaction::CosignedTransactionInfos ConsumedTransactionInfos;
+		};
+
+		void AssertShortHashesIbltCells(const model::ShortHashIbltCellRange& cells) {
+			auto expectedShortHashesIblt = CreateShortHashesIblt(Num_Reconciliation_Cells);
+			const auto& expectedCells = expectedShortHashesIblt.cells();
+			ASSERT_EQ(expectedCells.size(), cells.size());
+			EXPECT_TRUE(0 == std::memcmp(expectedCells.data(), cells.data(), expectedCells.size() * sizeof(utils::ShortHashIbltCell)));
+		}
+	}
+
+	TEST(TEST_CLASS, SynchronizerReconcilesShortHashesWhenTableIsSmallerThanShortHashPairs) {
+		// Arrange:
+		ReconciliationTestContext context(500, Max_Reconciliation_Difference);
+
+		// Act:
+		auto result = context.Synchronizer(context.RemoteApi).get();
+
+		// Assert: only a reconciliation request was made
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(std::vector<size_t>{ Num_Reconciliation_Cells }, context.RetrieverNumCells);
+		ASSERT_EQ(1u, context.RemoteApi.transactionInfosReconciliationRequests().size());
+		EXPECT_EQ(0u, context.RemoteApi.transactionInfosRequests().size());
+		AssertShortHashesIbltCells(context.RemoteApi.transactionInfosReconciliationRequests()[0]);
+
+		EXPECT_EQ(1u, context.NumConsumerCalls);
+		PtSynchronizerTraits::AssertCustomResponse(context.TransactionInfos, context.ConsumedTransactionInfos);
+	}
+
+	TEST(TEST_CLASS, SynchronizerFallsBackToShortHashPairsWhenReconciliationCannotBeDecoded) {
+		// Arrange:
+		ReconciliationTestContext context(500, Max_Reconciliation_Difference);
+		context.RemoteApi.setReconciliationDecoded(false);
+
+		// Act:
+		auto result = context.Synchronizer(context.RemoteApi).get();
+
+		// Assert: a reconciliation request was followed by a request with all short hash pairs
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		ASSERT_EQ(1u, context.RemoteApi.transactionInfosReconciliationRequests().size());
+		ASSERT_EQ(1u, context.RemoteApi.transactionInfosRequests().size());
+		AssertShortHashesIbltCells(context.RemoteApi.transactionInfosReconciliationRequests()[0]);
+		test::AssertEqualRange(context.ShortHashPairs, context.RemoteApi.transactionInfosRequests()[0], "short hash pairs");
+
+		EXPECT_EQ(1u, context.NumConsumerCalls);
+		PtSynchronizerTraits::AssertCustomResponse(context.TransactionInfos, context.ConsumedTransactionInfos);
+	}
+
+	TEST(TEST_CLASS, SynchronizerDoesNotFallBackToShortHashPairsWhenReconciliationFails) {
+		// Arrange:
+		ReconciliationTestContext context(500, Max_Reconciliation_Difference);
+		context.RemoteApi.setError(mocks::MockPtApi::EntryPoint::Reconcile_Transaction_Infos);
+
+		// Act:
+		auto result = context.Synchronizer(context.RemoteApi).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_EQ(1u, context.RemoteApi.transactionInfosReconciliationRequests().size());
+		EXPECT_EQ(0u, context.RemoteApi.transactionInfosRequests().size());
+		EXPECT_EQ(0u, context.NumConsumerCalls);
+	}
+
+	namespace {
+		void AssertShortHashPairsAreNotReconciled(uint32_t numShortHashPairs, uint32_t maxReconciliationDifference) {
+			// Arrange:
+			ReconciliationTestContext context(numShortHashPairs, maxReconciliationDifference);
+
+			// Act:
+			auto result = context.Synchronizer(context.RemoteApi).get();
+
+			// Assert: only a request with all short hash pairs was made and the table was never retrieved
+			EXPECT_EQ(NodeInteractionResult::Success, result);
+			EXPECT_TRUE(context.RetrieverNumCells.empty());
+			EXPECT_EQ(0u, context.RemoteApi.transactionInfosReconciliationRequests().size());
+			ASSERT_EQ(1u, context.RemoteApi.transactionInfosRequests().size());
+			test::AssertEqualRange(context.ShortHashPairs, context.RemoteApi.transactionInfosRequests()[0], "short hash pairs");
+
+			EXPECT_EQ(1u, context.NumConsumerCalls);
+		}
+	}
+
+	TEST(TEST_CLASS, SynchronizerDoesNotReconcileShortHashesWhenTableIsNotSmallerThanShortHashPairs) {
+		// Assert: 76 short hash pairs * 8 bytes/short hash pair is less than 51 cells * 12 bytes/cell
+		AssertShortHashPairsAreNotReconciled(50, Max_Reconciliation_Difference);
+		AssertShortHashPairsAreNotReconciled(76, Max_Reconciliation_Difference);
+	}
+
+	TEST(TEST_CLASS, SynchronizerDoesNotReconcileShortHashesWhenReconciliationIsDisabled) {
+		// Assert:
+		AssertShortHashPairsAreNotReconciled(500, 0);
+	}
+
+	// endregion
 }}
@@ -20,6 +20,7 @@
 
 #include "partialtransaction/src/handlers/PtHandlers.h"
 #include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
+#include "catapult/ionet/TransactionPackets.h"
 #include "catapult/utils/Functional.h"
 #include "tests/test/core/PushHandlerTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
@@ -136,14 +137,14 @@ namespace catapult { namespace handlers {
 					});
 				}
 
-				void assertPayload(const ionet::PacketPayload& payload) {
+				void assertPayload(const ionet::PacketPayload& payload, size_t numLeadingBuffers = 0) {
 					// note: there are either 2 or 3 buffers for each info (tag, transaction OR hash, optional cosignatures)
 					auto expectedNumBuffers = utils::Sum(
 							m_transactionInfos,
 							[](const auto& transactionInfo) { return transactionInfo.Cosignatures.empty() ? 2u : 3u; });
-					ASSERT_EQ(expectedNumBuffers, payload.buffers().size());
+					ASSERT_EQ(numLeadingBuffers + expectedNumBuffers, payload.buffers().size());
 
-					auto i = 0u;
+					auto i = numLeadingBuffers;
 					for (auto infoIndex = 0u; infoIndex < m_transactionInfos.size(); ++infoIndex) {
 						const auto& transactionInfo = m_transactionInfos[infoIndex];
 						auto failedMessage = " for info " + std::to_string(infoIndex);
@@ -181,4 +182,118 @@ namespace catapult { namespace handlers {
 	DEFINE_PULL_HANDLER_TESTS(TEST_CLASS, PullTransactions)
 
 	// endregion
+
+	// region pull partial transaction reconciliation handler
+
+	namespace {
+		constexpr auto Reconciliation_Packet_Type = ionet::PacketType::Pull_Partial_Transaction_Infos_Reconciliation;
+		constexpr auto Reconciliation_Header_Size = sizeof(ionet::PullTransactionsReconciliationResponseHeader);
+
+		struct ReconciliationRetrieverParams {
+			size_t NumCalls = 0;
+			std::vector<utils::ShortHashIbltCell> Cells;
+		};
+
+		void RegisterReconciliationHandler(
+				ionet::ServerPacketHandlers& handlers,
+				ReconciliationRetrieverParams& params,
+				bool isDecoded,
+				const CosignedTransactionInfos& transactionInfos) {
+			RegisterPullPartialTransactionInfosReconciliationHandler(handlers, [&params, isDecoded, transactionInfos](
+					const auto& shortHashesIblt,
+					auto& unknownTransactionInfos) {
+				++params.NumCalls;
+				params.Cells = shortHashesIblt.cells();
+				unknownTransactionInfos = transactionInfos;
+				return isDecoded;
+			});
+		}
+
+		void AssertReconciliationPacketIsRejected(uint32_t payloadSize, ionet::PacketType type, bool expectedCanProcessPacketType = true) {
+			// Arrange:
+			ReconciliationRetrieverParams params;
+			ionet::ServerPacketHandlers handlers;
+			RegisterReconciliationHandler(handlers, params, true, {});
+
+			auto pPacket = test::CreateRandomPacket(payloadSize, type);
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_EQ(expectedCanProcessPacketType, handlers.process(*pPacket, context));
+
+			// Assert:
+			EXPECT_EQ(0u, params.NumCalls);
+			test::AssertNoResponse(context);
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsReconciliationHandler_PacketWithWrongTypeIsRejected) {
+		// Assert:
+		AssertReconciliationPacketIsRejected(3 * sizeof(utils::ShortHashIbltCell), ionet::PacketType::Chain_Info, false);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsReconciliationHandler_PacketWithInvalidNumberOfCellsIsRejected) {
+		// Assert: empty table, number of cells not divisible by number of hash functions and partial cell
+		constexpr auto Cell_Size = static_cast<uint32_t>(sizeof(utils::ShortHashIbltCell));
+		for (auto payloadSize : { 0u, 4 * Cell_Size, 3 * Cell_Size + Cell_Size / 2 })
+			AssertReconciliationPacketIsRejected(payloadSize, Reconciliation_Packet_Type);
+	}
+
+	namespace {
+		void AssertReconciliationResponse(bool isDecoded, size_t numTransactionInfos, bool shouldContainTransactionInfos) {
+			// Arrange:
+			PullTransactionsTraits::ResponseContext responseContext(numTransactionInfos);
+			ReconciliationRetrieverParams params;
+			ionet::ServerPacketHandlers handlers;
+			RegisterReconciliationHandler(handlers, params, isDecoded, responseContext.response());
+
+			auto pPacket = test::CreateRandomPacket(6 * sizeof(utils::ShortHashIbltCell), Reconciliation_Packet_Type);
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_TRUE(handlers.process(*pPacket, context));
+
+			// Assert: the table was passed to the retriever
+			EXPECT_EQ(1u, params.NumCalls);
+			ASSERT_EQ(6u, params.Cells.size());
+			EXPECT_TRUE(0 == std::memcmp(pPacket->Data(), params.Cells.data(), 6 * sizeof(utils::ShortHashIbltCell)));
+
+			// - the response starts with the header and is optionally followed by the transaction infos
+			ASSERT_TRUE(context.hasResponse());
+			auto expectedTransactionInfosSize = shouldContainTransactionInfos ? responseContext.responseSize() : 0;
+			auto expectedSize = sizeof(ionet::PacketHeader) + Reconciliation_Header_Size + expectedTransactionInfosSize;
+			test::AssertPacketHeader(context, expectedSize, Reconciliation_Packet_Type);
+
+			const auto& buffers = context.response().buffers();
+			ASSERT_LE(1u, buffers.size());
+			ASSERT_EQ(Reconciliation_Header_Size, buffers[0].Size);
+			const auto& header = reinterpret_cast<const ionet::PullTransactionsReconciliationResponseHeader&>(*buffers[0].pData);
+			EXPECT_EQ(isDecoded ? 1u : 0u, header.IsDecoded);
+
+			if (!shouldContainTransactionInfos) {
+				EXPECT_EQ(1u, buffers.size());
+				return;
+			}
+
+			// - the header is followed by transaction infos serialized as in pull partial transaction infos responses
+			responseContext.assertPayload(context.response(), 1);
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsReconciliationHandler_ResponseContainsUnknownTransactionInfosWhenDecoded) {
+		// Assert:
+		AssertReconciliationResponse(true, 5, true);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsReconciliationHandler_ResponseContainsOnlyHeaderWhenDecodedAndAllTransactionInfosAreKnown) {
+		// Assert:
+		AssertReconciliationResponse(true, 0, false);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsReconciliationHandler_ResponseContainsOnlyHeaderWhenNotDecoded) {
+		// Assert: any transaction infos returned by the retriever are dropped
+		AssertReconciliationResponse(false, 5, false);
+	}
+
+	// endregion
 }}
@@ -29,7 +29,8 @@ namespace catapult { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Partial_Transaction_Infos
+			Partial_Transaction_Infos,
+			Reconcile_Transaction_Infos
 		};
 
 	public:
@@ -37,6 +38,7 @@ namespace catapult { namespace mocks {
 		explicit MockPtApi(const partialtransaction::CosignedTransactionInfos& transactionInfos)
 				: m_transactionInfos(transactionInfos)
 				, m_errorEntryPoint(EntryPoint::None)
+				, m_isReconciliationDecoded(true)
 		{}
 
 	public:
@@ -45,11 +47,21 @@ namespace catapult { namespace mocks {
 			m_errorEntryPoint = entryPoint;
 		}
 
+		/// Sets the reconciliation decoding result to \a isDecoded.
+		void setReconciliationDecoded(bool isDecoded) {
+			m_isReconciliationDecoded = isDecoded;
+		}
+
 		/// Returns the vector of short hash pair ranges that were passed to the partial transaction infos requests.
 		const std::vector<cache::ShortHashPairRange>& transactionInfosRequests() const {
 			return m_transactionInfosRequests;
 		}
 
+		/// Returns the vector of iblt cell ranges that were passed to the reconcile partial transaction infos requests.
+		const std::vector<model::ShortHashIbltCellRange>& transactionInfosReconciliationRequests() const {
+			return m_transactionInfosReconciliationRequests;
+		}
+
 	public:
 		/// Returns the configured partial transaction infos and throws if the error entry point is set to Partial_Transaction_Infos.
 		/// \note The \a knownShortHashPairs parameter is captured.
@@ -64,6 +76,24 @@ namespace catapult { namespace mocks {
 			return thread::make_ready_future(decltype(m_transactionInfos)(m_transactionInfos));
 		}
 
+		/// Returns the configured partial transaction infos when reconciliation is decoded and throws if the error entry point
+		/// is set to Reconcile_Transaction_Infos.
+		/// \note The \a knownShortHashesIbltCells parameter is captured.
+		thread::future<api::PartialTransactionInfosReconciliationResult> reconcileTransactionInfos(
+				model::ShortHashIbltCellRange&& knownShortHashesIbltCells) const override {
+			using ResultType = api::PartialTransactionInfosReconciliationResult;
+			m_transactionInfosReconciliationRequests.push_back(std::move(knownShortHashesIbltCells));
+			if (shouldRaiseException(EntryPoint::Reconcile_Transaction_Infos))
+				return CreateFutureException<ResultType>("reconcile partial transaction infos error has been set");
+
+			ResultType result;
+			result.IsDecoded = m_isReconciliationDecoded;
+			if (m_isReconciliationDecoded)
+				result.TransactionInfos = m_transactionInfos;
+
+			return thread::make_ready_future(std::move(result));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -77,6 +107,8 @@ namespace catapult { namespace mocks {
 	private:
 		partialtransaction::CosignedTransactionInfos m_transactionInfos;
 		EntryPoint m_errorEntryPoint;
+		bool m_isReconciliationDecoded;
 		mutable std::vector<cache::ShortHashPairRange> m_transactionInfosRequests;
+		mutable std::vector<model::ShortHashIbltCellRange> m_transactionInfosReconciliationRequests;
 	};
 }}
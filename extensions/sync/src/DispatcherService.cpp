@@ -62,6 +62,7 @@ namespace catapult { namespace sync {
 			auto options = ConsumerDispatcherOptions("block dispatcher", config.BlockDisruptorSize);
 			options.ElementTraceInterval = config.BlockElementTraceInterval;
 			options.ShouldThrowIfFull = config.ShouldAbortWhenDispatcherIsFull;
+			options.CpuAffinity = config.BlockDispatcherCpuAffinity;
 			return options;
 		}
 
@@ -69,6 +70,7 @@ namespace catapult { namespace sync {
 			auto options = ConsumerDispatcherOptions("transaction dispatcher", config.TransactionDisruptorSize);
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowIfFull = config.ShouldAbortWhenDispatcherIsFull;
+			options.CpuAffinity = config.TransactionDispatcherCpuAffinity;
 			return options;
 		}
 
@@ -170,6 +172,10 @@ namespace catapult { namespace sync {
 					extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
 			}
 
+			void addPrecomputedTransactionNotificationConsumer(const model::NotificationPublisher& publisher) {
+				m_consumers.push_back(CreateBlockNotificationPublicationConsumer(publisher));
+			}
+
 			void addPrecomputedTransactionAddressConsumer(const model::NotificationPublisher& publisher) {
 				m_consumers.push_back(CreateBlockAddressExtractionConsumer(publisher));
 			}
@@ -248,6 +254,10 @@ namespace catapult { namespace sync {
 						m_state.hooks().knownHashPredicate(m_state.utCache())));
 			}
 
+			void addPrecomputedTransactionNotificationConsumer(const model::NotificationPublisher& publisher) {
+				m_consumers.push_back(CreateTransactionNotificationPublicationConsumer(publisher));
+			}
+
 			void addPrecomputedTransactionAddressConsumer(const model::NotificationPublisher& publisher) {
 				m_consumers.push_back(CreateTransactionAddressExtractionConsumer(publisher));
 			}
@@ -312,7 +322,10 @@ namespace catapult { namespace sync {
 					CreateExecutionConfiguration(state.pluginManager()),
 					state.timeSupplier(),
 					extensions::SubscriberToSink(state.transactionStatusSubscriber()),
-					CreateUtUpdaterThrottle(state.config()));
+					CreateUtUpdaterThrottle(state.config()),
+					state.config().Node.ShouldUpdateUnconfirmedTransactionsIncrementally
+							? chain::UtUpdater::ChainUpdateMode::Incremental
+							: chain::UtUpdater::ChainUpdateMode::Rebuild);
 			locator.registerRootedService("dispatcher.utUpdater", pUtUpdater);
 
 			auto& utUpdater = *pUtUpdater;
@@ -363,7 +376,10 @@ namespace catapult { namespace sync {
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				// create shared services
-				auto pValidatorPool = state.pool().pushIsolatedPool("validator");
+				auto pValidatorPool = state.pool().pushIsolatedPool(
+						"validator",
+						thread::MultiServicePool::DefaultPoolConcurrency(),
+						state.config().Node.ValidatorPoolCpuAffinity);
 				auto& utUpdater = CreateAndRegisterUtUpdater(locator, state);
 
 				// create the block and transaction dispatchers and related services
@@ -376,10 +392,19 @@ namespace catapult { namespace sync {
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
 				transactionDispatcherBuilder.addHashConsumers();
 
-				if (state.config().Node.ShouldPrecomputeTransactionAddresses) {
+				const auto& nodeConfig = state.config().Node;
+				if (nodeConfig.ShouldPrecomputeTransactionNotifications || nodeConfig.ShouldPrecomputeTransactionAddresses) {
 					auto pPublisher = state.pluginManager().createNotificationPublisher();
-					blockDispatcherBuilder.addPrecomputedTransactionAddressConsumer(*pPublisher);
-					transactionDispatcherBuilder.addPrecomputedTransactionAddressConsumer(*pPublisher);
+					if (nodeConfig.ShouldPrecomputeTransactionNotifications) {
+						blockDispatcherBuilder.addPrecomputedTransactionNotificationConsumer(*pPublisher);
+						transactionDispatcherBuilder.addPrecomputedTransactionNotificationConsumer(*pPublisher);
+					}
+
+					if (nodeConfig.ShouldPrecomputeTransactionAddresses) {
+						blockDispatcherBuilder.addPrecomputedTransactionAddressConsumer(*pPublisher);
+						transactionDispatcherBuilder.addPrecomputedTransactionAddressConsumer(*pPublisher);
+					}
+
 					locator.registerRootedService("dispatcher.notificationPublisher", std::move(pPublisher));
 				}
 
@@ -26,6 +26,7 @@
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/extensions/ServiceUtils.h"
 #include "catapult/ionet/BroadcastUtils.h"
+#include "catapult/plugins/PluginManager.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/thread/MultiServicePool.h"
 
@@ -61,6 +62,13 @@ namespace catapult { namespace sync {
 			};
 		}
 
+		BlockSink CreatePushCompactBlockSink(const extensions::ServiceLocator& locator, const model::TransactionRegistry& registry) {
+			return [&locator, &registry](const auto& pBlock) {
+				auto payload = ionet::CreateCompactBroadcastPayload(*pBlock, registry);
+				locator.service<net::PacketWriters>(Service_Name)->broadcast(payload);
+			};
+		}
+
 		class NetworkPacketWritersServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			extensions::ServiceRegistrarInfo info() const override {
@@ -71,10 +79,14 @@ namespace catapult { namespace sync {
 				locator.registerServiceCounter<net::PacketWriters>(Service_Name, "WRITERS", [](const auto& writers) {
 					return writers.numActiveWriters();
 				});
+				locator.registerServiceCounter<net::PacketWriters>(Service_Name, "BCAST SAVED", [](const auto& writers) {
+					return writers.numBroadcastBytesSaved();
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
-				auto connectionSettings = extensions::GetConnectionSettings(state.config());
+				auto connectionSettings = extensions::GetConnectionSettings(state.config(), state.socketWorkingBufferPool());
+				connectionSettings.BroadcastKnownInventories = state.peerKnownInventories();
 				auto pServiceGroup = state.pool().pushServiceGroup(Service_Name);
 				auto pWriters = pServiceGroup->pushService(net::CreatePacketWriters, locator.keyPair(), connectionSettings);
 
@@ -82,7 +94,11 @@ namespace catapult { namespace sync {
 				state.packetIoPickers().insert(*pWriters, ionet::NodeRoles::Peer);
 
 				// add sinks
-				state.hooks().addNewBlockSink(extensions::CreatePushEntitySink<BlockSink>(locator, Service_Name));
+				if (state.config().Node.ShouldPushCompactBlocks)
+					state.hooks().addNewBlockSink(CreatePushCompactBlockSink(locator, state.pluginManager().transactionRegistry()));
+				else
+					state.hooks().addNewBlockSink(extensions::CreatePushEntitySink<BlockSink>(locator, Service_Name));
+
 				state.hooks().addNewTransactionsSink(extensions::CreatePushEntitySink<TransactionsSink>(locator, Service_Name));
 				state.hooks().addPacketPayloadSink([&writers = *pWriters](const auto& payload) { writers.broadcast(payload); });
 
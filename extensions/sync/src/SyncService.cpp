@@ -53,6 +53,8 @@ namespace catapult { namespace sync {
 			chainSynchronizerConfig.MaxBlocksPerSyncAttempt = config.Node.MaxBlocksPerSyncAttempt;
 			chainSynchronizerConfig.MaxChainBytesPerSyncAttempt = config.Node.MaxChainBytesPerSyncAttempt.bytes32();
 			chainSynchronizerConfig.MaxRollbackBlocks = config.BlockChain.MaxRollbackBlocks;
+			chainSynchronizerConfig.ShouldSyncBlockHeadersFirst = config.Node.ShouldSyncBlockHeadersFirst;
+			chainSynchronizerConfig.ShouldSampleChainHashes = config.Node.ShouldSampleChainHashes;
 			return chainSynchronizerConfig;
 		}
 
@@ -73,13 +75,15 @@ namespace catapult { namespace sync {
 					api::CreateRemoteChainApi,
 					packetWriters,
 					state,
-					task.Name);
+					task.Name,
+					config.Node.MaxPeersPerSyncAttempt);
 			return task;
 		}
 
 		thread::Task CreatePullUtTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			auto utSynchronizer = chain::CreateUtSynchronizer(
 					[&cache = state.utCache()]() { return cache.view().shortHashes(); },
+					state.config().Node.UnconfirmedTransactionsReconciliationMaxDifference,
 					state.hooks().transactionRangeConsumerFactory()(Sync_Source));
 
 			thread::Task task;
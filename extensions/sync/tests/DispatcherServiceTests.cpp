@@ -317,6 +317,49 @@ namespace catapult { namespace sync {
 		EXPECT_TRUE(!!context.locator().service<model::NotificationPublisher>("dispatcher.notificationPublisher"));
 	}
 
+	TEST(TEST_CLASS, CanBootServiceWithNotificationPrecomputationEnabled) {
+		// Arrange:
+		TestContext context;
+		const auto& config = context.testState().config();
+		const_cast<bool&>(config.Node.ShouldPrecomputeTransactionNotifications) = true;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(Num_Expected_Services + 1, context.locator().numServices());
+		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
+		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
+
+		EXPECT_EQ(7u, GetBlockDispatcherStatus(context.locator()).Size);
+		EXPECT_EQ(5u, GetTransactionDispatcherStatus(context.locator()).Size);
+
+		// - notification publisher service should exist
+		EXPECT_TRUE(!!context.locator().service<model::NotificationPublisher>("dispatcher.notificationPublisher"));
+	}
+
+	TEST(TEST_CLASS, CanBootServiceWithAddressAndNotificationPrecomputationEnabled) {
+		// Arrange:
+		TestContext context;
+		const auto& config = context.testState().config();
+		const_cast<bool&>(config.Node.ShouldPrecomputeTransactionAddresses) = true;
+		const_cast<bool&>(config.Node.ShouldPrecomputeTransactionNotifications) = true;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(Num_Expected_Services + 1, context.locator().numServices());
+		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
+		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
+
+		EXPECT_EQ(8u, GetBlockDispatcherStatus(context.locator()).Size);
+		EXPECT_EQ(6u, GetTransactionDispatcherStatus(context.locator()).Size);
+
+		// - notification publisher service should exist
+		EXPECT_TRUE(!!context.locator().service<model::NotificationPublisher>("dispatcher.notificationPublisher"));
+	}
+
 	TEST(TEST_CLASS, CanShutdownService) {
 		// Arrange:
 		TestContext context;
@@ -19,7 +19,7 @@
 **/
 
 #include "sync/src/NetworkPacketWritersService.h"
-#include "catapult/api/ChainPackets.h"
+#include "catapult/ionet/ChainPackets.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/net/VerifyPeer.h"
 #include "tests/test/local/PacketWritersServiceTestUtils.h"
@@ -34,6 +34,7 @@ namespace catapult { namespace sync {
 		struct NetworkPacketWritersServiceTraits {
 			static constexpr auto Counter_Name = "WRITERS";
 			static constexpr auto Num_Expected_Services = 1;
+			static constexpr auto Num_Expected_Counters = 2;
 
 			static constexpr auto GetWriters = GetPacketWriters;
 			static constexpr auto CreateRegistrar = CreateNetworkPacketWritersServiceRegistrar;
@@ -174,7 +175,7 @@ namespace catapult { namespace sync {
 			// - write the heights to the server sockets
 			auto i = 1u;
 			for (const auto& pSocket : serverSockets) {
-				auto pPacket = ionet::CreateSharedPacket<api::ChainInfoResponse>();
+				auto pPacket = ionet::CreateSharedPacket<ionet::ChainInfoResponse>();
 				pPacket->Height = Height(i + (0 == i % 2 ? 100u : 0));
 				pSocket->write(ionet::PacketPayload(pPacket), [](auto) {});
 				++i;
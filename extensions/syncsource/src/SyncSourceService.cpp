@@ -19,14 +19,19 @@
 **/
 
 #include "SyncSourceService.h"
+#include "catapult/api/RemoteChainApi.h"
 #include "catapult/cache/MemoryUtCache.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/ServerHooksUtils.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/handlers/ChainHandlers.h"
+#include "catapult/handlers/MultiplexedHandlers.h"
 #include "catapult/handlers/TransactionHandlers.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/utils/HexFormatter.h"
+#include "catapult/utils/SpinLock.h"
 
 namespace catapult { namespace syncsource {
 
@@ -36,21 +41,93 @@ namespace catapult { namespace syncsource {
 			blocksHandlerConfig.MaxResponseBytes = nodeConfig.MaxChainBytesPerSyncAttempt.bytes32();
 		}
 
+		// tracks the hash of the most recently pulled compact block in order to avoid pulling it once per announcing peer
+		class LastPulledBlockHash {
+		public:
+			LastPulledBlockHash() : m_hash()
+			{}
+
+		public:
+			bool trySet(const Hash256& hash) {
+				utils::SpinLockGuard guard(m_lock);
+				if (m_hash == hash)
+					return false;
+
+				m_hash = hash;
+				return true;
+			}
+
+		private:
+			utils::SpinLock m_lock;
+			Hash256 m_hash;
+		};
+
+		handlers::CompactBlockFallbackHandler CreateCompactBlockFallbackHandler(extensions::ServiceState& state) {
+			auto isChainSynced = state.hooks().chainSyncedPredicate();
+			auto blockRangeConsumer = state.hooks().blockRangeConsumerFactory()(disruptor::InputSource::Remote_Pull);
+			auto pLastPulledBlockHash = std::make_shared<LastPulledBlockHash>();
+			return [&packetIoPickers = state.packetIoPickers(),
+					&registry = state.pluginManager().transactionRegistry(),
+					&nodeConfig = state.config().Node,
+					isChainSynced,
+					blockRangeConsumer,
+					pLastPulledBlockHash](const auto& header, const auto&) {
+				auto blockHash = model::CalculateHash(header);
+				if (!isChainSynced() || !pLastPulledBlockHash->trySet(blockHash))
+					return;
+
+				auto packetIoPairs = packetIoPickers.pickMatching(nodeConfig.SyncTimeout, ionet::NodeRoles::Peer);
+				if (packetIoPairs.empty()) {
+					CATAPULT_LOG(warning) << "could not find any peer for pulling block at height " << header.Height;
+					return;
+				}
+
+				auto pPacketIo = packetIoPairs.front().io();
+				auto sourceKey = packetIoPairs.front().node().identityKey();
+				auto blocksFromOptions = api::BlocksFromOptions(1, nodeConfig.MaxChainBytesPerSyncAttempt.bytes32());
+				auto pChainApi = api::CreateRemoteChainApi(*pPacketIo, registry);
+				pChainApi->blocksFrom(header.Height, blocksFromOptions).then([pPacketIo, sourceKey, blockHash, blockRangeConsumer](
+						auto&& blocksFuture) {
+					try {
+						auto blocks = blocksFuture.get();
+						if (blocks.empty() || blockHash != model::CalculateHash(*blocks.cbegin())) {
+							CATAPULT_LOG(warning) << "peer did not return block with hash " << utils::HexFormat(blockHash);
+							return;
+						}
+
+						blockRangeConsumer(model::AnnotatedBlockRange(std::move(blocks), sourceKey));
+					} catch (const catapult_runtime_error& e) {
+						CATAPULT_LOG(warning) << "exception thrown while pulling block: " << e.what();
+					}
+				});
+			};
+		}
+
 		struct HandlersConfiguration {
 			handlers::BlockRangeHandler PushBlockCallback;
+			handlers::UtShortHashesRetriever UtShortHashesRetriever;
+			handlers::CompactBlockFallbackHandler CompactBlockFallback;
 			model::ChainScoreSupplier ChainScoreSupplier;
 			handlers::PullBlocksHandlerConfiguration BlocksHandlerConfig;
 			handlers::UtRetriever UtRetriever;
+			handlers::UtReconciliationRetriever UtReconciliationRetriever;
 		};
 
-		HandlersConfiguration CreateHandlersConfiguration(const extensions::ServiceState& state) {
+		HandlersConfiguration CreateHandlersConfiguration(extensions::ServiceState& state) {
 			HandlersConfiguration config;
-			config.PushBlockCallback = extensions::CreateBlockPushEntityCallback(state.hooks());
+			config.PushBlockCallback = extensions::CreateBlockPushEntityCallback(state.hooks(), state.peerKnownInventories());
+			config.UtShortHashesRetriever = [&cache = state.utCache()](const auto& shortHashes) {
+				return cache.view().transactionInfos(shortHashes);
+			};
+			config.CompactBlockFallback = CreateCompactBlockFallbackHandler(state);
 
 			config.ChainScoreSupplier = [&chainScore = state.score()]() { return chainScore.get(); };
 			config.UtRetriever = [&cache = state.utCache()](const auto& shortHashes) {
 				return cache.view().unknownTransactions(shortHashes);
 			};
+			config.UtReconciliationRetriever = [&cache = state.utCache()](const auto& shortHashesIblt, auto& transactions) {
+				return cache.view().tryGetUnknownTransactions(shortHashesIblt, transactions);
+			};
 
 			SetConfig(config.BlocksHandlerConfig, state.config().Node);
 			return config;
@@ -62,13 +139,24 @@ namespace catapult { namespace syncsource {
 				const model::TransactionRegistry& registry,
 				const HandlersConfiguration& config) {
 			handlers::RegisterPushBlockHandler(handlers, registry, config.PushBlockCallback);
+			handlers::RegisterPushCompactBlockHandler(
+					handlers,
+					registry,
+					config.UtShortHashesRetriever,
+					config.PushBlockCallback,
+					config.CompactBlockFallback);
 			handlers::RegisterPullBlockHandler(handlers, storage);
 
 			handlers::RegisterChainInfoHandler(handlers, storage, config.ChainScoreSupplier);
 			handlers::RegisterBlockHashesHandler(handlers, storage, static_cast<uint32_t>(config.BlocksHandlerConfig.MaxBlocks));
+			handlers::RegisterBlockHashesAtHandler(handlers, storage, static_cast<uint32_t>(config.BlocksHandlerConfig.MaxBlocks));
 			handlers::RegisterPullBlocksHandler(handlers, storage, config.BlocksHandlerConfig);
+			handlers::RegisterPullBlockHeadersHandler(handlers, storage, static_cast<uint32_t>(config.BlocksHandlerConfig.MaxBlocks));
 
 			handlers::RegisterPullTransactionsHandler(handlers, config.UtRetriever);
+			handlers::RegisterPullTransactionsReconciliationHandler(handlers, config.UtReconciliationRetriever);
+
+			handlers::RegisterMultiplexedRequestHandler(handlers);
 		}
 
 		class SyncSourceServiceRegistrar : public extensions::ServiceRegistrar {
@@ -19,6 +19,8 @@
 **/
 
 #include "syncsource/src/SyncSourceService.h"
+#include "catapult/model/BlockUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
@@ -76,15 +78,21 @@ namespace catapult { namespace syncsource {
 		const auto& handlers = context.testState().state().packetHandlers();
 
 		// Assert:
-		EXPECT_EQ(6u, handlers.size());
+		EXPECT_EQ(11u, handlers.size());
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Push_Block));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Push_Compact_Block));
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Block));
 
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Chain_Info));
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Block_Hashes));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Block_Hashes_At));
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Blocks));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Block_Headers));
 
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Transactions));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Transactions_Reconciliation));
+
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Multiplexed));
 	}
 
 	// endregion
@@ -117,5 +125,38 @@ namespace catapult { namespace syncsource {
 		AssertBlockPush(false, 0);
 	}
 
+	namespace {
+		void AssertCompactBlockPush(bool isChainSynced, size_t numExpectedPushes) {
+			// Arrange: create a compact block without transactions, which can always be reconstructed
+			TestContext context(isChainSynced);
+			context.boot();
+
+			auto pBlock = test::GenerateEmptyRandomBlock();
+			model::CalculateBlockTransactionsHash({}, pBlock->BlockTransactionsHash);
+
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(sizeof(model::BlockHeader));
+			pPacket->Type = ionet::PacketType::Push_Compact_Block;
+			std::memcpy(pPacket->Data(), pBlock.get(), sizeof(model::BlockHeader));
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext({}, "");
+			const auto& handlers = context.testState().state().packetHandlers();
+			handlers.process(*pPacket, handlerContext);
+
+			// Assert:
+			EXPECT_EQ(numExpectedPushes, context.numPushedBlockElements());
+		}
+	}
+
+	TEST(TEST_CLASS, CanPushCompactBlockWhenSynced) {
+		// Assert:
+		AssertCompactBlockPush(true, 1);
+	}
+
+	TEST(TEST_CLASS, CannotPushCompactBlockWhenNotSynced) {
+		// Assert:
+		AssertCompactBlockPush(false, 0);
+	}
+
 	// endregion
 }}
@@ -39,7 +39,7 @@ namespace catapult { namespace transactionsink {
 
 			void registerServices(extensions::ServiceLocator&, extensions::ServiceState& state) override {
 				// add handlers
-				auto pushTransactionsCallback = CreateTransactionPushEntityCallback(state.hooks());
+				auto pushTransactionsCallback = CreateTransactionPushEntityCallback(state.hooks(), state.peerKnownInventories());
 				handlers::RegisterPushTransactionsHandler(
 						state.packetHandlers(),
 						state.pluginManager().transactionRegistry(),
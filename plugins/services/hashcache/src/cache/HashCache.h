@@ -20,6 +20,7 @@
 
 #pragma once
 #include "HashCacheDelta.h"
+#include "HashCacheFilter.h"
 #include "HashCacheView.h"
 #include "catapult/cache/BasicCache.h"
 
@@ -33,8 +34,54 @@ namespace catapult { namespace cache {
 	public:
 		/// Creates a cache around \a config with the specified retention time (\a retentionTime).
 		explicit BasicHashCache(const CacheConfiguration& config, const utils::TimeSpan& retentionTime)
-				: HashBasicCache(config, HashCacheTypes::Options{ retentionTime })
+				: BasicHashCache(config, retentionTime, std::make_shared<HashCacheFilter>())
 		{}
+
+		/// Creates a cache around \a config with the specified retention time (\a retentionTime) and filter (\a pFilter).
+		/// \note The filter is not used when the cache is backed by a database.
+		explicit BasicHashCache(
+				const CacheConfiguration& config,
+				const utils::TimeSpan& retentionTime,
+				const std::shared_ptr<HashCacheFilter>& pFilter)
+				: HashBasicCache(config, HashCacheTypes::Options{ retentionTime, SelectFilter(config, pFilter) })
+				, m_pFilter(SelectFilter(config, pFilter))
+		{}
+
+	public:
+		/// Commits all pending changes from \a delta to the underlying storage.
+		void commit(const CacheDeltaType& delta) {
+			if (!m_pFilter) {
+				HashBasicCache::commit(delta);
+				return;
+			}
+
+			// pruning can only be applied to the filter by rebuilding it, which needs to happen after the commit
+			// (the filter is rebuilt when it is full too, but it must always be a superset of the committed hashes)
+			auto shouldRebuild = delta.pruningBoundary().isSet();
+			for (const auto& timestampedHash : delta.addedElements())
+				shouldRebuild = !m_pFilter->insert(timestampedHash) || shouldRebuild;
+
+			HashBasicCache::commit(delta);
+
+			if (shouldRebuild)
+				rebuildFilter();
+		}
+
+	private:
+		static std::shared_ptr<HashCacheFilter> SelectFilter(
+				const CacheConfiguration& config,
+				const std::shared_ptr<HashCacheFilter>& pFilter) {
+			// the filter can only be (re)built from an iterable view, which is not available for a database backed cache
+			return config.ShouldUseCacheDatabase ? nullptr : pFilter;
+		}
+
+		void rebuildFilter() {
+			auto view = createView();
+			m_pFilter->rebuild(view.size(), *view.tryMakeIterableView());
+		}
+
+	private:
+		std::shared_ptr<HashCacheFilter> m_pFilter;
 	};
 
 	/// Synchronized cache composed of timestamped hashes of (transaction) elements.
@@ -45,7 +92,23 @@ namespace catapult { namespace cache {
 	public:
 		/// Creates a cache around \a config with the specified retention time (\a retentionTime).
 		explicit HashCache(const CacheConfiguration& config, const utils::TimeSpan& retentionTime)
-				: SynchronizedCache<BasicHashCache>(BasicHashCache(config, retentionTime))
+				: HashCache(config, retentionTime, std::make_shared<HashCacheFilter>())
+		{}
+
+	private:
+		HashCache(const CacheConfiguration& config, const utils::TimeSpan& retentionTime, const std::shared_ptr<HashCacheFilter>& pFilter)
+				: SynchronizedCache<BasicHashCache>(BasicHashCache(config, retentionTime, pFilter))
+				, m_pFilter(pFilter)
 		{}
+
+	public:
+		/// Gets the filter over all committed hashes.
+		/// \note The filter is unused when the cache is backed by a database, so all of its counters will be zero.
+		const HashCacheFilter& filter() const {
+			return *m_pFilter;
+		}
+
+	private:
+		std::shared_ptr<const HashCacheFilter> m_pFilter;
 	};
 }}
@@ -19,15 +19,16 @@
 **/
 
 #include "HashCacheDelta.h"
+#include "HashCacheFilter.h"
 
 namespace catapult { namespace cache {
 
 	BasicHashCacheDelta::BasicHashCacheDelta(const HashCacheTypes::BaseSetDeltaPointers& hashSets, const HashCacheTypes::Options& options)
 			: HashCacheDeltaMixins::Size(*hashSets.pPrimary)
-			, HashCacheDeltaMixins::Contains(*hashSets.pPrimary)
 			, HashCacheDeltaMixins::BasicInsertRemove(*hashSets.pPrimary)
 			, m_pOrderedDelta(hashSets.pPrimary)
 			, m_retentionTime(options.RetentionTime)
+			, m_pFilter(options.pFilter)
 	{}
 
 	utils::TimeSpan BasicHashCacheDelta::retentionTime() const {
@@ -38,6 +39,24 @@ namespace catapult { namespace cache {
 		return m_pruningBoundary;
 	}
 
+	bool BasicHashCacheDelta::contains(const ValueType& timestampedHash) const {
+		if (!m_pFilter)
+			return m_pOrderedDelta->contains(timestampedHash);
+
+		// the filter only knows about committed hashes, so pending additions need to be checked separately
+		const auto& addedElements = m_pOrderedDelta->deltas().Added;
+		if (addedElements.cend() != addedElements.find(timestampedHash))
+			return true;
+
+		return m_pFilter->contains(timestampedHash, [this, &timestampedHash]() {
+			return m_pOrderedDelta->contains(timestampedHash);
+		});
+	}
+
+	const HashCacheTypes::PrimaryTypes::BaseSetDeltaType::MemorySetType& BasicHashCacheDelta::addedElements() const {
+		return m_pOrderedDelta->deltas().Added;
+	}
+
 	void BasicHashCacheDelta::prune(Timestamp timestamp) {
 		auto pruneTime = SubtractNonNegative(timestamp, m_retentionTime);
 		m_pruningBoundary = ValueType(pruneTime);
@@ -33,7 +33,6 @@ namespace catapult { namespace cache {
 	class BasicHashCacheDelta
 			: public utils::MoveOnly
 			, public HashCacheDeltaMixins::Size
-			, public HashCacheDeltaMixins::Contains
 			, public HashCacheDeltaMixins::BasicInsertRemove {
 	public:
 		using ReadOnlyView = HashCacheTypes::CacheReadOnlyType;
@@ -50,6 +49,12 @@ namespace catapult { namespace cache {
 		/// Gets the pruning boundary that is used during commit.
 		deltaset::PruningBoundary<ValueType> pruningBoundary() const;
 
+		/// Gets a value indicating whether or not the cache contains \a timestampedHash.
+		bool contains(const ValueType& timestampedHash) const;
+
+		/// Gets all hashes that were added to this delta and are pending commit.
+		const HashCacheTypes::PrimaryTypes::BaseSetDeltaType::MemorySetType& addedElements() const;
+
 	public:
 		/// Removes all timestamped hashes that have timestamps prior to the given \a timestamp minus the retention time.
 		void prune(Timestamp timestamp);
@@ -57,6 +62,7 @@ namespace catapult { namespace cache {
 	private:
 		HashCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pOrderedDelta;
 		utils::TimeSpan m_retentionTime;
+		std::shared_ptr<const HashCacheFilter> m_pFilter;
 		deltaset::PruningBoundary<ValueType> m_pruningBoundary;
 	};
 
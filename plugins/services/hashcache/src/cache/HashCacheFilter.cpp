@@ -0,0 +1,68 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "HashCacheFilter.h"
+#include <algorithm>
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+	HashCacheFilter::HashCacheFilter()
+			: m_filter(Min_Capacity)
+			, m_numDefiniteMisses(0)
+			, m_numFalsePositives(0)
+	{}
+
+	uint64_t HashCacheFilter::numDefiniteMisses() const {
+		return m_numDefiniteMisses;
+	}
+
+	uint64_t HashCacheFilter::numFalsePositives() const {
+		return m_numFalsePositives;
+	}
+
+	uint64_t HashCacheFilter::falsePositiveRatePpm() const {
+		// all lookups of hashes not in the cache are either definite misses or false positives
+		uint64_t numFalsePositives = m_numFalsePositives;
+		auto numNegatives = m_numDefiniteMisses + numFalsePositives;
+		return 0 == numNegatives ? 0 : numFalsePositives * 1'000'000 / numNegatives;
+	}
+
+	bool HashCacheFilter::insert(const state::TimestampedHash& timestampedHash) {
+		m_filter.insert(ToShortHash(timestampedHash));
+		return m_filter.size() <= m_filter.capacity();
+	}
+
+	utils::ShortHash HashCacheFilter::ToShortHash(const state::TimestampedHash& timestampedHash) {
+		// only hash the (random) hash bytes so that the filter is independent of the timestamp
+		utils::ShortHash shortHash;
+		std::memcpy(&shortHash, timestampedHash.Hash.data(), sizeof(utils::ShortHash));
+		return shortHash;
+	}
+
+	void HashCacheFilter::reset(size_t numTimestampedHashes) {
+		// leave room for growth so that the filter does not need to be rebuilt after every commit
+		auto capacity = std::max<size_t>(Min_Capacity, 2 * numTimestampedHashes);
+		if (capacity != m_filter.capacity())
+			m_filter = utils::ShortHashBloomFilter(capacity);
+		else
+			m_filter.clear();
+	}
+}}
@@ -0,0 +1,89 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/state/TimestampedHash.h"
+#include "catapult/utils/ShortHashBloomFilter.h"
+#include <atomic>
+
+namespace catapult { namespace cache {
+
+	/// Probabilistic prefilter over the (committed) hashes in a hash cache.
+	/// \note The filter only contains committed hashes; it is updated during commit and rebuilt when the cache is pruned.
+	class HashCacheFilter {
+	public:
+		/// Minimum number of hashes the filter is sized for.
+		static constexpr size_t Min_Capacity = 1024;
+
+	public:
+		/// Creates an empty filter.
+		HashCacheFilter();
+
+	public:
+		/// Gets the number of lookups that were rejected by the filter.
+		uint64_t numDefiniteMisses() const;
+
+		/// Gets the number of lookups that passed the filter but were not found in the cache.
+		uint64_t numFalsePositives() const;
+
+		/// Gets the observed false positive rate in parts per million.
+		uint64_t falsePositiveRatePpm() const;
+
+	public:
+		/// Checks if \a timestampedHash is contained in the cache by first consulting the filter and
+		/// then, if required, calling \a lookup, which performs a full lookup in the committed cache.
+		template<typename TLookup>
+		bool contains(const state::TimestampedHash& timestampedHash, TLookup lookup) const {
+			if (!m_filter.maybeContains(ToShortHash(timestampedHash))) {
+				++m_numDefiniteMisses;
+				return false;
+			}
+
+			if (lookup())
+				return true;
+
+			++m_numFalsePositives;
+			return false;
+		}
+
+	public:
+		/// Adds \a timestampedHash to the filter.
+		/// \note If the filter is full, \c false is returned and the filter should be rebuilt.
+		bool insert(const state::TimestampedHash& timestampedHash);
+
+		/// Rebuilds the filter from all \a timestampedHashes.
+		template<typename TTimestampedHashes>
+		void rebuild(size_t numTimestampedHashes, const TTimestampedHashes& timestampedHashes) {
+			reset(numTimestampedHashes);
+			for (const auto& timestampedHash : timestampedHashes)
+				insert(timestampedHash);
+		}
+
+	private:
+		static utils::ShortHash ToShortHash(const state::TimestampedHash& timestampedHash);
+
+		void reset(size_t numTimestampedHashes);
+
+	private:
+		utils::ShortHashBloomFilter m_filter;
+		mutable std::atomic<uint64_t> m_numDefiniteMisses;
+		mutable std::atomic<uint64_t> m_numFalsePositives;
+	};
+}}
@@ -23,6 +23,7 @@
 #include "catapult/cache/SingleSetCacheTypesAdapter.h"
 #include "catapult/state/TimestampedHash.h"
 #include "catapult/utils/TimeSpan.h"
+#include <memory>
 
 namespace catapult {
 	namespace cache {
@@ -30,6 +31,7 @@ namespace catapult {
 		class BasicHashCacheView;
 		class HashCache;
 		class HashCacheDelta;
+		class HashCacheFilter;
 		class HashCacheView;
 
 		template<typename TCache, typename TCacheDelta, typename TKey>
@@ -69,6 +71,9 @@ namespace catapult { namespace cache {
 		struct Options {
 			/// Cache retention time.
 			utils::TimeSpan RetentionTime;
+
+			/// Optional filter over all committed hashes.
+			std::shared_ptr<const HashCacheFilter> pFilter;
 		};
 	};
 }}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "HashCacheFilter.h"
 #include "HashCacheTypes.h"
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/ReadOnlySimpleCache.h"
@@ -33,7 +34,6 @@ namespace catapult { namespace cache {
 	class BasicHashCacheView
 			: public utils::MoveOnly
 			, public HashCacheViewMixins::Size
-			, public HashCacheViewMixins::Contains
 			, public HashCacheViewMixins::Iteration {
 	public:
 		using ReadOnlyView = HashCacheTypes::CacheReadOnlyType;
@@ -42,9 +42,10 @@ namespace catapult { namespace cache {
 		/// Creates a view around \a hashSets and \a options.
 		explicit BasicHashCacheView(const HashCacheTypes::BaseSets& hashSets, const HashCacheTypes::Options& options)
 				: HashCacheViewMixins::Size(hashSets.Primary)
-				, HashCacheViewMixins::Contains(hashSets.Primary)
 				, HashCacheViewMixins::Iteration(hashSets.Primary)
+				, m_hashes(hashSets.Primary)
 				, m_retentionTime(options.RetentionTime)
+				, m_pFilter(options.pFilter)
 		{}
 
 	public:
@@ -53,8 +54,20 @@ namespace catapult { namespace cache {
 			return m_retentionTime;
 		}
 
+		/// Gets a value indicating whether or not the cache contains \a timestampedHash.
+		bool contains(const state::TimestampedHash& timestampedHash) const {
+			if (!m_pFilter)
+				return m_hashes.contains(timestampedHash);
+
+			return m_pFilter->contains(timestampedHash, [this, &timestampedHash]() {
+				return m_hashes.contains(timestampedHash);
+			});
+		}
+
 	private:
+		const HashCacheTypes::PrimaryTypes::BaseSetType& m_hashes;
 		utils::TimeSpan m_retentionTime;
+		std::shared_ptr<const HashCacheFilter> m_pFilter;
 	};
 
 	/// View on top of the hash cache.
@@ -45,6 +45,12 @@ namespace catapult { namespace plugins {
 			counters.emplace_back(utils::DiagnosticCounterId("HASH C"), [&cache]() {
 				return cache.sub<cache::HashCache>().createView()->size();
 			});
+			counters.emplace_back(utils::DiagnosticCounterId("HASH C FP"), [&cache]() {
+				return cache.sub<cache::HashCache>().filter().numFalsePositives();
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("HASH C FPR"), [&cache]() {
+				return cache.sub<cache::HashCache>().filter().falsePositiveRatePpm();
+			});
 		});
 
 		manager.addStatefulValidatorHook([](auto& builder) {
@@ -0,0 +1,177 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/HashCacheFilter.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS HashCacheFilterTests
+
+	namespace {
+		state::TimestampedHash GenerateRandomTimestampedHash() {
+			return state::TimestampedHash(test::GenerateRandomValue<Timestamp>(), test::GenerateRandomData<Hash256_Size>());
+		}
+
+		std::vector<state::TimestampedHash> GenerateRandomTimestampedHashes(size_t count) {
+			std::vector<state::TimestampedHash> timestampedHashes;
+			for (auto i = 0u; i < count; ++i)
+				timestampedHashes.push_back(GenerateRandomTimestampedHash());
+
+			return timestampedHashes;
+		}
+
+		bool FilterContains(const HashCacheFilter& filter, const state::TimestampedHash& timestampedHash, bool lookupResult) {
+			return filter.contains(timestampedHash, [lookupResult]() { return lookupResult; });
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateFilter) {
+		// Act:
+		HashCacheFilter filter;
+
+		// Assert:
+		EXPECT_EQ(0u, filter.numDefiniteMisses());
+		EXPECT_EQ(0u, filter.numFalsePositives());
+		EXPECT_EQ(0u, filter.falsePositiveRatePpm());
+	}
+
+	// endregion
+
+	// region contains
+
+	TEST(TEST_CLASS, ContainsBypassesLookupWhenHashIsDefinitelyNotContained) {
+		// Arrange:
+		HashCacheFilter filter;
+		auto numLookups = 0u;
+
+		// Act:
+		auto result = filter.contains(GenerateRandomTimestampedHash(), [&numLookups]() {
+			++numLookups;
+			return true;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(0u, numLookups);
+		EXPECT_EQ(1u, filter.numDefiniteMisses());
+		EXPECT_EQ(0u, filter.numFalsePositives());
+	}
+
+	TEST(TEST_CLASS, ContainsDelegatesToLookupWhenHashIsMaybeContained) {
+		// Arrange:
+		HashCacheFilter filter;
+		auto timestampedHash = GenerateRandomTimestampedHash();
+		filter.insert(timestampedHash);
+
+		// Act:
+		auto result1 = FilterContains(filter, timestampedHash, true);
+		auto result2 = FilterContains(filter, timestampedHash, false);
+
+		// Assert: second lookup is a false positive
+		EXPECT_TRUE(result1);
+		EXPECT_FALSE(result2);
+		EXPECT_EQ(0u, filter.numDefiniteMisses());
+		EXPECT_EQ(1u, filter.numFalsePositives());
+	}
+
+	TEST(TEST_CLASS, FilterIsIndependentOfTimestamp) {
+		// Arrange:
+		HashCacheFilter filter;
+		auto timestampedHash = GenerateRandomTimestampedHash();
+		filter.insert(timestampedHash);
+
+		// Act:
+		timestampedHash.Time = timestampedHash.Time + Timestamp(1);
+		auto result = FilterContains(filter, timestampedHash, true);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(0u, filter.numDefiniteMisses());
+	}
+
+	TEST(TEST_CLASS, FalsePositiveRateIsCalculatedFromNegativeLookups) {
+		// Arrange:
+		HashCacheFilter filter;
+		auto timestampedHash = GenerateRandomTimestampedHash();
+		filter.insert(timestampedHash);
+
+		// Act: 1 false positive, 3 definite misses
+		FilterContains(filter, timestampedHash, false);
+		for (const auto& otherTimestampedHash : GenerateRandomTimestampedHashes(3))
+			FilterContains(filter, otherTimestampedHash, false);
+
+		// Assert:
+		EXPECT_EQ(3u, filter.numDefiniteMisses());
+		EXPECT_EQ(1u, filter.numFalsePositives());
+		EXPECT_EQ(250'000u, filter.falsePositiveRatePpm());
+	}
+
+	// endregion
+
+	// region insert / rebuild
+
+	TEST(TEST_CLASS, InsertReturnsFalseWhenFilterIsFull) {
+		// Arrange:
+		HashCacheFilter filter;
+		auto capacity = HashCacheFilter::Min_Capacity;
+		auto timestampedHashes = GenerateRandomTimestampedHashes(capacity + 1);
+
+		// Act:
+		auto numSuccesses = 0u;
+		for (const auto& timestampedHash : timestampedHashes)
+			numSuccesses += filter.insert(timestampedHash) ? 1 : 0;
+
+		// Assert:
+		EXPECT_EQ(capacity, numSuccesses);
+	}
+
+	TEST(TEST_CLASS, RebuildReplacesAllHashesAndPreservesCounters) {
+		// Arrange:
+		HashCacheFilter filter;
+		auto removedTimestampedHashes = GenerateRandomTimestampedHashes(10);
+		for (const auto& timestampedHash : removedTimestampedHashes)
+			filter.insert(timestampedHash);
+
+		FilterContains(filter, removedTimestampedHashes[0], false);
+
+		// Act:
+		auto timestampedHashes = GenerateRandomTimestampedHashes(2 * HashCacheFilter::Min_Capacity);
+		filter.rebuild(timestampedHashes.size(), timestampedHashes);
+
+		// Assert: all rebuilt hashes are contained and the filter has room for growth
+		for (const auto& timestampedHash : timestampedHashes)
+			EXPECT_TRUE(FilterContains(filter, timestampedHash, true));
+
+		EXPECT_TRUE(filter.insert(GenerateRandomTimestampedHash()));
+		EXPECT_EQ(1u, filter.numFalsePositives());
+
+		// - removed hashes are (almost certainly) no longer contained
+		auto numDefiniteMisses = filter.numDefiniteMisses();
+		for (const auto& timestampedHash : removedTimestampedHashes)
+			FilterContains(filter, timestampedHash, false);
+
+		EXPECT_LE(numDefiniteMisses + 9, filter.numDefiniteMisses());
+	}
+
+	// endregion
+}}
@@ -21,6 +21,7 @@
 #include "src/cache/HashCache.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/CacheMixinsTests.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -111,4 +112,145 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region filter
+
+	namespace {
+		state::TimestampedHash MakeTimestampedHash(uint32_t rawTimestamp) {
+			return state::TimestampedHash(Timestamp(rawTimestamp), test::GenerateRandomData<Hash256_Size>());
+		}
+
+		void InsertAndCommit(HashCache& cache, const std::vector<state::TimestampedHash>& timestampedHashes) {
+			auto delta = cache.createDelta();
+			for (const auto& timestampedHash : timestampedHashes)
+				delta->insert(timestampedHash);
+
+			cache.commit();
+		}
+	}
+
+	TEST(TEST_CLASS, ViewLookupOfUnknownHashIsRejectedByFilter) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		InsertAndCommit(cache, { MakeTimestampedHash(1), MakeTimestampedHash(2) });
+
+		// Act:
+		auto result = cache.createView()->contains(MakeTimestampedHash(1));
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(1u, cache.filter().numDefiniteMisses());
+	}
+
+	TEST(TEST_CLASS, ViewLookupOfCommittedHashPassesFilter) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		auto timestampedHash = MakeTimestampedHash(1);
+		InsertAndCommit(cache, { timestampedHash, MakeTimestampedHash(2) });
+
+		// Act:
+		auto result = cache.createView()->contains(timestampedHash);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(0u, cache.filter().numDefiniteMisses());
+		EXPECT_EQ(0u, cache.filter().numFalsePositives());
+	}
+
+	TEST(TEST_CLASS, DeltaLookupFindsPendingHashNotInFilter) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		InsertAndCommit(cache, { MakeTimestampedHash(1) });
+		auto timestampedHash = MakeTimestampedHash(2);
+
+		auto delta = cache.createDelta();
+		delta->insert(timestampedHash);
+
+		// Act:
+		auto result1 = delta->contains(timestampedHash);
+		auto result2 = delta->contains(MakeTimestampedHash(3));
+
+		// Assert:
+		EXPECT_TRUE(result1);
+		EXPECT_FALSE(result2);
+		EXPECT_EQ(1u, cache.filter().numDefiniteMisses());
+	}
+
+	TEST(TEST_CLASS, DeltaLookupOfRemovedCommittedHashFails) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		auto timestampedHash = MakeTimestampedHash(1);
+		InsertAndCommit(cache, { timestampedHash });
+
+		auto delta = cache.createDelta();
+		delta->remove(timestampedHash);
+
+		// Act:
+		auto result = delta->contains(timestampedHash);
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+	TEST(TEST_CLASS, PruneRebuildsFilter) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromMilliseconds(10));
+		auto prunedTimestampedHash = MakeTimestampedHash(1);
+		auto retainedTimestampedHash = MakeTimestampedHash(20);
+		InsertAndCommit(cache, { prunedTimestampedHash, retainedTimestampedHash });
+
+		// Act:
+		{
+			auto delta = cache.createDelta();
+			delta->prune(Timestamp(15));
+			cache.commit();
+		}
+
+		// Assert: pruned hash is (almost certainly) rejected by the filter
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		EXPECT_FALSE(view->contains(prunedTimestampedHash));
+		EXPECT_TRUE(view->contains(retainedTimestampedHash));
+		EXPECT_EQ(1u, cache.filter().numDefiniteMisses());
+	}
+
+	TEST(TEST_CLASS, FilterIsRebuiltWhenFull) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		std::vector<state::TimestampedHash> timestampedHashes;
+		for (auto i = 0u; i < 3 * HashCacheFilter::Min_Capacity; ++i)
+			timestampedHashes.push_back(MakeTimestampedHash(i));
+
+		// Act:
+		InsertAndCommit(cache, timestampedHashes);
+
+		// Assert:
+		auto view = cache.createView();
+		for (const auto& timestampedHash : timestampedHashes)
+			EXPECT_TRUE(view->contains(timestampedHash));
+
+		EXPECT_EQ(0u, cache.filter().numDefiniteMisses());
+		EXPECT_EQ(0u, cache.filter().numFalsePositives());
+	}
+
+	TEST(TEST_CLASS, FilterIsBypassedWhenCacheIsBackedByDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("testdb");
+		HashCache cache(CacheConfiguration(dbDirGuard.name()), utils::TimeSpan::FromHours(32));
+		auto timestampedHash = MakeTimestampedHash(1);
+		InsertAndCommit(cache, { timestampedHash, MakeTimestampedHash(2) });
+
+		// Act:
+		auto view = cache.createView();
+		auto result1 = view->contains(timestampedHash);
+		auto result2 = view->contains(MakeTimestampedHash(3));
+
+		// Assert: lookups are answered by the database without consulting the filter
+		EXPECT_TRUE(result1);
+		EXPECT_FALSE(result2);
+		EXPECT_EQ(0u, cache.filter().numDefiniteMisses());
+		EXPECT_EQ(0u, cache.filter().numFalsePositives());
+	}
+
+	// endregion
 }}
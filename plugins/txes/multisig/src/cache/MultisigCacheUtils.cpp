@@ -20,6 +20,8 @@
 
 #include "MultisigCacheUtils.h"
 #include "MultisigCache.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_map>
 
 namespace catapult { namespace cache {
 
@@ -37,18 +39,43 @@ namespace catapult { namespace cache {
 		};
 
 		template<typename TTraits>
-		size_t FindAll(const MultisigCacheTypes::CacheReadOnlyType& multisigCache, const Key& publicKey, utils::KeySet& keySet) {
-			if (!multisigCache.contains(publicKey))
-				return 0;
-
-			size_t numLevels = 0;
-			const auto& multisigEntry = multisigCache.get(publicKey);
-			for (const auto& linkedKey : TTraits::GetKeySet(multisigEntry)) {
-				keySet.insert(linkedKey);
-				numLevels = std::max(numLevels, FindAll<TTraits>(multisigCache, linkedKey, keySet) + 1);
+		class LinkedKeysFinder {
+		public:
+			LinkedKeysFinder(const MultisigCacheTypes::CacheReadOnlyType& multisigCache, utils::KeySet& keySet)
+					: m_multisigCache(multisigCache)
+					, m_keySet(keySet)
+			{}
+
+		public:
+			size_t find(const Key& publicKey) {
+				// each key is only visited once, so shared (diamond shaped) subgraphs are not reevaluated
+				auto iter = m_numLevelsMap.find(publicKey);
+				if (m_numLevelsMap.cend() != iter)
+					return iter->second;
+
+				size_t numLevels = 0;
+				if (m_multisigCache.contains(publicKey)) {
+					const auto& multisigEntry = m_multisigCache.get(publicKey);
+					for (const auto& linkedKey : TTraits::GetKeySet(multisigEntry)) {
+						m_keySet.insert(linkedKey);
+						numLevels = std::max(numLevels, find(linkedKey) + 1);
+					}
+				}
+
+				m_numLevelsMap.emplace(publicKey, numLevels);
+				return numLevels;
 			}
 
-			return numLevels;
+		private:
+			const MultisigCacheTypes::CacheReadOnlyType& m_multisigCache;
+			utils::KeySet& m_keySet;
+			std::unordered_map<Key, size_t, utils::ArrayHasher<Key>> m_numLevelsMap;
+		};
+
+		template<typename TTraits>
+		size_t FindAll(const MultisigCacheTypes::CacheReadOnlyType& multisigCache, const Key& publicKey, utils::KeySet& keySet) {
+			LinkedKeysFinder<TTraits> finder(multisigCache, keySet);
+			return finder.find(publicKey);
 		}
 	}
 
@@ -26,9 +26,11 @@ namespace catapult { namespace cache {
 
 	/// Finds all ancestors of a \a key in \a cache, adds them to \a ancestorKeys and returns the maximum distance between
 	/// \a key and any ancestor.
+	/// \note Each account is visited at most once, so the search is linear in the number of ancestors and links.
 	size_t FindAncestors(const MultisigCacheTypes::CacheReadOnlyType& cache, const Key& key, utils::KeySet& ancestorKeys);
 
 	/// Finds all descendants of a \a key in \a cache, adds them to \a descendantKeys and returns the maximum distance between
 	/// \a key and any descendant.
+	/// \note Each account is visited at most once, so the search is linear in the number of descendants and links.
 	size_t FindDescendants(const MultisigCacheTypes::CacheReadOnlyType& cache, const Key& key, utils::KeySet& descendantKeys);
 }}
@@ -22,7 +22,9 @@
 #include "src/cache/MultisigCache.h"
 #include "src/model/ModifyMultisigAccountTransaction.h"
 #include "catapult/utils/ArraySet.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/validators/ValidatorContext.h"
+#include <unordered_map>
 
 namespace catapult { namespace validators {
 
@@ -83,6 +85,17 @@ namespace catapult { namespace validators {
 
 		private:
 			bool isSatisfied(const Key& publicKey, OperationType operationType) {
+				// operation type is constant for a single check, so each account only needs to be evaluated once
+				auto iter = m_satisfiedMap.find(publicKey);
+				if (m_satisfiedMap.cend() != iter)
+					return iter->second;
+
+				auto isAccountSatisfied = isSatisfiedUncached(publicKey, operationType);
+				m_satisfiedMap.emplace(publicKey, isAccountSatisfied);
+				return isAccountSatisfied;
+			}
+
+			bool isSatisfiedUncached(const Key& publicKey, OperationType operationType) {
 				// if the account is unknown or not multisig, fallback to default non-multisig verification
 				// (where transaction signer is required to be a cosigner)
 				if (!m_multisigCache.contains(publicKey))
@@ -105,6 +118,7 @@ namespace catapult { namespace validators {
 			const Notification& m_notification;
 			const cache::MultisigCache::CacheReadOnlyType& m_multisigCache;
 			utils::KeyPointerSet m_cosigners;
+			std::unordered_map<Key, bool, utils::ArrayHasher<Key>> m_satisfiedMap;
 		};
 	}
 
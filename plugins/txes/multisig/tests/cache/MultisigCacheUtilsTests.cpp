@@ -157,4 +157,66 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region diamond hierarchies
+
+	namespace {
+		constexpr auto Num_Diamond_Levels = 32u;
+
+		auto CreateCacheMultisigDiamondLattice(const std::vector<Key>& keys) {
+			auto cache = test::MultisigCacheFactory::Create();
+			auto cacheDelta = cache.createDelta();
+
+			// each of the two accounts on level i is a multisig with both accounts on level i + 1 as cosignatories
+			// (an unmemoized search visits 2^i paths at level i)
+			for (auto i = 0u; i < Num_Diamond_Levels; ++i) {
+				auto cosignatoryKeys = std::vector<Key>{ keys[2 * i + 2], keys[2 * i + 3] };
+				test::MakeMultisig(cacheDelta, keys[2 * i], cosignatoryKeys);
+				test::MakeMultisig(cacheDelta, keys[2 * i + 1], cosignatoryKeys);
+			}
+
+			cache.commit(Height());
+			return cache;
+		}
+
+		template<typename TAction>
+		void RunMultisigDiamondLatticeTest(TAction action) {
+			// Arrange:
+			auto keys = test::GenerateKeys(2 * (Num_Diamond_Levels + 1));
+			auto cache = CreateCacheMultisigDiamondLattice(keys);
+			auto cacheView = cache.createView();
+			auto readOnlyCache = cacheView.toReadOnly();
+
+			// Act:
+			action(readOnlyCache.sub<cache::MultisigCache>(), keys);
+		}
+	}
+
+	TEST(TEST_CLASS, CanFindAllDescendantsInDiamondHierarchy) {
+		// Arrange:
+		RunMultisigDiamondLatticeTest([](const auto& cache, const auto& keys) {
+			// Act:
+			utils::KeySet descendantKeys;
+			auto numLevels = FindDescendants(cache, keys[0], descendantKeys);
+
+			// Assert: all keys except for the top level keys are descendants
+			EXPECT_EQ(Num_Diamond_Levels, numLevels);
+			EXPECT_EQ(utils::KeySet(keys.cbegin() + 2, keys.cend()), descendantKeys);
+		});
+	}
+
+	TEST(TEST_CLASS, CanFindAllAncestorsInDiamondHierarchy) {
+		// Arrange:
+		RunMultisigDiamondLatticeTest([](const auto& cache, const auto& keys) {
+			// Act:
+			utils::KeySet ancestorKeys;
+			auto numLevels = FindAncestors(cache, keys.back(), ancestorKeys);
+
+			// Assert: all keys except for the bottom level keys are ancestors
+			EXPECT_EQ(Num_Diamond_Levels, numLevels);
+			EXPECT_EQ(utils::KeySet(keys.cbegin(), keys.cend() - 2), ancestorKeys);
+		});
+	}
+
+	// endregion
 }}
@@ -273,6 +273,54 @@ namespace catapult { namespace validators {
 				[](const auto& cosignatories) { return std::vector<Key>{ cosignatories[0], cosignatories[2] }; });
 	}
 
+	namespace {
+		constexpr auto Num_Diamond_Levels = 32u;
+
+		auto CreateCacheWithDiamondMultisigLattice(const Key& embeddedSigner, const std::vector<Key>& keys) {
+			auto cache = test::MultisigCacheFactory::Create();
+			auto cacheDelta = cache.createDelta();
+
+			// make the embedded signer a 2-2-X multisig with the two top level accounts as cosignatories
+			// and make each of the two accounts on level i a 2-2-X multisig with both accounts on level i + 1 as cosignatories
+			test::MakeMultisig(cacheDelta, embeddedSigner, { keys[0], keys[1] }, 2, 2);
+			for (auto i = 0u; i < Num_Diamond_Levels; ++i) {
+				auto cosignatoryKeys = std::vector<Key>{ keys[2 * i + 2], keys[2 * i + 3] };
+				test::MakeMultisig(cacheDelta, keys[2 * i], cosignatoryKeys, 2, 2);
+				test::MakeMultisig(cacheDelta, keys[2 * i + 1], cosignatoryKeys, 2, 2);
+			}
+
+			cache.commit(Height());
+			return cache;
+		}
+
+		void AssertDiamondMultisigResult(ValidationResult expectedResult, size_t numBottomLevelCosigners) {
+			// Arrange:
+			auto embeddedSigner = test::GenerateRandomData<Key_Size>();
+			auto aggregateSigner = test::GenerateRandomData<Key_Size>();
+			auto keys = test::GenerateRandomDataVector<Key>(2 * (Num_Diamond_Levels + 1));
+
+			auto pSubTransaction = CreateEmbeddedTransaction(embeddedSigner);
+
+			// - create the cache where every account on every level is shared by both accounts on the preceding level
+			//   (an unmemoized evaluation visits 2^i paths at level i)
+			auto cache = CreateCacheWithDiamondMultisigLattice(embeddedSigner, keys);
+
+			// Assert: both bottom level accounts are required for approval
+			auto cosigners = std::vector<Key>(keys.cend() - static_cast<ptrdiff_t>(numBottomLevelCosigners), keys.cend());
+			AssertValidationResult(expectedResult, cache, aggregateSigner, *pSubTransaction, cosigners);
+		}
+	}
+
+	TEST(TEST_CLASS, SufficientWhenDiamondMultisigEmbeddedTransactionSignerHasMinApprovers) {
+		// Assert: 2 == 2
+		AssertDiamondMultisigResult(ValidationResult::Success, 2);
+	}
+
+	TEST(TEST_CLASS, InsufficientWhenDiamondMultisigEmbeddedTransactionSignerHasLessThanMinApprovers) {
+		// Assert: 1 < 2
+		AssertDiamondMultisigResult(Failure_Aggregate_Missing_Cosigners, 1);
+	}
+
 	TEST(TEST_CLASS, SuccessWhenMultisigTransactionSignerHasMinApproversSharedAcrossLevels) {
 		// Arrange:
 		auto embeddedSigner = test::GenerateRandomData<Key_Size>();
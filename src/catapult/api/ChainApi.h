@@ -47,5 +47,12 @@ namespace catapult { namespace api {
 
 		/// Gets the hashes starting at \a height.
 		virtual thread::future<model::HashRange> hashesFrom(Height height) const = 0;
+
+		/// Gets the hashes at \a heights.
+		/// \note Only hashes for the longest prefix of increasing \a heights that are all part of the chain are returned.
+		virtual thread::future<model::HashRange> hashesAt(model::HeightRange&& heights) const = 0;
+
+		/// Gets at most \a maxBlockHeaders block headers starting at \a height.
+		virtual thread::future<model::BlockHeaderRange> blockHeadersFrom(Height height, uint32_t maxBlockHeaders) const = 0;
 	};
 }}
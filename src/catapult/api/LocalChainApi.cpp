@@ -54,6 +54,30 @@ namespace catapult { namespace api {
 				return thread::make_ready_future(std::move(hashes));
 			}
 
+			thread::future<model::HashRange> hashesAt(model::HeightRange&& heights) const override {
+				return thread::make_ready_future(m_storage.view().loadHashesAt(heights, m_maxHashes));
+			}
+
+			thread::future<model::BlockHeaderRange> blockHeadersFrom(Height height, uint32_t maxBlockHeaders) const override {
+				auto storageView = m_storage.view();
+				auto chainHeight = storageView.chainHeight();
+				if (Height(0) == height || chainHeight < height) {
+					auto exception = CreateHeightException("unable to get block headers from height", height);
+					return thread::make_exceptional_future<model::BlockHeaderRange>(exception);
+				}
+
+				auto numBlockHeaders = std::min<uint64_t>(maxBlockHeaders, (chainHeight - height).unwrap() + 1);
+
+				uint8_t* pRangeData;
+				auto headers = model::BlockHeaderRange::PrepareFixed(numBlockHeaders, &pRangeData);
+				for (auto i = 0u; i < numBlockHeaders; ++i) {
+					auto pBlock = storageView.loadBlock(height + Height(i));
+					std::memcpy(pRangeData + i * sizeof(model::BlockHeader), pBlock.get(), sizeof(model::BlockHeader));
+				}
+
+				return thread::make_ready_future(std::move(headers));
+			}
+
 		private:
 			const io::BlockStorageCache& m_storage;
 			model::ChainScoreSupplier m_chainScoreSupplier;
@@ -19,10 +19,11 @@
 **/
 
 #include "RemoteChainApi.h"
-#include "ChainPackets.h"
 #include "RemoteApiUtils.h"
 #include "RemoteRequestDispatcher.h"
+#include "catapult/ionet/ChainPackets.h"
 #include "catapult/ionet/PacketEntityUtils.h"
+#include "catapult/ionet/PacketPayloadFactory.h"
 
 namespace catapult { namespace api {
 
@@ -41,7 +42,7 @@ namespace catapult { namespace api {
 
 		public:
 			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
-				const auto* pResponse = ionet::CoercePacket<ChainInfoResponse>(&packet);
+				const auto* pResponse = ionet::CoercePacket<ionet::ChainInfoResponse>(&packet);
 				if (!pResponse)
 					return false;
 
@@ -58,7 +59,7 @@ namespace catapult { namespace api {
 			static constexpr auto FriendlyName() { return "hashes from"; }
 
 			static auto CreateRequestPacketPayload(Height height) {
-				auto pPacket = ionet::CreateSharedPacket<BlockHashesRequest>();
+				auto pPacket = ionet::CreateSharedPacket<ionet::BlockHashesRequest>();
 				pPacket->Height = height;
 				return ionet::PacketPayload(pPacket);
 			}
@@ -70,6 +71,23 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct HashesAtTraits {
+		public:
+			using ResultType = model::HashRange;
+			static constexpr auto PacketType() { return ionet::PacketType::Block_Hashes_At; }
+			static constexpr auto FriendlyName() { return "hashes at"; }
+
+			static auto CreateRequestPacketPayload(model::HeightRange&& heights) {
+				return ionet::PacketPayloadFactory::FromFixedSizeRange(PacketType(), std::move(heights));
+			}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractFixedSizeStructuresFromPacket<Hash256>(packet);
+				return !result.empty() || sizeof(ionet::PacketHeader) == packet.Size;
+			}
+		};
+
 		struct BlockAtTraits : public RegistryDependentTraits<model::Block> {
 		public:
 			using ResultType = std::shared_ptr<const model::Block>;
@@ -77,7 +95,7 @@ namespace catapult { namespace api {
 			static constexpr auto FriendlyName() { return "block at"; }
 
 			static auto CreateRequestPacketPayload(Height height) {
-				auto pPacket = ionet::CreateSharedPacket<PullBlockRequest>();
+				auto pPacket = ionet::CreateSharedPacket<ionet::PullBlockRequest>();
 				pPacket->Height = height;
 				return ionet::PacketPayload(pPacket);
 			}
@@ -98,7 +116,7 @@ namespace catapult { namespace api {
 			static constexpr auto FriendlyName() { return "blocks from"; }
 
 			static auto CreateRequestPacketPayload(Height height, const BlocksFromOptions& options) {
-				auto pPacket = ionet::CreateSharedPacket<PullBlocksRequest>();
+				auto pPacket = ionet::CreateSharedPacket<ionet::PullBlocksRequest>();
 				pPacket->Height = height;
 				pPacket->NumBlocks = options.NumBlocks;
 				pPacket->NumResponseBytes = options.NumBytes;
@@ -114,6 +132,26 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct BlockHeadersFromTraits {
+		public:
+			using ResultType = model::BlockHeaderRange;
+			static constexpr auto PacketType() { return ionet::PacketType::Pull_Block_Headers; }
+			static constexpr auto FriendlyName() { return "block headers from"; }
+
+			static auto CreateRequestPacketPayload(Height height, uint32_t maxBlockHeaders) {
+				auto pPacket = ionet::CreateSharedPacket<ionet::PullBlockHeadersRequest>();
+				pPacket->Height = height;
+				pPacket->NumBlockHeaders = maxBlockHeaders;
+				return ionet::PacketPayload(pPacket);
+			}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractFixedSizeStructuresFromPacket<model::BlockHeader>(packet);
+				return !result.empty() || sizeof(ionet::PacketHeader) == packet.Size;
+			}
+		};
+
 		// endregion
 
 		class DefaultRemoteChainApi : public RemoteChainApi {
@@ -136,6 +174,14 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(HashesFromTraits(), height);
 			}
 
+			FutureType<HashesAtTraits> hashesAt(model::HeightRange&& heights) const override {
+				return m_impl.dispatch(HashesAtTraits(), std::move(heights));
+			}
+
+			FutureType<BlockHeadersFromTraits> blockHeadersFrom(Height height, uint32_t maxBlockHeaders) const override {
+				return m_impl.dispatch(BlockHeadersFromTraits(), height, maxBlockHeaders);
+			}
+
 			FutureType<BlockAtTraits> blockLast() const override {
 				return m_impl.dispatch(BlockAtTraits(*m_pRegistry), Height(0));
 			}
@@ -23,6 +23,7 @@
 #include "RemoteRequestDispatcher.h"
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/ionet/TransactionPackets.h"
 
 namespace catapult { namespace api {
 
@@ -48,6 +49,44 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct UtReconciliationTraits : public RegistryDependentTraits<model::Transaction> {
+		public:
+			using ResultType = UnconfirmedTransactionsReconciliationResult;
+			static constexpr auto PacketType() { return ionet::PacketType::Pull_Transactions_Reconciliation; }
+			static constexpr auto FriendlyName() { return "reconcile unconfirmed transactions"; }
+
+			static auto CreateRequestPacketPayload(model::ShortHashIbltCellRange&& knownShortHashesIbltCells) {
+				return ionet::PacketPayloadFactory::FromFixedSizeRange(PacketType(), std::move(knownShortHashesIbltCells));
+			}
+
+		public:
+			using RegistryDependentTraits::RegistryDependentTraits;
+
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				constexpr auto Min_Size = sizeof(ionet::PacketHeader) + sizeof(ionet::PullTransactionsReconciliationResponseHeader);
+				if (packet.Size < Min_Size)
+					return false;
+
+				const auto& header = reinterpret_cast<const ionet::PullTransactionsReconciliationResponseHeader&>(*packet.Data());
+				result.IsDecoded = 0 != header.IsDecoded;
+				if (Min_Size == packet.Size)
+					return true;
+
+				// transactions are only expected when the set difference was decoded
+				if (!result.IsDecoded)
+					return false;
+
+				const auto* pData = packet.Data() + sizeof(ionet::PullTransactionsReconciliationResponseHeader);
+				auto dataSize = packet.Size - Min_Size;
+				auto offsets = ionet::ExtractEntityOffsets<model::Transaction>({ pData, dataSize }, *this);
+				if (offsets.empty())
+					return false;
+
+				result.Transactions = model::TransactionRange::CopyVariable(pData, dataSize, offsets);
+				return true;
+			}
+		};
+
 		// endregion
 
 		class DefaultRemoteTransactionApi : public RemoteTransactionApi {
@@ -66,6 +105,11 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(UtTraits(m_registry), std::move(knownShortHashes));
 			}
 
+			FutureType<UtReconciliationTraits> reconcileUnconfirmedTransactions(
+					model::ShortHashIbltCellRange&& knownShortHashesIbltCells) const override {
+				return m_impl.dispatch(UtReconciliationTraits(m_registry), std::move(knownShortHashesIbltCells));
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
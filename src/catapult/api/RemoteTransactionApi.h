@@ -26,6 +26,15 @@ namespace catapult { namespace ionet { class PacketIo; } }
 
 namespace catapult { namespace api {
 
+	/// Result of reconciling unconfirmed transactions with a remote node.
+	struct UnconfirmedTransactionsReconciliationResult {
+		/// \c true if the remote node was able to decode the short hashes set difference.
+		bool IsDecoded;
+
+		/// Unconfirmed transactions that are unknown to the local node.
+		model::TransactionRange Transactions;
+	};
+
 	/// An api for retrieving transaction information from a remote node.
 	class RemoteTransactionApi {
 	public:
@@ -34,6 +43,11 @@ namespace catapult { namespace api {
 	public:
 		/// Gets all unconfirmed transactions from the remote excluding those with hashes in \a knownShortHashes.
 		virtual thread::future<model::TransactionRange> unconfirmedTransactions(model::ShortHashRange&& knownShortHashes) const = 0;
+
+		/// Gets all unconfirmed transactions from the remote excluding those with short hashes in the set encoded by the
+		/// invertible bloom lookup table composed of \a knownShortHashesIbltCells.
+		virtual thread::future<UnconfirmedTransactionsReconciliationResult> reconcileUnconfirmedTransactions(
+				model::ShortHashIbltCellRange&& knownShortHashesIbltCells) const = 0;
 	};
 
 	/// Creates a transaction api for interacting with a remote node with the specified \a io
@@ -58,11 +58,19 @@ namespace catapult { namespace cache {
 			}
 
 			std::vector<model::TransactionInfo> removeAll() override {
-				auto transactionInfos = modifier().removeAll();
+				return removeAll(modifier().removeAll());
+			}
+
+			std::vector<model::TransactionInfo> prune(const predicate<const model::TransactionInfo&>& transactionInfoPredicate) override {
+				return removeAll(modifier().prune(transactionInfoPredicate));
+			}
+
+		private:
+			std::vector<model::TransactionInfo> removeAll(std::vector<model::TransactionInfo>&& transactionInfos) {
 				for (const auto& transactionInfo : transactionInfos)
 					remove(transactionInfo);
 
-				return transactionInfos;
+				return std::move(transactionInfos);
 			}
 		};
 
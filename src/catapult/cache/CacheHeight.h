@@ -19,7 +19,7 @@
 **/
 
 #pragma once
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ReaderWriterLock.h"
 #include "catapult/types.h"
 
 namespace catapult { namespace cache {
@@ -28,7 +28,7 @@ namespace catapult { namespace cache {
 	class CacheHeightView : public utils::MoveOnly {
 	public:
 		/// Creates a cache height view around \a height with lock context \a readLock.
-		explicit CacheHeightView(Height height, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+		explicit CacheHeightView(Height height, utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 				: m_height(height)
 				, m_readLock(std::move(readLock))
 		{}
@@ -41,14 +41,14 @@ namespace catapult { namespace cache {
 
 	private:
 		Height m_height;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// A write only view on top of a cache height.
 	class CacheHeightModifier : public utils::MoveOnly {
 	public:
 		/// Creates a write only view around \a height with lock context \a readLock.
-		explicit CacheHeightModifier(Height& height, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+		explicit CacheHeightModifier(Height& height, utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 				: m_height(height)
 				, m_readLock(std::move(readLock))
 				, m_writeLock(m_readLock.promoteToWriter())
@@ -62,8 +62,8 @@ namespace catapult { namespace cache {
 
 	private:
 		Height& m_height;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::WriterLockGuard m_writeLock;
 	};
 
 	/// A synchronized height associated with a catapult cache.
@@ -81,6 +81,6 @@ namespace catapult { namespace cache {
 
 	private:
 		Height m_height;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ReaderWriterLock m_lock;
 	};
 }}
@@ -27,6 +27,18 @@
 
 namespace catapult { namespace cache {
 
+	namespace {
+		utils::ShortHash CalculateCosignatureShortHash(const Hash256& entityHash, const Key& signer) {
+			// include the transaction hash so that cosignatures by the same signer of different transactions are distinct
+			Hash256 cosignatureHash;
+			crypto::Sha3_256_Builder builder;
+			builder.update(entityHash);
+			builder.update(signer);
+			builder.final(cosignatureHash);
+			return utils::ToShortHash(cosignatureHash);
+		}
+	}
+
 	class PtData {
 	public:
 		explicit PtData(const model::DetachedTransactionInfo& transactionInfo)
@@ -55,6 +67,10 @@ namespace catapult { namespace cache {
 			return m_cosignaturesHash;
 		}
 
+		const std::vector<utils::ShortHash>& cosignatureShortHashes() const {
+			return m_cosignatureShortHashes;
+		}
+
 		model::WeakCosignedTransactionInfo weakCosignedTransactionInfo() const {
 			return { transaction().get(), &m_cosignatures };
 		}
@@ -73,6 +89,8 @@ namespace catapult { namespace cache {
 			while (m_cosignatures.end() != iter && iter->Signer < signer)
 				++iter;
 
+			auto shortHashIter = m_cosignatureShortHashes.begin() + (iter - m_cosignatures.begin());
+			m_cosignatureShortHashes.insert(shortHashIter, CalculateCosignatureShortHash(entityHash(), signer));
 			m_cosignatures.insert(iter, { signer, signature });
 
 			// recalculate the cosignatures hash
@@ -86,6 +104,7 @@ namespace catapult { namespace cache {
 		model::DetachedTransactionInfo m_transactionInfo;
 		Hash256 m_cosignaturesHash;
 		std::vector<model::Cosignature> m_cosignatures; // sorted by signer so that sets of cosignatures added in different order match
+		std::vector<utils::ShortHash> m_cosignatureShortHashes; // parallel to m_cosignatures
 	};
 
 	// region MemoryPtCacheView
@@ -93,7 +112,7 @@ namespace catapult { namespace cache {
 	MemoryPtCacheView::MemoryPtCacheView(
 			uint64_t maxResponseSize,
 			const PtDataContainer& transactionDataContainer,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
 			, m_readLock(std::move(readLock))
@@ -156,6 +175,72 @@ namespace catapult { namespace cache {
 		return unknownTransactionInfos;
 	}
 
+	utils::ShortHashIblt MemoryPtCacheView::shortHashesIblt(size_t numCells) const {
+		utils::ShortHashIblt shortHashesIblt(numCells);
+		for (const auto& pair : m_transactionDataContainer) {
+			const auto& data = pair.second;
+			shortHashesIblt.insert(utils::ToShortHash(data.entityHash()));
+			for (auto cosignatureShortHash : data.cosignatureShortHashes())
+				shortHashesIblt.insert(cosignatureShortHash);
+		}
+
+		return shortHashesIblt;
+	}
+
+	bool MemoryPtCacheView::tryGetUnknownTransactions(
+			const utils::ShortHashIblt& knownShortHashesIblt,
+			UnknownTransactionInfos& transactionInfos) const {
+		auto shortHashesIblt = this->shortHashesIblt(knownShortHashesIblt.numCells());
+
+		// after subtracting the known short hashes, positive short hashes are only in this cache
+		std::vector<utils::ShortHash> unknownShortHashes;
+		std::vector<utils::ShortHash> missingShortHashes;
+		shortHashesIblt.subtract(knownShortHashesIblt);
+		if (!shortHashesIblt.decode(unknownShortHashes, missingShortHashes))
+			return false;
+
+		utils::ShortHashesSet unknownShortHashesSet(unknownShortHashes.cbegin(), unknownShortHashes.cend());
+		auto isUnknown = [&unknownShortHashesSet](auto shortHash) {
+			return unknownShortHashesSet.cend() != unknownShortHashesSet.find(shortHash);
+		};
+
+		uint64_t totalSize = 0;
+		transactionInfos.clear();
+		for (const auto& pair : m_transactionDataContainer) {
+			const auto& data = pair.second;
+			const auto& cosignatures = data.cosignatures();
+			const auto& cosignatureShortHashes = data.cosignatureShortHashes();
+
+			// only add unknown cosignatures
+			model::CosignedTransactionInfo transactionInfo;
+			for (auto i = 0u; i < cosignatures.size(); ++i) {
+				if (isUnknown(cosignatureShortHashes[i]))
+					transactionInfo.Cosignatures.push_back(cosignatures[i]);
+			}
+
+			auto isTransactionUnknown = isUnknown(utils::ToShortHash(data.entityHash()));
+			if (!isTransactionUnknown && transactionInfo.Cosignatures.empty())
+				continue;
+
+			auto entrySize = sizeof(Hash256) + sizeof(model::Cosignature) * transactionInfo.Cosignatures.size();
+			transactionInfo.EntityHash = data.entityHash();
+
+			// only add the transaction if it is unknown
+			if (isTransactionUnknown) {
+				transactionInfo.pTransaction = data.transaction();
+				entrySize += transactionInfo.pTransaction->Size;
+			}
+
+			totalSize += entrySize;
+			if (totalSize > m_maxResponseSize)
+				break;
+
+			transactionInfos.push_back(std::move(transactionInfo));
+		}
+
+		return true;
+	}
+
 	// endregion
 
 	// region MemoryPtCacheModifier
@@ -171,7 +256,7 @@ namespace catapult { namespace cache {
 					uint64_t maxCacheSize,
 					PtDataContainer& transactionDataContainer,
 					std::set<state::TimestampedHash>& timestampedHashes,
-					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+					utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_transactionDataContainer(transactionDataContainer)
 					, m_timestampedHashes(timestampedHashes)
@@ -255,8 +340,8 @@ namespace catapult { namespace cache {
 			uint64_t m_maxCacheSize;
 			PtDataContainer& m_transactionDataContainer;
 			std::set<state::TimestampedHash>& m_timestampedHashes;
-			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+			utils::ReaderWriterLock::ReaderLockGuard m_readLock;
+			utils::ReaderWriterLock::WriterLockGuard m_writeLock;
 		};
 	}
 
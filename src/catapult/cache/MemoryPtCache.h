@@ -26,7 +26,8 @@
 #include "catapult/model/CosignedTransactionInfo.h"
 #include "catapult/model/WeakCosignedTransactionInfo.h"
 #include "catapult/utils/Hashers.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ReaderWriterLock.h"
+#include "catapult/utils/ShortHashIblt.h"
 #include <unordered_map>
 
 namespace catapult { namespace cache { class PtData; } }
@@ -46,7 +47,7 @@ namespace catapult { namespace cache {
 		explicit MemoryPtCacheView(
 				uint64_t maxResponseSize,
 				const PtDataContainer& transactionDataContainer,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+				utils::ReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
 		/// Returns the number of partial transactions in the cache.
@@ -62,10 +63,21 @@ namespace catapult { namespace cache {
 		/// Gets a vector of all unknown transaction infos in the cache that do not have a short hash pair in \a knownShortHashPairs.
 		UnknownTransactionInfos unknownTransactions(const ShortHashPairMap& knownShortHashPairs) const;
 
+		/// Gets an invertible bloom lookup table with \a numCells cells composed of the short hashes of all transactions
+		/// and cosignatures in the cache.
+		utils::ShortHashIblt shortHashesIblt(size_t numCells) const;
+
+		/// Gets all transaction infos in the cache that contain a transaction or cosignature with a short hash that is not
+		/// in the set encoded by \a knownShortHashesIblt and stores them in \a transactionInfos.
+		/// Returns \c false if the short hashes set difference could not be decoded.
+		bool tryGetUnknownTransactions(
+				const utils::ShortHashIblt& knownShortHashesIblt,
+				UnknownTransactionInfos& transactionInfos) const;
+
 	private:
 		uint64_t m_maxResponseSize;
 		const PtDataContainer& m_transactionDataContainer;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// Cache for all partial transactions.
@@ -90,7 +102,7 @@ namespace catapult { namespace cache {
 	private:
 		MemoryCacheOptions m_options;
 		std::unique_ptr<Impl> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ReaderWriterLock m_lock;
 	};
 
 	/// A delegating proxy around a MemoryPtCache.
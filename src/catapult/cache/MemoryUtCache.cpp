@@ -22,40 +22,208 @@
 #include "AccountCounters.h"
 #include "CacheSizeLogger.h"
 #include "catapult/model/EntityInfo.h"
+#include "catapult/utils/ShortHashIblt.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_map>
 
 namespace catapult { namespace cache {
 
-	struct TransactionData : public model::TransactionInfo, public utils::NonCopyable {
+	// region TransactionDataContainer
+
+	struct TransactionData : public model::TransactionInfo {
 	public:
-		explicit TransactionData(const model::TransactionInfo& transactionInfo, size_t id)
-				: model::TransactionInfo(transactionInfo.copy())
-				, Id(id)
-		{}
+		TransactionData* pPrevious = nullptr;
+		TransactionData* pNext = nullptr;
+	};
+
+	/// Internal container wrapped by MemoryUtCache.
+	/// \note Transactions are stored in slab allocated nodes that are linked in insertion order,
+	///       so adding and removing transactions does not allocate after the cache has reached its high water mark.
+	class TransactionDataContainer : public utils::NonCopyable {
+	private:
+		static constexpr size_t Slab_Size = 1024;
+
+		using HashLookup = std::unordered_map<Hash256, TransactionData*, utils::ArrayHasher<Hash256>>;
+		using ShortHashLookup = std::unordered_multimap<utils::ShortHash, TransactionData*, utils::ShortHashHasher>;
 
-		explicit TransactionData(size_t id)
-				: model::TransactionInfo()
-				, Id(id)
+	public:
+		/// Creates an empty container.
+		TransactionDataContainer()
+				: m_pHead(nullptr)
+				, m_pTail(nullptr)
+				, m_pFreeHead(nullptr)
 		{}
 
 	public:
-		bool operator<(const TransactionData& rhs) const {
-			return Id < rhs.Id;
+		/// Gets the number of transactions in the container.
+		size_t size() const {
+			return m_hashLookup.size();
+		}
+
+		/// Returns \c true if the container is empty.
+		bool empty() const {
+			return m_hashLookup.empty();
+		}
+
+		/// Returns \c true if the container contains a transaction with \a hash.
+		bool contains(const Hash256& hash) const {
+			return m_hashLookup.cend() != m_hashLookup.find(hash);
+		}
+
+		/// Finds the transaction with \a shortHash or returns \c nullptr if no such transaction is contained.
+		/// \note When multiple transactions share \a shortHash, any one of them is returned.
+		const model::TransactionInfo* find(utils::ShortHash shortHash) const {
+			auto iter = m_shortHashLookup.find(shortHash);
+			return m_shortHashLookup.cend() == iter ? nullptr : iter->second;
+		}
+
+		/// Calls \a consumer with all transactions in insertion order until \c false is returned.
+		template<typename TConsumer>
+		void forEach(const TConsumer& consumer) const {
+			for (const auto* pData = m_pHead; pData; pData = pData->pNext) {
+				if (!consumer(static_cast<const model::TransactionInfo&>(*pData)))
+					return;
+			}
 		}
 
 	public:
-		size_t Id;
+		/// Inserts \a transactionInfo at the end of the container.
+		/// Returns \c false if a transaction with the same hash is already contained.
+		bool insert(const model::TransactionInfo& transactionInfo) {
+			if (contains(transactionInfo.EntityHash))
+				return false;
+
+			auto* pData = allocate();
+			static_cast<model::TransactionInfo&>(*pData) = transactionInfo.copy();
+			m_hashLookup.emplace(transactionInfo.EntityHash, pData);
+			m_shortHashLookup.emplace(utils::ToShortHash(transactionInfo.EntityHash), pData);
+			link(pData);
+			return true;
+		}
+
+		/// Removes the transaction with \a hash and returns it.
+		model::TransactionInfo erase(const Hash256& hash) {
+			auto iter = m_hashLookup.find(hash);
+			if (m_hashLookup.cend() == iter)
+				return model::TransactionInfo();
+
+			auto* pData = iter->second;
+			m_hashLookup.erase(iter);
+			eraseShortHash(pData);
+			return unlinkAndRelease(pData);
+		}
+
+		/// Removes all transactions for which \a predicate returns \c true and returns them in insertion order.
+		std::vector<model::TransactionInfo> eraseIf(const predicate<const model::TransactionInfo&>& predicate) {
+			std::vector<model::TransactionInfo> erasedInfos;
+			auto* pData = m_pHead;
+			while (pData) {
+				auto* pNext = pData->pNext;
+				if (predicate(*pData)) {
+					m_hashLookup.erase(pData->EntityHash);
+					eraseShortHash(pData);
+					erasedInfos.push_back(unlinkAndRelease(pData));
+				}
+
+				pData = pNext;
+			}
+
+			return erasedInfos;
+		}
+
+		/// Removes all transactions and returns them in insertion order.
+		std::vector<model::TransactionInfo> clear() {
+			std::vector<model::TransactionInfo> erasedInfos;
+			erasedInfos.reserve(size());
+			while (m_pHead)
+				erasedInfos.push_back(unlinkAndRelease(m_pHead));
+
+			m_hashLookup.clear();
+			m_shortHashLookup.clear();
+			return erasedInfos;
+		}
+
+	private:
+		TransactionData* allocate() {
+			if (!m_pFreeHead) {
+				m_slabs.push_back(std::make_unique<TransactionData[]>(Slab_Size));
+				for (auto i = 0u; i < Slab_Size; ++i) {
+					auto* pData = &m_slabs.back()[i];
+					pData->pNext = m_pFreeHead;
+					m_pFreeHead = pData;
+				}
+			}
+
+			auto* pData = m_pFreeHead;
+			m_pFreeHead = pData->pNext;
+			pData->pNext = nullptr;
+			return pData;
+		}
+
+		void release(TransactionData* pData) {
+			// release the entity eagerly because the node is only reused when a new transaction is added
+			static_cast<model::TransactionInfo&>(*pData) = model::TransactionInfo();
+			pData->pPrevious = nullptr;
+			pData->pNext = m_pFreeHead;
+			m_pFreeHead = pData;
+		}
+
+		void eraseShortHash(const TransactionData* pData) {
+			auto range = m_shortHashLookup.equal_range(utils::ToShortHash(pData->EntityHash));
+			for (auto iter = range.first; range.second != iter; ++iter) {
+				if (pData == iter->second) {
+					m_shortHashLookup.erase(iter);
+					return;
+				}
+			}
+		}
+
+		void link(TransactionData* pData) {
+			pData->pPrevious = m_pTail;
+			pData->pNext = nullptr;
+			if (m_pTail)
+				m_pTail->pNext = pData;
+			else
+				m_pHead = pData;
+
+			m_pTail = pData;
+		}
+
+		model::TransactionInfo unlinkAndRelease(TransactionData* pData) {
+			if (pData->pPrevious)
+				pData->pPrevious->pNext = pData->pNext;
+			else
+				m_pHead = pData->pNext;
+
+			if (pData->pNext)
+				pData->pNext->pPrevious = pData->pPrevious;
+			else
+				m_pTail = pData->pPrevious;
+
+			auto transactionInfo = std::move(static_cast<model::TransactionInfo&>(*pData));
+			release(pData);
+			return transactionInfo;
+		}
+
+	private:
+		std::vector<std::unique_ptr<TransactionData[]>> m_slabs;
+		HashLookup m_hashLookup;
+		ShortHashLookup m_shortHashLookup;
+		TransactionData* m_pHead;
+		TransactionData* m_pTail;
+		TransactionData* m_pFreeHead;
 	};
 
+	// endregion
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
-			const IdLookup& idLookup,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
-			, m_idLookup(idLookup)
 			, m_readLock(std::move(readLock))
 	{}
 
@@ -64,42 +232,87 @@ namespace catapult { namespace cache {
 	}
 
 	bool MemoryUtCacheView::contains(const Hash256& hash) const {
-		return m_idLookup.cend() != m_idLookup.find(hash);
+		return m_transactionDataContainer.contains(hash);
 	}
 
 	void MemoryUtCacheView::forEach(const TransactionInfoConsumer& consumer) const {
-		for (const auto& data : m_transactionDataContainer) {
-			if (!consumer(data))
-				return;
-		}
+		m_transactionDataContainer.forEach(consumer);
 	}
 
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashesIter = shortHashes.begin();
-		for (const auto& data : m_transactionDataContainer)
-			*shortHashesIter++ = utils::ToShortHash(data.EntityHash);
+		m_transactionDataContainer.forEach([&shortHashesIter](const auto& transactionInfo) {
+			*shortHashesIter++ = utils::ToShortHash(transactionInfo.EntityHash);
+			return true;
+		});
 
 		return shortHashes;
 	}
 
+	namespace {
+		template<typename TPredicate>
+		std::vector<std::shared_ptr<const model::Transaction>> CollectTransactions(
+				const TransactionDataContainer& transactionDataContainer,
+				uint64_t maxResponseSize,
+				TPredicate shouldInclude) {
+			uint64_t totalSize = 0;
+			std::vector<std::shared_ptr<const model::Transaction>> transactions;
+			transactionDataContainer.forEach([maxResponseSize, shouldInclude, &totalSize, &transactions](const auto& transactionInfo) {
+				if (shouldInclude(utils::ToShortHash(transactionInfo.EntityHash))) {
+					auto pTransaction = transactionInfo.pEntity;
+					totalSize += pTransaction->Size;
+					if (totalSize > maxResponseSize)
+						return false;
+
+					transactions.push_back(pTransaction);
+				}
+
+				return true;
+			});
+
+			return transactions;
+		}
+	}
+
 	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::unknownTransactions(const utils::ShortHashesSet& knownShortHashes) const {
-		uint64_t totalSize = 0;
-		UnknownTransactions transactions;
-		for (const auto& data : m_transactionDataContainer) {
-			auto shortHash = utils::ToShortHash(data.EntityHash);
-			auto iter = knownShortHashes.find(shortHash);
-			if (knownShortHashes.cend() == iter) {
-				auto pTransaction = data.pEntity;
-				totalSize += pTransaction->Size;
-				if (totalSize > m_maxResponseSize)
-					break;
-
-				transactions.push_back(pTransaction);
-			}
+		return CollectTransactions(m_transactionDataContainer, m_maxResponseSize, [&knownShortHashes](auto shortHash) {
+			return knownShortHashes.cend() == knownShortHashes.find(shortHash);
+		});
+	}
+
+	bool MemoryUtCacheView::tryGetUnknownTransactions(
+			const utils::ShortHashIblt& knownShortHashesIblt,
+			UnknownTransactions& transactions) const {
+		utils::ShortHashIblt shortHashesIblt(knownShortHashesIblt.numCells());
+		m_transactionDataContainer.forEach([&shortHashesIblt](const auto& transactionInfo) {
+			shortHashesIblt.insert(utils::ToShortHash(transactionInfo.EntityHash));
+			return true;
+		});
+
+		// after subtracting the known short hashes, positive short hashes are only in this cache
+		std::vector<utils::ShortHash> unknownShortHashes;
+		std::vector<utils::ShortHash> missingShortHashes;
+		shortHashesIblt.subtract(knownShortHashesIblt);
+		if (!shortHashesIblt.decode(unknownShortHashes, missingShortHashes))
+			return false;
+
+		utils::ShortHashesSet unknownShortHashesSet(unknownShortHashes.cbegin(), unknownShortHashes.cend());
+		transactions = CollectTransactions(m_transactionDataContainer, m_maxResponseSize, [&unknownShortHashesSet](auto shortHash) {
+			return unknownShortHashesSet.cend() != unknownShortHashesSet.find(shortHash);
+		});
+		return true;
+	}
+
+	std::vector<model::TransactionInfo> MemoryUtCacheView::transactionInfos(const std::vector<utils::ShortHash>& shortHashes) const {
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.reserve(shortHashes.size());
+		for (auto shortHash : shortHashes) {
+			const auto* pTransactionInfo = m_transactionDataContainer.find(shortHash);
+			transactionInfos.push_back(pTransactionInfo ? pTransactionInfo->copy() : model::TransactionInfo());
 		}
 
-		return transactions;
+		return transactionInfos;
 	}
 
 	// endregion
@@ -108,21 +321,14 @@ namespace catapult { namespace cache {
 
 	namespace {
 		class MemoryUtCacheModifier : public UtCacheModifier {
-		private:
-			using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
-
 		public:
 			explicit MemoryUtCacheModifier(
 					uint64_t maxCacheSize,
-					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
-					IdLookup& idLookup,
 					AccountCounters& counters,
-					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+					utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 					: m_maxCacheSize(maxCacheSize)
-					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
-					, m_idLookup(idLookup)
 					, m_counters(counters)
 					, m_readLock(std::move(readLock))
 					, m_writeLock(m_readLock.promoteToWriter())
@@ -137,12 +343,9 @@ namespace catapult { namespace cache {
 				if (m_maxCacheSize <= m_transactionDataContainer.size())
 					return false;
 
-				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
+				if (!m_transactionDataContainer.insert(transactionInfo))
 					return false;
 
-				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
-
 				m_counters.increment(transactionInfo.pEntity->Signer);
 
 				LogSizes("unconfirmed transactions", m_transactionDataContainer.size(), m_maxCacheSize);
@@ -150,17 +353,10 @@ namespace catapult { namespace cache {
 			}
 
 			model::TransactionInfo remove(const Hash256& hash) override {
-				auto iter = m_idLookup.find(hash);
-				if (m_idLookup.cend() == iter)
-					return model::TransactionInfo();
-
-				auto dataIter = m_transactionDataContainer.find(TransactionData(iter->second));
-				auto erasedInfo = dataIter->copy();
+				auto erasedInfo = m_transactionDataContainer.erase(hash);
+				if (erasedInfo)
+					m_counters.decrement(erasedInfo.pEntity->Signer);
 
-				m_counters.decrement(dataIter->pEntity->Signer);
-
-				m_transactionDataContainer.erase(dataIter);
-				m_idLookup.erase(iter);
 				return erasedInfo;
 			}
 
@@ -172,27 +368,24 @@ namespace catapult { namespace cache {
 				if (!m_transactionDataContainer.empty())
 					CATAPULT_LOG(debug) << "removing " << m_transactionDataContainer.size() << " elements from ut cache";
 
-				// unfortunately cannot just move m_transactionDataContainer because it contains a different (derived) type
-				std::vector<model::TransactionInfo> transactionInfosCopy;
-				transactionInfosCopy.reserve(m_transactionDataContainer.size());
+				m_counters.reset();
+				return m_transactionDataContainer.clear();
+			}
 
-				for (const auto& data : m_transactionDataContainer)
-					transactionInfosCopy.emplace_back(data.copy());
+			std::vector<model::TransactionInfo> prune(const predicate<const model::TransactionInfo&>& transactionInfoPredicate) override {
+				auto erasedInfos = m_transactionDataContainer.eraseIf(transactionInfoPredicate);
+				for (const auto& erasedInfo : erasedInfos)
+					m_counters.decrement(erasedInfo.pEntity->Signer);
 
-				m_transactionDataContainer.clear();
-				m_idLookup.clear();
-				m_counters.reset();
-				return transactionInfosCopy;
+				return erasedInfos;
 			}
 
 		private:
 			uint64_t m_maxCacheSize;
-			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
-			IdLookup& m_idLookup;
 			AccountCounters& m_counters;
-			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+			utils::ReaderWriterLock::ReaderLockGuard m_readLock;
+			utils::ReaderWriterLock::WriterLockGuard m_writeLock;
 		};
 	}
 
@@ -202,28 +395,24 @@ namespace catapult { namespace cache {
 
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
-		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
 		AccountCounters Counters;
 	};
 
 	MemoryUtCache::MemoryUtCache(const MemoryCacheOptions& options)
 			: m_options(options)
-			, m_idSequence(0)
 			, m_pImpl(std::make_unique<Impl>())
 	{}
 
 	MemoryUtCache::~MemoryUtCache() = default;
 
 	MemoryUtCacheView MemoryUtCache::view() const {
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, m_lock.acquireReader());
+		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_lock.acquireReader());
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
 		return UtCacheModifierProxy(std::make_unique<MemoryUtCacheModifier>(
 				m_options.MaxCacheSize,
-				m_idSequence,
 				m_pImpl->TransactionDataContainer,
-				m_pImpl->IdLookup,
 				m_pImpl->Counters,
 				m_lock.acquireReader()));
 	}
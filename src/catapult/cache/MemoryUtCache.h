@@ -23,34 +23,28 @@
 #include "MemoryCacheProxy.h"
 #include "UtCache.h"
 #include "catapult/model/RangeTypes.h"
-#include "catapult/utils/Hashers.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
-#include <set>
-#include <unordered_map>
+#include "catapult/utils/ReaderWriterLock.h"
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache { class TransactionDataContainer; }
+	namespace utils { class ShortHashIblt; }
+}
 
 namespace catapult { namespace cache {
 
-	/// Internal container wrapped by MemoryUtCache.
-	/// \note std::set is used to allow incomplete type.
-	using TransactionDataContainer = std::set<TransactionData>;
-
 	/// A read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
 		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
-		using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
 		using TransactionInfoConsumer = predicate<const model::TransactionInfo&>;
 
 	public:
-		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// Creates a view around a maximum response size (\a maxResponseSize) and a transaction data container
+		/// (\a transactionDataContainer) with lock context \a readLock.
 		explicit MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
-				const IdLookup& idLookup,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+				utils::ReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
 		/// Returns the number of unconfirmed transactions in the cache.
@@ -69,11 +63,20 @@ namespace catapult { namespace cache {
 		/// Gets a vector of all transactions in the cache that do not have a short hash in \a knownShortHashes.
 		UnknownTransactions unknownTransactions(const utils::ShortHashesSet& knownShortHashes) const;
 
+		/// Gets a vector of all transactions in the cache (\a transactions) that do not have a short hash in the set
+		/// encoded by \a knownShortHashesIblt.
+		/// Returns \c false if the short hashes set difference could not be decoded.
+		bool tryGetUnknownTransactions(const utils::ShortHashIblt& knownShortHashesIblt, UnknownTransactions& transactions) const;
+
+		/// Gets the transaction infos of all transactions in the cache with short hashes in \a shortHashes.
+		/// \note The returned infos are ordered like \a shortHashes and an empty info is returned for each unknown short hash.
+		///       When multiple transactions share a short hash, any one of them is returned.
+		std::vector<model::TransactionInfo> transactionInfos(const std::vector<utils::ShortHash>& shortHashes) const;
+
 	private:
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
-		const IdLookup& m_idLookup;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// Cache for all unconfirmed transactions.
@@ -97,9 +100,8 @@ namespace catapult { namespace cache {
 
 	private:
 		MemoryCacheOptions m_options;
-		size_t m_idSequence;
 		std::unique_ptr<Impl> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ReaderWriterLock m_lock;
 	};
 
 	/// A delegating proxy around a MemoryUtCache.
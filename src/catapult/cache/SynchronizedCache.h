@@ -20,7 +20,7 @@
 
 #pragma once
 #include "catapult/utils/NonCopyable.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ReaderWriterLock.h"
 #include <boost/optional.hpp>
 
 namespace catapult { namespace cache {
@@ -34,7 +34,7 @@ namespace catapult { namespace cache {
 		struct CacheViewReadLockPair {
 		public:
 			/// Creates a pair around \a cacheView and \a readLock.
-			CacheViewReadLockPair(TCacheView&& cacheView, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			CacheViewReadLockPair(TCacheView&& cacheView, utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 					: CacheView(std::move(cacheView))
 					, ReadLock(std::move(readLock))
 			{}
@@ -44,7 +44,7 @@ namespace catapult { namespace cache {
 			TCacheView CacheView;
 
 			/// Read lock.
-			utils::SpinReaderWriterLock::ReaderLockGuard ReadLock;
+			utils::ReaderWriterLock::ReaderLockGuard ReadLock;
 		};
 
 		// endregion
@@ -101,7 +101,7 @@ namespace catapult { namespace cache {
 	class LockedCacheView : public detail::CacheViewAccessor<TCacheView> {
 	public:
 		/// Creates a view around \a cacheView and \a readLock.
-		LockedCacheView(TCacheView&& cacheView, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+		LockedCacheView(TCacheView&& cacheView, utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 				: detail::CacheViewAccessor<TCacheView>(&m_cacheView)
 				, m_cacheView(std::move(cacheView))
 				, m_readLock(std::move(readLock))
@@ -117,7 +117,7 @@ namespace catapult { namespace cache {
 
 	private:
 		TCacheView m_cacheView;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	// endregion
@@ -151,13 +151,13 @@ namespace catapult { namespace cache {
 		{}
 
 		/// Creates a view around \a cacheView and \a pReadLock.
-		OptionalLockedCacheDelta(TCacheView& cacheView, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+		OptionalLockedCacheDelta(TCacheView& cacheView, utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 				: detail::CacheViewAccessor<TCacheView>(&cacheView)
 				, m_readLock(std::move(readLock))
 		{}
 
 	private:
-		boost::optional<utils::SpinReaderWriterLock::ReaderLockGuard> m_readLock;
+		boost::optional<utils::ReaderWriterLock::ReaderLockGuard> m_readLock;
 	};
 
 	// endregion
@@ -169,7 +169,7 @@ namespace catapult { namespace cache {
 	public:
 		/// Creates a lockable cache delta around \a cacheDelta using the specified \a lock
 		/// and commit counter (\a commitCounter).
-		LockableCacheDelta(TCacheDelta&& cacheDelta, const size_t& commitCounter, utils::SpinReaderWriterLock& lock)
+		LockableCacheDelta(TCacheDelta&& cacheDelta, const size_t& commitCounter, utils::ReaderWriterLock& lock)
 				: m_cacheDelta(std::move(cacheDelta))
 				, m_initialCommitCount(commitCounter)
 				, m_commitCounter(commitCounter)
@@ -190,7 +190,7 @@ namespace catapult { namespace cache {
 		TCacheDelta m_cacheDelta;
 		size_t m_initialCommitCount;
 		const size_t& m_commitCounter;
-		utils::SpinReaderWriterLock& m_lock;
+		utils::ReaderWriterLock& m_lock;
 	};
 
 	// endregion
@@ -258,7 +258,7 @@ namespace catapult { namespace cache {
 		TCache m_cache;
 		size_t m_commitCounter;
 		std::weak_ptr<detail::CacheViewReadLockPair<CacheDeltaType>> m_pWeakDeltaPair;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ReaderWriterLock m_lock;
 	};
 
 	// endregion
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "BasicTransactionsCache.h"
+#include "catapult/functions.h"
 #include <vector>
 
 namespace catapult { namespace cache {
@@ -32,6 +33,10 @@ namespace catapult { namespace cache {
 
 		/// Removes all transactions from the cache.
 		virtual std::vector<model::TransactionInfo> removeAll() = 0;
+
+		/// Removes all transactions for which \a transactionInfoPredicate returns \c true.
+		/// \note \a transactionInfoPredicate is called for all transactions in the order they were added to the cache.
+		virtual std::vector<model::TransactionInfo> prune(const predicate<const model::TransactionInfo&>& transactionInfoPredicate) = 0;
 	};
 
 	/// A delegating proxy around a UtCacheModifier.
@@ -50,6 +55,11 @@ namespace catapult { namespace cache {
 		std::vector<model::TransactionInfo> removeAll() {
 			return modifier().removeAll();
 		}
+
+		/// Removes all transactions for which \a transactionInfoPredicate returns \c true.
+		std::vector<model::TransactionInfo> prune(const predicate<const model::TransactionInfo&>& transactionInfoPredicate) {
+			return modifier().prune(transactionInfoPredicate);
+		}
 	};
 
 	/// An interface for caching unconfirmed transactions.
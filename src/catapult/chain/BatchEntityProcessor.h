@@ -32,5 +32,7 @@ namespace catapult { namespace chain {
 			const observers::ObserverState&)>;
 
 	/// Creates a batch entity processor around \a config.
+	/// \note Entities are processed serially in order because every notification is validated against the state observed
+	///       for all preceding notifications and that state can be keyed by anything (not only by account).
 	BatchEntityProcessor CreateBatchEntityProcessor(const ExecutionConfiguration& config);
 }}
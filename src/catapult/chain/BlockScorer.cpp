@@ -33,7 +33,7 @@ namespace catapult { namespace chain {
 			uint32_t NumLeadingZeros;
 		};
 
-		constexpr utils::TimeSpan TimeBetweenBlocks(const model::Block& parent, const model::Block& block) {
+		constexpr utils::TimeSpan TimeBetweenBlocks(const model::BlockHeader& parent, const model::BlockHeader& block) {
 			return utils::TimeSpan::FromDifference(block.Timestamp, parent.Timestamp);
 		}
 
@@ -96,7 +96,7 @@ namespace catapult { namespace chain {
 		return result.convert_to<uint64_t>();
 	}
 
-	uint64_t CalculateScore(const model::Block& parentBlock, const model::Block& currentBlock) {
+	uint64_t CalculateScore(const model::BlockHeader& parentBlock, const model::BlockHeader& currentBlock) {
 		if (currentBlock.Timestamp <= parentBlock.Timestamp)
 			return 0u;
 
@@ -24,7 +24,12 @@
 #include <boost/multiprecision/cpp_int.hpp>
 #include <functional>
 
-namespace catapult { namespace model { struct Block; } }
+namespace catapult {
+	namespace model {
+		struct Block;
+		struct BlockHeader;
+	}
+}
 
 namespace catapult { namespace chain {
 
@@ -34,7 +39,7 @@ namespace catapult { namespace chain {
 	uint64_t CalculateHit(const Hash256& generationHash);
 
 	/// Calculates the score of \a currentBlock with parent \a parentBlock.
-	uint64_t CalculateScore(const model::Block& parentBlock, const model::Block& currentBlock);
+	uint64_t CalculateScore(const model::BlockHeader& parentBlock, const model::BlockHeader& currentBlock);
 
 	/// Calculates the target from a time span (\a timeSpan), a \a difficulty and an effective signer importance
 	/// of \a signerImportance for the block chain described by \a config.
@@ -19,11 +19,17 @@
 **/
 
 #include "ChainSynchronizer.h"
+#include "BlockScorer.h"
+#include "ChainUtils.h"
 #include "CompareChains.h"
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/thread/FutureUtils.h"
+#include "catapult/utils/ExceptionLogging.h"
 #include "catapult/utils/SpinLock.h"
+#include <algorithm>
 #include <queue>
 
 namespace catapult { namespace chain {
@@ -217,6 +223,219 @@ namespace catapult { namespace chain {
 			});
 		}
 
+		// reorders block ranges that are pulled in parallel and forwards them contiguously to the unprocessed elements
+		class BlockChunkSequencer {
+		public:
+			BlockChunkSequencer(Height startHeight, size_t numChunks, UnprocessedElements& unprocessedElements)
+					: m_nextHeight(startHeight)
+					, m_unprocessedElements(unprocessedElements)
+					, m_chunks(numChunks)
+					, m_isChunkCompleted(numChunks, false)
+					, m_nextChunkIndex(0)
+					, m_numForwardedChunks(0)
+					, m_isBroken(false)
+					, m_hasFirstChunkFailed(false)
+			{}
+
+		public:
+			void complete(size_t index, model::BlockRange&& range) {
+				utils::SpinLockGuard guard(m_spinLock);
+				m_chunks[index] = std::move(range);
+				m_isChunkCompleted[index] = true;
+				forwardContiguousChunks();
+			}
+
+			void fail(size_t index) {
+				utils::SpinLockGuard guard(m_spinLock);
+				m_hasFirstChunkFailed = m_hasFirstChunkFailed || 0 == index;
+				m_isChunkCompleted[index] = true;
+				forwardContiguousChunks();
+			}
+
+			NodeInteractionResult result() {
+				utils::SpinLockGuard guard(m_spinLock);
+				if (0 != m_numForwardedChunks)
+					return NodeInteractionResult::Success;
+
+				return m_hasFirstChunkFailed ? NodeInteractionResult::Failure : NodeInteractionResult::Neutral;
+			}
+
+		private:
+			void forwardContiguousChunks() {
+				for (; m_nextChunkIndex < m_chunks.size() && m_isChunkCompleted[m_nextChunkIndex]; ++m_nextChunkIndex) {
+					auto range = std::move(m_chunks[m_nextChunkIndex]);
+					if (m_isBroken)
+						continue;
+
+					// once there is a gap or a chunk does not link to the previous chunk (because its source is on a different fork),
+					// all subsequent chunks are dropped and will be pulled again in a later round
+					if (!isNextChunk(range)) {
+						CATAPULT_LOG(debug)
+								<< "dropping block chunks starting at chunk " << m_nextChunkIndex
+								<< " (expected height " << m_nextHeight << ")";
+						m_isBroken = true;
+						continue;
+					}
+
+					const auto& lastBlock = *--range.cend();
+					auto endHeight = lastBlock.Height;
+					auto endHash = model::CalculateHash(lastBlock);
+					if (!m_unprocessedElements.add(std::move(range))) {
+						m_isBroken = true;
+						continue;
+					}
+
+					++m_numForwardedChunks;
+					m_nextHeight = endHeight + Height(1);
+					m_nextPreviousBlockHash = endHash;
+				}
+			}
+
+			bool isNextChunk(const model::BlockRange& range) const {
+				if (range.empty() || m_nextHeight != range.cbegin()->Height)
+					return false;
+
+				// the first chunk is pulled from the primary peer and is linked to the local chain by the consumers
+				return 0 == m_numForwardedChunks || m_nextPreviousBlockHash == range.cbegin()->PreviousBlockHash;
+			}
+
+		private:
+			utils::SpinLock m_spinLock;
+			Height m_nextHeight;
+			Hash256 m_nextPreviousBlockHash;
+			UnprocessedElements& m_unprocessedElements;
+			std::vector<model::BlockRange> m_chunks;
+			std::vector<bool> m_isChunkCompleted;
+			size_t m_nextChunkIndex;
+			size_t m_numForwardedChunks;
+			bool m_isBroken;
+			bool m_hasFirstChunkFailed;
+		};
+
+		struct ChunkSource {
+			/// Remote chain api.
+			const api::RemoteChainApi* pChainApi;
+
+			/// Height of the remote chain.
+			Height ChainHeight;
+		};
+
+		NodeInteractionFuture ParallelChainBlocksFrom(
+				const std::vector<ChunkSource>& chunkSources,
+				const api::BlocksFromOptions& options,
+				Height startHeight,
+				UnprocessedElements& unprocessedElements) {
+			// chunk i is pulled from source i, starts at startHeight + i * options.NumBlocks and ends at or before the source chain height
+			auto pSequencer = std::make_shared<BlockChunkSequencer>(startHeight, chunkSources.size(), unprocessedElements);
+
+			std::vector<thread::future<bool>> chunkFutures;
+			for (auto i = 0u; i < chunkSources.size(); ++i) {
+				const auto& chunkSource = chunkSources[i];
+				auto chunkHeight = startHeight + Height(i * options.NumBlocks);
+				auto chunkOptions = options;
+				chunkOptions.NumBlocks = static_cast<uint32_t>(
+						std::min<uint64_t>(options.NumBlocks, (chunkSource.ChainHeight - chunkHeight).unwrap() + 1));
+
+				auto blocksFuture = chunkSource.pChainApi->blocksFrom(chunkHeight, chunkOptions);
+				chunkFutures.push_back(blocksFuture.then([pSequencer, i](auto&& blocksFuture) {
+					try {
+						auto range = blocksFuture.get();
+						CATAPULT_LOG(info) << "peer returned " << range.size() << " blocks for chunk " << i;
+						pSequencer->complete(i, std::move(range));
+					} catch (...) {
+						// every chunk must be completed (even on unexpected errors) or all subsequent chunks are never forwarded
+						CATAPULT_LOG(warning)
+								<< "exception thrown while requesting blocks for chunk " << i << ": " << EXCEPTION_DIAGNOSTIC_MESSAGE();
+						pSequencer->fail(i);
+					}
+
+					return true;
+				}));
+			}
+
+			return thread::when_all(std::move(chunkFutures)).then([pSequencer](auto&&) {
+				return pSequencer->result();
+			});
+		}
+
+		// region block headers
+
+		struct BlockHeadersInfo {
+			/// \c true if the block headers form a valid chain part.
+			bool IsValid;
+
+			/// Score of the chain part (excluding the first block header).
+			model::ChainScore Score;
+
+			/// Number of block headers in the chain part (excluding the first block header).
+			uint32_t NumBlockHeaders;
+		};
+
+		// analyzes block headers starting with the common block header;
+		// when shouldVerify is set, the headers are checked for being properly linked and signed
+		BlockHeadersInfo AnalyzeBlockHeaders(const model::BlockHeaderRange& headers, bool shouldVerify) {
+			BlockHeadersInfo info{ !headers.empty(), model::ChainScore(), 0 };
+			if (!info.IsValid)
+				return info;
+
+			auto iter = headers.cbegin();
+			const auto* pParentHeader = &*iter;
+			for (++iter; headers.cend() != iter; ++iter) {
+				const auto& header = *iter;
+				if (shouldVerify) {
+					if (!IsChainLink(*pParentHeader, model::CalculateHash(*pParentHeader), header)) {
+						CATAPULT_LOG(warning) << "block header at height " << header.Height << " does not link to previous block header";
+						info.IsValid = false;
+						return info;
+					}
+
+					if (!model::VerifyBlockHeaderSignature(header)) {
+						CATAPULT_LOG(warning) << "block header at height " << header.Height << " has an invalid signature";
+						info.IsValid = false;
+						return info;
+					}
+				}
+
+				info.Score += model::ChainScore(CalculateScore(*pParentHeader, header));
+				++info.NumBlockHeaders;
+				pParentHeader = &header;
+			}
+
+			return info;
+		}
+
+		NodeInteractionResult CheckRemoteBlockHeaders(
+				const model::BlockHeaderRange& localHeaders,
+				const model::BlockHeaderRange& remoteHeaders,
+				uint32_t& numBlocks) {
+			// both ranges must start with the same common block header
+			if (localHeaders.empty() || remoteHeaders.empty()
+					|| model::CalculateHash(*localHeaders.cbegin()) != model::CalculateHash(*remoteHeaders.cbegin())) {
+				CATAPULT_LOG(warning) << "remote returned block headers not starting at the common block";
+				return NodeInteractionResult::Failure;
+			}
+
+			auto remoteInfo = AnalyzeBlockHeaders(remoteHeaders, true);
+			if (!remoteInfo.IsValid)
+				return NodeInteractionResult::Failure;
+
+			// the remote chain part would be rejected by the consumers if it does not have a better score
+			// than the local chain part that it replaces, so there is no need to pull its blocks
+			auto localInfo = AnalyzeBlockHeaders(localHeaders, false);
+			if (remoteInfo.Score <= localInfo.Score) {
+				CATAPULT_LOG(warning)
+						<< "remote chain part with " << remoteInfo.NumBlockHeaders << " block headers has score " << remoteInfo.Score
+						<< " not better than local chain part with " << localInfo.NumBlockHeaders
+						<< " block headers with score " << localInfo.Score;
+				return NodeInteractionResult::Failure;
+			}
+
+			numBlocks = remoteInfo.NumBlockHeaders;
+			return NodeInteractionResult::Success;
+		}
+
+		// endregion
+
 		class DefaultChainSynchronizer {
 		public:
 			using RemoteApiType = api::RemoteChainApi;
@@ -230,26 +449,30 @@ namespace catapult { namespace chain {
 					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
 					: m_pLocalChainApi(pLocalChainApi)
 					, m_compareChainOptions(config.MaxBlocksPerSyncAttempt, config.MaxRollbackBlocks)
+					, m_shouldSyncBlockHeadersFirst(config.ShouldSyncBlockHeadersFirst)
 					, m_blocksFromOptions(config.MaxRollbackBlocks, config.MaxChainBytesPerSyncAttempt)
+					, m_chunkBlocksFromOptions(
+							std::min(config.MaxRollbackBlocks, config.MaxBlocksPerSyncAttempt),
+							config.MaxChainBytesPerSyncAttempt)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
-							3 * config.MaxChainBytesPerSyncAttempt))
-			{}
+							3 * config.MaxChainBytesPerSyncAttempt)) {
+				m_compareChainOptions.ShouldSampleHashes = config.ShouldSampleChainHashes;
+			}
 
 		public:
-			NodeInteractionFuture operator()(const RemoteApiType& remoteChainApi) {
-				if (!m_pUnprocessedElements->shouldStartSync())
+			NodeInteractionFuture operator()(const std::vector<const RemoteApiType*>& remoteChainApis) {
+				if (remoteChainApis.empty() || !m_pUnprocessedElements->shouldStartSync())
 					return thread::make_ready_future(NodeInteractionResult::Neutral);
 
+				std::vector<thread::future<CompareChainsResult>> compareChainsFutures;
+				for (const auto* pRemoteChainApi : remoteChainApis)
+					compareChainsFutures.push_back(compareChains(*pRemoteChainApi));
+
 				auto syncFuture = thread::compose(
-						compareChains(remoteChainApi),
-						[this, &remoteChainApi](auto&& compareChainsFuture) {
-							try {
-								return this->syncWithPeer(remoteChainApi, compareChainsFuture.get());
-							} catch (const catapult_runtime_error& e) {
-								CATAPULT_LOG(warning) << "exception thrown while comparing chains: " << e.what();
-								return thread::make_ready_future(NodeInteractionResult::Failure);
-							}
+						thread::when_all(std::move(compareChainsFutures)),
+						[this, remoteChainApis](auto&& compareChainsFuture) {
+							return this->syncWithPeers(remoteChainApis, compareChainsFuture.get());
 						});
 				return thread::compose(
 						std::move(syncFuture),
@@ -267,14 +490,30 @@ namespace catapult { namespace chain {
 				if (m_pUnprocessedElements->empty())
 					return CompareChains(*m_pLocalChainApi, remoteChainApi, m_compareChainOptions);
 
-				CompareChainsResult result;
-				result.Code = ChainComparisonCode::Remote_Is_Not_Synced;
-				result.CommonBlockHeight = m_pUnprocessedElements->maxHeight();
-				result.ForkDepth = 0;
-				return thread::make_ready_future(std::move(result));
+				// the remote chain height is still needed in order to limit the pulled blocks
+				auto commonBlockHeight = m_pUnprocessedElements->maxHeight();
+				return remoteChainApi.chainInfo().then([commonBlockHeight](auto&& chainInfoFuture) {
+					CompareChainsResult result;
+					result.Code = ChainComparisonCode::Remote_Is_Not_Synced;
+					result.CommonBlockHeight = commonBlockHeight;
+					result.ForkDepth = 0;
+					result.RemoteChainHeight = chainInfoFuture.get().Height;
+					return result;
+				});
 			}
 
-			NodeInteractionFuture syncWithPeer(const RemoteApiType& remoteChainApi, const CompareChainsResult& compareResult) const {
+			NodeInteractionFuture syncWithPeers(
+					const std::vector<const RemoteApiType*>& remoteChainApis,
+					std::vector<thread::future<CompareChainsResult>>&& compareChainsFutures) const {
+				// the first peer is the primary peer that determines how the local chain is synchronized
+				CompareChainsResult compareResult;
+				try {
+					compareResult = compareChainsFutures[0].get();
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning) << "exception thrown while comparing chains: " << e.what();
+					return thread::make_ready_future(NodeInteractionResult::Failure);
+				}
+
 				switch (compareResult.Code) {
 				case ChainComparisonCode::Remote_Is_Not_Synced:
 					break;
@@ -287,30 +526,145 @@ namespace catapult { namespace chain {
 					return thread::make_ready_future(std::move(result));
 				}
 
+				// a fork must be resolved by a single peer, but a chain extension can be pulled in parallel from all peers
+				// that report the same chain
+				auto startHeight = compareResult.CommonBlockHeight + Height(1);
+				if (0 == compareResult.ForkDepth) {
+					auto chunkSources = SelectChunkSources(remoteChainApis, compareChainsFutures, compareResult, startHeight);
+					if (chunkSources.size() > 1) {
+						CATAPULT_LOG(debug)
+								<< "pulling blocks in parallel from " << chunkSources.size()
+								<< " remotes with common height " << compareResult.CommonBlockHeight;
+						return ParallelChainBlocksFrom(chunkSources, m_chunkBlocksFromOptions, startHeight, *m_pUnprocessedElements);
+					}
+				}
+
+				if (0 != compareResult.ForkDepth && m_shouldSyncBlockHeadersFirst)
+					return syncForkBlockHeadersFirst(*remoteChainApis[0], compareResult);
+
 				CATAPULT_LOG(debug)
 						<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
 						<< " (fork depth = " << compareResult.ForkDepth << ")";
 				return ChainBlocksFrom(
-						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
-						compareResult.CommonBlockHeight + Height(1),
+						CreateFutureSupplier(*remoteChainApis[0], m_blocksFromOptions),
+						startHeight,
 						compareResult.ForkDepth,
 						std::make_shared<RangeAggregator>(),
 						*m_pUnprocessedElements);
 			}
 
+			// pulls and checks the block headers of a remote fork so that its blocks are only pulled when the fork is better
+			// than the local chain part that it replaces
+			// (when the remote cannot supply block headers, the fork blocks are pulled without them)
+			NodeInteractionFuture syncForkBlockHeadersFirst(
+					const RemoteApiType& remoteChainApi,
+					const CompareChainsResult& compareResult) const {
+				// the common block header is requested from both chains so that the first fork block header can be linked and scored
+				auto commonHeight = compareResult.CommonBlockHeight;
+				auto numLocalBlockHeaders = static_cast<uint32_t>(compareResult.ForkDepth + 1);
+				auto numRemoteBlockHeaders = m_blocksFromOptions.NumBlocks + 1;
+
+				CATAPULT_LOG(debug)
+						<< "pulling block headers from remote with common height " << commonHeight
+						<< " (fork depth = " << compareResult.ForkDepth << ")";
+				auto headersFuture = thread::when_all(
+						m_pLocalChainApi->blockHeadersFrom(commonHeight, numLocalBlockHeaders),
+						remoteChainApi.blockHeadersFrom(commonHeight, numRemoteBlockHeaders));
+
+				auto blocksFromOptions = m_blocksFromOptions;
+				auto forkDepth = compareResult.ForkDepth;
+				auto pUnprocessedElements = m_pUnprocessedElements;
+				return thread::compose(
+						std::move(headersFuture),
+						[&remoteChainApi, commonHeight, blocksFromOptions, forkDepth, pUnprocessedElements](auto&& headersFutures) {
+							auto futures = headersFutures.get();
+							model::BlockHeaderRange localHeaders;
+							try {
+								localHeaders = futures[0].get();
+							} catch (const catapult_runtime_error& e) {
+								CATAPULT_LOG(warning) << "exception thrown while requesting local block headers: " << e.what();
+								return thread::make_ready_future(NodeInteractionResult::Failure);
+							}
+
+							model::BlockHeaderRange remoteHeaders;
+							try {
+								remoteHeaders = futures[1].get();
+							} catch (const catapult_runtime_error& e) {
+								CATAPULT_LOG(warning)
+										<< "exception thrown while requesting remote block headers, pulling fork blocks without them: "
+										<< e.what();
+								return ChainBlocksFrom(
+										CreateFutureSupplier(remoteChainApi, blocksFromOptions),
+										commonHeight + Height(1),
+										forkDepth,
+										std::make_shared<RangeAggregator>(),
+										*pUnprocessedElements);
+							}
+
+							uint32_t numBlocks = 0;
+							auto result = CheckRemoteBlockHeaders(localHeaders, remoteHeaders, numBlocks);
+							if (NodeInteractionResult::Success != result)
+								return thread::make_ready_future(std::move(result));
+
+							CATAPULT_LOG(debug) << "pulling " << numBlocks << " blocks with validated block headers from remote";
+							return ChainBlocksFrom(
+									CreateFutureSupplier(remoteChainApi, api::BlocksFromOptions(numBlocks, blocksFromOptions.NumBytes)),
+									commonHeight + Height(1),
+									numBlocks,
+									std::make_shared<RangeAggregator>(),
+									*pUnprocessedElements);
+						});
+			}
+
+			std::vector<ChunkSource> SelectChunkSources(
+					const std::vector<const RemoteApiType*>& remoteChainApis,
+					std::vector<thread::future<CompareChainsResult>>& compareChainsFutures,
+					const CompareChainsResult& primaryCompareResult,
+					Height startHeight) const {
+				std::vector<ChunkSource> chunkSources{ { remoteChainApis[0], primaryCompareResult.RemoteChainHeight } };
+				for (auto i = 1u; i < remoteChainApis.size(); ++i) {
+					try {
+						auto compareResult = compareChainsFutures[i].get();
+						if (ChainComparisonCode::Remote_Is_Not_Synced != compareResult.Code || 0 != compareResult.ForkDepth)
+							continue;
+
+						if (primaryCompareResult.CommonBlockHeight == compareResult.CommonBlockHeight)
+							chunkSources.push_back({ remoteChainApis[i], compareResult.RemoteChainHeight });
+					} catch (const catapult_runtime_error& e) {
+						CATAPULT_LOG(debug) << "bypassing peer " << i << " that failed chain comparison: " << e.what();
+					}
+				}
+
+				// assign later chunks to taller remotes and drop all chunks starting above the height of their remotes
+				std::stable_sort(chunkSources.begin(), chunkSources.end(), [](const auto& lhs, const auto& rhs) {
+					return lhs.ChainHeight > rhs.ChainHeight;
+				});
+
+				auto numChunks = 0u;
+				for (; numChunks < chunkSources.size(); ++numChunks) {
+					if (chunkSources[numChunks].ChainHeight < startHeight + Height(numChunks * m_chunkBlocksFromOptions.NumBlocks))
+						break;
+				}
+
+				chunkSources.resize(numChunks);
+				return chunkSources;
+			}
+
 		private:
 			std::shared_ptr<const api::ChainApi> m_pLocalChainApi;
 			CompareChainsOptions m_compareChainOptions;
+			bool m_shouldSyncBlockHeadersFirst;
 			api::BlocksFromOptions m_blocksFromOptions;
+			api::BlocksFromOptions m_chunkBlocksFromOptions;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
 		};
 	}
 
-	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+	MultiRemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
 		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(pLocalChainApi, config, blockRangeConsumer);
-		return CreateRemoteNodeSynchronizer(pSynchronizer);
+		return CreateMultiRemoteNodeSynchronizer(pSynchronizer);
 	}
 }}
@@ -51,11 +51,20 @@ namespace catapult { namespace chain {
 
 		/// Maximum number of blocks that can be rolled back.
 		uint32_t MaxRollbackBlocks;
+
+		/// \c true if the block headers of a fork should be pulled and checked before its blocks are pulled.
+		bool ShouldSyncBlockHeadersFirst;
+
+		/// \c true if chains should be compared by sampling block hashes at sparse heights.
+		bool ShouldSampleChainHashes;
 	};
 
 	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config and
 	/// a block range consumer (\a blockRangeConsumer).
-	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+	/// \note When the first remote extends the local chain, blocks are pulled in parallel from all remotes reporting the same chain.
+	///       When the first remote reports a fork and block headers should be synced first, the blocks of the fork are only pulled
+	///       after its block headers are found to form a linked, signed chain part with a better score than the local chain part.
+	MultiRemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
@@ -27,7 +27,7 @@
 
 namespace catapult { namespace chain {
 
-	bool IsChainLink(const model::Block& parent, const Hash256& parentHash, const model::Block& child) {
+	bool IsChainLink(const model::BlockHeader& parent, const Hash256& parentHash, const model::BlockHeader& child) {
 		if (parent.Height + Height(1) != child.Height || parentHash != child.PreviousBlockHash)
 			return false;
 
@@ -31,7 +31,7 @@ namespace catapult {
 namespace catapult { namespace chain {
 
 	/// Determines if \a parent with hash \a parentHash and \a child form a chain link.
-	bool IsChainLink(const model::Block& parent, const Hash256& parentHash, const model::Block& child);
+	bool IsChainLink(const model::BlockHeader& parent, const Hash256& parentHash, const model::BlockHeader& child);
 
 	/// Checks if the difficulties in \a blocks are consistent with the difficulties stored in \a cache
 	/// for the block chain described by \a config. If there is an inconsistency, the index of the first
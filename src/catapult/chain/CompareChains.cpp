@@ -22,6 +22,7 @@
 #include "catapult/model/BlockUtils.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/Casting.h"
+#include <algorithm>
 #include <iostream>
 
 namespace catapult { namespace chain {
@@ -30,12 +31,29 @@ namespace catapult { namespace chain {
 		constexpr auto Num_Comparison_Functions = 2;
 		constexpr auto Incomplete_Chain_Comparison_Code = static_cast<ChainComparisonCode>(-1);
 
+		std::vector<Height> CreateSampleHeights(Height startingHeight, Height localHeight) {
+			// sample the height following the local chain and exponentially spaced heights down to the starting height
+			std::vector<Height> heights{ localHeight + Height(1) };
+			auto maxDistance = (localHeight - startingHeight).unwrap();
+			for (uint64_t distance = 0; distance < maxDistance; distance = 2 * distance + 1)
+				heights.push_back(localHeight - Height(distance));
+
+			heights.push_back(startingHeight);
+			std::reverse(heights.begin(), heights.end());
+			return heights;
+		}
+
+		model::HeightRange CreateHeightRange(const std::vector<Height>& heights) {
+			return model::HeightRange::CopyFixed(reinterpret_cast<const uint8_t*>(heights.data()), heights.size());
+		}
+
 		class CompareChainsContext : public std::enable_shared_from_this<CompareChainsContext> {
 		public:
 			CompareChainsContext(const api::ChainApi& local, const api::ChainApi& remote, const CompareChainsOptions& options)
 					: m_local(local)
 					, m_remote(remote)
 					, m_options(options)
+					, m_isPromiseSatisfied(false)
 					, m_nextFunctionId(0) {
 				m_comparisonFunctions[0] = [](auto& context) { return context.compareChainInfos(); };
 				m_comparisonFunctions[1] = [](auto& context) { return context.compareHashes(); };
@@ -50,11 +68,16 @@ namespace catapult { namespace chain {
 
 		private:
 			void startNextCompare() {
-				m_comparisonFunctions[m_nextFunctionId++](*this).then([pThis = shared_from_this()](auto&& future) {
+				m_comparisonFunctions[m_nextFunctionId++](*this).on_complete([pThis = shared_from_this()](auto&& future) {
 					if (pThis->isFutureChainComplete(future))
 						return;
 
-					pThis->startNextCompare();
+					// continuation exceptions are not captured by on_complete, so forward them to the comparison result
+					try {
+						pThis->startNextCompare();
+					} catch (...) {
+						pThis->setException(std::current_exception());
+					}
 				});
 			}
 
@@ -66,16 +89,30 @@ namespace catapult { namespace chain {
 
 					auto forkDepth = (m_localHeight - m_commonBlockHeight).unwrap();
 					auto result = ChainComparisonCode::Remote_Is_Not_Synced == code
-							? CompareChainsResult{ code, m_commonBlockHeight, forkDepth }
-							: CompareChainsResult{ code, Height(static_cast<Height::ValueType>(-1)), 0 };
-					m_promise.set_value(std::move(result));
+							? CompareChainsResult{ code, m_commonBlockHeight, forkDepth, m_remoteChainHeight }
+							: CompareChainsResult{ code, Height(static_cast<Height::ValueType>(-1)), 0, Height(0) };
+					setValue(std::move(result));
 					return true;
 				} catch (...) {
-					m_promise.set_exception(std::current_exception());
+					setException(std::current_exception());
 					return true;
 				}
 			}
 
+			void setValue(CompareChainsResult&& result) {
+				m_isPromiseSatisfied = true;
+				m_promise.set_value(std::move(result));
+			}
+
+			void setException(std::exception_ptr pException) {
+				// an exception can be raised after the result has already been set (e.g. by an inline continuation)
+				if (m_isPromiseSatisfied)
+					return;
+
+				m_isPromiseSatisfied = true;
+				m_promise.set_exception(pException);
+			}
+
 			thread::future<ChainComparisonCode> compareChainInfos() {
 				return thread::when_all(m_local.chainInfo(), m_remote.chainInfo()).then([pThis = shared_from_this()](
 						auto&& aggregateFuture) {
@@ -97,6 +134,7 @@ namespace catapult { namespace chain {
 
 				if (remoteScore > localScore) {
 					m_localHeight = localInfo.Height;
+					m_remoteChainHeight = remoteInfo.Height;
 					return Incomplete_Chain_Comparison_Code;
 				}
 
@@ -115,16 +153,26 @@ namespace catapult { namespace chain {
 				auto startingHeight = Height(localHeight > m_options.MaxBlocksToRewrite
 						? localHeight - m_options.MaxBlocksToRewrite
 						: 1);
+
+				if (!m_options.ShouldSampleHashes)
+					return compareHashesFrom(startingHeight);
+
+				auto heights = CreateSampleHeights(startingHeight, m_localHeight);
+				m_localHeight = Height(0);
+				return compareHashesAt(std::move(heights));
+			}
+
+			thread::future<ChainComparisonCode> compareHashesFrom(Height startingHeight) {
 				return thread::when_all(m_local.hashesFrom(startingHeight), m_remote.hashesFrom(startingHeight))
 					.then([pThis = shared_from_this(), startingHeight](auto&& aggregateFuture) {
 						auto hashesFuture = aggregateFuture.get();
 						const auto& localHashes = hashesFuture[0].get();
 						const auto& remoteHashes = hashesFuture[1].get();
-						return pThis->compareHashes(startingHeight, localHashes, remoteHashes);
+						return pThis->compareHashesFrom(startingHeight, localHashes, remoteHashes);
 					});
 			}
 
-			ChainComparisonCode compareHashes(
+			ChainComparisonCode compareHashesFrom(
 					Height startingHeight,
 					const model::HashRange& localHashes,
 					const model::HashRange& remoteHashes) {
@@ -149,18 +197,99 @@ namespace catapult { namespace chain {
 				return ChainComparisonCode::Remote_Is_Not_Synced;
 			}
 
+			thread::future<ChainComparisonCode> compareHashesAt(std::vector<Height>&& heights) {
+				auto localHashesFuture = m_local.hashesAt(CreateHeightRange(heights));
+				auto remoteHashesFuture = m_remote.hashesAt(CreateHeightRange(heights));
+				auto aggregateFuture = thread::when_all(std::move(localHashesFuture), std::move(remoteHashesFuture));
+				return thread::compose(std::move(aggregateFuture), [pThis = shared_from_this(), heights = std::move(heights)](
+						auto&& completedAggregateFuture) {
+					auto hashesFuture = completedAggregateFuture.get();
+					const auto& localHashes = hashesFuture[0].get();
+					const auto& remoteHashes = hashesFuture[1].get();
+					auto code = pThis->compareHashesAt(heights, localHashes, remoteHashes);
+					if (Incomplete_Chain_Comparison_Code != code)
+						return thread::make_ready_future(std::move(code));
+
+					return pThis->compareHashesAt(pThis->createNarrowingHeights());
+				});
+			}
+
+			ChainComparisonCode compareHashesAt(
+					const std::vector<Height>& heights,
+					const model::HashRange& localHashes,
+					const model::HashRange& remoteHashes) {
+				// the remote can return at most one hash per requested height
+				if (remoteHashes.size() > heights.size())
+					return ChainComparisonCode::Remote_Returned_Too_Many_Hashes;
+
+				if (!localHashes.empty())
+					m_localHeight = std::max(m_localHeight, heights[std::min(localHashes.size(), heights.size()) - 1]);
+
+				if (!remoteHashes.empty())
+					m_remoteHeight = std::max(m_remoteHeight, heights[remoteHashes.size() - 1]);
+
+				// at least the starting height should be the same; if not, the remote is a liar or on a fork
+				auto firstDifferenceIndex = FindFirstDifferenceIndex(localHashes, remoteHashes);
+				if (0 == firstDifferenceIndex && Height(0) == m_commonBlockHeight)
+					return ChainComparisonCode::Remote_Is_Forked;
+
+				// heights are increasing, so the fork point is between the last matching and the first differing height
+				if (0 != firstDifferenceIndex)
+					m_commonBlockHeight = heights[firstDifferenceIndex - 1];
+
+				if (heights.size() != firstDifferenceIndex)
+					m_firstDifferenceHeight = heights[firstDifferenceIndex];
+
+				if (Height(0) == m_firstDifferenceHeight || m_commonBlockHeight + Height(1) != m_firstDifferenceHeight)
+					return Incomplete_Chain_Comparison_Code;
+
+				// if the remote has no blocks after the common block, the remote node lied because it can't have a higher score
+				if (m_remoteHeight <= m_commonBlockHeight)
+					return ChainComparisonCode::Remote_Lied_About_Chain_Score;
+
+				return ChainComparisonCode::Remote_Is_Not_Synced;
+			}
+
+			std::vector<Height> createNarrowingHeights() const {
+				std::vector<Height> heights;
+				auto maxHeights = std::max<uint64_t>(1, m_options.MaxBlocksToAnalyze);
+				if (Height(0) == m_firstDifferenceHeight) {
+					// all sampled hashes matched (the local chain grew), so continue with the heights following the last match
+					for (auto i = 1u; i <= maxHeights; ++i)
+						heights.push_back(m_commonBlockHeight + Height(i));
+
+					return heights;
+				}
+
+				// request the remaining range if it is small enough, otherwise request evenly spaced samples within it
+				auto distance = (m_firstDifferenceHeight - m_commonBlockHeight).unwrap();
+				if (distance - 1 <= maxHeights) {
+					for (auto i = 1u; i < distance; ++i)
+						heights.push_back(m_commonBlockHeight + Height(i));
+				} else {
+					for (auto i = 1u; i <= maxHeights; ++i)
+						heights.push_back(m_commonBlockHeight + Height(i * distance / (maxHeights + 1)));
+				}
+
+				return heights;
+			}
+
 		private:
 			const api::ChainApi& m_local;
 			const api::ChainApi& m_remote;
 			CompareChainsOptions m_options;
 			thread::promise<CompareChainsResult> m_promise;
+			bool m_isPromiseSatisfied;
 
 			using ComparisonFunction = thread::future<ChainComparisonCode> (*)(CompareChainsContext& context);
 			ComparisonFunction m_comparisonFunctions[Num_Comparison_Functions];
 			size_t m_nextFunctionId;
 
 			Height m_localHeight;
+			Height m_remoteChainHeight;
+			Height m_remoteHeight;
 			Height m_commonBlockHeight;
+			Height m_firstDifferenceHeight;
 		};
 	}
 
@@ -36,13 +36,18 @@ namespace catapult { namespace chain {
 		CompareChainsOptions(uint32_t maxBlocksToAnalyze, uint32_t maxBlocksToRewrite)
 				: MaxBlocksToAnalyze(maxBlocksToAnalyze)
 				, MaxBlocksToRewrite(maxBlocksToRewrite)
+				, ShouldSampleHashes(false)
 		{}
 
-		/// Maximum number of blocks to analyze.
+		/// Maximum number of block hashes to analyze in a single comparison round.
 		uint32_t MaxBlocksToAnalyze;
 
 		/// Maximum number of blocks to rewrite.
 		uint32_t MaxBlocksToRewrite;
+
+		/// \c true if hashes should be compared at sampled heights (via hashes-at requests)
+		/// instead of at consecutive heights (via hashes-from requests).
+		bool ShouldSampleHashes;
 	};
 
 	/// Result of a chain comparison operation.
@@ -55,6 +60,9 @@ namespace catapult { namespace chain {
 
 		/// Depth of the fork that needs to be resolved.
 		uint64_t ForkDepth;
+
+		/// Height of the remote chain as reported by the remote.
+		Height RemoteChainHeight;
 	};
 
 	/// Compares two chains (\a local and \a remote) with the specified \a options.
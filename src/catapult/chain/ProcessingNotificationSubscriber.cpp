@@ -23,18 +23,48 @@
 
 namespace catapult { namespace chain {
 
+	namespace {
+		class ObservingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			ObservingNotificationSubscriber(const observers::NotificationObserver& observer, const observers::ObserverContext& context)
+					: m_observer(observer)
+					, m_context(context)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				m_observer.notify(notification, m_context);
+			}
+
+		private:
+			const observers::NotificationObserver& m_observer;
+			const observers::ObserverContext& m_context;
+		};
+	}
+
 	ProcessingNotificationSubscriber::ProcessingNotificationSubscriber(
 			const validators::stateful::NotificationValidator& validator,
 			const validators::ValidatorContext& validatorContext,
 			const observers::NotificationObserver& observer,
 			const observers::ObserverContext& observerContext)
+			: ProcessingNotificationSubscriber(validator, validatorContext, observer, observerContext, m_ownedUndoBuffer)
+	{}
+
+	ProcessingNotificationSubscriber::ProcessingNotificationSubscriber(
+			const validators::stateful::NotificationValidator& validator,
+			const validators::ValidatorContext& validatorContext,
+			const observers::NotificationObserver& observer,
+			const observers::ObserverContext& observerContext,
+			model::NotificationBuffer& undoBuffer)
 			: m_validator(validator)
 			, m_validatorContext(validatorContext)
 			, m_observer(observer)
 			, m_observerContext(observerContext)
 			, m_aggregateResult(validators::ValidationResult::Success)
 			, m_isUndoEnabled(false)
-	{}
+			, m_undoBuffer(undoBuffer) {
+		m_undoBuffer.clear();
+	}
 
 	validators::ValidationResult ProcessingNotificationSubscriber::result() const {
 		return m_aggregateResult;
@@ -56,12 +86,9 @@ namespace catapult { namespace chain {
 				m_observerContext.State,
 				m_observerContext.Height,
 				undoMode);
-		for (auto iter = m_notificationBuffers.crbegin(); m_notificationBuffers.crend() != iter; ++iter) {
-			const auto* pNotification = reinterpret_cast<const model::Notification*>(iter->data());
-			m_observer.notify(*pNotification, undoObserverContext);
-		}
-
-		m_notificationBuffers.clear();
+		ObservingNotificationSubscriber undoSub(m_observer, undoObserverContext);
+		m_undoBuffer.replayReverse(undoSub);
+		m_undoBuffer.clear();
 	}
 
 	void ProcessingNotificationSubscriber::notify(const model::Notification& notification) {
@@ -95,8 +122,7 @@ namespace catapult { namespace chain {
 		if (!m_isUndoEnabled)
 			return;
 
-		// store a copy of the notification buffer
-		const auto* pData = reinterpret_cast<const uint8_t*>(&notification);
-		m_notificationBuffers.emplace_back(pData, pData + notification.Size);
+		// store a copy of the notification in the (reusable) undo buffer
+		m_undoBuffer.notify(notification);
 	}
 }}
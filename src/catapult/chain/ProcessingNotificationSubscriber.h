@@ -19,7 +19,7 @@
 **/
 
 #pragma once
-#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/NotificationBuffer.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/validators/ValidatorContext.h"
 #include "catapult/validators/ValidatorTypes.h"
@@ -36,6 +36,16 @@ namespace catapult { namespace chain {
 				const observers::NotificationObserver& observer,
 				const observers::ObserverContext& observerContext);
 
+		/// Creates a subscriber around \a validator, \a validatorContext, \a observer, and \a observerContext
+		/// that stores notifications that can be undone in a reusable \a undoBuffer.
+		/// \note Any notifications in \a undoBuffer are discarded.
+		ProcessingNotificationSubscriber(
+				const validators::stateful::NotificationValidator& validator,
+				const validators::ValidatorContext& validatorContext,
+				const observers::NotificationObserver& observer,
+				const observers::ObserverContext& observerContext,
+				model::NotificationBuffer& undoBuffer);
+
 	public:
 		/// Gets the aggregate result of processed notifications.
 		validators::ValidationResult result() const;
@@ -62,6 +72,7 @@ namespace catapult { namespace chain {
 
 		validators::ValidationResult m_aggregateResult;
 		bool m_isUndoEnabled;
-		std::vector<std::vector<uint8_t>> m_notificationBuffers;
+		model::NotificationBuffer m_ownedUndoBuffer;
+		model::NotificationBuffer& m_undoBuffer;
 	};
 }}
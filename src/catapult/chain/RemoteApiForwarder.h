@@ -23,9 +23,11 @@
 #include "catapult/model/TransactionPlugin.h"
 #include "catapult/net/PacketIoPicker.h"
 #include "catapult/thread/Future.h"
+#include "catapult/utils/ArraySet.h"
 #include "catapult/utils/MemoryUtils.h"
 #include "catapult/utils/ThrottleLogger.h"
 #include "catapult/utils/TimeSpan.h"
+#include <vector>
 
 namespace catapult { namespace chain {
 
@@ -68,6 +70,49 @@ namespace catapult { namespace chain {
 			});
 		}
 
+		/// Picks up to \a maxPeers random distinct peers, wraps an api around each using \a apiFactory,
+		/// and then passes all apis to \a action.
+		template<typename TRemoteApiAction, typename TRemoteApiFactory>
+		thread::future<NodeInteractionResult> processSync(TRemoteApiAction action, TRemoteApiFactory apiFactory, size_t maxPeers) const {
+			using RemoteApiPointer = decltype(apiFactory(std::declval<ionet::PacketIo&>(), m_transactionRegistry));
+			using RemoteApiType = typename RemoteApiPointer::element_type;
+
+			utils::KeySet identityKeys;
+			std::vector<ionet::NodePacketIoPair> packetIoPairs;
+			for (auto i = 0u; i < maxPeers; ++i) {
+				auto packetIoPair = m_packetIoPicker.pickOne(m_timeout);
+				if (!packetIoPair)
+					break;
+
+				// multiplexed writers can be picked repeatedly, but each peer should only be used once per operation
+				if (!identityKeys.insert(packetIoPair.node().identityKey()).second)
+					continue;
+
+				packetIoPairs.push_back(packetIoPair);
+			}
+
+			if (packetIoPairs.empty()) {
+				CATAPULT_LOG_THROTTLE(warning, 60'000) << "no packet io available for operation '" << m_operationName << "'";
+				return thread::make_ready_future(NodeInteractionResult::None);
+			}
+
+			// pass in a non-owning pointer to the registry
+			auto pRemoteApis = std::make_shared<std::vector<std::shared_ptr<RemoteApiType>>>();
+			std::vector<const RemoteApiType*> remoteApis;
+			for (const auto& packetIoPair : packetIoPairs) {
+				pRemoteApis->push_back(utils::UniqueToShared(apiFactory(*packetIoPair.io(), m_transactionRegistry)));
+				remoteApis.push_back(pRemoteApis->back().get());
+			}
+
+			// extend the lifetimes of pRemoteApis and packetIoPairs until the completion of the action
+			return action(remoteApis).then([pRemoteApis, packetIoPairs, operationName = m_operationName](auto&& resultFuture) {
+				auto result = resultFuture.get();
+				CATAPULT_LOG_LEVEL(NodeInteractionResult::Neutral == result ? utils::LogLevel::Trace : utils::LogLevel::Info)
+						<< "completed '" << operationName << "' (" << packetIoPairs.size() << " peers) with result " << result;
+				return result;
+			});
+		}
+
 	private:
 		net::PacketIoPicker& m_packetIoPicker;
 		const model::TransactionRegistry& m_transactionRegistry;
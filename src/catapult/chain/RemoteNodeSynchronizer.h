@@ -22,6 +22,7 @@
 #include "NodeInteractionResult.h"
 #include "catapult/thread/FutureUtils.h"
 #include <functional>
+#include <vector>
 
 namespace catapult { namespace chain {
 
@@ -29,6 +30,10 @@ namespace catapult { namespace chain {
 	template<typename TRemoteApi>
 	using RemoteNodeSynchronizer = std::function<thread::future<NodeInteractionResult> (const TRemoteApi&)>;
 
+	/// Function signature for synchronizing with multiple remote nodes at once.
+	template<typename TRemoteApi>
+	using MultiRemoteNodeSynchronizer = std::function<thread::future<NodeInteractionResult> (const std::vector<const TRemoteApi*>&)>;
+
 	/// Creates a remote node synchronizer around \a pSynchronizer.
 	template<typename TSynchronizer>
 	RemoteNodeSynchronizer<typename TSynchronizer::RemoteApiType> CreateRemoteNodeSynchronizer(
@@ -41,4 +46,17 @@ namespace catapult { namespace chain {
 			});
 		};
 	}
+
+	/// Creates a multi remote node synchronizer around \a pSynchronizer.
+	template<typename TSynchronizer>
+	MultiRemoteNodeSynchronizer<typename TSynchronizer::RemoteApiType> CreateMultiRemoteNodeSynchronizer(
+			const std::shared_ptr<TSynchronizer>& pSynchronizer) {
+		return [pSynchronizer](const auto& remoteApis) {
+			// pSynchronizer is captured in the second lambda to compose, which extends its lifetime until
+			// the async operation is complete
+			return thread::compose(pSynchronizer->operator()(remoteApis), [pSynchronizer](auto&& future) {
+				return std::move(future);
+			});
+		};
+	}
 }}
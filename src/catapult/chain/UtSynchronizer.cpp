@@ -25,6 +25,15 @@
 namespace catapult { namespace chain {
 
 	namespace {
+		model::ShortHashIbltCellRange CreateShortHashesIbltCells(const model::ShortHashRange& shortHashes, size_t numCells) {
+			utils::ShortHashIblt shortHashesIblt(numCells);
+			for (auto shortHash : shortHashes)
+				shortHashesIblt.insert(shortHash);
+
+			const auto& cells = shortHashesIblt.cells();
+			return model::ShortHashIbltCellRange::CopyFixed(reinterpret_cast<const uint8_t*>(cells.data()), cells.size());
+		}
+
 		struct UtTraits {
 		public:
 			using RemoteApiType = api::RemoteTransactionApi;
@@ -33,22 +42,49 @@ namespace catapult { namespace chain {
 		public:
 			explicit UtTraits(
 					const ShortHashesSupplier& shortHashesSupplier,
+					uint32_t maxReconciliationDifference,
 					const handlers::TransactionRangeHandler& transactionRangeConsumer)
 					: m_shortHashesSupplier(shortHashesSupplier)
+					, m_numReconciliationCells(0 == maxReconciliationDifference
+							? 0
+							: utils::ShortHashIblt::CalculateNumCells(maxReconciliationDifference))
 					, m_transactionRangeConsumer(transactionRangeConsumer)
 			{}
 
 		public:
 			thread::future<model::TransactionRange> apiCall(const RemoteApiType& api) const {
-				return api.unconfirmedTransactions(m_shortHashesSupplier());
+				auto shortHashes = m_shortHashesSupplier();
+				if (!shouldReconcile(shortHashes.size()))
+					return api.unconfirmedTransactions(std::move(shortHashes));
+
+				auto shortHashesIbltCells = CreateShortHashesIbltCells(shortHashes, m_numReconciliationCells);
+				auto pShortHashes = std::make_shared<model::ShortHashRange>(std::move(shortHashes));
+				return thread::compose(
+						api.reconcileUnconfirmedTransactions(std::move(shortHashesIbltCells)),
+						[&api, pShortHashes](auto&& reconciliationFuture) {
+							auto result = reconciliationFuture.get();
+							if (result.IsDecoded)
+								return thread::make_ready_future(std::move(result.Transactions));
+
+							CATAPULT_LOG(debug) << "falling back to pulling unconfirmed transactions with all short hashes";
+							return api.unconfirmedTransactions(std::move(*pShortHashes));
+						});
 			}
 
 			void consume(model::TransactionRange&& range) const {
 				m_transactionRangeConsumer(std::move(range));
 			}
 
+		private:
+			bool shouldReconcile(size_t numShortHashes) const {
+				// only reconcile when the table is smaller than the short hashes it replaces
+				return 0 != m_numReconciliationCells
+						&& m_numReconciliationCells * sizeof(utils::ShortHashIbltCell) < numShortHashes * sizeof(utils::ShortHash);
+			}
+
 		private:
 			ShortHashesSupplier m_shortHashesSupplier;
+			size_t m_numReconciliationCells;
 			handlers::TransactionRangeHandler m_transactionRangeConsumer;
 		};
 	}
@@ -56,7 +92,14 @@ namespace catapult { namespace chain {
 	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
 			const ShortHashesSupplier& shortHashesSupplier,
 			const handlers::TransactionRangeHandler& transactionRangeConsumer) {
-		auto traits = UtTraits(shortHashesSupplier, transactionRangeConsumer);
+		return CreateUtSynchronizer(shortHashesSupplier, 0, transactionRangeConsumer);
+	}
+
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
+			const ShortHashesSupplier& shortHashesSupplier,
+			uint32_t maxReconciliationDifference,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer) {
+		auto traits = UtTraits(shortHashesSupplier, maxReconciliationDifference, transactionRangeConsumer);
 		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<UtTraits>>(std::move(traits));
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
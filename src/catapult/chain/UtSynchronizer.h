@@ -35,4 +35,13 @@ namespace catapult { namespace chain {
 	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
 			const ShortHashesSupplier& shortHashesSupplier,
 			const handlers::TransactionRangeHandler& transactionRangeConsumer);
+
+	/// Creates an unconfirmed transactions synchronizer around the specified short hashes supplier (\a shortHashesSupplier)
+	/// and transaction range consumer (\a transactionRangeConsumer) that reconciles short hashes with remote nodes
+	/// using tables sized for set differences of up to \a maxReconciliationDifference short hashes.
+	/// \note When the remote node is unable to decode the set difference, all short hashes are sent instead.
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
+			const ShortHashesSupplier& shortHashesSupplier,
+			uint32_t maxReconciliationDifference,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer);
 }}
@@ -49,13 +49,15 @@ namespace catapult { namespace chain {
 				const ExecutionConfiguration& config,
 				const TimeSupplier& timeSupplier,
 				const FailedTransactionSink& failedTransactionSink,
-				const Throttle& throttle)
+				const Throttle& throttle,
+				ChainUpdateMode chainUpdateMode)
 				: m_transactionsCache(transactionsCache)
 				, m_detachedCatapultCache(confirmedCatapultCache)
 				, m_config(config)
 				, m_timeSupplier(timeSupplier)
 				, m_failedTransactionSink(failedTransactionSink)
 				, m_throttle(throttle)
+				, m_chainUpdateMode(chainUpdateMode)
 		{}
 
 	public:
@@ -84,15 +86,28 @@ namespace catapult { namespace chain {
 			// 1. lock the catapult cache and rebase the unconfirmed catapult cache
 			auto pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
 
-			// 2. lock and clear the UT cache
+			// 2. lock the UT cache
 			auto modifier = m_transactionsCache.modifier();
+			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
+
+			// reverted txes need to be applied before all original txes, so incremental updates are only possible in their absence
+			if (ChainUpdateMode::Incremental == m_chainUpdateMode && utInfos.empty()) {
+				// 3. remove confirmed txes
+				for (const auto* pHash : confirmedTransactionHashes)
+					modifier.remove(*pHash);
+
+				// 4. reapply remaining original txes in place
+				reapply(applyState);
+				return;
+			}
+
+			// 3. clear the UT cache
 			auto originalTransactionInfos = modifier.removeAll();
 
-			// 3. add back reverted txes
-			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
+			// 4. add back reverted txes
 			apply(applyState, utInfos, TransactionSource::Reverted);
 
-			// 4. add back original txes that have not been confirmed
+			// 5. add back original txes that have not been confirmed
 			apply(applyState, originalTransactionInfos, TransactionSource::Existing, [&confirmedTransactionHashes](const auto& info) {
 				return confirmedTransactionHashes.cend() == confirmedTransactionHashes.find(&info.EntityHash);
 			});
@@ -108,6 +123,47 @@ namespace catapult { namespace chain {
 				const std::vector<model::TransactionInfo>& utInfos,
 				TransactionSource transactionSource,
 				const predicate<const model::TransactionInfo&>& filter) {
+			execute(applyState, [this, &applyState, &utInfos, transactionSource, &filter](
+					auto& readOnlyCache,
+					const auto& validatorContext,
+					auto& observerContext) {
+				for (const auto& utInfo : utInfos) {
+					const auto& entity = *utInfo.pEntity;
+					const auto& entityHash = utInfo.EntityHash;
+
+					if (!filter(utInfo))
+						continue;
+
+					if (this->throttle(utInfo, transactionSource, applyState, readOnlyCache)) {
+						CATAPULT_LOG(warning) << "dropping transaction " << utils::HexFormat(entityHash) << " due to throttle";
+						m_failedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+						continue;
+					}
+
+					// in incremental mode, txes are reapplied after every block, so their notifications are cached with them
+					auto cachedUtInfo = this->prepareForCache(utInfo);
+					if (!applyState.Modifier.add(cachedUtInfo))
+						continue;
+
+					if (!this->process(cachedUtInfo, validatorContext, observerContext))
+						applyState.Modifier.remove(entityHash);
+				}
+			});
+		}
+
+		void reapply(const ApplyState& applyState) {
+			// existing txes are not throttled because they are already contained in the cache
+			// notice that all txes are revalidated because their validity can depend on the chain height and on state
+			// that is not keyed by account (e.g. namespaces, mosaics and locks), which can be changed by any block
+			execute(applyState, [this, &applyState](const auto&, const auto& validatorContext, auto& observerContext) {
+				applyState.Modifier.prune([this, &validatorContext, &observerContext](const auto& utInfo) {
+					return !this->process(utInfo, validatorContext, observerContext);
+				});
+			});
+		}
+
+		template<typename TAction>
+		void execute(const ApplyState& applyState, TAction action) {
 			auto currentTime = m_timeSupplier();
 
 			auto readOnlyCache = applyState.UnconfirmedCatapultCache.toReadOnly();
@@ -121,40 +177,51 @@ namespace catapult { namespace chain {
 			auto& cache = applyState.UnconfirmedCatapultCache;
 			state::CatapultState dummyState;
 			auto observerContext = observers::ObserverContext(cache, dummyState, effectiveHeight, observers::NotifyMode::Commit);
-			for (const auto& utInfo : utInfos) {
-				const auto& entity = *utInfo.pEntity;
-				const auto& entityHash = utInfo.EntityHash;
+			action(readOnlyCache, validatorContext, observerContext);
+		}
 
-				if (!filter(utInfo))
-					continue;
+		bool process(
+				const model::TransactionInfo& utInfo,
+				const validators::ValidatorContext& validatorContext,
+				observers::ObserverContext& observerContext) {
+			const auto& entity = *utInfo.pEntity;
+			const auto& entityHash = utInfo.EntityHash;
 
-				if (throttle(utInfo, transactionSource, applyState, readOnlyCache)) {
-					CATAPULT_LOG(warning) << "dropping transaction " << utils::HexFormat(entityHash) << " due to throttle";
-					m_failedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
-					continue;
-				}
+			// notice that subscriber is created per transaction because aggregate result needs to be reset each time
+			// but undo buffer is reused across transactions (all processing is serialized by the ut cache modifier)
+			ProcessingNotificationSubscriber sub(
+					*m_config.pValidator,
+					validatorContext,
+					*m_config.pObserver,
+					observerContext,
+					m_undoBuffer);
+			sub.enableUndo();
+			auto entityInfo = model::WeakEntityInfo(entity, entityHash, utInfo.OptionalNotifications.get());
+			m_config.pNotificationPublisher->publish(entityInfo, sub);
+			if (IsValidationResultSuccess(sub.result()))
+				return true;
 
-				if (!applyState.Modifier.add(utInfo))
-					continue;
-
-				// notice that subscriber is created within loop because aggregate result needs to be reset each iteration
-				ProcessingNotificationSubscriber sub(*m_config.pValidator, validatorContext, *m_config.pObserver, observerContext);
-				sub.enableUndo();
-				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
-				m_config.pNotificationPublisher->publish(entityInfo, sub);
-				if (!IsValidationResultSuccess(sub.result())) {
-					CATAPULT_LOG_LEVEL(validators::MapToLogLevel(sub.result()))
-							<< "dropping transaction " << utils::HexFormat(entityHash) << ": " << sub.result();
-
-					// only forward failure (not neutral) results
-					if (IsValidationResultFailure(sub.result()))
-						m_failedTransactionSink(entity, entityHash, sub.result());
-
-					sub.undo();
-					applyState.Modifier.remove(entityHash);
-					continue;
-				}
+			CATAPULT_LOG_LEVEL(validators::MapToLogLevel(sub.result()))
+					<< "dropping transaction " << utils::HexFormat(entityHash) << ": " << sub.result();
+
+			// only forward failure (not neutral) results
+			if (IsValidationResultFailure(sub.result()))
+				m_failedTransactionSink(entity, entityHash, sub.result());
+
+			sub.undo();
+			return false;
+		}
+
+		model::TransactionInfo prepareForCache(const model::TransactionInfo& utInfo) const {
+			auto cachedUtInfo = utInfo.copy();
+			if (ChainUpdateMode::Incremental == m_chainUpdateMode && !cachedUtInfo.OptionalNotifications) {
+				cachedUtInfo.OptionalNotifications = std::make_shared<model::TransactionNotifications>(
+						*utInfo.pEntity,
+						utInfo.EntityHash,
+						*m_config.pNotificationPublisher);
 			}
+
+			return cachedUtInfo;
 		}
 
 		bool throttle(
@@ -177,6 +244,8 @@ namespace catapult { namespace chain {
 		TimeSupplier m_timeSupplier;
 		FailedTransactionSink m_failedTransactionSink;
 		UtUpdater::Throttle m_throttle;
+		ChainUpdateMode m_chainUpdateMode;
+		model::NotificationBuffer m_undoBuffer;
 	};
 
 	UtUpdater::UtUpdater(
@@ -185,14 +254,16 @@ namespace catapult { namespace chain {
 			const ExecutionConfiguration& config,
 			const TimeSupplier& timeSupplier,
 			const FailedTransactionSink& failedTransactionSink,
-			const Throttle& throttle)
+			const Throttle& throttle,
+			ChainUpdateMode chainUpdateMode)
 			: m_pImpl(std::make_unique<Impl>(
 					transactionsCache,
 					confirmedCatapultCache,
 					config,
 					timeSupplier,
 					failedTransactionSink,
-					throttle))
+					throttle,
+					chainUpdateMode))
 	{}
 
 	UtUpdater::~UtUpdater() = default;
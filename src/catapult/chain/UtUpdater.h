@@ -66,18 +66,30 @@ namespace catapult { namespace chain {
 		/// Function signature for throttling cache additions.
 		using Throttle = predicate<const model::TransactionInfo&, const ThrottleContext&>;
 
+		/// Modes for updating the cache after the chain has changed.
+		enum class ChainUpdateMode {
+			/// All transactions are removed from the cache and reapplied.
+			Rebuild,
+			/// Confirmed transactions are removed from the cache and all other transactions are revalidated and reapplied in place.
+			/// Notifications are stored with cached transactions so that they are replayed instead of republished when reapplied.
+			/// \note Rebuild is used when transactions are reverted.
+			Incremental
+		};
+
 	public:
 		/// Creates an updater around \a transactionsCache with execution configuration (\a config),
 		/// current time supplier (\a timeSupplier) and failed transaction sink (\a failedTransactionSink).
 		/// \a confirmedCatapultCache is the real (confirmed) catapult cache.
 		/// \a throttle allows throttling (rejection) of transactions.
+		/// \a chainUpdateMode determines how the cache is updated after the chain has changed.
 		UtUpdater(
 				cache::UtCache& transactionsCache,
 				const cache::CatapultCache& confirmedCatapultCache,
 				const ExecutionConfiguration& config,
 				const TimeSupplier& timeSupplier,
 				const FailedTransactionSink& failedTransactionSink,
-				const Throttle& throttle);
+				const Throttle& throttle,
+				ChainUpdateMode chainUpdateMode = ChainUpdateMode::Rebuild);
 
 		/// Destroys the updater.
 		~UtUpdater();
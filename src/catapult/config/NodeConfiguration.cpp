@@ -46,6 +46,10 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxPeersPerSyncAttempt);
+		LOAD_NODE_PROPERTY(ShouldSyncBlockHeadersFirst);
+		LOAD_NODE_PROPERTY(ShouldSampleChainHashes);
+		LOAD_NODE_PROPERTY(ShouldPushCompactBlocks);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -54,13 +58,23 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
+		LOAD_NODE_PROPERTY(ShouldUpdateUnconfirmedTransactionsIncrementally);
+		LOAD_NODE_PROPERTY(UnconfirmedTransactionsReconciliationMaxDifference);
 
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
+		LOAD_NODE_PROPERTY(MultiplexedRequestTimeout);
 
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSize);
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSensitivity);
+		LOAD_NODE_PROPERTY(SocketWorkingBufferPoolSize);
 		LOAD_NODE_PROPERTY(MaxPacketDataSize);
+		LOAD_NODE_PROPERTY(SocketMaxCoalescedWriteSize);
+		LOAD_NODE_PROPERTY(PacketCompressionThreshold);
+
+		LOAD_NODE_PROPERTY(BroadcastKnownInventorySize);
+		LOAD_NODE_PROPERTY(MaxBroadcastFanout);
+		LOAD_NODE_PROPERTY(BroadcastTrickleInterval);
 
 		LOAD_NODE_PROPERTY(BlockDisruptorSize);
 		LOAD_NODE_PROPERTY(BlockElementTraceInterval);
@@ -70,6 +84,12 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(ShouldAbortWhenDispatcherIsFull);
 		LOAD_NODE_PROPERTY(ShouldAuditDispatcherInputs);
 		LOAD_NODE_PROPERTY(ShouldPrecomputeTransactionAddresses);
+		LOAD_NODE_PROPERTY(ShouldPrecomputeTransactionNotifications);
+
+		LOAD_NODE_PROPERTY(ThreadPoolCpuAffinity);
+		LOAD_NODE_PROPERTY(ValidatorPoolCpuAffinity);
+		LOAD_NODE_PROPERTY(BlockDispatcherCpuAffinity);
+		LOAD_NODE_PROPERTY(TransactionDispatcherCpuAffinity);
 
 		LOAD_NODE_PROPERTY(OutgoingSecurityMode);
 		LOAD_NODE_PROPERTY(IncomingSecurityModes);
@@ -103,7 +123,7 @@ namespace catapult { namespace config {
 		auto extensionsPair = utils::ExtractSectionAsUnorderedSet(bag, "extensions");
 		config.Extensions = extensionsPair.first;
 
-		utils::VerifyBagSizeLte(bag, 29 + 4 + 2 + 3 + extensionsPair.second);
+		utils::VerifyBagSizeLte(bag, 47 + 4 + 2 + 3 + extensionsPair.second);
 		return config;
 	}
 
@@ -21,6 +21,7 @@
 #pragma once
 #include "catapult/ionet/ConnectionSecurityMode.h"
 #include "catapult/ionet/NodeRoles.h"
+#include "catapult/utils/CpuSet.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/utils/TimeSpan.h"
 #include <unordered_set>
@@ -59,6 +60,19 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of peers that blocks are pulled from in parallel per sync attempt.
+		uint32_t MaxPeersPerSyncAttempt;
+
+		/// \c true if block headers of a fork should be pulled and validated before the corresponding blocks are pulled.
+		bool ShouldSyncBlockHeadersFirst;
+
+		/// \c true if chains should be compared by sampling block hashes at sparse heights instead of pulling consecutive hashes.
+		/// \note Sampling requires all sync peers to support block-hashes-at requests.
+		bool ShouldSampleChainHashes;
+
+		/// \c true if new blocks should be pushed as compact blocks composed of a block header and transaction short hashes.
+		bool ShouldPushCompactBlocks;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -77,12 +91,23 @@ namespace catapult { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		uint32_t UnconfirmedTransactionsCacheMaxSize;
 
+		/// \c true if the unconfirmed transactions cache should be updated incrementally after a block is applied.
+		bool ShouldUpdateUnconfirmedTransactionsIncrementally;
+
+		/// Maximum number of differing short hashes that can be reconciled when pulling unconfirmed transactions.
+		/// \note \c 0 will disable reconciliation, which should only be enabled when all peers support it.
+		uint32_t UnconfirmedTransactionsReconciliationMaxDifference;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
 		/// Timeout for syncing with a peer.
 		utils::TimeSpan SyncTimeout;
 
+		/// Timeout for a single request multiplexed over a shared peer connection.
+		/// \note \c 0 will disable request multiplexing, which should only be enabled when all peers support it.
+		utils::TimeSpan MultiplexedRequestTimeout;
+
 		/// Initial socket working buffer size (socket reads will attempt to read buffers of roughly this size).
 		utils::FileSize SocketWorkingBufferSize;
 
@@ -90,9 +115,34 @@ namespace catapult { namespace config {
 		/// \note \c 0 will disable memory reclamation.
 		uint32_t SocketWorkingBufferSensitivity;
 
+		/// Maximum number of idle socket working buffers retained for reuse across connections.
+		/// \note \c 0 will disable working buffer pooling.
+		uint32_t SocketWorkingBufferPoolSize;
+
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
+		/// Maximum number of bytes of pending socket writes that can be coalesced into a single write.
+		/// \note \c 0 will disable write coalescing.
+		utils::FileSize SocketMaxCoalescedWriteSize;
+
+		/// Minimum size of packets that are compressed on connections that negotiate packet compression.
+		/// \note \c 0 will disable packet compression.
+		/// \note Compression is only used on connections where both peers enable it (peers without compression support ignore requests).
+		utils::FileSize PacketCompressionThreshold;
+
+		/// Maximum number of broadcast inventory items remembered per peer in order to suppress redundant sends.
+		/// \note \c 0 will disable broadcast deduplication.
+		/// \note Inventory sent to a peer and blocks and transactions pushed by a peer are remembered.
+		uint32_t BroadcastKnownInventorySize;
+
+		/// Maximum number of writer connections a broadcast is sent to immediately.
+		/// \note \c 0 will send every broadcast to all writer connections immediately.
+		uint32_t MaxBroadcastFanout;
+
+		/// Interval at which broadcasts deferred due to the fanout limit are sent to the remaining writer connections.
+		utils::TimeSpan BroadcastTrickleInterval;
+
 		/// Size of the block disruptor circular buffer.
 		uint32_t BlockDisruptorSize;
 
@@ -114,6 +164,22 @@ namespace catapult { namespace config {
 		/// \c true if all transaction addresses should be extracted during dispatcher processing.
 		bool ShouldPrecomputeTransactionAddresses;
 
+		/// \c true if all transaction notifications should be published once during dispatcher processing and replayed afterwards.
+		bool ShouldPrecomputeTransactionNotifications;
+
+		/// Cpus to which the main thread pool (including network io) should be pinned (empty to allow any cpu).
+		utils::CpuSet ThreadPoolCpuAffinity;
+
+		/// Cpus to which the validator thread pool should be pinned (empty to allow any cpu).
+		utils::CpuSet ValidatorPoolCpuAffinity;
+
+		/// Cpus to which the block dispatcher consumer threads should be pinned (empty to allow any cpu).
+		utils::CpuSet BlockDispatcherCpuAffinity;
+
+		/// Cpus to which the transaction and partial transaction dispatcher consumer threads should be pinned
+		/// (empty to allow any cpu).
+		utils::CpuSet TransactionDispatcherCpuAffinity;
+
 		/// Security mode of outgoing connections initiated by this node.
 		ionet::ConnectionSecurityMode OutgoingSecurityMode;
 
@@ -29,7 +29,10 @@ namespace catapult { namespace consumers {
 		template<typename TTransactionElements>
 		void UpdateAddresses(TTransactionElements& elements, const model::NotificationPublisher& notificationPublisher) {
 			for (auto& element : elements) {
-				auto addresses = ExtractAddresses(element.Transaction, notificationPublisher);
+				// prefer replaying previously published notifications when available
+				auto addresses = element.OptionalNotifications
+						? model::ExtractAddresses(*element.OptionalNotifications)
+						: model::ExtractAddresses(element.Transaction, notificationPublisher);
 				element.OptionalExtractedAddresses = std::make_shared<decltype(addresses)>(std::move(addresses));
 			}
 		}
@@ -46,6 +46,10 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that extracts all addresses affected by transactions using \a notificationPublisher.
 	disruptor::BlockConsumer CreateBlockAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher);
 
+	/// Creates a consumer that publishes all transaction notifications once using \a notificationPublisher
+	/// so that they can be replayed by later stages.
+	disruptor::BlockConsumer CreateBlockNotificationPublicationConsumer(const model::NotificationPublisher& notificationPublisher);
+
 	/// Creates a consumer that checks a block chain for internal integrity.
 	/// A valid chain must have no more than \a maxChainSize blocks and end no more than \a maxBlockFutureTime past the current time
 	/// supplied by \a timeSupplier.
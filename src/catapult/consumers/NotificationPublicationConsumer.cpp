@@ -0,0 +1,91 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockConsumers.h"
+#include "ConsumerResultFactory.h"
+#include "TransactionConsumers.h"
+#include "catapult/model/NotificationBuffer.h"
+
+namespace catapult { namespace consumers {
+
+	namespace {
+		template<typename TTransactionElements>
+		void PublishNotifications(TTransactionElements& elements, const model::NotificationPublisher& notificationPublisher) {
+			for (auto& element : elements) {
+				element.OptionalNotifications = std::make_shared<model::TransactionNotifications>(
+						element.Transaction,
+						element.EntityHash,
+						notificationPublisher);
+			}
+		}
+
+		class BlockNotificationPublicationConsumer {
+		public:
+			explicit BlockNotificationPublicationConsumer(const model::NotificationPublisher& notificationPublisher)
+					: m_notificationPublisher(notificationPublisher)
+			{}
+
+		public:
+			ConsumerResult operator()(BlockElements& elements) const {
+				if (elements.empty())
+					return Abort(Failure_Consumer_Empty_Input);
+
+				for (auto& element : elements)
+					PublishNotifications(element.Transactions, m_notificationPublisher);
+
+				return Continue();
+			}
+
+		private:
+			const model::NotificationPublisher& m_notificationPublisher;
+		};
+	}
+
+	disruptor::BlockConsumer CreateBlockNotificationPublicationConsumer(const model::NotificationPublisher& notificationPublisher) {
+		return BlockNotificationPublicationConsumer(notificationPublisher);
+	}
+
+	namespace {
+		class TransactionNotificationPublicationConsumer {
+		public:
+			explicit TransactionNotificationPublicationConsumer(const model::NotificationPublisher& notificationPublisher)
+					: m_notificationPublisher(notificationPublisher)
+			{}
+
+		public:
+			ConsumerResult operator()(TransactionElements& elements) const {
+				if (elements.empty())
+					return Abort(Failure_Consumer_Empty_Input);
+
+				PublishNotifications(elements, m_notificationPublisher);
+
+				return Continue();
+			}
+
+		private:
+			const model::NotificationPublisher& m_notificationPublisher;
+		};
+	}
+
+	disruptor::TransactionConsumer CreateTransactionNotificationPublicationConsumer(
+			const model::NotificationPublisher& notificationPublisher) {
+		return TransactionNotificationPublicationConsumer(notificationPublisher);
+	}
+}}
@@ -44,6 +44,11 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that extracts all addresses affected by transactions using \a notificationPublisher.
 	disruptor::TransactionConsumer CreateTransactionAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher);
 
+	/// Creates a consumer that publishes all transaction notifications once using \a notificationPublisher
+	/// so that they can be replayed by later stages.
+	disruptor::TransactionConsumer CreateTransactionNotificationPublicationConsumer(
+			const model::NotificationPublisher& notificationPublisher);
+
 	/// Creates a consumer that runs stateless validation using \a pValidator and the specified policy
 	/// (\a pValidationPolicy) and calls \a failedTransactionSink for each failure.
 	disruptor::TransactionConsumer CreateTransactionStatelessValidationConsumer(
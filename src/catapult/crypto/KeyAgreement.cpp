@@ -0,0 +1,127 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "KeyAgreement.h"
+#include "CryptoUtils.h"
+#include "SecureZero.h"
+
+extern "C" {
+#include <ref10/fe.h>
+#include <ref10/ge.h>
+}
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		constexpr int Num_Scalar_Bits = 255;
+
+		void ConditionalSwap(fe f, fe g, unsigned int swap) {
+			fe temp;
+			fe_copy(temp, f);
+			fe_cmov(f, g, swap);
+			fe_cmov(g, temp, swap);
+		}
+
+		// u = (1 + y) / (1 - y)
+		void EdwardsToMontgomery(const Key& publicKey, fe u) {
+			fe y, one, numerator, denominator;
+			fe_frombytes(y, publicKey.data());
+			fe_1(one);
+			fe_add(numerator, one, y);
+			fe_sub(denominator, one, y);
+			fe_invert(denominator, denominator);
+			fe_mul(u, numerator, denominator);
+		}
+
+		// montgomery ladder as described in RFC 7748 (section 5)
+		void ScalarMultiply(const uint8_t* scalar, const fe u, fe result) {
+			fe a24;
+			fe_0(a24);
+			a24[0] = 121665;
+
+			fe x1, x2, z2, x3, z3;
+			fe_copy(x1, u);
+			fe_1(x2);
+			fe_0(z2);
+			fe_copy(x3, u);
+			fe_1(z3);
+
+			fe a, aa, b, bb, e, c, d, da, cb, temp;
+			unsigned int swap = 0;
+			for (auto i = Num_Scalar_Bits - 1; i >= 0; --i) {
+				unsigned int bit = (scalar[i / 8] >> (i % 8)) & 1;
+				swap ^= bit;
+				ConditionalSwap(x2, x3, swap);
+				ConditionalSwap(z2, z3, swap);
+				swap = bit;
+
+				fe_add(a, x2, z2);
+				fe_sq(aa, a);
+				fe_sub(b, x2, z2);
+				fe_sq(bb, b);
+				fe_sub(e, aa, bb);
+				fe_add(c, x3, z3);
+				fe_sub(d, x3, z3);
+				fe_mul(da, d, a);
+				fe_mul(cb, c, b);
+
+				fe_add(temp, da, cb);
+				fe_sq(x3, temp);
+				fe_sub(temp, da, cb);
+				fe_sq(temp, temp);
+				fe_mul(z3, x1, temp);
+
+				fe_mul(x2, aa, bb);
+				fe_mul(temp, a24, e);
+				fe_add(temp, aa, temp);
+				fe_mul(z2, e, temp);
+			}
+
+			ConditionalSwap(x2, x3, swap);
+			ConditionalSwap(z2, z3, swap);
+
+			fe_invert(z2, z2);
+			fe_mul(result, x2, z2);
+		}
+	}
+
+	bool TryDeriveSharedSecret(const KeyPair& keyPair, const Key& otherPublicKey, Key& sharedSecret) {
+		// reject keys that are not points on the curve (the decoded point itself is not needed)
+		ge_p3 otherPoint;
+		if (0 != ge_frombytes_negate_vartime(&otherPoint, otherPublicKey.data()))
+			return false;
+
+		// a = clamped privHash[0:256] (same scalar as used for signing)
+		Hash512 privHash;
+		HashPrivateKey(keyPair.privateKey(), privHash);
+		privHash[0] &= 0xF8;
+		privHash[31] &= 0x7F;
+		privHash[31] |= 0x40;
+
+		fe u, result;
+		EdwardsToMontgomery(otherPublicKey, u);
+		ScalarMultiply(privHash.data(), u, result);
+		fe_tobytes(sharedSecret.data(), result);
+		SecureZero(privHash.data(), privHash.size());
+
+		// a low order public key results in a zero secret, which must not be used
+		return Key() != sharedSecret;
+	}
+}}
@@ -35,6 +35,14 @@ namespace catapult { namespace disruptor {
 			return options;
 		}
 
+		void PinConsumerThread(const std::string& name, const utils::CpuSet& cpuAffinity) {
+			if (cpuAffinity.empty())
+				return;
+
+			if (!thread::SetThreadAffinity(cpuAffinity))
+				CATAPULT_LOG(warning) << name << " consumer thread could not be pinned to cpus " << cpuAffinity;
+		}
+
 		void LogCompletion(const DisruptorElement& element, const DisruptorBarriers& barriers, size_t elementTraceInterval) {
 			if (!IsIntervalElementId(element.id(), elementTraceInterval))
 				return;
@@ -66,8 +74,9 @@ namespace catapult { namespace disruptor {
 		auto currentLevel = 0u;
 		for (const auto& consumer : consumers) {
 			ConsumerEntry consumerEntry(currentLevel++);
-			m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
+			m_threads.create_thread([pThis = this, consumerEntry, consumer, cpuAffinity = options.CpuAffinity]() mutable {
 				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+				PinConsumerThread(pThis->name(), cpuAffinity);
 				while (pThis->m_keepRunning) {
 					try {
 						auto* pDisruptorElement = pThis->tryNext(consumerEntry);
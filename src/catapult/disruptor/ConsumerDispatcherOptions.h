@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/utils/CpuSet.h"
 #include <stddef.h>
 
 namespace catapult { namespace disruptor {
@@ -27,7 +28,7 @@ namespace catapult { namespace disruptor {
 	struct ConsumerDispatcherOptions {
 	public:
 		/// Creates options around \a dispatcherName and \a disruptorSize.
-		constexpr ConsumerDispatcherOptions(const char* dispatcherName, size_t disruptorSize)
+		ConsumerDispatcherOptions(const char* dispatcherName, size_t disruptorSize)
 				: DispatcherName(dispatcherName)
 				, DisruptorSize(disruptorSize)
 				, ElementTraceInterval(1)
@@ -46,5 +47,8 @@ namespace catapult { namespace disruptor {
 
 		/// \c true if the dispatcher should throw if full, \c false if it should return an error.
 		bool ShouldThrowIfFull;
+
+		/// Cpus to which all consumer threads should be pinned (empty to allow any cpu).
+		utils::CpuSet CpuAffinity;
 	};
 }}
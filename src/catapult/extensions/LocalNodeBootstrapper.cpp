@@ -45,7 +45,8 @@ namespace catapult { namespace extensions {
 					thread::MultiServicePool::DefaultPoolConcurrency(),
 					m_config.Node.ShouldUseSingleThreadPool
 							? thread::MultiServicePool::IsolatedPoolMode::Disabled
-							: thread::MultiServicePool::IsolatedPoolMode::Enabled))
+							: thread::MultiServicePool::IsolatedPoolMode::Enabled,
+					m_config.Node.ThreadPoolCpuAffinity))
 			, m_subscriptionManager(config)
 			, m_pluginManager(m_config.BlockChain, CreateStorageConfiguration(config))
 	{}
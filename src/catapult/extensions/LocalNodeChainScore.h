@@ -20,7 +20,7 @@
 
 #pragma once
 #include "catapult/model/ChainScore.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ReaderWriterLock.h"
 
 namespace catapult { namespace extensions {
 
@@ -53,6 +53,6 @@ namespace catapult { namespace extensions {
 
 	private:
 		model::ChainScore m_score;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ReaderWriterLock m_lock;
 	};
 }}
@@ -22,21 +22,33 @@
 
 namespace catapult { namespace extensions {
 
-	net::ConnectionSettings GetConnectionSettings(const config::LocalNodeConfiguration& config) {
+	net::ConnectionSettings GetConnectionSettings(
+			const config::LocalNodeConfiguration& config,
+			const std::shared_ptr<ionet::ByteBufferPool>& pSocketWorkingBufferPool) {
 		net::ConnectionSettings settings;
 		settings.NetworkIdentifier = config.BlockChain.Network.Identifier;
 		settings.Timeout = config.Node.ConnectTimeout;
+		settings.MultiplexedRequestTimeout = config.Node.MultiplexedRequestTimeout;
 		settings.SocketWorkingBufferSize = config.Node.SocketWorkingBufferSize;
 		settings.SocketWorkingBufferSensitivity = config.Node.SocketWorkingBufferSensitivity;
 		settings.MaxPacketDataSize = config.Node.MaxPacketDataSize;
+		settings.SocketMaxCoalescedWriteSize = config.Node.SocketMaxCoalescedWriteSize;
+		settings.PacketCompressionThreshold = config.Node.PacketCompressionThreshold;
+		settings.BroadcastKnownInventorySize = config.Node.BroadcastKnownInventorySize;
+		settings.MaxBroadcastFanout = config.Node.MaxBroadcastFanout;
+		settings.BroadcastTrickleInterval = config.Node.BroadcastTrickleInterval;
+		settings.SocketWorkingBufferPool = pSocketWorkingBufferPool;
 
 		settings.OutgoingSecurityMode = config.Node.OutgoingSecurityMode;
 		settings.IncomingSecurityModes = config.Node.IncomingSecurityModes;
 		return settings;
 	}
 
-	void UpdateAsyncTcpServerSettings(net::AsyncTcpServerSettings& settings, const config::LocalNodeConfiguration& config) {
-		settings.PacketSocketOptions = GetConnectionSettings(config).toSocketOptions();
+	void UpdateAsyncTcpServerSettings(
+			net::AsyncTcpServerSettings& settings,
+			const config::LocalNodeConfiguration& config,
+			const std::shared_ptr<ionet::ByteBufferPool>& pSocketWorkingBufferPool) {
+		settings.PacketSocketOptions = GetConnectionSettings(config, pSocketWorkingBufferPool).toSocketOptions();
 		settings.AllowAddressReuse = config.Node.ShouldAllowAddressReuse;
 
 		const auto& connectionsConfig = config.Node.IncomingConnections;
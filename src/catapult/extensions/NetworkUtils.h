@@ -27,21 +27,28 @@
 
 namespace catapult { namespace extensions {
 
-	/// Extracts connection settings from \a config.
-	net::ConnectionSettings GetConnectionSettings(const config::LocalNodeConfiguration& config);
+	/// Extracts connection settings from \a config using the (shared) socket working buffer pool \a pSocketWorkingBufferPool.
+	net::ConnectionSettings GetConnectionSettings(
+			const config::LocalNodeConfiguration& config,
+			const std::shared_ptr<ionet::ByteBufferPool>& pSocketWorkingBufferPool);
 
-	/// Updates \a settings with values in \a config.
-	void UpdateAsyncTcpServerSettings(net::AsyncTcpServerSettings& settings, const config::LocalNodeConfiguration& config);
+	/// Updates \a settings with values in \a config and the (shared) socket working buffer pool \a pSocketWorkingBufferPool.
+	void UpdateAsyncTcpServerSettings(
+			net::AsyncTcpServerSettings& settings,
+			const config::LocalNodeConfiguration& config,
+			const std::shared_ptr<ionet::ByteBufferPool>& pSocketWorkingBufferPool);
 
 	/// Gets the maximum number of incoming connections per identity as specified by \a roles.
 	uint32_t GetMaxIncomingConnectionsPerIdentity(ionet::NodeRoles roles);
 
-	/// Boots a tcp server with \a serviceGroup on localhost \a port with connection \a config and \a acceptor.
+	/// Boots a tcp server with \a serviceGroup on localhost \a port with connection \a config, \a pSocketWorkingBufferPool
+	/// and \a acceptor.
 	template<typename TAcceptor>
 	std::shared_ptr<net::AsyncTcpServer> BootServer(
 			thread::MultiServicePool::ServiceGroup& serviceGroup,
 			unsigned short port,
 			const config::LocalNodeConfiguration& config,
+			const std::shared_ptr<ionet::ByteBufferPool>& pSocketWorkingBufferPool,
 			TAcceptor acceptor) {
 		auto endpoint = boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port);
 		auto settings = net::AsyncTcpServerSettings([acceptor, port](const auto& socketInfo) {
@@ -50,7 +57,7 @@ namespace catapult { namespace extensions {
 			});
 		});
 
-		UpdateAsyncTcpServerSettings(settings, config);
+		UpdateAsyncTcpServerSettings(settings, config, pSocketWorkingBufferPool);
 		return serviceGroup.pushService(net::CreateAsyncTcpServer, endpoint, settings);
 	}
 }}
@@ -19,24 +19,47 @@
 **/
 
 #include "ServerHooksUtils.h"
+#include "catapult/net/BroadcastInventory.h"
 
 namespace catapult { namespace extensions {
 
 	namespace {
+		template<typename TRange>
+		void AddKnownInventory(net::PeerKnownInventories& knownInventories, const TRange& range) {
+			std::vector<utils::ShortHash> inventory;
+			inventory.reserve(range.Range.size());
+			for (const auto& entity : range.Range)
+				inventory.push_back(net::CalculateBroadcastInventoryItem(entity));
+
+			knownInventories.add(range.SourcePublicKey, inventory);
+		}
+
 		template<typename TConsumerFactory>
-		auto CreatePushEntityCallback(const TConsumerFactory& consumerFactory, const extensions::ChainSyncedPredicate& isChainSynced) {
-			return [isChainSynced, consumer = consumerFactory(disruptor::InputSource::Remote_Push)](auto&& range) {
+		auto CreatePushEntityCallback(
+				const TConsumerFactory& consumerFactory,
+				const extensions::ChainSyncedPredicate& isChainSynced,
+				const std::shared_ptr<net::PeerKnownInventories>& pKnownInventories) {
+			auto consumer = consumerFactory(disruptor::InputSource::Remote_Push);
+			return [isChainSynced, consumer, pKnownInventories](auto&& range) {
+				// pushed entities are known to the pushing peer even when they are not consumed
+				if (pKnownInventories)
+					AddKnownInventory(*pKnownInventories, range);
+
 				if (isChainSynced())
 					consumer(std::move(range));
 			};
 		}
 	}
 
-	BlockRangeConsumerFunc CreateBlockPushEntityCallback(const ServerHooks& hooks) {
-		return CreatePushEntityCallback(hooks.blockRangeConsumerFactory(), hooks.chainSyncedPredicate());
+	BlockRangeConsumerFunc CreateBlockPushEntityCallback(
+			const ServerHooks& hooks,
+			const std::shared_ptr<net::PeerKnownInventories>& pKnownInventories) {
+		return CreatePushEntityCallback(hooks.blockRangeConsumerFactory(), hooks.chainSyncedPredicate(), pKnownInventories);
 	}
 
-	TransactionRangeConsumerFunc CreateTransactionPushEntityCallback(const ServerHooks& hooks) {
-		return CreatePushEntityCallback(hooks.transactionRangeConsumerFactory(), hooks.chainSyncedPredicate());
+	TransactionRangeConsumerFunc CreateTransactionPushEntityCallback(
+			const ServerHooks& hooks,
+			const std::shared_ptr<net::PeerKnownInventories>& pKnownInventories) {
+		return CreatePushEntityCallback(hooks.transactionRangeConsumerFactory(), hooks.chainSyncedPredicate(), pKnownInventories);
 	}
 }}
@@ -21,11 +21,19 @@
 #pragma once
 #include "ServerHooks.h"
 
+namespace catapult { namespace net { class PeerKnownInventories; } }
+
 namespace catapult { namespace extensions {
 
 	/// Creates a block push entity callback from \a hooks that only pushes when synced.
-	BlockRangeConsumerFunc CreateBlockPushEntityCallback(const ServerHooks& hooks);
+	/// \note Pushed blocks are added to the known inventory of the pushing peer in \a pKnownInventories (when set).
+	BlockRangeConsumerFunc CreateBlockPushEntityCallback(
+			const ServerHooks& hooks,
+			const std::shared_ptr<net::PeerKnownInventories>& pKnownInventories);
 
 	/// Creates a transaction push entity callback from \a hooks that only pushes when synced.
-	TransactionRangeConsumerFunc CreateTransactionPushEntityCallback(const ServerHooks& hooks);
+	/// \note Pushed transactions are added to the known inventory of the pushing peer in \a pKnownInventories (when set).
+	TransactionRangeConsumerFunc CreateTransactionPushEntityCallback(
+			const ServerHooks& hooks,
+			const std::shared_ptr<net::PeerKnownInventories>& pKnownInventories);
 }}
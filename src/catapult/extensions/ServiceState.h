@@ -22,7 +22,9 @@
 #include "ServerHooks.h"
 #include "ServiceState.h"
 #include "catapult/config/LocalNodeConfiguration.h"
+#include "catapult/ionet/ByteBufferPool.h"
 #include "catapult/ionet/PacketHandlers.h"
+#include "catapult/net/BroadcastInventory.h"
 #include "catapult/net/PacketIoPickerContainer.h"
 #include "catapult/thread/Task.h"
 
@@ -82,6 +84,12 @@ namespace catapult { namespace extensions {
 				, m_pluginManager(pluginManager)
 				, m_pool(pool)
 				, m_packetHandlers(m_config.Node.MaxPacketDataSize.bytes32())
+				, m_pSocketWorkingBufferPool(0 == m_config.Node.SocketWorkingBufferPoolSize
+						? nullptr
+						: std::make_shared<ionet::ByteBufferPool>(
+								m_config.Node.SocketWorkingBufferSize.bytes(),
+								m_config.Node.SocketWorkingBufferPoolSize))
+				, m_pPeerKnownInventories(std::make_shared<net::PeerKnownInventories>(m_config.Node.BroadcastKnownInventorySize))
 		{}
 
 	public:
@@ -181,6 +189,16 @@ namespace catapult { namespace extensions {
 			return m_packetIoPickers;
 		}
 
+		/// Gets the socket working buffer pool shared by all connections (if enabled).
+		const auto& socketWorkingBufferPool() const {
+			return m_pSocketWorkingBufferPool;
+		}
+
+		/// Gets the broadcast known inventories of peers shared by writers and push handlers.
+		const auto& peerKnownInventories() const {
+			return m_pPeerKnownInventories;
+		}
+
 	private:
 		// references
 		const config::LocalNodeConfiguration& m_config;
@@ -205,5 +223,7 @@ namespace catapult { namespace extensions {
 		ionet::ServerPacketHandlers m_packetHandlers;
 		ServerHooks m_hooks;
 		net::PacketIoPickerContainer m_packetIoPickers;
+		std::shared_ptr<ionet::ByteBufferPool> m_pSocketWorkingBufferPool;
+		std::shared_ptr<net::PeerKnownInventories> m_pPeerKnownInventories;
 	};
 }}
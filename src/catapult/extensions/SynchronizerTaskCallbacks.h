@@ -44,6 +44,26 @@ namespace catapult { namespace extensions {
 		};
 	}
 
+	/// Creates a synchronizer task callback for \a synchronizer named \a taskName that does not require the local chain to be synced.
+	/// \a packetIoPicker is used to select up to \a maxPeers peers and \a remoteApiFactory wraps an api around peers.
+	/// \a state provides additional service information.
+	template<typename TRemoteApi, typename TRemoteApiFactory>
+	thread::TaskCallback CreateSynchronizerTaskCallback(
+			chain::MultiRemoteNodeSynchronizer<TRemoteApi>&& synchronizer,
+			TRemoteApiFactory remoteApiFactory,
+			net::PacketIoPicker& packetIoPicker,
+			const extensions::ServiceState& state,
+			const std::string& taskName,
+			uint32_t maxPeers) {
+		auto syncTimeout = state.config().Node.SyncTimeout;
+		chain::RemoteApiForwarder forwarder(packetIoPicker, state.pluginManager().transactionRegistry(), syncTimeout, taskName);
+		return [forwarder, synchronizer, remoteApiFactory, maxPeers]() {
+			return forwarder.processSync(synchronizer, remoteApiFactory, maxPeers).then([](auto&&) {
+				return thread::TaskResult::Continue;
+			});
+		};
+	}
+
 	/// Creates a synchronizer task callback for \a synchronizer named \a taskName that requires the local chain to be synced.
 	/// \a packetIoPicker is used to select peers and \a remoteApiFactory wraps an api around peers.
 	/// \a state provides additional service information.
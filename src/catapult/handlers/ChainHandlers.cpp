@@ -20,12 +20,14 @@
 
 #include "ChainHandlers.h"
 #include "HandlerUtils.h"
-#include "catapult/api/ChainPackets.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/ionet/ChainPackets.h"
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/Block.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <cstring>
 
 namespace catapult { namespace handlers {
 
@@ -36,6 +38,80 @@ namespace catapult { namespace handlers {
 		handlers.registerHandler(ionet::PacketType::Push_Block, CreatePushEntityHandler<model::Block>(registry, blockRangeHandler));
 	}
 
+	namespace {
+		std::unique_ptr<model::Block> TryReconstructBlock(
+				const model::BlockHeader& header,
+				const std::vector<model::TransactionInfo>& transactionInfos) {
+			uint64_t blockSize = sizeof(model::BlockHeader);
+			std::vector<const model::TransactionInfo*> transactionInfoPointers;
+			for (const auto& transactionInfo : transactionInfos) {
+				if (!transactionInfo)
+					return nullptr;
+
+				blockSize += transactionInfo.pEntity->Size;
+				transactionInfoPointers.push_back(&transactionInfo);
+			}
+
+			// short hashes can collide, so the reconstructed transactions must match the signed block header
+			Hash256 blockTransactionsHash;
+			model::CalculateBlockTransactionsHash(transactionInfoPointers, blockTransactionsHash);
+			if (header.Size != blockSize || header.BlockTransactionsHash != blockTransactionsHash)
+				return nullptr;
+
+			auto pBlock = utils::MakeUniqueWithSize<model::Block>(blockSize);
+			std::memcpy(static_cast<void*>(pBlock.get()), &header, sizeof(model::BlockHeader));
+
+			auto* pTransactionData = reinterpret_cast<uint8_t*>(pBlock.get()) + sizeof(model::BlockHeader);
+			for (const auto& transactionInfo : transactionInfos) {
+				std::memcpy(pTransactionData, transactionInfo.pEntity.get(), transactionInfo.pEntity->Size);
+				pTransactionData += transactionInfo.pEntity->Size;
+			}
+
+			return pBlock;
+		}
+
+		auto CreatePushCompactBlockHandler(
+				const model::TransactionRegistry& registry,
+				const UtShortHashesRetriever& utShortHashesRetriever,
+				const BlockRangeHandler& blockRangeHandler,
+				const CompactBlockFallbackHandler& fallbackHandler) {
+			return [&registry, utShortHashesRetriever, blockRangeHandler, fallbackHandler](const auto& packet, const auto& context) {
+				auto dataSize = packet.Size - sizeof(ionet::Packet);
+				auto shortHashesSize = dataSize - sizeof(model::BlockHeader);
+				if (dataSize < sizeof(model::BlockHeader) || 0 != shortHashesSize % sizeof(utils::ShortHash)) {
+					CATAPULT_LOG(warning) << "rejecting malformed compact block: " << packet;
+					return;
+				}
+
+				const auto& header = reinterpret_cast<const model::BlockHeader&>(*packet.Data());
+				const auto* pShortHashes = reinterpret_cast<const utils::ShortHash*>(packet.Data() + sizeof(model::BlockHeader));
+				std::vector<utils::ShortHash> shortHashes(pShortHashes, pShortHashes + shortHashesSize / sizeof(utils::ShortHash));
+
+				auto pBlock = TryReconstructBlock(header, utShortHashesRetriever(shortHashes));
+				if (!pBlock || !IsSizeValid(*pBlock, registry)) {
+					CATAPULT_LOG(debug)
+							<< "could not reconstruct compact block at height " << header.Height << ", falling back to full block";
+					fallbackHandler(header, context.key());
+					return;
+				}
+
+				CATAPULT_LOG(trace) << "reconstructed compact block at height " << header.Height;
+				blockRangeHandler({ model::BlockRange::FromEntity(std::move(pBlock)), context.key() });
+			};
+		}
+	}
+
+	void RegisterPushCompactBlockHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const model::TransactionRegistry& registry,
+			const UtShortHashesRetriever& utShortHashesRetriever,
+			const BlockRangeHandler& blockRangeHandler,
+			const CompactBlockFallbackHandler& fallbackHandler) {
+		handlers.registerHandler(
+				ionet::PacketType::Push_Compact_Block,
+				CreatePushCompactBlockHandler(registry, utShortHashesRetriever, blockRangeHandler, fallbackHandler));
+	}
+
 	namespace {
 		template<typename TPacket>
 		auto CreateResponsePacket(uint32_t payloadSize) {
@@ -84,7 +160,7 @@ namespace catapult { namespace handlers {
 
 		auto CreatePullBlockHandler(const io::BlockStorageCache& storage) {
 			return [&storage](const auto& packet, auto& context) {
-				using RequestType = api::PullBlockRequest;
+				using RequestType = ionet::PullBlockRequest;
 				auto storageView = storage.view();
 				auto info = ProcessHeightRequest<RequestType>(storageView, packet, context, true);
 				if (!info.pRequest)
@@ -107,7 +183,7 @@ namespace catapult { namespace handlers {
 	namespace {
 		auto CreateChainInfoHandler(const io::BlockStorageCache& storage, const model::ChainScoreSupplier& chainScoreSupplier) {
 			return [&storage, chainScoreSupplier](const auto& packet, auto& context) {
-				using RequestType = api::ChainInfoResponse;
+				using RequestType = ionet::ChainInfoResponse;
 				if (!ionet::IsPacketValid(packet, RequestType::Packet_Type))
 					return;
 
@@ -132,7 +208,7 @@ namespace catapult { namespace handlers {
 	namespace {
 		auto CreateBlockHashesHandler(const io::BlockStorageCache& storage, uint32_t maxHashes) {
 			return [&storage, maxHashes](const auto& packet, auto& context) {
-				using RequestType = api::BlockHashesRequest;
+				using RequestType = ionet::BlockHashesRequest;
 				auto storageView = storage.view();
 				auto info = ProcessHeightRequest<RequestType>(storageView, packet, context, false);
 				if (!info.pRequest)
@@ -150,20 +226,42 @@ namespace catapult { namespace handlers {
 	}
 
 	namespace {
-		uint32_t ClampNumBlocks(const HeightRequestInfo<api::PullBlocksRequest>& info, const PullBlocksHandlerConfiguration& config) {
+		auto CreateBlockHashesAtHandler(const io::BlockStorageCache& storage, uint32_t maxHashes) {
+			return [&storage, maxHashes](const auto& packet, auto& context) {
+				constexpr auto Packet_Type = ionet::PacketType::Block_Hashes_At;
+				if (Packet_Type != packet.Type)
+					return;
+
+				auto heights = ionet::ExtractFixedSizeStructuresFromPacket<Height>(packet);
+				if (heights.empty())
+					return;
+
+				auto hashes = storage.view().loadHashesAt(heights, maxHashes);
+				auto payload = ionet::PacketPayloadFactory::FromFixedSizeRange(Packet_Type, std::move(hashes));
+				context.response(std::move(payload));
+			};
+		}
+	}
+
+	void RegisterBlockHashesAtHandler(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage, uint32_t maxHashes) {
+		handlers.registerHandler(ionet::PacketType::Block_Hashes_At, CreateBlockHashesAtHandler(storage, maxHashes));
+	}
+
+	namespace {
+		uint32_t ClampNumBlocks(const HeightRequestInfo<ionet::PullBlocksRequest>& info, const PullBlocksHandlerConfiguration& config) {
 			auto numBlocks = std::min(config.MaxBlocks, info.pRequest->NumBlocks);
 			return std::min(numBlocks, info.numAvailableBlocks());
 		}
 
 		uint32_t ClampNumResponseBytes(
-				const HeightRequestInfo<api::PullBlocksRequest>& info,
+				const HeightRequestInfo<ionet::PullBlocksRequest>& info,
 				const PullBlocksHandlerConfiguration& config) {
 			return std::min(config.MaxResponseBytes, info.pRequest->NumResponseBytes);
 		}
 
 		auto CreatePullBlocksHandler(const io::BlockStorageCache& storage, const PullBlocksHandlerConfiguration& config) {
 			return [&storage, config](const auto& packet, auto& context) {
-				using RequestType = api::PullBlocksRequest;
+				using RequestType = ionet::PullBlocksRequest;
 				auto storageView = storage.view();
 				auto info = ProcessHeightRequest<RequestType>(storageView, packet, context, false);
 				if (!info.pRequest)
@@ -196,4 +294,37 @@ namespace catapult { namespace handlers {
 			const PullBlocksHandlerConfiguration& config) {
 		handlers.registerHandler(ionet::PacketType::Pull_Blocks, CreatePullBlocksHandler(storage, config));
 	}
+
+	namespace {
+		auto CreatePullBlockHeadersHandler(const io::BlockStorageCache& storage, uint32_t maxBlockHeaders) {
+			return [&storage, maxBlockHeaders](const auto& packet, auto& context) {
+				using RequestType = ionet::PullBlockHeadersRequest;
+				auto storageView = storage.view();
+				auto info = ProcessHeightRequest<RequestType>(storageView, packet, context, false);
+				if (!info.pRequest)
+					return;
+
+				auto numBlockHeaders = std::min(maxBlockHeaders, info.pRequest->NumBlockHeaders);
+				numBlockHeaders = std::min(numBlockHeaders, info.numAvailableBlocks());
+
+				// block headers are fixed size, so only the header part of each block is copied into the response
+				uint8_t* pRangeData;
+				auto headers = model::BlockHeaderRange::PrepareFixed(numBlockHeaders, &pRangeData);
+				for (auto i = 0u; i < numBlockHeaders; ++i) {
+					auto pBlock = storageView.loadBlock(info.pRequest->Height + Height(i));
+					std::memcpy(pRangeData + i * sizeof(model::BlockHeader), pBlock.get(), sizeof(model::BlockHeader));
+				}
+
+				auto payload = ionet::PacketPayloadFactory::FromFixedSizeRange(RequestType::Packet_Type, std::move(headers));
+				context.response(std::move(payload));
+			};
+		}
+	}
+
+	void RegisterPullBlockHeadersHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const io::BlockStorageCache& storage,
+			uint32_t maxBlockHeaders) {
+		handlers.registerHandler(ionet::PacketType::Pull_Block_Headers, CreatePullBlockHeadersHandler(storage, maxBlockHeaders));
+	}
 }}
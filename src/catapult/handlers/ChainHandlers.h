@@ -22,7 +22,9 @@
 #include "HandlerTypes.h"
 #include "catapult/ionet/PacketHandlers.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/model/EntityInfo.h"
 #include "catapult/model/RangeTypes.h"
+#include "catapult/utils/ShortHash.h"
 
 namespace catapult { namespace io { class BlockStorageCache; } }
 
@@ -35,6 +37,24 @@ namespace catapult { namespace handlers {
 			const model::TransactionRegistry& registry,
 			const BlockRangeHandler& blockRangeHandler);
 
+	/// Prototype for a function that retrieves the unconfirmed transaction infos with matching short hashes.
+	/// \note An empty info is expected for each unknown short hash.
+	using UtShortHashesRetriever = std::function<std::vector<model::TransactionInfo> (const std::vector<utils::ShortHash>&)>;
+
+	/// Prototype for a function that processes the header of a compact block that could not be reconstructed
+	/// and the key of the node that pushed it.
+	using CompactBlockFallbackHandler = consumer<const model::BlockHeader&, const Key&>;
+
+	/// Registers a push compact block handler in \a handlers that reconstructs a block from its header and the transactions
+	/// returned by \a utShortHashesRetriever and, if valid, forwards it to \a blockRangeHandler given a \a registry
+	/// composed of known transactions. Compact blocks that cannot be reconstructed are forwarded to \a fallbackHandler.
+	void RegisterPushCompactBlockHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const model::TransactionRegistry& registry,
+			const UtShortHashesRetriever& utShortHashesRetriever,
+			const BlockRangeHandler& blockRangeHandler,
+			const CompactBlockFallbackHandler& fallbackHandler);
+
 	/// Registers a pull block handler in \a handlers that responds with a block in \a storage.
 	void RegisterPullBlockHandler(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage);
 
@@ -48,6 +68,10 @@ namespace catapult { namespace handlers {
 	/// Registers a block hashes handler in \a handlers that responds with at most \a maxHashes hashes in \a storage.
 	void RegisterBlockHashesHandler(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage, uint32_t maxHashes);
 
+	/// Registers a block hashes at handler in \a handlers that responds with at most \a maxHashes hashes in \a storage
+	/// at the requested heights.
+	void RegisterBlockHashesAtHandler(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage, uint32_t maxHashes);
+
 	/// Configuration for pull blocks handler.
 	struct PullBlocksHandlerConfiguration {
 		/// Maximum blocks to return.
@@ -63,4 +87,11 @@ namespace catapult { namespace handlers {
 			ionet::ServerPacketHandlers& handlers,
 			const io::BlockStorageCache& storage,
 			const PullBlocksHandlerConfiguration& config);
+
+	/// Registers a pull block headers handler in \a handlers that responds with at most \a maxBlockHeaders block headers
+	/// from \a storage.
+	void RegisterPullBlockHeadersHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const io::BlockStorageCache& storage,
+			uint32_t maxBlockHeaders);
 }}
@@ -0,0 +1,54 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiplexedHandlers.h"
+#include "catapult/ionet/MultiplexedPacketIo.h"
+
+namespace catapult { namespace handlers {
+
+	namespace {
+		auto CreateMultiplexedRequestHandler(const ionet::ServerPacketHandlers& handlers) {
+			return [&handlers](const auto& packet, auto& context) {
+				using RequestType = ionet::MultiplexedPacket;
+				if (RequestType::Packet_Type != packet.Type || sizeof(RequestType) > packet.Size)
+					return;
+
+				const auto& request = static_cast<const RequestType&>(packet);
+				const auto* pChildPacket = ionet::GetMultiplexedChildPacket(request);
+				if (!pChildPacket) {
+					CATAPULT_LOG(warning) << "rejecting malformed multiplexed request " << request.RequestId;
+					return;
+				}
+
+				ionet::ServerPacketHandlerContext childContext(context.key(), context.host());
+				if (!handlers.process(*pChildPacket, childContext) || !childContext.hasResponse())
+					return;
+
+				auto pResponseHeader = ionet::CreateSharedPacket<RequestType>();
+				pResponseHeader->RequestId = request.RequestId;
+				context.response(ionet::PacketPayload::Merge(pResponseHeader, childContext.response()));
+			};
+		}
+	}
+
+	void RegisterMultiplexedRequestHandler(ionet::ServerPacketHandlers& handlers) {
+		handlers.registerHandler(ionet::PacketType::Multiplexed, CreateMultiplexedRequestHandler(handlers));
+	}
+}}
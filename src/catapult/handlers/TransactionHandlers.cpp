@@ -20,7 +20,9 @@
 
 #include "TransactionHandlers.h"
 #include "HandlerUtils.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/ionet/TransactionPackets.h"
 #include "catapult/utils/ShortHash.h"
 #include "catapult/types.h"
 
@@ -78,4 +80,40 @@ namespace catapult { namespace handlers {
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever) {
 		handlers.registerHandler(ionet::PacketType::Pull_Transactions, CreatePullTransactionsHandler(utRetriever));
 	}
+
+	namespace {
+		auto CreatePullTransactionsReconciliationHandler(const UtReconciliationRetriever& utReconciliationRetriever) {
+			return [utReconciliationRetriever](const auto& packet, auto& context) {
+				if (ionet::PacketType::Pull_Transactions_Reconciliation != packet.Type)
+					return;
+
+				auto range = ionet::ExtractFixedSizeStructuresFromPacket<utils::ShortHashIbltCell>(packet);
+				if (!utils::ShortHashIblt::IsValidNumCells(range.size()))
+					return;
+
+				utils::ShortHashIblt shortHashesIblt(std::vector<utils::ShortHashIbltCell>(range.cbegin(), range.cend()));
+
+				UnconfirmedTransactions transactions;
+				auto isDecoded = utReconciliationRetriever(shortHashesIblt, transactions);
+
+				ionet::PullTransactionsReconciliationResponseHeader header;
+				header.IsDecoded = isDecoded ? 1 : 0;
+
+				ionet::PacketPayloadBuilder builder(ionet::PacketType::Pull_Transactions_Reconciliation);
+				builder.appendValue(header);
+				if (isDecoded)
+					builder.appendEntities(transactions);
+
+				context.response(builder.build());
+			};
+		}
+	}
+
+	void RegisterPullTransactionsReconciliationHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const UtReconciliationRetriever& utReconciliationRetriever) {
+		handlers.registerHandler(
+				ionet::PacketType::Pull_Transactions_Reconciliation,
+				CreatePullTransactionsReconciliationHandler(utReconciliationRetriever));
+	}
 }}
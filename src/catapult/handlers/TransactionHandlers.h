@@ -24,6 +24,7 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/model/Transaction.h"
 #include "catapult/utils/ShortHash.h"
+#include "catapult/utils/ShortHashIblt.h"
 #include <unordered_set>
 
 namespace catapult { namespace handlers {
@@ -44,4 +45,15 @@ namespace catapult { namespace handlers {
 	/// Registers a pull transactions handler in \a handlers that responds with unconfirmed transactions
 	/// returned by the retriever (\a utRetriever).
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever);
+
+	/// Prototype for a function that retrieves unconfirmed transactions that are unknown to a peer
+	/// given a table of the peer's short hashes.
+	/// \note The function returns \c false if the short hashes set difference could not be decoded.
+	using UtReconciliationRetriever = std::function<bool (const utils::ShortHashIblt&, UnconfirmedTransactions&)>;
+
+	/// Registers a pull transactions reconciliation handler in \a handlers that responds with unconfirmed transactions
+	/// returned by the retriever (\a utReconciliationRetriever).
+	void RegisterPullTransactionsReconciliationHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const UtReconciliationRetriever& utReconciliationRetriever);
 }}
@@ -150,6 +150,28 @@ namespace catapult { namespace io {
 		return m_storage.loadHashesFrom(height, maxHashes);
 	}
 
+	model::HashRange BlockStorageView::loadHashesAt(const model::HeightRange& heights, size_t maxHashes) const {
+		auto height = chainHeight();
+		size_t numHashes = 0;
+		Height previousHeight;
+		for (auto requestHeight : heights) {
+			if (maxHashes == numHashes || requestHeight <= previousHeight || requestHeight > height)
+				break;
+
+			previousHeight = requestHeight;
+			++numHashes;
+		}
+
+		auto hashes = model::HashRange::PrepareFixed(numHashes);
+		auto heightIter = heights.cbegin();
+		for (auto& hash : hashes) {
+			hash = *m_storage.loadHashesFrom(*heightIter, 1).cbegin();
+			++heightIter;
+		}
+
+		return hashes;
+	}
+
 	// endregion
 
 	// region BlockStorageModifier
@@ -195,5 +217,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, m_lock.acquireReader(), *m_pCachedData);
 	}
 
+	utils::ReaderWriterLockStatistics BlockStorageCache::lockStatistics() const {
+		return m_lock.statistics();
+	}
+
 	// endregion
 }}
@@ -20,7 +20,7 @@
 
 #pragma once
 #include "BlockStorage.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ReaderWriterLock.h"
 
 namespace catapult { namespace io { struct CachedData; } }
 
@@ -32,7 +32,7 @@ namespace catapult { namespace io {
 		/// Creates a view around \a storage and cache data (\a cachedData) with lock context \a readLock.
 		explicit BlockStorageView(
 				const BlockStorage& storage,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
+				utils::ReaderWriterLock::ReaderLockGuard&& readLock,
 				const CachedData& cachedData)
 				: m_storage(storage)
 				, m_readLock(std::move(readLock))
@@ -52,9 +52,13 @@ namespace catapult { namespace io {
 		/// Returns a range of at most \a maxHashes hashes starting at \a height.
 		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const;
 
+		/// Returns a range of at most \a maxHashes hashes at \a heights.
+		/// \note Loading stops at the first height that is zero, not increasing or greater than the chain height.
+		model::HashRange loadHashesAt(const model::HeightRange& heights, size_t maxHashes) const;
+
 	private:
 		const BlockStorage& m_storage;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
 		const CachedData& m_cachedData;
 	};
 
@@ -64,7 +68,7 @@ namespace catapult { namespace io {
 		/// Creates a view around \a storage and cache data (\a cachedData) with lock context \a readLock.
 		explicit BlockStorageModifier(
 				BlockStorage& storage,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
+				utils::ReaderWriterLock::ReaderLockGuard&& readLock,
 				CachedData& cachedData)
 				: m_storage(storage)
 				, m_readLock(std::move(readLock))
@@ -84,8 +88,8 @@ namespace catapult { namespace io {
 
 	private:
 		BlockStorage& m_storage;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::WriterLockGuard m_writeLock;
 		CachedData& m_cachedData;
 	};
 
@@ -106,9 +110,12 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the contention statistics of the storage lock.
+		utils::ReaderWriterLockStatistics lockStatistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<CachedData> m_pCachedData;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ReaderWriterLock m_lock;
 	};
 }}
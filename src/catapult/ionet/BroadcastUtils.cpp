@@ -22,6 +22,9 @@
 #include "PacketPayloadFactory.h"
 #include "catapult/model/Block.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/model/EntityHasher.h"
+#include "catapult/utils/ShortHash.h"
+#include <cstring>
 
 namespace catapult { namespace ionet {
 
@@ -29,6 +32,21 @@ namespace catapult { namespace ionet {
 		return PacketPayloadFactory::FromEntity(PacketType::Push_Block, pBlock);
 	}
 
+	PacketPayload CreateCompactBroadcastPayload(const model::Block& block, const model::TransactionRegistry& registry) {
+		std::vector<utils::ShortHash> shortHashes;
+		for (const auto& transaction : block.Transactions()) {
+			const auto& plugin = *registry.findPlugin(transaction.Type);
+			shortHashes.push_back(utils::ToShortHash(model::CalculateHash(transaction, plugin.dataBuffer(transaction))));
+		}
+
+		auto shortHashesSize = static_cast<uint32_t>(shortHashes.size() * sizeof(utils::ShortHash));
+		auto pPacket = CreateSharedPacket<Packet>(static_cast<uint32_t>(sizeof(model::BlockHeader)) + shortHashesSize);
+		pPacket->Type = PacketType::Push_Compact_Block;
+		std::memcpy(pPacket->Data(), &block, sizeof(model::BlockHeader));
+		std::memcpy(pPacket->Data() + sizeof(model::BlockHeader), shortHashes.data(), shortHashesSize);
+		return PacketPayload(pPacket);
+	}
+
 	PacketPayload CreateBroadcastPayload(const std::vector<model::TransactionInfo>& transactionInfos) {
 		return CreateBroadcastPayload(transactionInfos, PacketType::Push_Transactions);
 	}
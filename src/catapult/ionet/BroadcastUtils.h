@@ -22,6 +22,7 @@
 #include "PacketPayload.h"
 #include "catapult/model/Cosignature.h"
 #include "catapult/model/EntityInfo.h"
+#include "catapult/model/TransactionPlugin.h"
 #include <vector>
 
 namespace catapult { namespace ionet {
@@ -29,6 +30,10 @@ namespace catapult { namespace ionet {
 	/// Creates a payload around \a pBlock for broadcasting.
 	PacketPayload CreateBroadcastPayload(const std::shared_ptr<const model::Block>& pBlock);
 
+	/// Creates a compact payload around \a block for broadcasting given a \a registry composed of known transactions.
+	/// \note The payload is composed of the block header followed by the short hashes of all block transactions.
+	PacketPayload CreateCompactBroadcastPayload(const model::Block& block, const model::TransactionRegistry& registry);
+
 	/// Creates a payload around \a transactionInfos for broadcasting.
 	PacketPayload CreateBroadcastPayload(const std::vector<model::TransactionInfo>& transactionInfos);
 
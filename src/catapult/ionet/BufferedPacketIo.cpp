@@ -19,7 +19,6 @@
 **/
 
 #include "BufferedPacketIo.h"
-#include "PacketIo.h"
 #include "catapult/utils/Logging.h"
 #include <deque>
 
@@ -33,6 +32,11 @@ namespace catapult { namespace ionet {
 					, m_payload(payload)
 			{}
 
+		public:
+			const PacketPayload& payload() const {
+				return m_payload;
+			}
+
 		public:
 			template<typename TCallback>
 			void invoke(TCallback callback) {
@@ -117,13 +121,94 @@ namespace catapult { namespace ionet {
 			std::deque<std::pair<TRequest, TCallback>> m_requests;
 		};
 
-		/// Protects RequestQueue via a strand.
-		template<typename TRequest, typename TCallback>
+		// write queue implementation that coalesces queued writes into batch writes
+		template<typename TCallbackWrapper>
+		class WriteRequestQueue {
+		public:
+			WriteRequestQueue(TCallbackWrapper& wrapper, const BatchPacketWriter& batchWriter, size_t maxBatchWriteSize)
+					: m_wrapper(wrapper)
+					, m_batchWriter(batchWriter)
+					, m_maxBatchWriteSize(maxBatchWriteSize)
+					, m_numInProgressRequests(0)
+					, m_numPendingCallbacks(0)
+			{}
+
+		public:
+			void push(const WriteRequest& request, const PacketIo::WriteCallback& callback) {
+				m_requests.emplace_back(request, callback);
+
+				if (0 != m_numInProgressRequests) {
+					CATAPULT_LOG(trace) << "queuing work because in progress operation detected";
+					return;
+				}
+
+				next();
+			}
+
+		private:
+			void next() {
+				// note that requests should only be popped after all of their callbacks are invoked (and the operation is complete)
+				m_numInProgressRequests = countCoalescableRequests();
+				m_numPendingCallbacks = m_numInProgressRequests;
+				if (1 == m_numInProgressRequests) {
+					m_requests.front().first.invoke(m_wrapper.wrap(createCompletionHandler(0)));
+					return;
+				}
+
+				PacketPayloadWrites writes;
+				for (auto i = 0u; i < m_numInProgressRequests; ++i)
+					writes.emplace_back(m_requests[i].first.payload(), m_wrapper.wrap(createCompletionHandler(i)));
+
+				CATAPULT_LOG(trace) << "coalescing " << m_numInProgressRequests << " queued writes";
+				m_batchWriter(writes);
+			}
+
+			size_t countCoalescableRequests() const {
+				// always write at least one payload and then coalesce subsequent payloads as long as they fit
+				size_t numRequests = 1;
+				size_t batchWriteSize = m_requests.front().first.payload().header().Size;
+				for (; numRequests < m_requests.size(); ++numRequests) {
+					batchWriteSize += m_requests[numRequests].first.payload().header().Size;
+					if (batchWriteSize > m_maxBatchWriteSize)
+						break;
+				}
+
+				return numRequests;
+			}
+
+			auto createCompletionHandler(size_t index) {
+				return [this, index](auto code) {
+					// copy the user handler because it can extend the lifetime of this queue
+					auto handler = m_requests[index].second;
+					handler(code);
+					if (0 != --m_numPendingCallbacks)
+						return;
+
+					// pop the completed requests and, if requests are pending, start the next batch
+					for (; 0 != m_numInProgressRequests; --m_numInProgressRequests)
+						m_requests.pop_front();
+					if (!m_requests.empty())
+						next();
+				};
+			}
+
+		private:
+			TCallbackWrapper& m_wrapper;
+			BatchPacketWriter m_batchWriter;
+			size_t m_maxBatchWriteSize;
+			std::deque<std::pair<WriteRequest, PacketIo::WriteCallback>> m_requests;
+			size_t m_numInProgressRequests;
+			size_t m_numPendingCallbacks;
+		};
+
+		/// Protects a request queue (\a TRequestQueue) via a strand.
+		template<typename TRequestQueue, typename TRequest, typename TCallback>
 		class QueuedOperation {
 		public:
-			explicit QueuedOperation(boost::asio::strand& strand)
+			template<typename... TArgs>
+			explicit QueuedOperation(boost::asio::strand& strand, TArgs&&... args)
 					: m_strand(strand)
-					, m_requests(m_strand)
+					, m_requests(m_strand, std::forward<TArgs>(args)...)
 			{}
 
 		public:
@@ -135,20 +220,25 @@ namespace catapult { namespace ionet {
 
 		private:
 			boost::asio::strand& m_strand;
-			RequestQueue<TRequest, TCallback, boost::asio::strand> m_requests;
+			TRequestQueue m_requests;
 		};
 
-		using QueuedWriteOperation = QueuedOperation<WriteRequest, PacketIo::WriteCallback>;
-		using QueuedReadOperation = QueuedOperation<ReadRequest, PacketIo::ReadCallback>;
+		using QueuedWriteOperation = QueuedOperation<WriteRequestQueue<boost::asio::strand>, WriteRequest, PacketIo::WriteCallback>;
+		using ReadRequestQueue = RequestQueue<ReadRequest, PacketIo::ReadCallback, boost::asio::strand>;
+		using QueuedReadOperation = QueuedOperation<ReadRequestQueue, ReadRequest, PacketIo::ReadCallback>;
 
 		class BufferedPacketIo
 				: public PacketIo
 				, public std::enable_shared_from_this<BufferedPacketIo> {
 		public:
-			BufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::strand& strand)
+			BufferedPacketIo(
+					const std::shared_ptr<PacketIo>& pIo,
+					boost::asio::strand& strand,
+					const BatchPacketWriter& batchWriter,
+					size_t maxBatchWriteSize)
 					: m_pIo(pIo)
 					, m_strand(strand)
-					, m_pWriteOperation(std::make_unique<QueuedWriteOperation>(m_strand))
+					, m_pWriteOperation(std::make_unique<QueuedWriteOperation>(m_strand, batchWriter, maxBatchWriteSize))
 					, m_pReadOperation(std::make_unique<QueuedReadOperation>(m_strand))
 			{}
 
@@ -176,6 +266,14 @@ namespace catapult { namespace ionet {
 	}
 
 	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::strand& strand) {
-		return std::make_shared<BufferedPacketIo>(pIo, strand);
+		return CreateBufferedPacketIo(pIo, strand, BatchPacketWriter(), 0);
+	}
+
+	std::shared_ptr<PacketIo> CreateBufferedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			boost::asio::strand& strand,
+			const BatchPacketWriter& batchWriter,
+			size_t maxBatchWriteSize) {
+		return std::make_shared<BufferedPacketIo>(pIo, strand, batchWriter, maxBatchWriteSize);
 	}
 }}
@@ -20,11 +20,26 @@
 
 #pragma once
 #include "IoTypes.h"
-
-namespace catapult { namespace ionet { class PacketIo; } }
+#include "PacketIo.h"
+#include <vector>
 
 namespace catapult { namespace ionet {
 
+	/// Pairs of payloads and write callbacks that are written together.
+	using PacketPayloadWrites = std::vector<std::pair<PacketPayload, PacketIo::WriteCallback>>;
+
+	/// Writes multiple payloads with a single (gathered) write and calls the callback paired with each payload on completion.
+	using BatchPacketWriter = consumer<const PacketPayloadWrites&>;
+
 	/// Adds buffering to \a pIo using \a strand for synchronization.
 	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::strand& strand);
+
+	/// Adds buffering to \a pIo using \a strand for synchronization.
+	/// Queued writes are coalesced and written by \a batchWriter as long as their total size does not exceed \a maxBatchWriteSize.
+	/// \note \c 0 \a maxBatchWriteSize will disable write coalescing.
+	std::shared_ptr<PacketIo> CreateBufferedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			boost::asio::strand& strand,
+			const BatchPacketWriter& batchWriter,
+			size_t maxBatchWriteSize);
 }}
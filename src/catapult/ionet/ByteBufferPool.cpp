@@ -0,0 +1,67 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ByteBufferPool.h"
+
+namespace catapult { namespace ionet {
+
+	ByteBufferPool::ByteBufferPool(size_t bufferCapacity, size_t maxPooledBuffers)
+			: m_bufferCapacity(bufferCapacity)
+			, m_maxPooledBuffers(maxPooledBuffers) {
+		m_buffers.reserve(m_maxPooledBuffers);
+	}
+
+	size_t ByteBufferPool::bufferCapacity() const {
+		return m_bufferCapacity;
+	}
+
+	size_t ByteBufferPool::numPooledBuffers() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_buffers.size();
+	}
+
+	ByteBuffer ByteBufferPool::acquire() {
+		{
+			utils::SpinLockGuard guard(m_lock);
+			if (!m_buffers.empty()) {
+				auto buffer = std::move(m_buffers.back());
+				m_buffers.pop_back();
+				return buffer;
+			}
+		}
+
+		// allocate outside of the lock when the pool is exhausted
+		ByteBuffer buffer;
+		buffer.reserve(m_bufferCapacity);
+		return buffer;
+	}
+
+	void ByteBufferPool::release(ByteBuffer&& buffer) {
+		// discard buffers that have been resized (e.g. to hold a large packet) so that their memory is reclaimed
+		if (m_bufferCapacity != buffer.capacity())
+			return;
+
+		buffer.clear();
+
+		utils::SpinLockGuard guard(m_lock);
+		if (m_buffers.size() < m_maxPooledBuffers)
+			m_buffers.push_back(std::move(buffer));
+	}
+}}
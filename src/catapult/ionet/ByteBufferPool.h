@@ -0,0 +1,56 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "IoTypes.h"
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/utils/SpinLock.h"
+#include <vector>
+
+namespace catapult { namespace ionet {
+
+	/// Thread-safe pool of reusable byte buffers that can be shared by multiple sockets.
+	class ByteBufferPool : public utils::NonCopyable {
+	public:
+		/// Creates a pool that retains at most \a maxPooledBuffers buffers each with a capacity of \a bufferCapacity bytes.
+		ByteBufferPool(size_t bufferCapacity, size_t maxPooledBuffers);
+
+	public:
+		/// Gets the capacity of buffers returned by this pool.
+		size_t bufferCapacity() const;
+
+		/// Gets the number of buffers currently retained by this pool.
+		size_t numPooledBuffers() const;
+
+	public:
+		/// Acquires an empty buffer with bufferCapacity() capacity.
+		ByteBuffer acquire();
+
+		/// Releases \a buffer back into the pool.
+		/// \note Buffers with a capacity other than bufferCapacity() or that exceed the pool size are discarded.
+		void release(ByteBuffer&& buffer);
+
+	private:
+		size_t m_bufferCapacity;
+		size_t m_maxPooledBuffers;
+		std::vector<ByteBuffer> m_buffers;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -19,16 +19,16 @@
 **/
 
 #pragma once
-#include "catapult/ionet/Packet.h"
+#include "Packet.h"
 #include "catapult/types.h"
 
-namespace catapult { namespace api {
+namespace catapult { namespace ionet {
 
 #pragma pack(push, 1)
 
 	/// A chain info response.
-	struct ChainInfoResponse : public ionet::Packet {
-		static constexpr ionet::PacketType Packet_Type = ionet::PacketType::Chain_Info;
+	struct ChainInfoResponse : public Packet {
+		static constexpr PacketType Packet_Type = PacketType::Chain_Info;
 
 		/// Chain height.
 		catapult::Height Height;
@@ -41,22 +41,22 @@ namespace catapult { namespace api {
 	};
 
 	/// A packet containing header information and a height.
-	template<ionet::PacketType PacketType>
-	struct HeightPacket : public ionet::Packet {
-		static constexpr ionet::PacketType Packet_Type = PacketType;
+	template<PacketType TPacketType>
+	struct HeightPacket : public Packet {
+		static constexpr PacketType Packet_Type = TPacketType;
 
 		/// Requested block height.
 		catapult::Height Height;
 	};
 
 	/// A pull block request.
-	using PullBlockRequest = HeightPacket<ionet::PacketType::Pull_Block>;
+	using PullBlockRequest = HeightPacket<PacketType::Pull_Block>;
 
 	/// A block hashes request.
-	using BlockHashesRequest = HeightPacket<ionet::PacketType::Block_Hashes>;
+	using BlockHashesRequest = HeightPacket<PacketType::Block_Hashes>;
 
 	/// A pull blocks request.
-	struct PullBlocksRequest : public HeightPacket<ionet::PacketType::Pull_Blocks> {
+	struct PullBlocksRequest : public HeightPacket<PacketType::Pull_Blocks> {
 		/// Requested number of blocks.
 		uint32_t NumBlocks;
 
@@ -64,5 +64,11 @@ namespace catapult { namespace api {
 		uint32_t NumResponseBytes;
 	};
 
+	/// A pull block headers request.
+	struct PullBlockHeadersRequest : public HeightPacket<PacketType::Pull_Block_Headers> {
+		/// Requested number of block headers.
+		uint32_t NumBlockHeaders;
+	};
+
 #pragma pack(pop)
 }}
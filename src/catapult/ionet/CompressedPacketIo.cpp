@@ -0,0 +1,301 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CompressedPacketIo.h"
+#include "BatchPacketReader.h"
+#include "DecoratedPacketSocket.h"
+#include "PacketIo.h"
+#include "PacketSocket.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/SpinLock.h"
+#include <zlib.h>
+
+namespace catapult { namespace ionet {
+
+	std::ostream& operator<<(std::ostream& out, const PacketCompressionStatistics& statistics) {
+		out
+				<< "compressed " << statistics.NumCompressedPackets << " packets ("
+				<< statistics.NumUncompressedBytes << " -> " << statistics.NumCompressedBytes << " bytes), decompressed "
+				<< statistics.NumDecompressedPackets << " packets";
+		return out;
+	}
+
+	namespace {
+#pragma pack(push, 1)
+
+		struct CompressedPacketHeader : public Packet {
+			static constexpr PacketType Packet_Type = PacketType::Compressed;
+
+			/// Size of the (uncompressed) child packet.
+			uint32_t UncompressedSize;
+		};
+
+#pragma pack(pop)
+
+		// deflate stream that is reused for all packets written to a single connection
+		class Deflater {
+		public:
+			Deflater() : m_stream() {
+				m_isInitialized = Z_OK == deflateInit(&m_stream, Z_BEST_SPEED);
+			}
+
+			~Deflater() {
+				if (m_isInitialized)
+					deflateEnd(&m_stream);
+			}
+
+		public:
+			bool tryDeflate(const PacketPayload& payload, uint8_t* pOutput, uint32_t outputSize, uint32_t& compressedSize) {
+				// connection ios can write concurrently, so serialize access to the (stateful) stream
+				utils::SpinLockGuard guard(m_lock);
+				if (!m_isInitialized || Z_OK != deflateReset(&m_stream))
+					return false;
+
+				m_stream.next_out = pOutput;
+				m_stream.avail_out = outputSize;
+
+				// compress full payload, including header
+				const auto& header = payload.header();
+				if (!update(reinterpret_cast<const uint8_t*>(&header), sizeof(PacketHeader), Z_NO_FLUSH))
+					return false;
+
+				for (const auto& buffer : payload.buffers()) {
+					if (!update(buffer.pData, buffer.Size, Z_NO_FLUSH))
+						return false;
+				}
+
+				if (Z_STREAM_END != deflate(&m_stream, Z_FINISH))
+					return false;
+
+				compressedSize = outputSize - m_stream.avail_out;
+				return true;
+			}
+
+		private:
+			bool update(const uint8_t* pData, size_t size, int flush) {
+				m_stream.next_in = const_cast<uint8_t*>(pData);
+				m_stream.avail_in = static_cast<uInt>(size);
+				auto result = deflate(&m_stream, flush);
+
+				// when output space is exhausted, the payload is not compressible enough to be worth compressing
+				return Z_OK == result && 0 == m_stream.avail_in;
+			}
+
+		private:
+			z_stream m_stream;
+			bool m_isInitialized;
+			utils::SpinLock m_lock;
+		};
+
+		bool TryInflate(const uint8_t* pData, uint32_t size, uint8_t* pOutput, uint32_t outputSize) {
+			z_stream stream = z_stream();
+			if (Z_OK != inflateInit(&stream))
+				return false;
+
+			stream.next_in = const_cast<uint8_t*>(pData);
+			stream.avail_in = size;
+			stream.next_out = pOutput;
+			stream.avail_out = outputSize;
+			auto result = inflate(&stream, Z_FINISH);
+			auto isComplete = Z_STREAM_END == result && 0 == stream.avail_out && 0 == stream.avail_in;
+			inflateEnd(&stream);
+			return isComplete;
+		}
+
+		class DecompressingReadCallback {
+		public:
+			DecompressingReadCallback(
+					uint32_t maxPacketDataSize,
+					PacketCompressionStatistics& statistics,
+					const PacketIo::ReadCallback& callback)
+					: m_maxPacketDataSize(maxPacketDataSize)
+					, m_statistics(statistics)
+					, m_callback(callback)
+			{}
+
+		public:
+			void operator()(SocketOperationCode code, const Packet* pPacket) {
+				// uncompressed packets are forwarded as is
+				if (SocketOperationCode::Success != code || CompressedPacketHeader::Packet_Type != pPacket->Type)
+					return m_callback(code, pPacket);
+
+				// cannot use CoercePacket because Size is variable
+				if (sizeof(CompressedPacketHeader) > pPacket->Size)
+					return m_callback(SocketOperationCode::Malformed_Data, nullptr);
+
+				const auto& compressedPacketHeader = static_cast<const CompressedPacketHeader&>(*pPacket);
+				auto uncompressedSize = compressedPacketHeader.UncompressedSize;
+				if (sizeof(PacketHeader) > uncompressedSize || uncompressedSize - sizeof(PacketHeader) > m_maxPacketDataSize) {
+					CATAPULT_LOG(warning) << "rejecting compressed packet with uncompressed size " << uncompressedSize;
+					return m_callback(SocketOperationCode::Malformed_Data, nullptr);
+				}
+
+				ByteBuffer buffer(uncompressedSize);
+				const auto* pCompressedData = reinterpret_cast<const uint8_t*>(&compressedPacketHeader + 1);
+				auto compressedSize = static_cast<uint32_t>(pPacket->Size - sizeof(CompressedPacketHeader));
+				if (!TryInflate(pCompressedData, compressedSize, buffer.data(), uncompressedSize)) {
+					CATAPULT_LOG(warning) << "failed to decompress packet with compressed size " << compressedSize;
+					return m_callback(SocketOperationCode::Malformed_Data, nullptr);
+				}
+
+				const auto& childPacket = reinterpret_cast<const Packet&>(buffer[0]);
+				if (uncompressedSize != childPacket.Size || CompressedPacketHeader::Packet_Type == childPacket.Type)
+					return m_callback(SocketOperationCode::Malformed_Data, nullptr);
+
+				++m_statistics.NumDecompressedPackets;
+				m_callback(code, &childPacket);
+			}
+
+		private:
+			uint32_t m_maxPacketDataSize;
+			PacketCompressionStatistics& m_statistics;
+			PacketIo::ReadCallback m_callback;
+		};
+
+		class CompressedPacketIo
+				: public PacketIo
+				, public std::enable_shared_from_this<CompressedPacketIo> {
+		public:
+			CompressedPacketIo(
+					const std::shared_ptr<PacketIo>& pIo,
+					uint32_t compressionThreshold,
+					uint32_t maxPacketDataSize,
+					const std::shared_ptr<Deflater>& pDeflater,
+					const std::shared_ptr<PacketCompressionStatistics>& pStatistics)
+					: m_pIo(pIo)
+					, m_compressionThreshold(compressionThreshold)
+					, m_maxPacketDataSize(maxPacketDataSize)
+					, m_pDeflater(pDeflater)
+					, m_pStatistics(pStatistics)
+			{}
+
+		public:
+			void write(const PacketPayload& payload, const WriteCallback& callback) override {
+				if (payload.unset() || 0 == m_compressionThreshold || payload.header().Size < m_compressionThreshold)
+					return m_pIo->write(payload, callback);
+
+				auto pCompressedPacket = tryCompress(payload);
+				if (!pCompressedPacket)
+					return m_pIo->write(payload, callback);
+
+				++m_pStatistics->NumCompressedPackets;
+				m_pStatistics->NumUncompressedBytes += payload.header().Size;
+				m_pStatistics->NumCompressedBytes += pCompressedPacket->Size;
+				m_pIo->write(PacketPayload(pCompressedPacket), callback);
+			}
+
+			void read(const ReadCallback& callback) override {
+				m_pIo->read([pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+					DecompressingReadCallback(pThis->m_maxPacketDataSize, *pThis->m_pStatistics, callback)(code, pPacket);
+				});
+			}
+
+		private:
+			std::shared_ptr<Packet> tryCompress(const PacketPayload& payload) {
+				// only use compression when it results in a smaller packet
+				auto uncompressedSize = payload.header().Size;
+				if (uncompressedSize <= sizeof(CompressedPacketHeader))
+					return nullptr;
+
+				auto maxCompressedSize = static_cast<uint32_t>(uncompressedSize - sizeof(CompressedPacketHeader));
+				auto pCompressedPacket = CreateSharedPacket<CompressedPacketHeader>(maxCompressedSize);
+				pCompressedPacket->UncompressedSize = uncompressedSize;
+
+				uint32_t compressedSize;
+				auto* pCompressedData = reinterpret_cast<uint8_t*>(pCompressedPacket.get() + 1);
+				if (!m_pDeflater->tryDeflate(payload, pCompressedData, maxCompressedSize, compressedSize))
+					return nullptr;
+
+				pCompressedPacket->Size = static_cast<uint32_t>(sizeof(CompressedPacketHeader) + compressedSize);
+				return pCompressedPacket;
+			}
+
+		private:
+			std::shared_ptr<PacketIo> m_pIo;
+			uint32_t m_compressionThreshold;
+			uint32_t m_maxPacketDataSize;
+			std::shared_ptr<Deflater> m_pDeflater;
+			std::shared_ptr<PacketCompressionStatistics> m_pStatistics;
+		};
+	}
+
+	std::shared_ptr<PacketIo> CreateCompressedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			uint32_t compressionThreshold,
+			uint32_t maxPacketDataSize,
+			const std::shared_ptr<PacketCompressionStatistics>& pStatistics) {
+		auto pDeflater = std::make_shared<Deflater>();
+		return std::make_shared<CompressedPacketIo>(pIo, compressionThreshold, maxPacketDataSize, pDeflater, pStatistics);
+	}
+
+	namespace {
+		class CompressedBatchPacketReader
+				: public BatchPacketReader
+				, public std::enable_shared_from_this<CompressedBatchPacketReader> {
+		public:
+			CompressedBatchPacketReader(
+					const std::shared_ptr<BatchPacketReader>& pReader,
+					uint32_t maxPacketDataSize,
+					const std::shared_ptr<PacketCompressionStatistics>& pStatistics)
+					: m_pReader(pReader)
+					, m_maxPacketDataSize(maxPacketDataSize)
+					, m_pStatistics(pStatistics)
+			{}
+
+		public:
+			void readMultiple(const PacketIo::ReadCallback& callback) override {
+				m_pReader->readMultiple([pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+					DecompressingReadCallback(pThis->m_maxPacketDataSize, *pThis->m_pStatistics, callback)(code, pPacket);
+				});
+			}
+
+		private:
+			std::shared_ptr<BatchPacketReader> m_pReader;
+			uint32_t m_maxPacketDataSize;
+			std::shared_ptr<PacketCompressionStatistics> m_pStatistics;
+		};
+	}
+
+	std::shared_ptr<BatchPacketReader> CreateCompressedBatchPacketReader(
+			const std::shared_ptr<BatchPacketReader>& pReader,
+			uint32_t maxPacketDataSize,
+			const std::shared_ptr<PacketCompressionStatistics>& pStatistics) {
+		return std::make_shared<CompressedBatchPacketReader>(pReader, maxPacketDataSize, pStatistics);
+	}
+
+	std::shared_ptr<PacketSocket> Compress(
+			const std::shared_ptr<PacketSocket>& pSocket,
+			uint32_t compressionThreshold,
+			uint32_t maxPacketDataSize) {
+		// all ios and the reader share the statistics, which are logged when the connection is destroyed
+		auto pStatistics = std::shared_ptr<PacketCompressionStatistics>(new PacketCompressionStatistics(), [](const auto* pStatistics) {
+			CATAPULT_LOG(debug) << "connection packet compression statistics: " << *pStatistics;
+			delete pStatistics;
+		});
+
+		// all ios share a single deflate stream, which is reset (instead of recreated) for every compressed packet
+		auto pDeflater = std::make_shared<Deflater>();
+		auto ioDecorator = [compressionThreshold, maxPacketDataSize, pDeflater, pStatistics](const auto& pIo) {
+			return std::make_shared<CompressedPacketIo>(pIo, compressionThreshold, maxPacketDataSize, pDeflater, pStatistics);
+		};
+		auto pReader = CreateCompressedBatchPacketReader(pSocket, maxPacketDataSize, pStatistics);
+		return CreateDecoratedPacketSocket(pSocket, ioDecorator, pReader);
+	}
+}}
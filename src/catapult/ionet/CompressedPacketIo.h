@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <atomic>
+#include <iosfwd>
+#include <memory>
+#include <stdint.h>
+
+namespace catapult {
+	namespace ionet {
+		class BatchPacketReader;
+		class PacketIo;
+		class PacketSocket;
+	}
+}
+
+namespace catapult { namespace ionet {
+
+	/// Packet compression statistics of a single connection.
+	struct PacketCompressionStatistics {
+		/// Number of packets that were compressed before being written.
+		std::atomic<uint64_t> NumCompressedPackets{ 0 };
+
+		/// Total size of all compressed packets before compression.
+		std::atomic<uint64_t> NumUncompressedBytes{ 0 };
+
+		/// Total size of all compressed packets after compression.
+		std::atomic<uint64_t> NumCompressedBytes{ 0 };
+
+		/// Number of packets that were decompressed after being read.
+		std::atomic<uint64_t> NumDecompressedPackets{ 0 };
+	};
+
+	/// Insertion operator for outputting \a statistics to \a out.
+	std::ostream& operator<<(std::ostream& out, const PacketCompressionStatistics& statistics);
+
+	/// Adds compression to all packets read from and written to \a pIo.
+	/// - All written packets with a size of at least \a compressionThreshold are compressed when that reduces their size.
+	/// - All read compressed packets are decompressed and must have a max packet data size of \a maxPacketDataSize.
+	/// \note Compression and decompression are recorded in \a pStatistics.
+	/// \note A \a compressionThreshold of \c 0 disables compression of written packets.
+	std::shared_ptr<PacketIo> CreateCompressedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			uint32_t compressionThreshold,
+			uint32_t maxPacketDataSize,
+			const std::shared_ptr<PacketCompressionStatistics>& pStatistics);
+
+	/// Adds decompression to all packets read from \a pReader.
+	/// - All read compressed packets are decompressed and must have a max packet data size of \a maxPacketDataSize.
+	/// \note Decompression is recorded in \a pStatistics.
+	std::shared_ptr<BatchPacketReader> CreateCompressedBatchPacketReader(
+			const std::shared_ptr<BatchPacketReader>& pReader,
+			uint32_t maxPacketDataSize,
+			const std::shared_ptr<PacketCompressionStatistics>& pStatistics);
+
+	/// Adds compression to a packet socket (\a pSocket) by compressing written packets with a size of at least
+	/// \a compressionThreshold and decompressing read packets with a max packet data size of \a maxPacketDataSize.
+	/// \note A \a compressionThreshold of \c 0 disables compression of written packets.
+	/// \note All ios of the socket share a single deflate stream.
+	/// \note Packets are compressed inline by the writing thread (before they are queued for writing).
+	/// \note Per-connection compression statistics are logged when the connection is destroyed.
+	std::shared_ptr<PacketSocket> Compress(
+			const std::shared_ptr<PacketSocket>& pSocket,
+			uint32_t compressionThreshold,
+			uint32_t maxPacketDataSize);
+}}
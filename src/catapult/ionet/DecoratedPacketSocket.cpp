@@ -0,0 +1,79 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "DecoratedPacketSocket.h"
+#include "PacketSocket.h"
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		class DecoratedPacketSocket : public PacketSocket {
+		public:
+			DecoratedPacketSocket(
+					const std::shared_ptr<PacketSocket>& pSocket,
+					const PacketIoDecorator& ioDecorator,
+					const std::shared_ptr<BatchPacketReader>& pReader)
+					: m_pSocket(pSocket)
+					, m_ioDecorator(ioDecorator)
+					, m_pIo(m_ioDecorator(m_pSocket))
+					, m_pReader(pReader)
+			{}
+
+		public:
+			void read(const ReadCallback& callback) override {
+				m_pIo->read(callback);
+			}
+
+			void write(const PacketPayload& payload, const WriteCallback& callback) override {
+				m_pIo->write(payload, callback);
+			}
+
+			void readMultiple(const ReadCallback& callback) override {
+				m_pReader->readMultiple(callback);
+			}
+
+		public:
+			void stats(const StatsCallback& callback) override {
+				m_pSocket->stats(callback);
+			}
+
+			void close() override {
+				m_pSocket->close();
+			}
+
+			std::shared_ptr<PacketIo> buffered() override {
+				return m_ioDecorator(m_pSocket->buffered());
+			}
+
+		private:
+			std::shared_ptr<PacketSocket> m_pSocket;
+			PacketIoDecorator m_ioDecorator;
+			std::shared_ptr<PacketIo> m_pIo;
+			std::shared_ptr<BatchPacketReader> m_pReader;
+		};
+	}
+
+	std::shared_ptr<PacketSocket> CreateDecoratedPacketSocket(
+			const std::shared_ptr<PacketSocket>& pSocket,
+			const PacketIoDecorator& ioDecorator,
+			const std::shared_ptr<BatchPacketReader>& pReader) {
+		return std::make_shared<DecoratedPacketSocket>(pSocket, ioDecorator, pReader);
+	}
+}}
@@ -0,0 +1,44 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <functional>
+#include <memory>
+
+namespace catapult {
+	namespace ionet {
+		class BatchPacketReader;
+		class PacketIo;
+		class PacketSocket;
+	}
+}
+
+namespace catapult { namespace ionet {
+
+	/// Function that decorates a packet io.
+	using PacketIoDecorator = std::function<std::shared_ptr<PacketIo> (const std::shared_ptr<PacketIo>&)>;
+
+	/// Creates a packet socket around \a pSocket that decorates both its default and buffered ios with \a ioDecorator
+	/// and that uses \a pReader for batch reads.
+	std::shared_ptr<PacketSocket> CreateDecoratedPacketSocket(
+			const std::shared_ptr<PacketSocket>& pSocket,
+			const PacketIoDecorator& ioDecorator,
+			const std::shared_ptr<BatchPacketReader>& pReader);
+}}
@@ -63,9 +63,10 @@ namespace catapult { namespace ionet {
 #undef DEFINE_ENUM
 
 	namespace {
-		const std::array<std::pair<const char*, ConnectionSecurityMode>, 2> String_To_Connection_Security_Mode_Pairs{{
+		const std::array<std::pair<const char*, ConnectionSecurityMode>, 3> String_To_Connection_Security_Mode_Pairs{{
 			{ "None", ConnectionSecurityMode::None },
-			{ "Signed", ConnectionSecurityMode::Signed }
+			{ "Signed", ConnectionSecurityMode::Signed },
+			{ "Session", ConnectionSecurityMode::Session }
 		}};
 	}
 
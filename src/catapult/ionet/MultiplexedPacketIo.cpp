@@ -0,0 +1,332 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiplexedPacketIo.h"
+#include "PacketIo.h"
+#include "catapult/thread/TimedCallback.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/SpinLock.h"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <unordered_map>
+
+namespace catapult { namespace ionet {
+
+	const Packet* GetMultiplexedChildPacket(const MultiplexedPacket& packet) {
+		if (sizeof(MultiplexedPacket) + sizeof(PacketHeader) > packet.Size)
+			return nullptr;
+
+		const auto& childPacket = reinterpret_cast<const Packet&>(*(&packet + 1));
+		if (packet.Size - sizeof(MultiplexedPacket) != childPacket.Size || MultiplexedPacket::Packet_Type == childPacket.Type)
+			return nullptr;
+
+		return &childPacket;
+	}
+
+	namespace {
+		using ResponseCallback = consumer<SocketOperationCode, const std::shared_ptr<const Packet>&>;
+		using TimedResponseCallback = thread::StrandedTimedCallback<ResponseCallback, SocketOperationCode, std::shared_ptr<const Packet>>;
+
+		std::shared_ptr<const Packet> CopyPacket(const Packet& packet) {
+			auto pPacket = utils::MakeSharedWithSize<Packet>(packet.Size);
+			std::memcpy(static_cast<void*>(pPacket.get()), &packet, packet.Size);
+			return pPacket;
+		}
+
+		class DefaultPacketMultiplexer
+				: public PacketMultiplexer
+				, public std::enable_shared_from_this<DefaultPacketMultiplexer> {
+		private:
+			struct PendingRequest {
+			public:
+				PendingRequest() : IsAwaitingResponse(true), IsCompleted(false), Code(SocketOperationCode::Success)
+				{}
+
+			public:
+				std::shared_ptr<TimedResponseCallback> pTimedCallback;
+				PacketIo::ReadCallback ReadCallback;
+				bool IsAwaitingResponse;
+				bool IsCompleted;
+				SocketOperationCode Code;
+				std::shared_ptr<const Packet> pResponse;
+			};
+
+		public:
+			DefaultPacketMultiplexer(
+					const std::shared_ptr<PacketIo>& pIo,
+					boost::asio::io_service& service,
+					const utils::TimeSpan& requestTimeout)
+					: m_pIo(pIo)
+					, m_service(service)
+					, m_requestTimeout(requestTimeout)
+					, m_nextRequestId(0)
+					, m_isReading(false)
+			{}
+
+		public:
+			size_t numPendingRequests() const override {
+				utils::SpinLockGuard guard(m_lock);
+				return m_requests.size();
+			}
+
+			std::shared_ptr<PacketIo> createChannel() override;
+
+		public:
+			uint32_t registerRequest() {
+				std::unique_lock<utils::SpinLock> lock(m_lock);
+				auto requestId = ++m_nextRequestId;
+				auto& request = m_requests[requestId];
+
+				// the timed callback ensures that a request is completed exactly once
+				// (by its response, by an io error or by a timeout)
+				ResponseCallback responseCallback = [pThis = shared_from_this(), requestId](auto code, const auto& pResponse) {
+					pThis->onResponse(requestId, code, pResponse);
+				};
+				request.pTimedCallback = thread::MakeTimedCallback(
+						m_service,
+						responseCallback,
+						SocketOperationCode::Timed_Out,
+						std::shared_ptr<const Packet>());
+				auto pTimedCallback = request.pTimedCallback;
+				lock.unlock();
+
+				pTimedCallback->setTimeout(m_requestTimeout);
+				return requestId;
+			}
+
+			void write(uint32_t requestId, const PacketPayload& payload, const PacketIo::WriteCallback& callback) {
+				auto pHeader = CreateSharedPacket<MultiplexedPacket>();
+				pHeader->RequestId = requestId;
+				m_pIo->write(PacketPayload::Merge(pHeader, payload), [pThis = shared_from_this(), requestId, callback](auto code) {
+					if (SocketOperationCode::Success == code)
+						pThis->startReading();
+					else
+						pThis->complete(requestId, code, nullptr);
+
+					callback(code);
+				});
+			}
+
+			void read(uint32_t requestId, const PacketIo::ReadCallback& callback) {
+				std::unique_lock<utils::SpinLock> lock(m_lock);
+				auto iter = m_requests.find(requestId);
+				if (m_requests.end() == iter) {
+					lock.unlock();
+					return callback(SocketOperationCode::Read_Error, nullptr);
+				}
+
+				if (!iter->second.IsCompleted) {
+					iter->second.ReadCallback = callback;
+					return;
+				}
+
+				auto code = iter->second.Code;
+				auto pResponse = iter->second.pResponse;
+				m_requests.erase(iter);
+				lock.unlock();
+				callback(code, pResponse.get());
+			}
+
+			void release(const std::deque<uint32_t>& requestIds) {
+				std::vector<std::shared_ptr<TimedResponseCallback>> timedCallbacks;
+				{
+					utils::SpinLockGuard guard(m_lock);
+					for (auto requestId : requestIds) {
+						auto iter = m_requests.find(requestId);
+						if (m_requests.end() == iter)
+							continue;
+
+						if (iter->second.IsAwaitingResponse)
+							timedCallbacks.push_back(iter->second.pTimedCallback);
+
+						m_requests.erase(iter);
+					}
+				}
+
+				// complete released requests so that their timers are cancelled
+				for (const auto& pTimedCallback : timedCallbacks)
+					pTimedCallback->callback(SocketOperationCode::Closed, std::shared_ptr<const Packet>());
+			}
+
+		private:
+			void startReading() {
+				{
+					utils::SpinLockGuard guard(m_lock);
+					if (m_isReading || !isAnyRequestAwaitingResponse())
+						return;
+
+					m_isReading = true;
+				}
+
+				m_pIo->read([pThis = shared_from_this()](auto code, const auto* pPacket) {
+					pThis->handleRead(code, pPacket);
+				});
+			}
+
+			void handleRead(SocketOperationCode code, const Packet* pPacket) {
+				{
+					utils::SpinLockGuard guard(m_lock);
+					m_isReading = false;
+				}
+
+				if (SocketOperationCode::Success != code)
+					return completeAll(code);
+
+				const Packet* pChildPacket = nullptr;
+				if (MultiplexedPacket::Packet_Type == pPacket->Type && sizeof(MultiplexedPacket) <= pPacket->Size)
+					pChildPacket = GetMultiplexedChildPacket(static_cast<const MultiplexedPacket&>(*pPacket));
+
+				if (!pChildPacket) {
+					CATAPULT_LOG(warning) << "received unexpected packet in response to multiplexed request " << *pPacket;
+					return completeAll(SocketOperationCode::Malformed_Data);
+				}
+
+				auto requestId = static_cast<const MultiplexedPacket&>(*pPacket).RequestId;
+				if (!complete(requestId, SocketOperationCode::Success, pChildPacket))
+					CATAPULT_LOG(debug) << "dropping response to unknown or expired multiplexed request " << requestId;
+
+				startReading();
+			}
+
+			bool complete(uint32_t requestId, SocketOperationCode code, const Packet* pPacket) {
+				std::shared_ptr<TimedResponseCallback> pTimedCallback;
+				{
+					utils::SpinLockGuard guard(m_lock);
+					auto iter = m_requests.find(requestId);
+					if (m_requests.end() == iter || !iter->second.IsAwaitingResponse)
+						return false;
+
+					iter->second.IsAwaitingResponse = false;
+					pTimedCallback = iter->second.pTimedCallback;
+				}
+
+				// the packet is only valid for the duration of this call, so it needs to be copied
+				pTimedCallback->callback(code, pPacket ? CopyPacket(*pPacket) : std::shared_ptr<const Packet>());
+				return true;
+			}
+
+			void completeAll(SocketOperationCode code) {
+				std::vector<std::shared_ptr<TimedResponseCallback>> timedCallbacks;
+				{
+					utils::SpinLockGuard guard(m_lock);
+					for (auto& pair : m_requests) {
+						if (!pair.second.IsAwaitingResponse)
+							continue;
+
+						pair.second.IsAwaitingResponse = false;
+						timedCallbacks.push_back(pair.second.pTimedCallback);
+					}
+				}
+
+				CATAPULT_LOG(debug) << "failing " << timedCallbacks.size() << " multiplexed requests with " << code;
+				for (const auto& pTimedCallback : timedCallbacks)
+					pTimedCallback->callback(code, std::shared_ptr<const Packet>());
+			}
+
+			void onResponse(uint32_t requestId, SocketOperationCode code, const std::shared_ptr<const Packet>& pResponse) {
+				std::unique_lock<utils::SpinLock> lock(m_lock);
+				auto iter = m_requests.find(requestId);
+				if (m_requests.end() == iter)
+					return;
+
+				auto& request = iter->second;
+				request.IsAwaitingResponse = false;
+				request.pTimedCallback.reset();
+				if (SocketOperationCode::Timed_Out == code)
+					CATAPULT_LOG(warning) << "multiplexed request " << requestId << " timed out";
+
+				if (!request.ReadCallback) {
+					// buffer the response until it is read
+					request.IsCompleted = true;
+					request.Code = code;
+					request.pResponse = pResponse;
+					return;
+				}
+
+				auto readCallback = request.ReadCallback;
+				m_requests.erase(iter);
+				lock.unlock();
+				readCallback(code, pResponse.get());
+			}
+
+			bool isAnyRequestAwaitingResponse() const {
+				return std::any_of(m_requests.cbegin(), m_requests.cend(), [](const auto& pair) {
+					return pair.second.IsAwaitingResponse;
+				});
+			}
+
+		private:
+			std::shared_ptr<PacketIo> m_pIo;
+			boost::asio::io_service& m_service;
+			utils::TimeSpan m_requestTimeout;
+
+			uint32_t m_nextRequestId;
+			bool m_isReading;
+			std::unordered_map<uint32_t, PendingRequest> m_requests;
+			mutable utils::SpinLock m_lock;
+		};
+
+		class MultiplexedChannel : public PacketIo {
+		public:
+			explicit MultiplexedChannel(const std::shared_ptr<DefaultPacketMultiplexer>& pMultiplexer) : m_pMultiplexer(pMultiplexer)
+			{}
+
+			~MultiplexedChannel() override {
+				// responses to requests that were never read are no longer needed
+				m_pMultiplexer->release(m_requestIds);
+			}
+
+		public:
+			void write(const PacketPayload& payload, const WriteCallback& callback) override {
+				// register the request before writing it so that it can be read from within the write callback
+				auto requestId = m_pMultiplexer->registerRequest();
+				m_requestIds.push_back(requestId);
+				m_pMultiplexer->write(requestId, payload, callback);
+			}
+
+			void read(const ReadCallback& callback) override {
+				if (m_requestIds.empty()) {
+					CATAPULT_LOG(warning) << "multiplexed channel cannot read without an outstanding request";
+					return callback(SocketOperationCode::Read_Error, nullptr);
+				}
+
+				auto requestId = m_requestIds.front();
+				m_requestIds.pop_front();
+				m_pMultiplexer->read(requestId, callback);
+			}
+
+		private:
+			std::shared_ptr<DefaultPacketMultiplexer> m_pMultiplexer;
+			std::deque<uint32_t> m_requestIds;
+		};
+
+		std::shared_ptr<PacketIo> DefaultPacketMultiplexer::createChannel() {
+			return std::make_shared<MultiplexedChannel>(shared_from_this());
+		}
+	}
+
+	std::shared_ptr<PacketMultiplexer> CreatePacketMultiplexer(
+			const std::shared_ptr<PacketIo>& pIo,
+			boost::asio::io_service& service,
+			const utils::TimeSpan& requestTimeout) {
+		return std::make_shared<DefaultPacketMultiplexer>(pIo, service, requestTimeout);
+	}
+}}
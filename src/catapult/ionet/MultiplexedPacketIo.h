@@ -0,0 +1,70 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "Packet.h"
+#include "catapult/utils/TimeSpan.h"
+#include <memory>
+
+namespace boost { namespace asio { class io_service; } }
+
+namespace catapult { namespace ionet { class PacketIo; } }
+
+namespace catapult { namespace ionet {
+
+#pragma pack(push, 1)
+
+	/// A packet that wraps a child request or response packet and tags it with a request id.
+	struct MultiplexedPacket : public Packet {
+		static constexpr PacketType Packet_Type = PacketType::Multiplexed;
+
+		/// Identifier of the request (shared by the request and its response).
+		uint32_t RequestId;
+	};
+
+#pragma pack(pop)
+
+	/// Gets the child packet wrapped by multiplexed \a packet or \c nullptr if \a packet is malformed.
+	/// \note Nested multiplexed packets are considered malformed.
+	const Packet* GetMultiplexedChildPacket(const MultiplexedPacket& packet);
+
+	/// Multiplexes independent request / response exchanges over a single packet io.
+	class PacketMultiplexer {
+	public:
+		virtual ~PacketMultiplexer() {}
+
+	public:
+		/// Gets the number of requests that have been written but whose responses have not yet been consumed.
+		virtual size_t numPendingRequests() const = 0;
+
+		/// Creates a new request channel.
+		/// \note Each packet written to a channel is sent as a separate multiplexed request and each read from the channel
+		///       returns the response to the oldest request written to it that has not yet been read.
+		virtual std::shared_ptr<PacketIo> createChannel() = 0;
+	};
+
+	/// Creates a packet multiplexer around \a pIo that uses \a service for timing out requests that do not receive a response
+	/// within \a requestTimeout.
+	/// \note Requests that time out complete with SocketOperationCode::Timed_Out and late responses are dropped.
+	std::shared_ptr<PacketMultiplexer> CreatePacketMultiplexer(
+			const std::shared_ptr<PacketIo>& pIo,
+			boost::asio::io_service& service,
+			const utils::TimeSpan& requestTimeout);
+}}
@@ -45,7 +45,7 @@ namespace catapult { namespace ionet {
 
 	NodeContainerView::NodeContainerView(
 			const NodeDataContainer& nodeDataContainer,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_nodeDataContainer(nodeDataContainer)
 			, m_readLock(std::move(readLock))
 	{}
@@ -78,7 +78,7 @@ namespace catapult { namespace ionet {
 	NodeContainerModifier::NodeContainerModifier(
 			NodeDataContainer& nodeDataContainer,
 			ServiceRolesMap& serviceRolesMap,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			utils::ReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_nodeDataContainer(nodeDataContainer)
 			, m_serviceRolesMap(serviceRolesMap)
 			, m_readLock(std::move(readLock))
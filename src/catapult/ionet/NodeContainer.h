@@ -21,8 +21,9 @@
 #pragma once
 #include "Node.h"
 #include "NodeInfo.h"
+#include "catapult/functions.h"
 #include "catapult/utils/ArraySet.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ReaderWriterLock.h"
 #include <unordered_map>
 
 namespace catapult { namespace ionet { struct NodeData; } }
@@ -36,7 +37,7 @@ namespace catapult { namespace ionet {
 	class NodeContainerView : utils::MoveOnly {
 	public:
 		/// Creates a view around \a nodeDataContainer with lock context \a readLock.
-		NodeContainerView(const NodeDataContainer& nodeDataContainer, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+		NodeContainerView(const NodeDataContainer& nodeDataContainer, utils::ReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
 		/// Returns the number of nodes.
@@ -53,7 +54,7 @@ namespace catapult { namespace ionet {
 
 	private:
 		const NodeDataContainer& m_nodeDataContainer;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// A write only view on top of node container.
@@ -67,7 +68,7 @@ namespace catapult { namespace ionet {
 		NodeContainerModifier(
 				NodeDataContainer& nodeDataContainer,
 				ServiceRolesMap& serviceRolesMap,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+				utils::ReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
 		/// Adds a \a node to the collection with \a source.
@@ -89,8 +90,8 @@ namespace catapult { namespace ionet {
 	private:
 		NodeDataContainer& m_nodeDataContainer;
 		ServiceRolesMap& m_serviceRolesMap;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+		utils::ReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ReaderWriterLock::WriterLockGuard m_writeLock;
 	};
 
 	/// A collection of nodes.
@@ -114,7 +115,7 @@ namespace catapult { namespace ionet {
 
 	private:
 		std::unique_ptr<Impl> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ReaderWriterLock m_lock;
 	};
 
 	/// Finds all active nodes in \a view.
@@ -74,4 +74,23 @@ namespace catapult { namespace ionet {
 		mergedPayload.m_buffers.insert(mergedPayload.m_buffers.end(), payload.m_buffers.cbegin(), payload.m_buffers.cend());
 		return mergedPayload;
 	}
+
+	PacketPayload PacketPayload::Filter(const PacketPayload& payload, const predicate<size_t>& include) {
+		if (payload.unset())
+			return PacketPayload();
+
+		// buffers can share backing data, so all backing data is retained
+		PacketPayload filteredPayload(payload.m_header.Type);
+		filteredPayload.m_entities = payload.m_entities;
+		for (auto i = 0u; i < payload.m_buffers.size(); ++i) {
+			if (!include(i))
+				continue;
+
+			const auto& buffer = payload.m_buffers[i];
+			filteredPayload.m_header.Size += static_cast<uint32_t>(buffer.Size);
+			filteredPayload.m_buffers.push_back(buffer);
+		}
+
+		return filteredPayload;
+	}
 }}
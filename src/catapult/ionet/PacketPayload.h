@@ -20,6 +20,7 @@
 
 #pragma once
 #include "Packet.h"
+#include "catapult/functions.h"
 #include "catapult/types.h"
 #include <vector>
 
@@ -51,6 +52,10 @@ namespace catapult { namespace ionet {
 		/// Merges a packet (\a pPacket) and a packet \a payload into a new packet payload.
 		static PacketPayload Merge(const std::shared_ptr<const Packet>& pPacket, const PacketPayload& payload);
 
+		/// Creates a new packet payload composed of the header of \a payload and all of its buffers for which \a include
+		/// returns \c true when passed the buffer index.
+		static PacketPayload Filter(const PacketPayload& payload, const predicate<size_t>& include);
+
 	private:
 		PacketHeader m_header;
 		std::vector<RawBuffer> m_buffers;
@@ -73,69 +73,71 @@ namespace catapult { namespace ionet {
 					: m_socket(service)
 					, m_wrapper(wrapper)
 					, m_buffer(options)
+					, m_isWorkingBufferPooled(!!options.WorkingBufferPool)
 					, m_maxPacketDataSize(options.MaxPacketDataSize)
 			{}
 
 		public:
 			void write(const PacketPayload& payload, const PacketSocket::WriteCallback& callback) {
-				if (!IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize)) {
-					CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
-					callback(SocketOperationCode::Malformed_Data);
-					return;
+				writeMultiple({ std::make_pair(payload, callback) });
+			}
+
+			void writeMultiple(const PacketPayloadWrites& writes) {
+				auto pContext = std::make_shared<WriteContext>();
+				for (const auto& write : writes) {
+					if (!IsPacketDataSizeValid(write.first.header(), m_maxPacketDataSize)) {
+						CATAPULT_LOG(warning) << "bypassing write of malformed " << write.first.header();
+						write.second(SocketOperationCode::Malformed_Data);
+						continue;
+					}
+
+					pContext->add(write.first, write.second);
 				}
 
-				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
+				if (pContext->empty())
+					return;
+
+				// write all headers and data buffers with a single (gathered) write
+				boost::asio::async_write(m_socket, pContext->buffers(), m_wrapper.wrap([pContext](const auto& ec, auto) {
+					pContext->complete(ec);
 				}));
 			}
 
 		private:
 			struct WriteContext {
 			public:
-				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
-						: m_payload(payload)
-						, m_callback(callback)
-						, m_nextBufferIndex(0)
-				{}
-
-			public:
-				auto headerBuffer() const {
-					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+				bool empty() const {
+					return m_payloads.empty();
 				}
 
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
+				void add(const PacketPayload& payload, const PacketSocket::WriteCallback& callback) {
+					m_payloads.push_back(payload);
+					m_callbacks.push_back(callback);
 				}
 
-				bool tryComplete(const boost::system::error_code& ec) {
-					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
-						m_callback(lastCode);
-						return true;
+				std::vector<boost::asio::const_buffer> buffers() const {
+					std::vector<boost::asio::const_buffer> buffers;
+					for (const auto& payload : m_payloads) {
+						const auto& header = payload.header();
+						buffers.push_back(boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header)));
+						for (const auto& rawBuffer : payload.buffers())
+							buffers.push_back(boost::asio::buffer(rawBuffer.pData, rawBuffer.Size));
 					}
 
-					return false;
+					return buffers;
+				}
+
+				void complete(const boost::system::error_code& ec) {
+					auto code = mapWriteErrorCodeToSocketOperationCode(ec);
+					for (const auto& callback : m_callbacks)
+						callback(code);
 				}
 
 			private:
-				const PacketPayload m_payload;
-				const PacketSocket::WriteCallback m_callback;
-				size_t m_nextBufferIndex;
+				std::vector<PacketPayload> m_payloads;
+				std::vector<PacketSocket::WriteCallback> m_callbacks;
 			};
 
-			void writeNext(const boost::system::error_code& lastEc, const std::shared_ptr<WriteContext>& pContext) {
-				if (pContext->tryComplete(lastEc))
-					return;
-
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
-			}
-
 		public:
 			void read(const PacketSocket::ReadCallback& callback, bool allowMultiple) {
 				// try to extract a packet from the working buffer
@@ -193,6 +195,23 @@ namespace catapult { namespace ionet {
 			};
 
 			void readSome(const PacketSocket::ReadCallback& callback, bool allowMultiple) {
+				// only release a pooled working buffer when no data is pending, so busy sockets read without an extra wait
+				if (!m_isWorkingBufferPooled || hasPendingData() || !m_buffer.tryRelease())
+					return readSomeData(callback, allowMultiple);
+
+				// the (empty) working buffer was returned to the pool, so wait for data before reacquiring it
+				auto readyHandler = [this, callback, allowMultiple](const auto& ec, auto) {
+					auto code = mapReadErrorCodeToSocketOperationCode(ec);
+					if (SocketOperationCode::Success != code)
+						return callback(code, nullptr);
+
+					this->readSomeData(callback, allowMultiple);
+				};
+
+				m_socket.async_read_some(boost::asio::null_buffers(), m_wrapper.wrap(readyHandler));
+			}
+
+			void readSomeData(const PacketSocket::ReadCallback& callback, bool allowMultiple) {
 				auto pAppendContext = std::make_shared<SharedAppendContext>(m_buffer.prepareAppend());
 				auto readHandler = [this, callback, allowMultiple, pAppendContext](const auto& ec, auto bytesReceived) {
 					auto code = mapReadErrorCodeToSocketOperationCode(ec);
@@ -206,6 +225,11 @@ namespace catapult { namespace ionet {
 				m_socket.async_read_some(pAppendContext->Context.buffer(), m_wrapper.wrap(readHandler));
 			}
 
+			bool hasPendingData() {
+				boost::system::error_code ec;
+				return 0 != m_socket.available(ec) || ec;
+			}
+
 			void checkAndHandleError(PacketExtractResult extractResult, const PacketSocket::ReadCallback& callback, bool allowMultiple) {
 				// ignore non errors
 				switch (extractResult) {
@@ -238,6 +262,7 @@ namespace catapult { namespace ionet {
 			socket m_socket;
 			TSocketCallbackWrapper& m_wrapper;
 			WorkingBuffer m_buffer;
+			bool m_isWorkingBufferPooled;
 			size_t m_maxPacketDataSize;
 		};
 
@@ -254,6 +279,7 @@ namespace catapult { namespace ionet {
 					: m_strand(service)
 					, m_strandWrapper(m_strand)
 					, m_socket(service, options, *this)
+					, m_maxCoalescedWriteSize(options.MaxCoalescedWriteSize)
 			{}
 
 			~StrandedPacketSocket() override {
@@ -288,7 +314,10 @@ namespace catapult { namespace ionet {
 			}
 
 			std::shared_ptr<PacketIo> buffered() override {
-				return CreateBufferedPacketIo(shared_from_this(), m_strand);
+				auto batchWriter = [pThis = shared_from_this()](const auto& writes) {
+					pThis->post([writes](auto& socket) { socket.writeMultiple(writes); });
+				};
+				return CreateBufferedPacketIo(shared_from_this(), m_strand, batchWriter, m_maxCoalescedWriteSize);
 			}
 
 		public:
@@ -320,6 +349,7 @@ namespace catapult { namespace ionet {
 			boost::asio::strand m_strand;
 			thread::StrandOwnerLifetimeExtender<StrandedPacketSocket> m_strandWrapper;
 			SocketType m_socket;
+			size_t m_maxCoalescedWriteSize;
 		};
 
 		// region Accept
@@ -19,6 +19,8 @@
 **/
 
 #pragma once
+#include "ByteBufferPool.h"
+#include <memory>
 #include <stddef.h>
 
 namespace catapult { namespace ionet {
@@ -33,5 +35,13 @@ namespace catapult { namespace ionet {
 
 		/// Maximum packet data size.
 		size_t MaxPacketDataSize;
+
+		/// Maximum number of bytes of payloads queued by buffered writers that can be coalesced into a single (gathered) write.
+		/// \note \c 0 will disable write coalescing.
+		size_t MaxCoalescedWriteSize;
+
+		/// Pool of working buffers shared across sockets.
+		/// \note \c nullptr will disable pooling and each socket will own its working buffer.
+		std::shared_ptr<ByteBufferPool> WorkingBufferPool;
 	};
 }}
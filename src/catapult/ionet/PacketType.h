@@ -60,6 +60,27 @@ namespace catapult { namespace ionet {
 	/* A secure packet with a signature. */ \
 	ENUM_VALUE(Secure_Signed, 11) \
 	\
+	/* Unconfirmed transactions have been requested by a peer using short hash set reconciliation. */ \
+	ENUM_VALUE(Pull_Transactions_Reconciliation, 12) \
+	\
+	/* A secure packet with a session authentication code. */ \
+	ENUM_VALUE(Secure_Session, 13) \
+	\
+	/* A compressed packet. */ \
+	ENUM_VALUE(Compressed, 14) \
+	\
+	/* Block headers have been requested by a peer. */ \
+	ENUM_VALUE(Pull_Block_Headers, 15) \
+	\
+	/* Block hashes at specific heights have been requested by a peer. */ \
+	ENUM_VALUE(Block_Hashes_At, 16) \
+	\
+	/* A request or response multiplexed with other requests over a single connection. */ \
+	ENUM_VALUE(Multiplexed, 17) \
+	\
+	/* A compact block composed of a block header and transaction short hashes has been pushed by a peer. */ \
+	ENUM_VALUE(Push_Compact_Block, 18) \
+	\
 	/* api only packets have types [500, 600) */ \
 	\
 	/* Partial aggregate transactions have been pushed by an api-node. */ \
@@ -71,6 +92,9 @@ namespace catapult { namespace ionet {
 	/* Partial transaction infos have been requested by an api-node. */ \
 	ENUM_VALUE(Pull_Partial_Transaction_Infos, 502) \
 	\
+	/* Partial transaction infos have been requested by an api-node using short hash set reconciliation. */ \
+	ENUM_VALUE(Pull_Partial_Transaction_Infos_Reconciliation, 503) \
+	\
 	/* node discovery packets have types [600, 700) */ \
 	\
 	/* Node information has been pushed by a peer. */ \
@@ -19,67 +19,40 @@
 **/
 
 #include "SecurePacketSocketDecorator.h"
+#include "DecoratedPacketSocket.h"
 #include "PacketSocket.h"
+#include "SecureSessionPacketIo.h"
 #include "SecureSignedPacketIo.h"
+#include "catapult/crypto/KeyPair.h"
 #include "catapult/utils/FileSize.h"
 
 namespace catapult { namespace ionet {
 
 	namespace {
-		class SecureSignedPacketSocket : public PacketSocket {
-		public:
-			SecureSignedPacketSocket(
-					const std::shared_ptr<PacketSocket>& pSocket,
-					const crypto::KeyPair& sourceKeyPair,
-					const Key& remoteKey,
-					uint32_t maxPacketDataSize)
-					: m_pSocket(pSocket)
-					, m_sourceKeyPair(sourceKeyPair)
-					, m_remoteKey(remoteKey)
-					, m_maxPacketDataSize(maxPacketDataSize)
-					, m_pIo(createSecureSignedPacketIo(m_pSocket))
-					, m_pReader(CreateSecureSignedBatchPacketReader(m_pSocket, m_remoteKey))
-			{}
+		std::shared_ptr<PacketSocket> CreateSecureSignedPacketSocket(
+				const std::shared_ptr<PacketSocket>& pSocket,
+				const crypto::KeyPair& sourceKeyPair,
+				const Key& remoteKey,
+				uint32_t maxPacketDataSize) {
+			auto ioDecorator = [&sourceKeyPair, remoteKey, maxPacketDataSize](const auto& pIo) {
+				return CreateSecureSignedPacketIo(pIo, sourceKeyPair, remoteKey, maxPacketDataSize);
+			};
+			return CreateDecoratedPacketSocket(pSocket, ioDecorator, CreateSecureSignedBatchPacketReader(pSocket, remoteKey));
+		}
 
-		public:
-			void read(const ReadCallback& callback) override {
-				m_pIo->read(callback);
-			}
-
-			void write(const PacketPayload& payload, const WriteCallback& callback) override {
-				m_pIo->write(payload, callback);
-			}
-
-			void readMultiple(const ReadCallback& callback) override {
-				m_pReader->readMultiple(callback);
-			}
-
-		public:
-			void stats(const StatsCallback& callback) override {
-				m_pSocket->stats(callback);
-			}
-
-			void close() override{
-				m_pSocket->close();
-			}
-
-			std::shared_ptr<PacketIo> buffered() override {
-				return createSecureSignedPacketIo(m_pSocket->buffered());
-			}
-
-		private:
-			std::shared_ptr<PacketIo> createSecureSignedPacketIo(const std::shared_ptr<PacketIo>& pSocket) {
-				return CreateSecureSignedPacketIo(pSocket, m_sourceKeyPair, m_remoteKey, m_maxPacketDataSize);
-			}
-
-		private:
-			std::shared_ptr<PacketSocket> m_pSocket;
-			const crypto::KeyPair& m_sourceKeyPair;
-			Key m_remoteKey;
-			uint32_t m_maxPacketDataSize;
-			std::shared_ptr<PacketIo> m_pIo;
-			std::shared_ptr<BatchPacketReader> m_pReader;
-		};
+		std::shared_ptr<PacketSocket> CreateSecureSessionPacketSocket(
+				const std::shared_ptr<PacketSocket>& pSocket,
+				const crypto::KeyPair& sourceKeyPair,
+				const Key& remoteKey,
+				const Hash256& sessionKey,
+				uint32_t maxPacketDataSize) {
+			// all ios and the reader need to share the session so that sequence numbers are consistent
+			auto pSession = std::make_shared<SecureSession>(sessionKey, sourceKeyPair.publicKey(), remoteKey);
+			auto ioDecorator = [pSession, maxPacketDataSize](const auto& pIo) {
+				return CreateSecureSessionPacketIo(pIo, pSession, maxPacketDataSize);
+			};
+			return CreateDecoratedPacketSocket(pSocket, ioDecorator, CreateSecureSessionBatchPacketReader(pSocket, pSession));
+		}
 	}
 
 	std::shared_ptr<PacketSocket> Secure(
@@ -87,9 +60,13 @@ namespace catapult { namespace ionet {
 			ConnectionSecurityMode securityMode,
 			const crypto::KeyPair& sourceKeyPair,
 			const Key& remoteKey,
+			const Hash256& sessionKey,
 			const utils::FileSize& maxPacketDataSize) {
+		if (HasFlag(ConnectionSecurityMode::Session, securityMode))
+			return CreateSecureSessionPacketSocket(pSocket, sourceKeyPair, remoteKey, sessionKey, maxPacketDataSize.bytes32());
+
 		return HasFlag(ConnectionSecurityMode::Signed, securityMode)
-				? std::make_shared<SecureSignedPacketSocket>(pSocket, sourceKeyPair, remoteKey, maxPacketDataSize.bytes32())
+				? CreateSecureSignedPacketSocket(pSocket, sourceKeyPair, remoteKey, maxPacketDataSize.bytes32())
 				: pSocket;
 	}
 }}
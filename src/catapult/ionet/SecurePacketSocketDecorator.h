@@ -32,10 +32,12 @@ namespace catapult { namespace ionet {
 
 	/// Secures a packet socket (\a pSocket) to conform with \a securityMode for a connection from \a sourceKeyPair to \a remoteKey
 	/// allowing a specified max packet data size (\a maxPacketDataSize).
+	/// \a sessionKey is only used when \a securityMode is ConnectionSecurityMode::Session.
 	std::shared_ptr<PacketSocket> Secure(
 			const std::shared_ptr<PacketSocket>& pSocket,
 			ConnectionSecurityMode securityMode,
 			const crypto::KeyPair& sourceKeyPair,
 			const Key& remoteKey,
+			const Hash256& sessionKey,
 			const utils::FileSize& maxPacketDataSize);
 }}
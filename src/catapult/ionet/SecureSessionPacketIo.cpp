@@ -0,0 +1,243 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SecureSessionPacketIo.h"
+#include "BatchPacketReader.h"
+#include "PacketIo.h"
+#include "catapult/crypto/Hashes.h"
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		struct SecurePacketHeader : public ionet::Packet {
+			static constexpr PacketType Packet_Type = PacketType::Secure_Session;
+
+			Hash256 AuthenticationCode;
+		};
+
+		Hash256 DeriveDirectionalKey(const Hash256& sessionKey, const Key& senderKey) {
+			Hash256 directionalKey;
+			crypto::Sha3_256_Builder hashBuilder;
+			hashBuilder.update({ sessionKey, senderKey });
+			hashBuilder.final(directionalKey);
+			return directionalKey;
+		}
+
+		crypto::Sha3_256_Builder CreateAuthenticationCodeBuilder(const Hash256& key, uint64_t sequenceNumber) {
+			crypto::Sha3_256_Builder hashBuilder;
+			hashBuilder.update({ key, { reinterpret_cast<const uint8_t*>(&sequenceNumber), sizeof(uint64_t) } });
+			return hashBuilder;
+		}
+
+		bool AreEqualConstantTime(const Hash256& lhs, const Hash256& rhs) {
+			uint8_t difference = 0;
+			for (auto i = 0u; i < Hash256_Size; ++i)
+				difference |= lhs[i] ^ rhs[i];
+
+			return 0 == difference;
+		}
+	}
+
+	SecureSession::SecureSession(const Hash256& sessionKey, const Key& sourceKey, const Key& remoteKey)
+			: m_writeKey(DeriveDirectionalKey(sessionKey, sourceKey))
+			, m_readKey(DeriveDirectionalKey(sessionKey, remoteKey))
+			, m_writeSequenceNumber(0)
+			, m_readSequenceNumber(0)
+			, m_isWriting(false)
+	{}
+
+	Hash256 SecureSession::authenticate(const PacketPayload& payload) {
+		// authenticate full payload, including header
+		auto hashBuilder = CreateAuthenticationCodeBuilder(m_writeKey, m_writeSequenceNumber++);
+		hashBuilder.update({ reinterpret_cast<const uint8_t*>(&payload.header()), sizeof(PacketHeader) });
+		for (const auto& buffer : payload.buffers())
+			hashBuilder.update(buffer);
+
+		Hash256 authenticationCode;
+		hashBuilder.final(authenticationCode);
+		return authenticationCode;
+	}
+
+	void SecureSession::write(const PacketPayload& payload, const AuthenticatedWriter& writer) {
+		{
+			utils::SpinLockGuard guard(m_writeLock);
+			m_pendingWrites.emplace_back(payload, writer);
+
+			// the thread that is already writing will process the queued write
+			if (m_isWriting)
+				return;
+
+			m_isWriting = true;
+		}
+
+		// only a single thread processes pending writes at a time, so authentication codes are calculated and forwarded in order
+		// (a write issued by a writer on the same thread is queued and processed after the writer returns)
+		for (;;) {
+			std::pair<PacketPayload, AuthenticatedWriter> pendingWrite;
+			{
+				utils::SpinLockGuard guard(m_writeLock);
+				if (m_pendingWrites.empty()) {
+					m_isWriting = false;
+					return;
+				}
+
+				pendingWrite = std::move(m_pendingWrites.front());
+				m_pendingWrites.pop_front();
+			}
+
+			try {
+				pendingWrite.second(authenticate(pendingWrite.first));
+			} catch (...) {
+				utils::SpinLockGuard guard(m_writeLock);
+				m_isWriting = false;
+				throw;
+			}
+		}
+	}
+
+	bool SecureSession::verify(const Packet& packet, const Hash256& authenticationCode) {
+		auto hashBuilder = CreateAuthenticationCodeBuilder(m_readKey, m_readSequenceNumber);
+		hashBuilder.update({ reinterpret_cast<const uint8_t*>(&packet), packet.Size });
+
+		Hash256 expectedAuthenticationCode;
+		hashBuilder.final(expectedAuthenticationCode);
+		if (!AreEqualConstantTime(expectedAuthenticationCode, authenticationCode))
+			return false;
+
+		++m_readSequenceNumber;
+		return true;
+	}
+
+	namespace {
+		class VerifyingReadCallback {
+		public:
+			VerifyingReadCallback(SecureSession& session, PacketIo::ReadCallback callback)
+					: m_session(session)
+					, m_callback(callback)
+			{}
+
+		public:
+			void operator()(SocketOperationCode code, const Packet* pPacket) {
+				if (SocketOperationCode::Success != code)
+					return m_callback(code, nullptr);
+
+				// cannot use CoercePacket because Size is variable
+				auto minPacketSize = sizeof(SecurePacketHeader) + sizeof(PacketHeader);
+				if (pPacket->Type != SecurePacketHeader::Packet_Type || minPacketSize > pPacket->Size)
+					return m_callback(SocketOperationCode::Malformed_Data, nullptr);
+
+				auto& securePacketHeader = static_cast<const SecurePacketHeader&>(*pPacket);
+				auto& childPacket = static_cast<const Packet&>(*(&securePacketHeader + 1));
+				if (securePacketHeader.Size - sizeof(SecurePacketHeader) != childPacket.Size)
+					return m_callback(SocketOperationCode::Malformed_Data, nullptr);
+
+				if (!m_session.verify(childPacket, securePacketHeader.AuthenticationCode)) {
+					CATAPULT_LOG(warning) << "packet has invalid session authentication code";
+					return m_callback(SocketOperationCode::Security_Error, nullptr);
+				}
+
+				m_callback(code, &childPacket);
+			}
+
+		private:
+			SecureSession& m_session;
+			PacketIo::ReadCallback m_callback;
+		};
+
+		class SecureSessionPacketIo
+				: public PacketIo
+				, public std::enable_shared_from_this<SecureSessionPacketIo> {
+		public:
+			SecureSessionPacketIo(
+					const std::shared_ptr<PacketIo>& pIo,
+					const std::shared_ptr<SecureSession>& pSession,
+					uint32_t maxPacketDataSize)
+					: m_pIo(pIo)
+					, m_pSession(pSession)
+					, m_maxPacketDataSize(maxPacketDataSize)
+			{}
+
+		public:
+			void write(const PacketPayload& payload, const WriteCallback& callback) override {
+				if (!IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize)) {
+					CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
+					callback(SocketOperationCode::Malformed_Data);
+					return;
+				}
+
+				// assign the sequence number as part of the serialized write so that it matches the order of packets on the wire
+				m_pSession->write(payload, [pThis = shared_from_this(), payload, callback](const auto& authenticationCode) {
+					auto pSecurePacketHeader = CreateSharedPacket<SecurePacketHeader>(0);
+					pSecurePacketHeader->AuthenticationCode = authenticationCode;
+					pThis->m_pIo->write(PacketPayload::Merge(pSecurePacketHeader, payload), callback);
+				});
+			}
+
+			void read(const ReadCallback& callback) override {
+				m_pIo->read([pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+					VerifyingReadCallback(*pThis->m_pSession, callback)(code, pPacket);
+				});
+			}
+
+		private:
+			std::shared_ptr<PacketIo> m_pIo;
+			std::shared_ptr<SecureSession> m_pSession;
+			uint32_t m_maxPacketDataSize;
+		};
+	}
+
+	std::shared_ptr<PacketIo> CreateSecureSessionPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const std::shared_ptr<SecureSession>& pSession,
+			uint32_t maxPacketDataSize) {
+		return std::make_shared<SecureSessionPacketIo>(pIo, pSession, maxPacketDataSize);
+	}
+
+	namespace {
+		class SecureSessionBatchPacketReader
+				: public BatchPacketReader
+				, public std::enable_shared_from_this<SecureSessionBatchPacketReader> {
+		public:
+			SecureSessionBatchPacketReader(
+					const std::shared_ptr<BatchPacketReader>& pReader,
+					const std::shared_ptr<SecureSession>& pSession)
+					: m_pReader(pReader)
+					, m_pSession(pSession)
+			{}
+
+		public:
+			void readMultiple(const PacketIo::ReadCallback& callback) override {
+				m_pReader->readMultiple([pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+					VerifyingReadCallback(*pThis->m_pSession, callback)(code, pPacket);
+				});
+			}
+
+		private:
+			std::shared_ptr<BatchPacketReader> m_pReader;
+			std::shared_ptr<SecureSession> m_pSession;
+		};
+	}
+
+	std::shared_ptr<BatchPacketReader> CreateSecureSessionBatchPacketReader(
+			const std::shared_ptr<BatchPacketReader>& pReader,
+			const std::shared_ptr<SecureSession>& pSession) {
+		return std::make_shared<SecureSessionBatchPacketReader>(pReader, pSession);
+	}
+}}
@@ -0,0 +1,87 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "IoTypes.h"
+#include "PacketPayload.h"
+#include "catapult/functions.h"
+#include "catapult/types.h"
+#include "catapult/utils/SpinLock.h"
+#include <deque>
+
+namespace catapult {
+	namespace ionet {
+		class BatchPacketReader;
+		class PacketIo;
+		struct Packet;
+	}
+}
+
+namespace catapult { namespace ionet {
+
+	/// Authentication state of a session that is shared by all packet ios and readers decorating the same connection.
+	/// \note Each direction uses its own key and an implicit sequence number, so reordered or replayed packets are rejected.
+	class SecureSession {
+	public:
+		/// Consumes the authentication code of a written payload.
+		using AuthenticatedWriter = consumer<const Hash256&>;
+
+	public:
+		/// Creates a session for a connection from \a sourceKey to \a remoteKey around a shared \a sessionKey.
+		SecureSession(const Hash256& sessionKey, const Key& sourceKey, const Key& remoteKey);
+
+	public:
+		/// Calculates the authentication code of \a payload, which is the next payload written to the session.
+		/// \note This is not threadsafe and should only be called directly when there is a single writer.
+		Hash256 authenticate(const PacketPayload& payload);
+
+		/// Calculates the authentication code of \a payload and passes it to \a writer.
+		/// \note Concurrent writes are serialized, so sequence numbers are assigned in the order writers are called.
+		void write(const PacketPayload& payload, const AuthenticatedWriter& writer);
+
+		/// Returns \c true if \a authenticationCode is valid for \a packet, which is the next packet read from the session.
+		bool verify(const Packet& packet, const Hash256& authenticationCode);
+
+	private:
+		Hash256 m_writeKey;
+		Hash256 m_readKey;
+		uint64_t m_writeSequenceNumber;
+		uint64_t m_readSequenceNumber;
+
+		utils::SpinLock m_writeLock;
+		std::deque<std::pair<PacketPayload, AuthenticatedWriter>> m_pendingWrites;
+		bool m_isWriting;
+	};
+
+	/// Adds session authentication to all packets read from and written to \a pIo.
+	/// - All written packets are wrapped in a packet authenticated by \a pSession and must have
+	///   a max packet data size of \a maxPacketDataSize.
+	/// - All read packets are validated to be authenticated by the remote end of \a pSession.
+	std::shared_ptr<PacketIo> CreateSecureSessionPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const std::shared_ptr<SecureSession>& pSession,
+			uint32_t maxPacketDataSize);
+
+	/// Adds session authentication to all packets read from \a pReader.
+	/// - All read packets are validated to be authenticated by the remote end of \a pSession.
+	std::shared_ptr<BatchPacketReader> CreateSecureSessionBatchPacketReader(
+			const std::shared_ptr<BatchPacketReader>& pReader,
+			const std::shared_ptr<SecureSession>& pSession);
+}}
@@ -43,7 +43,10 @@ namespace catapult { namespace ionet {
 	ENUM_VALUE(Security_Error) \
 	\
 	/* Socket operation completed due to insufficient data. */ \
-	ENUM_VALUE(Insufficient_Data)
+	ENUM_VALUE(Insufficient_Data) \
+	\
+	/* Socket operation did not complete before its deadline. */ \
+	ENUM_VALUE(Timed_Out)
 
 #define ENUM_VALUE(LABEL) LABEL,
 	/// Enumeration of socket operation results.
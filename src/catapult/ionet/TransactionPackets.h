@@ -0,0 +1,37 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <stdint.h>
+
+namespace catapult { namespace ionet {
+
+#pragma pack(push, 1)
+
+	/// Header of a pull transactions or pull partial transaction infos reconciliation response.
+	/// \note When the short hashes set difference was decoded, the header is followed by all transactions
+	///       (or partial transaction infos) unknown to the requester.
+	struct PullTransactionsReconciliationResponseHeader {
+		/// Nonzero if the short hashes set difference was decoded.
+		uint8_t IsDecoded;
+	};
+
+#pragma pack(pop)
+}}
@@ -26,10 +26,15 @@ namespace catapult { namespace ionet {
 			: m_options(options)
 			, m_numDataSizeSamples(0)
 			, m_maxDataSize(0) {
-		m_data.reserve(m_options.WorkingBufferSize);
+		// pooled working buffers acquire memory lazily when data is appended
+		if (!m_options.WorkingBufferPool)
+			m_data.reserve(m_options.WorkingBufferSize);
 	}
 
 	AppendContext WorkingBuffer::prepareAppend() {
+		if (m_options.WorkingBufferPool && 0 == m_data.capacity())
+			m_data = m_options.WorkingBufferPool->acquire();
+
 		AppendContext appendContext(m_data, m_options.WorkingBufferSize);
 		checkMemoryUsage();
 		return appendContext;
@@ -39,6 +44,15 @@ namespace catapult { namespace ionet {
 		return PacketExtractor(m_data, m_options.MaxPacketDataSize);
 	}
 
+	bool WorkingBuffer::tryRelease() {
+		if (!m_options.WorkingBufferPool || !m_data.empty() || 0 == m_data.capacity())
+			return false;
+
+		m_options.WorkingBufferPool->release(std::move(m_data));
+		m_data = ByteBuffer();
+		return true;
+	}
+
 	void WorkingBuffer::checkMemoryUsage() {
 		// ignore if memory reclamation is disabled
 		if (0 == m_options.WorkingBufferSensitivity)
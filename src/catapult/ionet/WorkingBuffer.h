@@ -65,6 +65,10 @@ namespace catapult { namespace ionet {
 		/// Creates a packet extractor that can be used to extract packets from the working buffer.
 		PacketExtractor preparePacketExtractor();
 
+		/// Returns the underlying memory to the working buffer pool if the working buffer is pooled and empty.
+		/// \note Returns \c true if memory was released and will be reacquired by the next call to prepareAppend.
+		bool tryRelease();
+
 	private:
 		void checkMemoryUsage();
 
@@ -116,6 +116,9 @@ namespace catapult { namespace local {
 				m_counters.emplace_back(utils::DiagnosticCounterId("UT CACHE"), [&source = *m_pUtCache]() {
 					return source.view().size();
 				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("STORAGE WAIT"), [&source = m_storage]() {
+					return source.lockStatistics().TotalWaitMicroseconds / 1000;
+				});
 			}
 
 		public:
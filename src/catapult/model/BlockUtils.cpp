@@ -28,10 +28,10 @@
 namespace catapult { namespace model {
 
 	namespace {
-		RawBuffer BlockDataBuffer(const Block& block) {
+		RawBuffer BlockDataBuffer(const BlockHeader& header) {
 			return {
-				reinterpret_cast<const uint8_t*>(&block) + VerifiableEntity::Header_Size,
-				sizeof(Block) - VerifiableEntity::Header_Size
+				reinterpret_cast<const uint8_t*>(&header) + VerifiableEntity::Header_Size,
+				sizeof(BlockHeader) - VerifiableEntity::Header_Size
 			};
 		}
 	}
@@ -59,12 +59,12 @@ namespace catapult { namespace model {
 
 	// region sign / verify
 
-	void SignBlockHeader(const crypto::KeyPair& signer, Block& block) {
-		crypto::Sign(signer, BlockDataBuffer(block), block.Signature);
+	void SignBlockHeader(const crypto::KeyPair& signer, BlockHeader& header) {
+		crypto::Sign(signer, BlockDataBuffer(header), header.Signature);
 	}
 
-	bool VerifyBlockHeaderSignature(const Block& block) {
-		return crypto::Verify(block.Signer, BlockDataBuffer(block), block.Signature);
+	bool VerifyBlockHeaderSignature(const BlockHeader& header) {
+		return crypto::Verify(header.Signer, BlockDataBuffer(header), header.Signature);
 	}
 
 	// endregion
@@ -40,12 +40,12 @@ namespace catapult { namespace model {
 
 	// region sign / verify
 
-	/// Signs \a block header as \a signer.
+	/// Signs block \a header as \a signer.
 	/// \note All header data is assumed to be present and valid.
-	void SignBlockHeader(const crypto::KeyPair& signer, Block& block);
+	void SignBlockHeader(const crypto::KeyPair& signer, BlockHeader& header);
 
-	/// Validates signature of \a block header.
-	bool VerifyBlockHeaderSignature(const Block& block);
+	/// Validates signature of block \a header.
+	bool VerifyBlockHeaderSignature(const BlockHeader& header);
 
 	// endregion
 
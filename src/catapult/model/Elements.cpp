@@ -19,6 +19,7 @@
 **/
 
 #include "Elements.h"
+#include "NotificationBuffer.h"
 
 namespace catapult { namespace model {
 
@@ -35,7 +36,7 @@ namespace catapult { namespace model {
 			void add(const TElement& element) {
 				const auto& entity = GetEntity(element);
 				if (m_predicate(ToBasicEntityType(entity.Type), GetTimestamp(element), element.EntityHash))
-					m_entityInfos.push_back(WeakEntityInfo(entity, element.EntityHash));
+					m_entityInfos.push_back(WeakEntityInfo(entity, element.EntityHash, GetNotifications(element)));
 			}
 
 		private:
@@ -49,6 +50,16 @@ namespace catapult { namespace model {
 				return element.Transaction;
 			}
 
+			inline
+			static const TransactionNotifications* GetNotifications(const BlockElement&) {
+				return nullptr;
+			}
+
+			inline
+			static const TransactionNotifications* GetNotifications(const TransactionElement& element) {
+				return element.OptionalNotifications.get();
+			}
+
 			inline
 			static const Timestamp GetTimestamp(const BlockElement& element) {
 				return element.Block.Timestamp;
@@ -103,6 +114,11 @@ namespace catapult { namespace model {
 		model::TransactionInfo transactionInfo(pTransaction, transactionElement.EntityHash);
 		transactionInfo.MerkleComponentHash = transactionElement.MerkleComponentHash;
 		transactionInfo.OptionalExtractedAddresses = transactionElement.OptionalExtractedAddresses;
+
+		// notifications can only be reused when they were published for the same transaction
+		if (transactionElement.OptionalNotifications && &transactionElement.OptionalNotifications->transaction() == pTransaction.get())
+			transactionInfo.OptionalNotifications = transactionElement.OptionalNotifications;
+
 		return transactionInfo;
 	}
 }}
@@ -45,6 +45,9 @@ namespace catapult { namespace model {
 
 		/// Optional extracted addresses.
 		std::shared_ptr<AddressSet> OptionalExtractedAddresses;
+
+		/// Optional notifications published for the transaction in PublicationMode::All.
+		std::shared_ptr<const TransactionNotifications> OptionalNotifications;
 	};
 
 	/// Processing element for a block composed of a block and metadata.
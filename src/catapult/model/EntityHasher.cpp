@@ -33,8 +33,8 @@ namespace catapult { namespace model {
 		}
 	}
 
-	Hash256 CalculateHash(const Block& block) {
-		return CalculateHash(block, EntityDataBuffer(block, sizeof(Block)));
+	Hash256 CalculateHash(const BlockHeader& header) {
+		return CalculateHash(header, EntityDataBuffer(header, sizeof(BlockHeader)));
 	}
 
 	Hash256 CalculateHash(const Transaction& transaction) {
@@ -30,8 +30,8 @@ namespace catapult {
 
 namespace catapult { namespace model {
 
-	/// Calculates the hash for the given \a block header.
-	Hash256 CalculateHash(const Block& block);
+	/// Calculates the hash for the given block \a header.
+	Hash256 CalculateHash(const BlockHeader& header);
 
 	/// Calculates the hash for the given \a transaction.
 	Hash256 CalculateHash(const Transaction& transaction);
@@ -26,6 +26,8 @@
 #include "catapult/utils/NonCopyable.h"
 #include <memory>
 
+namespace catapult { namespace model { class TransactionNotifications; } }
+
 namespace catapult { namespace model {
 
 	/// Tuple composed of an entity and its associated metadata.
@@ -92,12 +94,16 @@ namespace catapult { namespace model {
 		DetachedTransactionInfo copy() const {
 			auto transactionInfo = DetachedTransactionInfo(pEntity, EntityHash);
 			transactionInfo.OptionalExtractedAddresses = OptionalExtractedAddresses;
+			transactionInfo.OptionalNotifications = OptionalNotifications;
 			return transactionInfo;
 		}
 
 	public:
 		/// Extracted addresses (optional).
 		std::shared_ptr<const AddressSet> OptionalExtractedAddresses;
+
+		/// Notifications published for the transaction in PublicationMode::All (optional).
+		std::shared_ptr<const TransactionNotifications> OptionalNotifications;
 	};
 
 	/// A transaction and its associated metadata.
@@ -122,6 +128,7 @@ namespace catapult { namespace model {
 		TransactionInfo copy() const {
 			auto transactionInfo = TransactionInfo(pEntity, EntityHash);
 			transactionInfo.OptionalExtractedAddresses = OptionalExtractedAddresses;
+			transactionInfo.OptionalNotifications = OptionalNotifications;
 			transactionInfo.MerkleComponentHash = MerkleComponentHash;
 			return transactionInfo;
 		}
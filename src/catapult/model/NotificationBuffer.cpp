@@ -0,0 +1,94 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NotificationBuffer.h"
+#include "NotificationPublisher.h"
+#include "Transaction.h"
+#include "catapult/exceptions.h"
+#include <cstddef>
+#include <cstring>
+
+namespace catapult { namespace model {
+
+	namespace {
+		// pad all notifications so that every buffered notification is suitably aligned
+		size_t GetPaddedSize(size_t size) {
+			constexpr auto Alignment = alignof(std::max_align_t);
+			return (size + Alignment - 1) / Alignment * Alignment;
+		}
+	}
+
+	NotificationBuffer::NotificationBuffer() = default;
+
+	size_t NotificationBuffer::size() const {
+		return m_offsets.size();
+	}
+
+	void NotificationBuffer::replay(NotificationSubscriber& sub) const {
+		for (auto offset : m_offsets)
+			sub.notify(reinterpret_cast<const Notification&>(m_data[offset]));
+	}
+
+	void NotificationBuffer::replayReverse(NotificationSubscriber& sub) const {
+		for (auto iter = m_offsets.crbegin(); m_offsets.crend() != iter; ++iter)
+			sub.notify(reinterpret_cast<const Notification&>(m_data[*iter]));
+	}
+
+	void NotificationBuffer::clear() {
+		m_offsets.clear();
+		m_data.clear();
+	}
+
+	void NotificationBuffer::notify(const Notification& notification) {
+		if (notification.Size < sizeof(Notification))
+			CATAPULT_THROW_INVALID_ARGUMENT("cannot buffer notification with incorrect size");
+
+		auto offset = m_data.size();
+		m_data.resize(offset + GetPaddedSize(notification.Size));
+		std::memcpy(&m_data[offset], &notification, notification.Size);
+		m_offsets.push_back(offset);
+	}
+
+	TransactionNotifications::TransactionNotifications(
+			const Transaction& transaction,
+			const Hash256& hash,
+			const NotificationPublisher& publisher)
+			: m_transaction(transaction)
+			, m_hash(hash) {
+		// publish using the owned hash because published notifications can reference it
+		publisher.publish(WeakEntityInfo(m_transaction, m_hash), m_buffer);
+	}
+
+	const Transaction& TransactionNotifications::transaction() const {
+		return m_transaction;
+	}
+
+	const Hash256& TransactionNotifications::hash() const {
+		return m_hash;
+	}
+
+	size_t TransactionNotifications::size() const {
+		return m_buffer.size();
+	}
+
+	void TransactionNotifications::replay(NotificationSubscriber& sub) const {
+		m_buffer.replay(sub);
+	}
+}}
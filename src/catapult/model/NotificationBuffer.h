@@ -0,0 +1,89 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationSubscriber.h"
+#include "catapult/types.h"
+#include "catapult/utils/NonCopyable.h"
+#include <vector>
+
+namespace catapult {
+	namespace model {
+		class NotificationPublisher;
+		struct Transaction;
+	}
+}
+
+namespace catapult { namespace model {
+
+	/// A notification subscriber that stores copies of all notifications it is notified of so that they can be replayed later.
+	/// \note Buffered notifications can reference external data (e.g. entities), which must outlive the buffer.
+	class NotificationBuffer : public NotificationSubscriber {
+	public:
+		/// Creates an empty buffer.
+		NotificationBuffer();
+
+	public:
+		/// Gets the number of buffered notifications.
+		size_t size() const;
+
+		/// Notifies \a sub of all buffered notifications in the order they were buffered.
+		void replay(NotificationSubscriber& sub) const;
+
+		/// Notifies \a sub of all buffered notifications in the reverse order they were buffered.
+		void replayReverse(NotificationSubscriber& sub) const;
+
+		/// Removes all buffered notifications but retains allocated memory so that the buffer can be reused.
+		void clear();
+
+	public:
+		void notify(const Notification& notification) override;
+
+	private:
+		std::vector<size_t> m_offsets;
+		std::vector<uint8_t> m_data;
+	};
+
+	/// All notifications published for a single transaction, which can be replayed instead of republishing the transaction.
+	/// \note The transaction must outlive these notifications.
+	class TransactionNotifications : public utils::NonCopyable {
+	public:
+		/// Creates notifications by publishing \a transaction with \a hash using \a publisher.
+		TransactionNotifications(const Transaction& transaction, const Hash256& hash, const NotificationPublisher& publisher);
+
+	public:
+		/// Gets the transaction.
+		const Transaction& transaction() const;
+
+		/// Gets the transaction hash.
+		const Hash256& hash() const;
+
+		/// Gets the number of notifications.
+		size_t size() const;
+
+		/// Notifies \a sub of all notifications in the order they were published.
+		void replay(NotificationSubscriber& sub) const;
+
+	private:
+		const Transaction& m_transaction;
+		Hash256 m_hash;
+		NotificationBuffer m_buffer;
+	};
+}}
@@ -0,0 +1,71 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationType.h"
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace model {
+
+	/// Table that maps notification types (excluding channel) to all handlers registered for them.
+	/// \note Handlers are stored by pointer and must outlive the table.
+	template<typename THandler>
+	class NotificationDispatchTable {
+	public:
+		using Handlers = std::vector<const THandler*>;
+
+	public:
+		/// Adds \a handler that handles notifications of all types.
+		void add(const THandler& handler) {
+			m_universalHandlers.push_back(&handler);
+			for (auto& pair : m_handlersMap)
+				pair.second.push_back(&handler);
+		}
+
+		/// Adds \a handler that only handles notifications with \a type.
+		void add(NotificationType type, const THandler& handler) {
+			auto key = ToKey(type);
+			auto iter = m_handlersMap.find(key);
+			if (m_handlersMap.cend() == iter) {
+				// all previously added universal handlers must precede handler
+				iter = m_handlersMap.emplace(key, m_universalHandlers).first;
+			}
+
+			iter->second.push_back(&handler);
+		}
+
+	public:
+		/// Gets all handlers that handle notifications with \a type in the order they were added.
+		const Handlers& handlers(NotificationType type) const {
+			auto iter = m_handlersMap.find(ToKey(type));
+			return m_handlersMap.cend() == iter ? m_universalHandlers : iter->second;
+		}
+
+	private:
+		static uint32_t ToKey(NotificationType type) {
+			return 0x00FFFFFFu & utils::to_underlying_type(type);
+		}
+
+	private:
+		Handlers m_universalHandlers;
+		std::unordered_map<uint32_t, Handlers> m_handlersMap;
+	};
+}}
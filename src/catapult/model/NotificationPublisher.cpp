@@ -20,6 +20,7 @@
 
 #include "NotificationPublisher.h"
 #include "Block.h"
+#include "NotificationBuffer.h"
 #include "NotificationSubscriber.h"
 #include "TransactionPlugin.h"
 
@@ -110,10 +111,22 @@ namespace catapult { namespace model {
 
 		public:
 			void publish(const WeakEntityInfoT<VerifiableEntity>& entityInfo, NotificationSubscriber& sub) const override {
+				if (IsReplayable(entityInfo))
+					return entityInfo.notifications()->replay(sub);
+
 				m_basicPublisher.publish(entityInfo, sub);
 				m_customPublisher.publish(entityInfo, sub);
 			}
 
+		private:
+			static bool IsReplayable(const WeakEntityInfoT<VerifiableEntity>& entityInfo) {
+				const auto* pNotifications = entityInfo.notifications();
+				if (!pNotifications || !entityInfo.isHashSet())
+					return false;
+
+				return &entityInfo.entity() == &pNotifications->transaction() && entityInfo.hash() == pNotifications->hash();
+			}
+
 		private:
 			BasicNotificationPublisher m_basicPublisher;
 			CustomNotificationPublisher m_customPublisher;
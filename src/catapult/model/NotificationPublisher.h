@@ -51,6 +51,7 @@ namespace catapult { namespace model {
 	};
 
 	/// Creates a notification publisher around \a transactionRegistry for the specified \a mode.
+	/// \note A publisher with mode PublicationMode::All replays notifications previously published for an entity when available.
 	std::unique_ptr<NotificationPublisher> CreateNotificationPublisher(
 			const TransactionRegistry& transactionRegistry,
 			PublicationMode mode = PublicationMode::All);
@@ -23,21 +23,31 @@
 #include "Block.h"
 #include "EntityRange.h"
 #include "catapult/utils/ShortHash.h"
+#include "catapult/utils/ShortHashIblt.h"
 
 namespace catapult { namespace model {
 
 	/// An entity range composed of blocks.
 	using BlockRange = EntityRange<Block>;
 
+	/// An entity range composed of block headers.
+	using BlockHeaderRange = EntityRange<BlockHeader>;
+
 	/// An entity range composed of transactions.
 	using TransactionRange = EntityRange<Transaction>;
 
 	/// An entity range composed of hashes.
 	using HashRange = EntityRange<Hash256>;
 
+	/// An entity range composed of heights.
+	using HeightRange = EntityRange<Height>;
+
 	/// An entity range composed of short hashes.
 	using ShortHashRange = EntityRange<utils::ShortHash>;
 
+	/// An entity range composed of short hash invertible bloom lookup table cells.
+	using ShortHashIbltCellRange = EntityRange<utils::ShortHashIbltCell>;
+
 	/// An entity range composed of addresses.
 	using AddressRange = EntityRange<Address>;
 
@@ -20,6 +20,7 @@
 
 #include "TransactionUtils.h"
 #include "Address.h"
+#include "NotificationBuffer.h"
 #include "NotificationPublisher.h"
 #include "NotificationSubscriber.h"
 #include "Transaction.h"
@@ -62,4 +63,10 @@ namespace catapult { namespace model {
 		notificationPublisher.publish(weakInfo, sub);
 		return sub.addresses();
 	}
+
+	model::AddressSet ExtractAddresses(const TransactionNotifications& notifications) {
+		AddressCollector sub(NetworkIdentifier(notifications.transaction().Network()));
+		notifications.replay(sub);
+		return sub.addresses();
+	}
 }}
@@ -25,6 +25,7 @@ namespace catapult {
 	namespace model {
 		class NotificationPublisher;
 		struct Transaction;
+		class TransactionNotifications;
 	}
 }
 
@@ -32,4 +33,7 @@ namespace catapult { namespace model {
 
 	/// Extracts all addresses that are involved in \a transaction using \a notificationPublisher.
 	model::AddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher);
+
+	/// Extracts all addresses that are involved in a transaction by replaying its previously published \a notifications.
+	model::AddressSet ExtractAddresses(const TransactionNotifications& notifications);
 }}
@@ -24,6 +24,8 @@
 #include <iosfwd>
 #include <vector>
 
+namespace catapult { namespace model { class TransactionNotifications; } }
+
 namespace catapult { namespace model {
 
 	/// Wrapper around a strongly typed entity and its associated metadata.
@@ -31,7 +33,7 @@ namespace catapult { namespace model {
 	class WeakEntityInfoT {
 	public:
 		/// Creates an entity info.
-		constexpr WeakEntityInfoT() : m_pEntity(nullptr), m_pHash(nullptr)
+		constexpr WeakEntityInfoT() : m_pEntity(nullptr), m_pHash(nullptr), m_pNotifications(nullptr)
 		{}
 
 		/// Creates an entity info around \a entity.
@@ -39,12 +41,19 @@ namespace catapult { namespace model {
 		constexpr WeakEntityInfoT(const TEntity& entity)
 				: m_pEntity(&entity)
 				, m_pHash(nullptr)
+				, m_pNotifications(nullptr)
 		{}
 
 		/// Creates an entity info around \a entity and \a hash.
 		constexpr explicit WeakEntityInfoT(const TEntity& entity, const Hash256& hash)
+				: WeakEntityInfoT(entity, hash, nullptr)
+		{}
+
+		/// Creates an entity info around \a entity, \a hash and its previously published notifications (\a pNotifications).
+		constexpr explicit WeakEntityInfoT(const TEntity& entity, const Hash256& hash, const TransactionNotifications* pNotifications)
 				: m_pEntity(&entity)
 				, m_pHash(&hash)
+				, m_pNotifications(pNotifications)
 		{}
 
 	public:
@@ -73,6 +82,11 @@ namespace catapult { namespace model {
 			return *m_pHash;
 		}
 
+		/// Gets the previously published entity notifications (optional).
+		constexpr const TransactionNotifications* notifications() const {
+			return m_pNotifications;
+		}
+
 	public:
 		/// Returns \c true if this info is equal to \a rhs.
 		constexpr bool operator==(const WeakEntityInfoT& rhs) const {
@@ -88,12 +102,13 @@ namespace catapult { namespace model {
 		/// Coerces this info into a differently typed info.
 		template<typename TEntityResult>
 		WeakEntityInfoT<TEntityResult> cast() const {
-			return WeakEntityInfoT<TEntityResult>(static_cast<const TEntityResult&>(entity()), hash());
+			return WeakEntityInfoT<TEntityResult>(static_cast<const TEntityResult&>(entity()), hash(), notifications());
 		}
 
 	private:
 		const TEntity* m_pEntity;
 		const Hash256* m_pHash;
+		const TransactionNotifications* m_pNotifications;
 	};
 
 	using WeakEntityInfo = WeakEntityInfoT<VerifiableEntity>;
@@ -0,0 +1,172 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BroadcastInventory.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/model/Block.h"
+#include <algorithm>
+
+namespace catapult { namespace net {
+
+	namespace {
+		// calculates the short hash of (at most) the first maxSize bytes of buffers
+		utils::ShortHash CalculateShortHash(const std::vector<RawBuffer>& buffers, size_t maxSize) {
+			Hash256 hash;
+			crypto::Sha3_256_Builder builder;
+			for (const auto& buffer : buffers) {
+				auto size = std::min(buffer.Size, maxSize);
+				builder.update(RawBuffer(buffer.pData, size));
+
+				maxSize -= size;
+				if (0 == maxSize)
+					break;
+			}
+
+			builder.final(hash);
+			return utils::ToShortHash(hash);
+		}
+
+		utils::ShortHash CalculateShortHash(const RawBuffer& buffer) {
+			return CalculateShortHash(std::vector<RawBuffer>{ buffer }, buffer.Size);
+		}
+	}
+
+	std::vector<utils::ShortHash> CalculateBroadcastInventory(const ionet::PacketPayload& payload) {
+		std::vector<utils::ShortHash> inventory;
+		if (payload.buffers().empty())
+			return inventory;
+
+		switch (payload.header().Type) {
+		case ionet::PacketType::Push_Transactions:
+		case ionet::PacketType::Push_Partial_Transactions:
+			for (const auto& buffer : payload.buffers())
+				inventory.push_back(CalculateShortHash(buffer));
+			break;
+
+		case ionet::PacketType::Push_Block:
+		case ionet::PacketType::Push_Compact_Block:
+			// full and compact block payloads both start with the block header
+			inventory.push_back(CalculateShortHash(payload.buffers(), sizeof(model::BlockHeader)));
+			break;
+
+		case ionet::PacketType::Push_Detached_Cosignatures:
+			inventory.push_back(CalculateShortHash(payload.buffers(), payload.header().Size));
+			break;
+
+		default:
+			break;
+		}
+
+		return inventory;
+	}
+
+	utils::ShortHash CalculateBroadcastInventoryItem(const model::Block& block) {
+		return CalculateShortHash(RawBuffer(reinterpret_cast<const uint8_t*>(&block), sizeof(model::BlockHeader)));
+	}
+
+	utils::ShortHash CalculateBroadcastInventoryItem(const model::Transaction& transaction) {
+		return CalculateShortHash(RawBuffer(reinterpret_cast<const uint8_t*>(&transaction), transaction.Size));
+	}
+
+	// region KnownInventory
+
+	KnownInventory::KnownInventory(size_t maxSize) : m_maxSize(maxSize)
+	{}
+
+	size_t KnownInventory::size() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_shortHashes.size();
+	}
+
+	bool KnownInventory::contains(utils::ShortHash shortHash) const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_shortHashes.cend() != m_shortHashes.find(shortHash);
+	}
+
+	bool KnownInventory::add(utils::ShortHash shortHash) {
+		if (0 == m_maxSize)
+			return true;
+
+		utils::SpinLockGuard guard(m_lock);
+		if (!m_shortHashes.insert(shortHash).second)
+			return false;
+
+		m_orderedShortHashes.push_back(shortHash);
+		if (m_orderedShortHashes.size() > m_maxSize) {
+			m_shortHashes.erase(m_orderedShortHashes.front());
+			m_orderedShortHashes.pop_front();
+		}
+
+		return true;
+	}
+
+	// endregion
+
+	// region PeerKnownInventories
+
+	PeerKnownInventories::PeerKnownInventories(size_t maxSize) : m_maxSize(maxSize)
+	{}
+
+	size_t PeerKnownInventories::size() const {
+		utils::SpinLockGuard guard(m_lock);
+		return static_cast<size_t>(std::count_if(m_inventories.cbegin(), m_inventories.cend(), [](const auto& pair) {
+			return !pair.second.expired();
+		}));
+	}
+
+	std::shared_ptr<KnownInventory> PeerKnownInventories::acquire(const Key& identityKey) {
+		utils::SpinLockGuard guard(m_lock);
+		auto pInventory = m_inventories[identityKey].lock();
+		if (!pInventory) {
+			pInventory = std::make_shared<KnownInventory>(m_maxSize);
+			m_inventories[identityKey] = pInventory;
+		}
+
+		// forget all peers that are no longer tracked
+		for (auto iter = m_inventories.begin(); m_inventories.end() != iter;) {
+			if (iter->second.expired())
+				iter = m_inventories.erase(iter);
+			else
+				++iter;
+		}
+
+		return pInventory;
+	}
+
+	void PeerKnownInventories::add(const Key& identityKey, const std::vector<utils::ShortHash>& inventory) {
+		std::shared_ptr<KnownInventory> pInventory;
+		{
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_inventories.find(identityKey);
+			if (m_inventories.cend() == iter)
+				return;
+
+			pInventory = iter->second.lock();
+		}
+
+		if (!pInventory)
+			return;
+
+		for (auto shortHash : inventory)
+			pInventory->add(shortHash);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,100 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/ionet/PacketPayload.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/ShortHash.h"
+#include "catapult/utils/SpinLock.h"
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+namespace catapult {
+	namespace model {
+		struct Block;
+		struct Transaction;
+	}
+}
+
+namespace catapult { namespace net {
+
+	/// Calculates the broadcast inventory of \a payload, which is used to suppress sending the same data to a peer multiple times.
+	/// \note Each transaction in a transactions payload is a separate inventory item, blocks and cosignatures payloads are
+	///       single inventory items and all other payloads have no inventory and are never suppressed.
+	/// \note The inventory item of a (full or compact) block payload only depends on the block header.
+	std::vector<utils::ShortHash> CalculateBroadcastInventory(const ionet::PacketPayload& payload);
+
+	/// Calculates the broadcast inventory item of \a block.
+	utils::ShortHash CalculateBroadcastInventoryItem(const model::Block& block);
+
+	/// Calculates the broadcast inventory item of \a transaction.
+	utils::ShortHash CalculateBroadcastInventoryItem(const model::Transaction& transaction);
+
+	/// A bounded set of broadcast inventory items known to a single peer because they were sent to it or received from it.
+	class KnownInventory {
+	public:
+		/// Creates a known inventory that remembers at most \a maxSize items.
+		/// \note A \a maxSize of \c 0 disables the known inventory.
+		explicit KnownInventory(size_t maxSize);
+
+	public:
+		/// Gets the number of known inventory items.
+		size_t size() const;
+
+		/// Returns \c true if \a shortHash is a known inventory item.
+		bool contains(utils::ShortHash shortHash) const;
+
+	public:
+		/// Adds \a shortHash to the known inventory and returns \c true if it was previously unknown.
+		/// \note The oldest inventory item is forgotten when the known inventory is full.
+		bool add(utils::ShortHash shortHash);
+
+	private:
+		size_t m_maxSize;
+		utils::ShortHashesSet m_shortHashes;
+		std::deque<utils::ShortHash> m_orderedShortHashes;
+		mutable utils::SpinLock m_lock;
+	};
+
+	/// Known inventories of peers keyed by peer identity.
+	/// \note This is shared by the writers that broadcast to peers and the handlers that receive pushed data from peers.
+	class PeerKnownInventories {
+	public:
+		/// Creates peer known inventories that each remember at most \a maxSize items.
+		explicit PeerKnownInventories(size_t maxSize);
+
+	public:
+		/// Gets the number of tracked peers.
+		size_t size() const;
+
+		/// Gets the known inventory of the peer with identity \a identityKey and starts tracking the peer if it is untracked.
+		/// \note A peer is tracked as long as a known inventory returned for it is alive.
+		std::shared_ptr<KnownInventory> acquire(const Key& identityKey);
+
+		/// Adds all \a inventory items to the known inventory of the peer with identity \a identityKey if the peer is tracked.
+		void add(const Key& identityKey, const std::vector<utils::ShortHash>& inventory);
+
+	private:
+		size_t m_maxSize;
+		std::unordered_map<Key, std::weak_ptr<KnownInventory>, utils::ArrayHasher<Key>> m_inventories;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -19,11 +19,15 @@
 **/
 
 #include "Challenge.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/KeyAgreement.h"
 #include "catapult/crypto/KeyPair.h"
+#include "catapult/crypto/SecureZero.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/utils/Logging.h"
+#include <cstring>
 #include <random>
 
 namespace catapult { namespace net {
@@ -39,6 +43,18 @@ namespace catapult { namespace net {
 			std::generate_n(challenge.begin(), challenge.size(), [&generator]() { return static_cast<uint8_t>(generator()); });
 		}
 
+		// a client requests compression by ending its (random) challenge with a tag derived from the rest of the challenge
+		constexpr size_t Compression_Request_Tag_Size = 8;
+
+		// a server accepts compression by signing this marker together with the client challenge
+		constexpr std::array<uint8_t, 8> Compression_Accepted_Marker{{ 'c', 'o', 'm', 'p', 'r', 'e', 's', 's' }};
+
+		Hash256 CalculateCompressionRequestTag(const Challenge& challenge) {
+			Hash256 tag;
+			crypto::Sha3_256({ challenge.data(), challenge.size() - Compression_Request_Tag_Size }, tag);
+			return tag;
+		}
+
 		RawBuffer ToRawBuffer(const ionet::ConnectionSecurityMode& securityMode) {
 			return { reinterpret_cast<const uint8_t*>(&securityMode), sizeof(ionet::ConnectionSecurityMode) };
 		}
@@ -67,8 +83,22 @@ namespace catapult { namespace net {
 			const ServerChallengeRequest& request,
 			const crypto::KeyPair& keyPair,
 			ionet::ConnectionSecurityMode securityMode) {
+		return GenerateServerChallengeResponse(request, keyPair, securityMode, false);
+	}
+
+	std::shared_ptr<ServerChallengeResponse> GenerateServerChallengeResponse(
+			const ServerChallengeRequest& request,
+			const crypto::KeyPair& keyPair,
+			ionet::ConnectionSecurityMode securityMode,
+			bool isCompressionRequested) {
 		auto pResponse = ionet::CreateSharedPacket<ServerChallengeResponse>();
 		GenerateRandomChallenge(pResponse->Challenge);
+		if (isCompressionRequested) {
+			auto tag = CalculateCompressionRequestTag(pResponse->Challenge);
+			auto tagOffset = pResponse->Challenge.size() - Compression_Request_Tag_Size;
+			std::memcpy(pResponse->Challenge.data() + tagOffset, tag.data(), Compression_Request_Tag_Size);
+		}
+
 		SignChallenge(keyPair, { request.Challenge, ToRawBuffer(securityMode) }, pResponse->Signature);
 
 		pResponse->PublicKey = keyPair.publicKey();
@@ -76,6 +106,12 @@ namespace catapult { namespace net {
 		return pResponse;
 	}
 
+	bool IsCompressionRequested(const ServerChallengeResponse& response) {
+		auto tag = CalculateCompressionRequestTag(response.Challenge);
+		auto tagOffset = response.Challenge.size() - Compression_Request_Tag_Size;
+		return 0 == std::memcmp(response.Challenge.data() + tagOffset, tag.data(), Compression_Request_Tag_Size);
+	}
+
 	bool VerifyServerChallengeResponse(const ServerChallengeResponse& response, const Challenge& challenge) {
 		return VerifyChallenge(response.PublicKey, { challenge, ToRawBuffer(response.SecurityMode) }, response.Signature);
 	}
@@ -83,12 +119,53 @@ namespace catapult { namespace net {
 	std::shared_ptr<ClientChallengeResponse> GenerateClientChallengeResponse(
 			const ServerChallengeResponse& request,
 			const crypto::KeyPair& keyPair) {
+		return GenerateClientChallengeResponse(request, keyPair, false);
+	}
+
+	std::shared_ptr<ClientChallengeResponse> GenerateClientChallengeResponse(
+			const ServerChallengeResponse& request,
+			const crypto::KeyPair& keyPair,
+			bool isCompressionAccepted) {
 		auto pResponse = ionet::CreateSharedPacket<ClientChallengeResponse>();
-		SignChallenge(keyPair, { request.Challenge }, pResponse->Signature);
+		if (isCompressionAccepted)
+			SignChallenge(keyPair, { request.Challenge, Compression_Accepted_Marker }, pResponse->Signature);
+		else
+			SignChallenge(keyPair, { request.Challenge }, pResponse->Signature);
+
 		return pResponse;
 	}
 
 	bool VerifyClientChallengeResponse(const ClientChallengeResponse& response, const Key& serverPublicKey, const Challenge& challenge) {
-		return VerifyChallenge(serverPublicKey, { challenge }, response.Signature);
+		return VerifyClientChallengeResponse(response, serverPublicKey, challenge, false);
+	}
+
+	bool VerifyClientChallengeResponse(
+			const ClientChallengeResponse& response,
+			const Key& serverPublicKey,
+			const Challenge& challenge,
+			bool isCompressionAccepted) {
+		return isCompressionAccepted
+				? VerifyChallenge(serverPublicKey, { challenge, Compression_Accepted_Marker }, response.Signature)
+				: VerifyChallenge(serverPublicKey, { challenge }, response.Signature);
+	}
+
+	bool TryCalculateSessionKey(
+			const crypto::KeyPair& keyPair,
+			const Key& remotePublicKey,
+			const Challenge& serverChallenge,
+			const Challenge& clientChallenge,
+			Hash256& sessionKey) {
+		Key sharedSecret;
+		if (!crypto::TryDeriveSharedSecret(keyPair, remotePublicKey, sharedSecret)) {
+			CATAPULT_LOG(warning) << "unable to derive shared secret with " << utils::HexFormat(remotePublicKey);
+			return false;
+		}
+
+		// bind the session key to the (random) challenges so that every connection uses a distinct key
+		crypto::Sha3_256_Builder hashBuilder;
+		hashBuilder.update({ sharedSecret, serverChallenge, clientChallenge });
+		hashBuilder.final(sessionKey);
+		crypto::SecureZero(sharedSecret);
+		return true;
 	}
 }}
@@ -78,6 +78,18 @@ namespace catapult { namespace net {
 			const crypto::KeyPair& keyPair,
 			ionet::ConnectionSecurityMode securityMode);
 
+	/// Generates a client response to a server challenge (\a request) using the client key pair (\a keyPair)
+	/// and requests the specified security mode (\a securityMode) and packet compression (\a isCompressionRequested).
+	/// \note Compression is requested by tagging the client challenge, which is ignored by servers without compression support.
+	std::shared_ptr<ServerChallengeResponse> GenerateServerChallengeResponse(
+			const ServerChallengeRequest& request,
+			const crypto::KeyPair& keyPair,
+			ionet::ConnectionSecurityMode securityMode,
+			bool isCompressionRequested);
+
+	/// Returns \c true if a client's \a response requests packet compression.
+	bool IsCompressionRequested(const ServerChallengeResponse& response);
+
 	/// Verifies a client's \a response to \a challenge.
 	bool VerifyServerChallengeResponse(const ServerChallengeResponse& response, const Challenge& challenge);
 
@@ -86,7 +98,32 @@ namespace catapult { namespace net {
 			const ServerChallengeResponse& request,
 			const crypto::KeyPair& keyPair);
 
+	/// Generates a server response to a client challenge (\a request) using the server key pair (\a keyPair)
+	/// that accepts packet compression if \a isCompressionAccepted is \c true.
+	/// \note Acceptance is signed together with the client challenge, so it cannot be forged or stripped.
+	std::shared_ptr<ClientChallengeResponse> GenerateClientChallengeResponse(
+			const ServerChallengeResponse& request,
+			const crypto::KeyPair& keyPair,
+			bool isCompressionAccepted);
+
 	/// Verifies a server's \a response to \a challenge assuming the server has a public key
 	/// of \a serverPublicKey.
 	bool VerifyClientChallengeResponse(const ClientChallengeResponse& response, const Key& serverPublicKey, const Challenge& challenge);
+
+	/// Verifies a server's \a response to \a challenge assuming the server has a public key
+	/// of \a serverPublicKey and accepted packet compression if \a isCompressionAccepted is \c true.
+	bool VerifyClientChallengeResponse(
+			const ClientChallengeResponse& response,
+			const Key& serverPublicKey,
+			const Challenge& challenge,
+			bool isCompressionAccepted);
+
+	/// Tries to calculate the \a sessionKey shared by the owner of \a keyPair and the owner of \a remotePublicKey
+	/// for a connection handshake using \a serverChallenge and \a clientChallenge.
+	bool TryCalculateSessionKey(
+			const crypto::KeyPair& keyPair,
+			const Key& remotePublicKey,
+			const Challenge& serverChallenge,
+			const Challenge& clientChallenge,
+			Hash256& sessionKey);
 }}
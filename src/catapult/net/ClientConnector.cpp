@@ -21,6 +21,7 @@
 #include "ClientConnector.h"
 #include "VerifyPeer.h"
 #include "catapult/crypto/KeyPair.h"
+#include "catapult/ionet/CompressedPacketIo.h"
 #include "catapult/ionet/PacketSocket.h"
 #include "catapult/ionet/SecurePacketSocketDecorator.h"
 #include "catapult/thread/IoServiceThreadPool.h"
@@ -70,7 +71,8 @@ namespace catapult { namespace net {
 				pRequest->setTimeoutHandler([pAcceptedSocket]() { pAcceptedSocket->close(); });
 
 				auto securityModes = m_settings.IncomingSecurityModes;
-				VerifyClient(pAcceptedSocket, m_keyPair, securityModes, [pThis = shared_from_this(), pAcceptedSocket, pRequest](
+				auto isCompressionSupported = m_settings.isCompressionEnabled();
+				auto verifyCallback = [pThis = shared_from_this(), pAcceptedSocket, pRequest](
 						auto verifyResult,
 						const auto& verifiedPeerInfo) {
 					if (VerifyResult::Success != verifyResult) {
@@ -80,7 +82,8 @@ namespace catapult { namespace net {
 
 					auto pSecuredSocket = pThis->secure(pAcceptedSocket, verifiedPeerInfo);
 					return pRequest->callback(PeerConnectResult::Accepted, pSecuredSocket, verifiedPeerInfo.PublicKey);
-				});
+				};
+				VerifyClient(pAcceptedSocket, m_keyPair, securityModes, isCompressionSupported, verifyCallback);
 			}
 
 			void shutdown() override {
@@ -90,7 +93,18 @@ namespace catapult { namespace net {
 
 		private:
 			PacketSocketPointer secure(const PacketSocketPointer& pSocket, const VerifiedPeerInfo& peerInfo) {
-				return Secure(pSocket, peerInfo.SecurityMode, m_keyPair, peerInfo.PublicKey, m_settings.MaxPacketDataSize);
+				auto pSecuredSocket = Secure(
+						pSocket,
+						peerInfo.SecurityMode,
+						m_keyPair,
+						peerInfo.PublicKey,
+						peerInfo.SessionKey,
+						m_settings.MaxPacketDataSize);
+				if (!peerInfo.IsCompressionEnabled)
+					return pSecuredSocket;
+
+				// compress above the security layer so that compressed packets are signed or authenticated
+				return Compress(pSecuredSocket, m_settings.PacketCompressionThreshold.bytes32(), m_settings.MaxPacketDataSize.bytes32());
 			}
 
 		private:
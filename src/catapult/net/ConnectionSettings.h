@@ -25,6 +25,8 @@
 #include "catapult/utils/FileSize.h"
 #include "catapult/utils/TimeSpan.h"
 
+namespace catapult { namespace net { class PeerKnownInventories; } }
+
 namespace catapult { namespace net {
 
 	/// Settings used to configure connections.
@@ -34,9 +36,15 @@ namespace catapult { namespace net {
 		ConnectionSettings()
 				: NetworkIdentifier(model::NetworkIdentifier::Zero)
 				, Timeout(utils::TimeSpan::FromSeconds(10))
+				, MultiplexedRequestTimeout(utils::TimeSpan::FromSeconds(0)) // request multiplexing disabled
 				, SocketWorkingBufferSize(utils::FileSize::FromKilobytes(4))
 				, SocketWorkingBufferSensitivity(0) // memory reclamation disabled
 				, MaxPacketDataSize(utils::FileSize::FromMegabytes(100))
+				, SocketMaxCoalescedWriteSize(utils::FileSize::FromBytes(0)) // write coalescing disabled
+				, PacketCompressionThreshold(utils::FileSize::FromBytes(0)) // compression disabled
+				, BroadcastKnownInventorySize(0) // broadcast deduplication disabled
+				, MaxBroadcastFanout(0) // broadcast fanout unlimited
+				, BroadcastTrickleInterval(utils::TimeSpan::FromMilliseconds(500))
 				, OutgoingSecurityMode(ionet::ConnectionSecurityMode::None)
 				, IncomingSecurityModes(ionet::ConnectionSecurityMode::None)
 		{}
@@ -48,6 +56,10 @@ namespace catapult { namespace net {
 		/// Connection timeout.
 		utils::TimeSpan Timeout;
 
+		/// Timeout for a single request multiplexed over a shared writer connection.
+		/// \note \c 0 will disable request multiplexing.
+		utils::TimeSpan MultiplexedRequestTimeout;
+
 		/// Socket working buffer size.
 		utils::FileSize SocketWorkingBufferSize;
 
@@ -57,6 +69,32 @@ namespace catapult { namespace net {
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
+		/// Maximum number of bytes of queued socket writes that can be coalesced.
+		utils::FileSize SocketMaxCoalescedWriteSize;
+
+		/// Pool of socket working buffers (optional).
+		std::shared_ptr<ionet::ByteBufferPool> SocketWorkingBufferPool;
+
+		/// Minimum size of packets that are compressed on connections that negotiate packet compression.
+		/// \note \c 0 will disable packet compression.
+		/// \note Compression is only used on connections where both peers enable it (peers without compression support ignore requests).
+		utils::FileSize PacketCompressionThreshold;
+
+		/// Maximum number of broadcast inventory items remembered per peer.
+		/// \note \c 0 will disable broadcast deduplication.
+		uint32_t BroadcastKnownInventorySize;
+
+		/// Known inventories of peers shared with the handlers of pushed data (optional).
+		/// \note When unset, only inventory previously sent to a peer is suppressed (inventory received from a peer is not).
+		std::shared_ptr<PeerKnownInventories> BroadcastKnownInventories;
+
+		/// Maximum number of writer connections a broadcast is sent to immediately.
+		/// \note \c 0 will send every broadcast to all writer connections immediately.
+		uint32_t MaxBroadcastFanout;
+
+		/// Interval at which deferred broadcasts are trickled to the remaining writer connections.
+		utils::TimeSpan BroadcastTrickleInterval;
+
 		/// Security mode of outgoing connections initiated by this node.
 		ionet::ConnectionSecurityMode OutgoingSecurityMode;
 
@@ -64,12 +102,24 @@ namespace catapult { namespace net {
 		ionet::ConnectionSecurityMode IncomingSecurityModes;
 
 	public:
+		/// Returns \c true if requests should be multiplexed over shared writer connections.
+		bool isMultiplexingEnabled() const {
+			return utils::TimeSpan() != MultiplexedRequestTimeout;
+		}
+
+		/// Returns \c true if packet compression should be negotiated with peers.
+		bool isCompressionEnabled() const {
+			return 0 != PacketCompressionThreshold.bytes();
+		}
+
 		/// Gets the packet socket options represented by the configured settings.
 		ionet::PacketSocketOptions toSocketOptions() const {
 			ionet::PacketSocketOptions options;
 			options.WorkingBufferSize = SocketWorkingBufferSize.bytes();
 			options.WorkingBufferSensitivity = SocketWorkingBufferSensitivity;
 			options.MaxPacketDataSize = MaxPacketDataSize.bytes();
+			options.MaxCoalescedWriteSize = SocketMaxCoalescedWriteSize.bytes();
+			options.WorkingBufferPool = SocketWorkingBufferPool;
 			return options;
 		}
 	};
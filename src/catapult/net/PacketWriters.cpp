@@ -19,8 +19,10 @@
 **/
 
 #include "PacketWriters.h"
+#include "BroadcastInventory.h"
 #include "ClientConnector.h"
 #include "ServerConnector.h"
+#include "catapult/ionet/MultiplexedPacketIo.h"
 #include "catapult/ionet/PacketSocket.h"
 #include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/thread/TimedCallback.h"
@@ -28,6 +30,7 @@
 #include "catapult/utils/ModificationSafeIterableContainer.h"
 #include "catapult/utils/SpinLock.h"
 #include "catapult/utils/ThrottleLogger.h"
+#include <boost/asio/steady_timer.hpp>
 #include <list>
 
 namespace catapult { namespace net {
@@ -35,6 +38,18 @@ namespace catapult { namespace net {
 	namespace {
 		using SocketPointer = std::shared_ptr<ionet::PacketSocket>;
 
+		// deferred payloads are only accessed while the writers lock is held
+		// (the known inventory is shared with the handlers of data pushed by the same peer)
+		struct BroadcastState {
+		public:
+			explicit BroadcastState(const std::shared_ptr<KnownInventory>& pKnownInventory) : pInventory(pKnownInventory)
+			{}
+
+		public:
+			std::shared_ptr<KnownInventory> pInventory;
+			std::vector<ionet::PacketPayload> DeferredPayloads;
+		};
+
 		struct WriterState {
 		public:
 			WriterState() : IsAvailable(true)
@@ -45,6 +60,8 @@ namespace catapult { namespace net {
 			ionet::Node Node;
 			SocketPointer pSocket;
 			std::shared_ptr<ionet::PacketIo> pBufferedIo;
+			std::shared_ptr<ionet::PacketMultiplexer> pMultiplexer;
+			std::shared_ptr<BroadcastState> pBroadcastState;
 		};
 
 		bool IsStateAvailable(const WriterState& state) {
@@ -91,13 +108,40 @@ namespace catapult { namespace net {
 				}
 			}
 
+			// handler is called with isImmediate set for at most maxFanout available writers (or all writers when maxFanout is 0);
+			// the window of immediate writers rotates across calls so that all writers are eventually served first
+			template<typename THandler>
+			void forEachWithFanout(size_t maxFanout, THandler handler) {
+				utils::SpinLockGuard guard(m_lock);
+				auto numAvailable = static_cast<size_t>(std::count_if(m_writers.cbegin(), m_writers.cend(), IsStateAvailable));
+				if (0 == numAvailable)
+					return;
+
+				auto startIndex = m_fanoutOffset % numAvailable;
+				auto numImmediate = 0 == maxFanout ? numAvailable : std::min(maxFanout, numAvailable);
+				m_fanoutOffset = startIndex + numImmediate;
+
+				size_t index = 0;
+				for (const auto& state : m_writers) {
+					if (!state.IsAvailable)
+						continue;
+
+					auto windowIndex = (index + numAvailable - startIndex) % numAvailable;
+					handler(state, windowIndex < numImmediate);
+					++index;
+				}
+			}
+
 			bool pickOne(WriterState& state) {
 				utils::SpinLockGuard guard(m_lock);
 				auto* pState = m_writers.nextIf(IsStateAvailable);
 				if (!pState)
 					return false;
 
-				pState->IsAvailable = false;
+				// writers with multiplexers can be shared by multiple concurrent requestors
+				if (!pState->pMultiplexer)
+					pState->IsAvailable = false;
+
 				state = *pState;
 				return true;
 			}
@@ -197,9 +241,39 @@ namespace catapult { namespace net {
 			utils::KeySet m_nodeIdentityKeys; // keys of active writers (both connected AND accepted)
 			utils::KeySet m_outgoingNodeIdentityKeys; // keys of connecting or connected writers
 			Writers m_writers;
+			size_t m_fanoutOffset = 0;
 			mutable utils::SpinLock m_lock;
 		};
 
+		ionet::PacketPayload FilterKnownInventory(
+				KnownInventory& knownInventory,
+				const ionet::PacketPayload& payload,
+				const std::vector<utils::ShortHash>& inventory,
+				uint64_t& numBytesSaved) {
+			if (inventory.empty())
+				return payload;
+
+			// an inventory item either corresponds to a single buffer or to the entire payload
+			if (inventory.size() != payload.buffers().size()) {
+				if (knownInventory.add(inventory[0]))
+					return payload;
+
+				numBytesSaved += payload.header().Size;
+				return ionet::PacketPayload();
+			}
+
+			auto filteredPayload = ionet::PacketPayload::Filter(payload, [&knownInventory, &inventory](auto index) {
+				return knownInventory.add(inventory[index]);
+			});
+
+			numBytesSaved += payload.header().Size - filteredPayload.header().Size;
+			if (!filteredPayload.buffers().empty())
+				return filteredPayload;
+
+			numBytesSaved += filteredPayload.header().Size;
+			return ionet::PacketPayload();
+		}
+
 		class ErrorHandlingPacketIo : public ionet::PacketIo {
 		public:
 			using ErrorCallback = action;
@@ -263,6 +337,16 @@ namespace catapult { namespace net {
 					, m_pClientConnector(CreateClientConnector(m_pPool, keyPair, settings))
 					, m_pServerConnector(CreateServerConnector(m_pPool, keyPair, settings))
 					, m_networkIdentifier(settings.NetworkIdentifier)
+					, m_multiplexedRequestTimeout(settings.MultiplexedRequestTimeout)
+					, m_knownInventorySize(settings.BroadcastKnownInventorySize)
+					, m_pKnownInventories(settings.BroadcastKnownInventories
+							? settings.BroadcastKnownInventories
+							: std::make_shared<PeerKnownInventories>(m_knownInventorySize))
+					, m_maxBroadcastFanout(settings.MaxBroadcastFanout)
+					, m_broadcastTrickleInterval(settings.BroadcastTrickleInterval)
+					, m_numBroadcastBytesSaved(0)
+					, m_trickleTimer(m_pPool->service())
+					, m_isTrickleScheduled(false)
 			{}
 
 		public:
@@ -280,21 +364,40 @@ namespace catapult { namespace net {
 				return m_writers.availableSize();
 			}
 
+			uint64_t numBroadcastBytesSaved() const override {
+				return m_numBroadcastBytesSaved;
+			}
+
 			utils::KeySet identities() const override {
 				return m_writers.identities();
 			}
 
 		public:
 			void broadcast(const ionet::PacketPayload& payload) override {
-				m_writers.forEach([pThis = shared_from_this(), payload](const auto& state) {
-					state.pBufferedIo->write(payload, [pThis, pSocket = state.pSocket](auto code) {
-						if (ionet::SocketOperationCode::Success == code)
-							return;
-
-						CATAPULT_LOG(warning) << "closing socket due to broadcast write error";
-						pThis->removeWriter(pSocket);
-					});
+				auto inventory = 0 == m_knownInventorySize ? std::vector<utils::ShortHash>() : CalculateBroadcastInventory(payload);
+
+				uint64_t numBytesSaved = 0;
+				auto hasDeferredPayloads = false;
+				m_writers.forEachWithFanout(m_maxBroadcastFanout, [this, &payload, &inventory, &numBytesSaved, &hasDeferredPayloads](
+						const auto& state,
+						auto isImmediate) {
+					auto& broadcastState = *state.pBroadcastState;
+					auto filteredPayload = FilterKnownInventory(*broadcastState.pInventory, payload, inventory, numBytesSaved);
+					if (filteredPayload.unset())
+						return;
+
+					if (isImmediate) {
+						this->write(state, filteredPayload);
+						return;
+					}
+
+					broadcastState.DeferredPayloads.push_back(filteredPayload);
+					hasDeferredPayloads = true;
 				});
+
+				m_numBroadcastBytesSaved += numBytesSaved;
+				if (hasDeferredPayloads)
+					scheduleTrickle();
 			}
 
 			ionet::NodePacketIoPair pickOne(const utils::TimeSpan& ioDuration) override {
@@ -312,7 +415,7 @@ namespace catapult { namespace net {
 				};
 
 				auto pPacketIo = std::make_shared<ErrorHandlingPacketIo>(
-						state.pBufferedIo,
+						state.pMultiplexer ? state.pMultiplexer->createChannel() : state.pBufferedIo,
 						errorHandler,
 						createTimedCompletionHandler(state.pSocket, ioDuration, errorHandler));
 
@@ -321,6 +424,45 @@ namespace catapult { namespace net {
 			}
 
 		private:
+			void write(const WriterState& state, const ionet::PacketPayload& payload) {
+				state.pBufferedIo->write(payload, [pThis = shared_from_this(), pSocket = state.pSocket](auto code) {
+					if (ionet::SocketOperationCode::Success == code)
+						return;
+
+					CATAPULT_LOG(warning) << "closing socket due to broadcast write error";
+					pThis->removeWriter(pSocket);
+				});
+			}
+
+			void scheduleTrickle() {
+				utils::SpinLockGuard guard(m_trickleLock);
+				if (m_isTrickleScheduled)
+					return;
+
+				m_isTrickleScheduled = true;
+				m_trickleTimer.expires_from_now(std::chrono::milliseconds(m_broadcastTrickleInterval.millis()));
+				m_trickleTimer.async_wait([pThis = shared_from_this()](const auto& ec) {
+					{
+						utils::SpinLockGuard trickleGuard(pThis->m_trickleLock);
+						pThis->m_isTrickleScheduled = false;
+					}
+
+					if (ec)
+						return;
+
+					pThis->trickle();
+				});
+			}
+
+			void trickle() {
+				m_writers.forEach([this](const auto& state) {
+					std::vector<ionet::PacketPayload> deferredPayloads;
+					deferredPayloads.swap(state.pBroadcastState->DeferredPayloads);
+					for (const auto& payload : deferredPayloads)
+						this->write(state, payload);
+				});
+			}
+
 			ErrorHandlingPacketIo::CompletionCallback createTimedCompletionHandler(
 					const SocketPointer& pSocket,
 					const utils::TimeSpan& ioDuration,
@@ -387,6 +529,10 @@ namespace catapult { namespace net {
 				state.Node = node;
 				state.pSocket = pSocket;
 				state.pBufferedIo = pSocket->buffered();
+				if (utils::TimeSpan() != m_multiplexedRequestTimeout)
+					state.pMultiplexer = ionet::CreatePacketMultiplexer(state.pBufferedIo, m_pPool->service(), m_multiplexedRequestTimeout);
+
+				state.pBroadcastState = std::make_shared<BroadcastState>(m_pKnownInventories->acquire(node.identityKey()));
 				return m_writers.insert(state);
 			}
 
@@ -409,6 +555,9 @@ namespace catapult { namespace net {
 				m_pClientConnector->shutdown();
 				m_pServerConnector->shutdown();
 				m_writers.clear();
+
+				utils::SpinLockGuard guard(m_trickleLock);
+				m_trickleTimer.cancel();
 			}
 
 		private:
@@ -416,7 +565,17 @@ namespace catapult { namespace net {
 			std::shared_ptr<ClientConnector> m_pClientConnector;
 			std::shared_ptr<ServerConnector> m_pServerConnector;
 			model::NetworkIdentifier m_networkIdentifier;
+			utils::TimeSpan m_multiplexedRequestTimeout;
+			size_t m_knownInventorySize;
+			std::shared_ptr<PeerKnownInventories> m_pKnownInventories;
+			size_t m_maxBroadcastFanout;
+			utils::TimeSpan m_broadcastTrickleInterval;
 			WriterContainer m_writers;
+			std::atomic<uint64_t> m_numBroadcastBytesSaved;
+
+			boost::asio::steady_timer m_trickleTimer;
+			bool m_isTrickleScheduled;
+			utils::SpinLock m_trickleLock;
 		};
 	}
 
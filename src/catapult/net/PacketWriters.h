@@ -50,6 +50,9 @@ namespace catapult { namespace net {
 		/// \note There will be fewer available writers than active writers when some writers are checked out.
 		virtual size_t numAvailableWriters() const = 0;
 
+		/// Gets the number of bytes not broadcast because the data was already sent to the receiving peer.
+		virtual uint64_t numBroadcastBytesSaved() const = 0;
+
 	public:
 		/// Broadcasts \a payload to all active connections.
 		virtual void broadcast(const ionet::PacketPayload& payload) = 0;
@@ -21,6 +21,7 @@
 #include "ServerConnector.h"
 #include "VerifyPeer.h"
 #include "catapult/crypto/KeyPair.h"
+#include "catapult/ionet/CompressedPacketIo.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/PacketSocket.h"
 #include "catapult/ionet/SecurePacketSocketDecorator.h"
@@ -85,6 +86,7 @@ namespace catapult { namespace net {
 				});
 
 				VerifiedPeerInfo serverPeerInfo{ publicKey, m_settings.OutgoingSecurityMode };
+				serverPeerInfo.IsCompressionEnabled = m_settings.isCompressionEnabled();
 				VerifyServer(pConnectedSocket, serverPeerInfo, m_keyPair, [pThis = shared_from_this(), pConnectedSocket, pRequest](
 						auto verifyResult,
 						const auto& verifiedPeerInfo) {
@@ -99,7 +101,18 @@ namespace catapult { namespace net {
 			}
 
 			PacketSocketPointer secure(const PacketSocketPointer& pSocket, const VerifiedPeerInfo& peerInfo) {
-				return Secure(pSocket, peerInfo.SecurityMode, m_keyPair, peerInfo.PublicKey, m_settings.MaxPacketDataSize);
+				auto pSecuredSocket = Secure(
+						pSocket,
+						peerInfo.SecurityMode,
+						m_keyPair,
+						peerInfo.PublicKey,
+						peerInfo.SessionKey,
+						m_settings.MaxPacketDataSize);
+				if (!peerInfo.IsCompressionEnabled)
+					return pSecuredSocket;
+
+				// compress above the security layer so that compressed packets are signed or authenticated
+				return Compress(pSecuredSocket, m_settings.PacketCompressionThreshold.bytes32(), m_settings.MaxPacketDataSize.bytes32());
 			}
 
 		public:
@@ -45,10 +45,12 @@ namespace catapult { namespace net {
 					const std::shared_ptr<ionet::PacketIo>& pIo,
 					const crypto::KeyPair& keyPair,
 					ionet::ConnectionSecurityMode allowedSecurityModes,
+					bool isCompressionSupported,
 					const VerifyCallback& callback)
 					: m_pIo(pIo)
 					, m_keyPair(keyPair)
 					, m_allowedSecurityModes(allowedSecurityModes)
+					, m_isCompressionSupported(isCompressionSupported)
 					, m_callback(callback)
 			{}
 
@@ -79,13 +81,17 @@ namespace catapult { namespace net {
 					return invokeCallback(VerifyResult::Malformed_Data);
 
 				auto clientPeerInfo = VerifiedPeerInfo{ pResponse->PublicKey, pResponse->SecurityMode };
-				if (!HasSingleFlag(pResponse->SecurityMode) || !HasFlag(pResponse->SecurityMode, m_allowedSecurityModes))
+				clientPeerInfo.IsCompressionEnabled = m_isCompressionSupported && IsCompressionRequested(*pResponse);
+				if (!HasSingleFlag(clientPeerInfo.SecurityMode) || !HasFlag(clientPeerInfo.SecurityMode, m_allowedSecurityModes))
 					return invokeCallback(VerifyResult::Failure_Unsupported_Connection, clientPeerInfo);
 
 				if (!VerifyServerChallengeResponse(*pResponse, m_pRequest->Challenge))
 					return invokeCallback(VerifyResult::Failure_Challenge, clientPeerInfo);
 
-				auto pServerResponse = GenerateClientChallengeResponse(*pResponse, m_keyPair);
+				if (!tryCalculateSessionKey(clientPeerInfo, m_pRequest->Challenge, pResponse->Challenge))
+					return invokeCallback(VerifyResult::Failure_Challenge, clientPeerInfo);
+
+				auto pServerResponse = GenerateClientChallengeResponse(*pResponse, m_keyPair, clientPeerInfo.IsCompressionEnabled);
 				m_pIo->write(ionet::PacketPayload(pServerResponse), [pThis = shared_from_this(), clientPeerInfo](auto writeCode) {
 					pThis->handleClientChallengeReponseWrite(writeCode, clientPeerInfo);
 				});
@@ -98,6 +104,21 @@ namespace catapult { namespace net {
 				invokeCallback(VerifyResult::Success, clientPeerInfo);
 			}
 
+			bool tryCalculateSessionKey(
+					VerifiedPeerInfo& clientPeerInfo,
+					const Challenge& serverChallenge,
+					const Challenge& clientChallenge) const {
+				if (ionet::ConnectionSecurityMode::Session != clientPeerInfo.SecurityMode)
+					return true;
+
+				return TryCalculateSessionKey(
+						m_keyPair,
+						clientPeerInfo.PublicKey,
+						serverChallenge,
+						clientChallenge,
+						clientPeerInfo.SessionKey);
+			}
+
 		private:
 			void invokeCallback(VerifyResult result) const {
 				invokeCallback(result, VerifiedPeerInfo());
@@ -112,6 +133,7 @@ namespace catapult { namespace net {
 			std::shared_ptr<ionet::PacketIo> m_pIo;
 			const crypto::KeyPair& m_keyPair;
 			ionet::ConnectionSecurityMode m_allowedSecurityModes;
+			bool m_isCompressionSupported;
 			VerifyCallback m_callback;
 			std::shared_ptr<ServerChallengeRequest> m_pRequest;
 		};
@@ -122,7 +144,16 @@ namespace catapult { namespace net {
 			const crypto::KeyPair& keyPair,
 			ionet::ConnectionSecurityMode allowedSecurityModes,
 			const VerifyCallback& callback) {
-		auto pHandler = std::make_shared<VerifyClientHandler>(pClientIo, keyPair, allowedSecurityModes, callback);
+		VerifyClient(pClientIo, keyPair, allowedSecurityModes, false, callback);
+	}
+
+	void VerifyClient(
+			const std::shared_ptr<ionet::PacketIo>& pClientIo,
+			const crypto::KeyPair& keyPair,
+			ionet::ConnectionSecurityMode allowedSecurityModes,
+			bool isCompressionSupported,
+			const VerifyCallback& callback) {
+		auto pHandler = std::make_shared<VerifyClientHandler>(pClientIo, keyPair, allowedSecurityModes, isCompressionSupported, callback);
 		pHandler->start();
 	}
 
@@ -156,7 +187,9 @@ namespace catapult { namespace net {
 				if (!pRequest)
 					return invokeCallback(VerifyResult::Malformed_Data);
 
-				m_pRequest = GenerateServerChallengeResponse(*pRequest, m_keyPair, m_serverPeerInfo.SecurityMode);
+				m_serverChallenge = pRequest->Challenge;
+				auto isCompressionRequested = m_serverPeerInfo.IsCompressionEnabled;
+				m_pRequest = GenerateServerChallengeResponse(*pRequest, m_keyPair, m_serverPeerInfo.SecurityMode, isCompressionRequested);
 				m_pIo->write(ionet::PacketPayload(m_pRequest), [pThis = shared_from_this()](auto writeCode) {
 					pThis->handleServerChallengeResponseWrite(writeCode);
 				});
@@ -179,14 +212,36 @@ namespace catapult { namespace net {
 				if (!pResponse)
 					return invokeCallback(VerifyResult::Malformed_Data);
 
-				auto isVerified = VerifyClientChallengeResponse(*pResponse, m_serverPeerInfo.PublicKey, m_pRequest->Challenge);
-				invokeCallback(isVerified ? VerifyResult::Success: VerifyResult::Failure_Challenge);
+				// a server that does not (want to) support compression ignores the compression request
+				auto serverPeerInfo = m_serverPeerInfo;
+				const auto& challenge = m_pRequest->Challenge;
+				serverPeerInfo.IsCompressionEnabled = serverPeerInfo.IsCompressionEnabled
+						&& VerifyClientChallengeResponse(*pResponse, serverPeerInfo.PublicKey, challenge, true);
+				if (!serverPeerInfo.IsCompressionEnabled && !VerifyClientChallengeResponse(*pResponse, serverPeerInfo.PublicKey, challenge))
+					return invokeCallback(VerifyResult::Failure_Challenge);
+
+				if (ionet::ConnectionSecurityMode::Session == serverPeerInfo.SecurityMode) {
+					auto isCalculated = TryCalculateSessionKey(
+							m_keyPair,
+							serverPeerInfo.PublicKey,
+							m_serverChallenge,
+							m_pRequest->Challenge,
+							serverPeerInfo.SessionKey);
+					if (!isCalculated)
+						return invokeCallback(VerifyResult::Failure_Challenge);
+				}
+
+				invokeCallback(VerifyResult::Success, serverPeerInfo);
 			}
 
 		private:
 			void invokeCallback(VerifyResult result) const {
+				invokeCallback(result, m_serverPeerInfo);
+			}
+
+			void invokeCallback(VerifyResult result, const VerifiedPeerInfo& serverPeerInfo) const {
 				CATAPULT_LOG(debug) << "VerifyServer completed with " << result;
-				m_callback(result, m_serverPeerInfo);
+				m_callback(result, serverPeerInfo);
 			}
 
 		private:
@@ -194,6 +249,7 @@ namespace catapult { namespace net {
 			VerifiedPeerInfo m_serverPeerInfo;
 			const crypto::KeyPair& m_keyPair;
 			VerifyCallback m_callback;
+			Challenge m_serverChallenge;
 			std::shared_ptr<ServerChallengeResponse> m_pRequest;
 		};
 	}
@@ -67,6 +67,13 @@ namespace catapult { namespace net {
 
 		/// Security mode established.
 		ionet::ConnectionSecurityMode SecurityMode;
+
+		/// Session key agreed during verification (only set when SecurityMode is ConnectionSecurityMode::Session).
+		Hash256 SessionKey = Hash256();
+
+		/// \c true if packet compression was requested by the client and accepted by the server.
+		/// \note When verifying a server, this indicates whether or not compression should be requested.
+		bool IsCompressionEnabled = false;
 	};
 
 	/// Insertion operator for outputting \a value to \a out.
@@ -84,8 +91,20 @@ namespace catapult { namespace net {
 			ionet::ConnectionSecurityMode allowedSecurityModes,
 			const VerifyCallback& callback);
 
+	/// Attempts to verify a client (\a pClientIo) and calls \a callback on completion.
+	/// Only security modes set in \a allowedSecurityModes are allowed.
+	/// Packet compression requested by the client is accepted only if \a isCompressionSupported is \c true.
+	/// \a keyPair is used for responses from the server.
+	void VerifyClient(
+			const std::shared_ptr<ionet::PacketIo>& pClientIo,
+			const crypto::KeyPair& keyPair,
+			ionet::ConnectionSecurityMode allowedSecurityModes,
+			bool isCompressionSupported,
+			const VerifyCallback& callback);
+
 	/// Attempts to verify a server (\a pServerIo) using \a serverPeerInfo and calls \a callback on completion.
 	/// \a keyPair is used for responses from the client.
+	/// \note Requested packet compression is only enabled in the verified peer information when the server accepted it.
 	void VerifyServer(
 			const std::shared_ptr<ionet::PacketIo>& pServerIo,
 			const VerifiedPeerInfo& serverPeerInfo,
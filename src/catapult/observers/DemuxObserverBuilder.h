@@ -19,41 +19,41 @@
 **/
 
 #pragma once
-#include "AggregateObserverBuilder.h"
+#include "AggregateNotificationObserver.h"
 #include "ObserverTypes.h"
-#include <functional>
+#include "catapult/model/NotificationDispatchTable.h"
+#include "catapult/utils/NamedObject.h"
 #include <vector>
 
 namespace catapult { namespace observers {
 
 	/// A demultiplexing observer builder.
+	/// \note Observers are grouped by notification type when they are added so that each notification is only forwarded
+	///        to the observers that are registered for its type.
 	class DemuxObserverBuilder {
 	private:
-		using NotificationObserverPredicate = predicate<const model::Notification&>;
+		using NotificationObserverPointerVector = std::vector<NotificationObserverPointerT<model::Notification>>;
+		using NotificationObserverDispatchTable = model::NotificationDispatchTable<NotificationObserver>;
 
 	public:
 		/// Adds an observer (\a pObserver) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
 		DemuxObserverBuilder& add(NotificationObserverPointerT<TNotification>&& pObserver) {
-			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-				return model::AreEqualExcludingChannel(type, notification.Type);
-			};
-			m_builder.add(std::make_unique<ConditionalObserver<TNotification>>(std::move(pObserver), predicate));
+			m_observers.push_back(std::make_unique<TypedObserver<TNotification>>(std::move(pObserver)));
+			m_dispatchTable.add(TNotification::Notification_Type, *m_observers.back());
 			return *this;
 		}
 
 		/// Builds a demultiplexing observer.
 		AggregateNotificationObserverPointerT<model::Notification> build() {
-			return m_builder.build();
+			return std::make_unique<DemuxAggregateNotificationObserver>(std::move(m_observers), std::move(m_dispatchTable));
 		}
 
 	private:
 		template<typename TNotification>
-		class ConditionalObserver : public NotificationObserver {
+		class TypedObserver : public NotificationObserver {
 		public:
-			ConditionalObserver(NotificationObserverPointerT<TNotification>&& pObserver, const NotificationObserverPredicate& predicate)
-					: m_pObserver(std::move(pObserver))
-					, m_predicate(predicate)
+			explicit TypedObserver(NotificationObserverPointerT<TNotification>&& pObserver) : m_pObserver(std::move(pObserver))
 			{}
 
 		public:
@@ -62,26 +62,65 @@ namespace catapult { namespace observers {
 			}
 
 			void notify(const model::Notification& notification, const ObserverContext& context) const override {
-				if (!m_predicate(notification))
-					return;
-
+				// notification type has already been checked by dispatch table
 				m_pObserver->notify(static_cast<const TNotification&>(notification), context);
 			}
 
 		private:
 			NotificationObserverPointerT<TNotification> m_pObserver;
-			NotificationObserverPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationObserver : public AggregateNotificationObserverT<model::Notification> {
+		public:
+			DemuxAggregateNotificationObserver(
+					NotificationObserverPointerVector&& observers,
+					NotificationObserverDispatchTable&& dispatchTable)
+					: m_observers(std::move(observers))
+					, m_dispatchTable(std::move(dispatchTable))
+					, m_name(utils::ReduceNames(utils::ExtractNames(m_observers)))
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return utils::ExtractNames(m_observers);
+			}
+
+			void notify(const model::Notification& notification, const ObserverContext& context) const override {
+				const auto& observers = m_dispatchTable.handlers(notification.Type);
+				if (NotifyMode::Commit == context.Mode)
+					notifyAll(observers.cbegin(), observers.cend(), notification, context);
+				else
+					notifyAll(observers.crbegin(), observers.crend(), notification, context);
+			}
+
+		private:
+			template<typename TIter>
+			void notifyAll(TIter begin, TIter end, const model::Notification& notification, const ObserverContext& context) const {
+				for (auto iter = begin; end != iter; ++iter)
+					(*iter)->notify(notification, context);
+			}
+
+		private:
+			NotificationObserverPointerVector m_observers;
+			NotificationObserverDispatchTable m_dispatchTable;
+			std::string m_name;
 		};
 
 	private:
-		AggregateObserverBuilder<model::Notification> m_builder;
+		NotificationObserverPointerVector m_observers;
+		NotificationObserverDispatchTable m_dispatchTable;
 	};
 
 	/// Adds an observer (\a pObserver) to the builder that is always invoked.
 	template<>
 	CATAPULT_INLINE
 	DemuxObserverBuilder& DemuxObserverBuilder::add(NotificationObserverPointerT<model::Notification>&& pObserver) {
-		m_builder.add(std::move(pObserver));
+		m_observers.push_back(std::move(pObserver));
+		m_dispatchTable.add(*m_observers.back());
 		return *this;
 	}
 }}
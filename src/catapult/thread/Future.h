@@ -58,9 +58,9 @@ namespace catapult { namespace thread {
 		>
 		auto then(TContinuation continuation, typename std::enable_if<!std::is_same<TResultType, void>::value>::type* = nullptr) {
 			auto pResultState = std::make_shared<detail::shared_state<TResultType>>();
-			m_pState->set_continuation([pResultState, continuation](const auto& pState) {
+			on_complete([pResultState, continuation](auto&& completedFuture) {
 				try {
-					pResultState->set_value(continuation(future<T>(pState)));
+					pResultState->set_value(continuation(std::move(completedFuture)));
 				} catch (...) {
 					pResultState->set_exception(std::current_exception());
 				}
@@ -93,6 +93,17 @@ namespace catapult { namespace thread {
 #pragma warning(pop)
 #endif
 
+		/// Configures \a continuation to run at the completion of this future.
+		/// \note Unlike then, no future (and shared state) is created for the result of \a continuation,
+		///       so this should be preferred when the result is not needed.
+		/// \note Exceptions thrown by \a continuation are not captured and propagate to the completing thread.
+		template<typename TContinuation>
+		void on_complete(TContinuation continuation) {
+			m_pState->set_continuation([continuation](const auto& pState) {
+				continuation(future<T>(pState));
+			});
+		}
+
 	private:
 		std::shared_ptr<detail::shared_state<T>> m_pState;
 	};
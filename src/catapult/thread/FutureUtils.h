@@ -52,7 +52,7 @@ namespace catapult { namespace thread {
 
 			void setContinuation(FutureType& future, size_t index) {
 				auto pThis = this->shared_from_this();
-				future.then([pThis, index](auto&& continuationFuture) {
+				future.on_complete([pThis, index](auto&& continuationFuture) {
 					auto& futures = pThis->m_futures;
 					futures[index] = std::move(continuationFuture);
 					if (futures.size() != ++pThis->m_counter)
@@ -100,23 +100,23 @@ namespace catapult { namespace thread {
 			typename TResultFuture = typename std::result_of<TCreateNextFuture(future<TSeed>&&)>::type,
 			typename TResultType = decltype(TResultFuture().get())>
 	auto compose(future<TSeed>&& startFuture, TCreateNextFuture createNextFuture) {
-		auto pComposePromise = std::make_shared<promise<TResultType>>();
-		startFuture.then([createNextFuture, pComposePromise](auto&& completedFirstFuture) {
+		auto pComposeState = std::make_shared<detail::shared_state<TResultType>>();
+		startFuture.on_complete([createNextFuture, pComposeState](auto&& completedFirstFuture) {
 			try {
 				auto secondFuture = createNextFuture(std::move(completedFirstFuture));
-				secondFuture.then([pComposePromise](auto&& completedSecondFuture) {
+				secondFuture.on_complete([pComposeState](auto&& completedSecondFuture) {
 					try {
-						pComposePromise->set_value(completedSecondFuture.get());
+						pComposeState->set_value(completedSecondFuture.get());
 					} catch (...) {
-						pComposePromise->set_exception(std::current_exception());
+						pComposeState->set_exception(std::current_exception());
 					}
 				});
 			} catch (...) {
-				pComposePromise->set_exception(std::current_exception());
+				pComposeState->set_exception(std::current_exception());
 			}
 		});
 
-		return pComposePromise->get_future();
+		return future<TResultType>(pComposeState);
 	}
 
 	/// Evaluates all \a futures and returns the results of all non-exceptional ones.
@@ -61,9 +61,10 @@ namespace catapult { namespace thread {
 
 		class DefaultIoServiceThreadPool : public IoServiceThreadPool {
 		public:
-			DefaultIoServiceThreadPool(size_t numWorkerThreads, const std::string& tag)
+			DefaultIoServiceThreadPool(size_t numWorkerThreads, const std::string& tag, const utils::CpuSet& cpuAffinity)
 					: m_numConfiguredWorkerThreads(numWorkerThreads)
 					, m_tag(tag)
+					, m_cpuAffinity(cpuAffinity)
 					, m_numWorkerThreads(0)
 			{}
 
@@ -95,6 +96,7 @@ namespace catapult { namespace thread {
 				for (auto i = 0u; i < m_numConfiguredWorkerThreads; ++i) {
 					m_pContext->createThread([this, i]() {
 						thread::SetThreadName(std::to_string(i) + " " + this->tag() + " worker");
+						pinWorkerThread();
 						ioWorkerFunction();
 					});
 				}
@@ -115,6 +117,16 @@ namespace catapult { namespace thread {
 			}
 
 		private:
+			void pinWorkerThread() {
+				if (m_cpuAffinity.empty())
+					return;
+
+				if (thread::SetThreadAffinity(m_cpuAffinity))
+					CATAPULT_LOG(trace) << m_tag << " worker thread pinned to cpus " << m_cpuAffinity;
+				else
+					CATAPULT_LOG(warning) << m_tag << " worker thread could not be pinned to cpus " << m_cpuAffinity;
+			}
+
 			void ioWorkerFunction() {
 				CATAPULT_LOG(trace) << m_tag << " worker thread started";
 
@@ -135,6 +147,7 @@ namespace catapult { namespace thread {
 		private:
 			size_t m_numConfiguredWorkerThreads;
 			std::string m_tag;
+			utils::CpuSet m_cpuAffinity;
 
 			boost::asio::io_service m_service;
 			std::unique_ptr<ThreadPoolContext> m_pContext;
@@ -153,7 +166,10 @@ namespace catapult { namespace thread {
 		}
 	}
 
-	std::unique_ptr<IoServiceThreadPool> CreateIoServiceThreadPool(size_t numWorkerThreads, const char* name) {
-		return std::make_unique<DefaultIoServiceThreadPool>(numWorkerThreads, CreateTagFromName(name));
+	std::unique_ptr<IoServiceThreadPool> CreateIoServiceThreadPool(
+			size_t numWorkerThreads,
+			const char* name,
+			const utils::CpuSet& cpuAffinity) {
+		return std::make_unique<DefaultIoServiceThreadPool>(numWorkerThreads, CreateTagFromName(name), cpuAffinity);
 	}
 }}
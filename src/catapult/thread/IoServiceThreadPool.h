@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/utils/CpuSet.h"
 #include <memory>
 #include <string>
 
@@ -52,5 +53,9 @@ namespace catapult { namespace thread {
 
 	/// Creates an io service thread pool with the specified number of threads (\a numWorkerThreads) and the
 	/// optional friendly \a name used in logging.
-	std::unique_ptr<IoServiceThreadPool> CreateIoServiceThreadPool(size_t numWorkerThreads, const char* name = nullptr);
+	/// \note When \a cpuAffinity is not empty, all worker threads will be pinned to the cpus it contains.
+	std::unique_ptr<IoServiceThreadPool> CreateIoServiceThreadPool(
+			size_t numWorkerThreads,
+			const char* name = nullptr,
+			const utils::CpuSet& cpuAffinity = utils::CpuSet());
 }}
@@ -115,14 +115,18 @@ namespace catapult { namespace thread {
 
 	public:
 		/// Creates a pool with the specified number of threads (\a numWorkerThreads) and \a name with optional
-		/// isolated pool mode (\a isolatedPoolMode).
+		/// isolated pool mode (\a isolatedPoolMode) and optional cpu affinity (\a cpuAffinity).
 		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
-		MultiServicePool(const std::string& name, size_t numWorkerThreads, IsolatedPoolMode isolatedPoolMode = IsolatedPoolMode::Enabled)
+		MultiServicePool(
+				const std::string& name,
+				size_t numWorkerThreads,
+				IsolatedPoolMode isolatedPoolMode = IsolatedPoolMode::Enabled,
+				const utils::CpuSet& cpuAffinity = utils::CpuSet())
 				: m_name(name)
 				, m_isolatedPoolMode(isolatedPoolMode)
 				, m_numTotalIsolatedPoolThreads(0)
 				, m_numServiceGroups(0)
-				, m_pPool(CreateThreadPool(numWorkerThreads, name))
+				, m_pPool(CreateThreadPool(numWorkerThreads, name, cpuAffinity))
 		{}
 
 		/// Destroys the pool.
@@ -181,9 +185,14 @@ namespace catapult { namespace thread {
 			return pushIsolatedPool(name, DefaultPoolConcurrency());
 		}
 
-		/// Creates a new isolated threadpool with the specified number of threads (\a numWorkerThreads) and \a name.
+		/// Creates a new isolated threadpool with the specified number of threads (\a numWorkerThreads) and \a name
+		/// with optional cpu affinity (\a cpuAffinity).
 		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
-		std::shared_ptr<thread::IoServiceThreadPool> pushIsolatedPool(const std::string& name, size_t numWorkerThreads) {
+		/// \note When isolated pools are disabled, the main pool is returned and \a cpuAffinity is ignored.
+		std::shared_ptr<thread::IoServiceThreadPool> pushIsolatedPool(
+				const std::string& name,
+				size_t numWorkerThreads,
+				const utils::CpuSet& cpuAffinity = utils::CpuSet()) {
 			class PoolServiceAdapter {
 			public:
 				explicit PoolServiceAdapter(const std::shared_ptr<thread::IoServiceThreadPool>& pPool) : m_pPool(pPool)
@@ -200,10 +209,17 @@ namespace catapult { namespace thread {
 			};
 
 			// when isolated pool mode is disabled, use the main pool for everything
-			if (IsolatedPoolMode::Disabled == m_isolatedPoolMode)
+			if (IsolatedPoolMode::Disabled == m_isolatedPoolMode) {
+				if (!cpuAffinity.empty()) {
+					CATAPULT_LOG(warning)
+							<< "ignoring cpu affinity (" << cpuAffinity << ") of " << name
+							<< " pool because isolated pools are disabled";
+				}
+
 				return m_pPool;
+			}
 
-			auto pPool = CreateThreadPool(numWorkerThreads, name);
+			auto pPool = CreateThreadPool(numWorkerThreads, name, cpuAffinity);
 			registerService(std::make_shared<PoolServiceAdapter>(pPool), name + " (isolated pool)");
 			m_numTotalIsolatedPoolThreads += pPool->numWorkerThreads();
 			return pPool;
@@ -233,9 +249,15 @@ namespace catapult { namespace thread {
 		}
 
 	private:
-		static std::shared_ptr<thread::IoServiceThreadPool> CreateThreadPool(size_t numWorkerThreads, const std::string& name) {
-			numWorkerThreads = DefaultPoolConcurrency() == numWorkerThreads ? std::thread::hardware_concurrency() : numWorkerThreads;
-			auto pPool = thread::CreateIoServiceThreadPool(numWorkerThreads, name.c_str());
+		static std::shared_ptr<thread::IoServiceThreadPool> CreateThreadPool(
+				size_t numWorkerThreads,
+				const std::string& name,
+				const utils::CpuSet& cpuAffinity) {
+			// when the pool is pinned, by default use one thread per pinned cpu
+			if (DefaultPoolConcurrency() == numWorkerThreads)
+				numWorkerThreads = cpuAffinity.empty() ? std::thread::hardware_concurrency() : cpuAffinity.size();
+
+			auto pPool = thread::CreateIoServiceThreadPool(numWorkerThreads, name.c_str(), cpuAffinity);
 			pPool->start();
 			return std::move(pPool);
 		}
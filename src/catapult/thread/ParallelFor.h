@@ -20,7 +20,16 @@
 
 #pragma once
 #include "Future.h"
+#include "FutureUtils.h"
+#include "catapult/utils/SpinLock.h"
 #include <boost/asio.hpp>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace catapult { namespace thread {
 
@@ -112,15 +121,298 @@ namespace catapult { namespace thread {
 		return pParallelContext->future();
 	}
 
-	/// Uses \a service to process \a items in \a numPartitions batches and calls \a callback for each item.
+	/// Work distribution statistics of a parallel for operation.
+	struct ParallelForStatistics {
+		/// Number of partitions that processed items.
+		size_t NumPartitions = 0;
+
+		/// Number of processed items.
+		size_t NumItems = 0;
+
+		/// Number of successful steals.
+		size_t NumSteals = 0;
+
+		/// Number of items moved between partitions by steals.
+		size_t NumStolenItems = 0;
+
+		/// Minimum number of items processed by a single partition.
+		size_t MinPartitionItems = 0;
+
+		/// Maximum number of items processed by a single partition.
+		size_t MaxPartitionItems = 0;
+	};
+
+	namespace detail {
+		/// Item index ranges, one per partition, that allow idle partitions to steal work from busy ones.
+		/// \note Each partition processes its own range from the front and steals half of the remaining items of another
+		///        partition from the back once its own range is exhausted.
+		class WorkStealingPartitions {
+		private:
+			struct Partition {
+				utils::SpinLock Lock;
+				size_t Begin = 0;
+				size_t End = 0;
+				size_t NumProcessedItems = 0; // only accessed by the partition owner
+			};
+
+		public:
+			/// Creates partitions that split \a numItems items evenly across at most \a numPartitions partitions.
+			WorkStealingPartitions(size_t numItems, size_t numPartitions)
+					: m_numPartitions(std::min(numItems, numPartitions))
+					, m_pPartitions(std::make_unique<Partition[]>(m_numPartitions))
+					, m_numSteals(0)
+					, m_numStolenItems(0) {
+				// note: in the case that numItems is not divisible by m_numPartitions,
+				//       give the leading partitions one more item in order to ensure that the partitions cover all items
+				size_t begin = 0;
+				for (auto i = 0u; i < m_numPartitions; ++i) {
+					auto size = numItems / m_numPartitions + (i < numItems % m_numPartitions ? 1 : 0);
+					m_pPartitions[i].Begin = begin;
+					m_pPartitions[i].End = begin + size;
+					begin += size;
+				}
+			}
+
+		public:
+			/// Gets the number of partitions.
+			size_t size() const {
+				return m_numPartitions;
+			}
+
+		public:
+			/// Claims the next item for the partition with index \a partitionIndex and stores its index in \a itemIndex.
+			/// Returns \c false when there are no remaining items in any partition.
+			bool next(size_t partitionIndex, size_t& itemIndex) {
+				// note that stolen items can be stolen again before they are claimed, so keep stealing until an item is claimed
+				auto& partition = m_pPartitions[partitionIndex];
+				while (!tryPopFront(partition, itemIndex)) {
+					if (!steal(partitionIndex))
+						return false;
+				}
+
+				++partition.NumProcessedItems;
+				return true;
+			}
+
+			/// Drops all remaining items of the partition with index \a partitionIndex.
+			void abandon(size_t partitionIndex) {
+				auto& partition = m_pPartitions[partitionIndex];
+				utils::SpinLockGuard guard(partition.Lock);
+				partition.Begin = partition.End;
+			}
+
+			/// Gets the work distribution statistics.
+			/// \note This is only valid after all partitions have completed.
+			ParallelForStatistics statistics() const {
+				ParallelForStatistics statistics;
+				statistics.NumPartitions = m_numPartitions;
+				statistics.NumSteals = m_numSteals;
+				statistics.NumStolenItems = m_numStolenItems;
+				statistics.MinPartitionItems = 0 == m_numPartitions ? 0 : std::numeric_limits<size_t>::max();
+				for (auto i = 0u; i < m_numPartitions; ++i) {
+					auto numProcessedItems = m_pPartitions[i].NumProcessedItems;
+					statistics.NumItems += numProcessedItems;
+					statistics.MinPartitionItems = std::min(statistics.MinPartitionItems, numProcessedItems);
+					statistics.MaxPartitionItems = std::max(statistics.MaxPartitionItems, numProcessedItems);
+				}
+
+				return statistics;
+			}
+
+		private:
+			static bool tryPopFront(Partition& partition, size_t& itemIndex) {
+				utils::SpinLockGuard guard(partition.Lock);
+				if (partition.Begin == partition.End)
+					return false;
+
+				itemIndex = partition.Begin++;
+				return true;
+			}
+
+			bool steal(size_t partitionIndex) {
+				for (auto i = 1u; i < m_numPartitions; ++i) {
+					auto& victim = m_pPartitions[(partitionIndex + i) % m_numPartitions];
+					size_t begin;
+					size_t end;
+					{
+						utils::SpinLockGuard guard(victim.Lock);
+						auto numRemainingItems = victim.End - victim.Begin;
+						if (0 == numRemainingItems)
+							continue;
+
+						// take the back half of the remaining items, which the victim will process last
+						end = victim.End;
+						victim.End -= (numRemainingItems + 1) / 2;
+						begin = victim.End;
+					}
+
+					auto& partition = m_pPartitions[partitionIndex];
+					{
+						utils::SpinLockGuard guard(partition.Lock);
+						partition.Begin = begin;
+						partition.End = end;
+					}
+
+					++m_numSteals;
+					m_numStolenItems += end - begin;
+					return true;
+				}
+
+				return false;
+			}
+
+		private:
+			size_t m_numPartitions;
+			std::unique_ptr<Partition[]> m_pPartitions;
+			std::atomic<size_t> m_numSteals;
+			std::atomic<size_t> m_numStolenItems;
+		};
+
+		/// Provides indexed access to the items of a container with random access iterators.
+		template<typename TIterator, bool IsRandomAccess>
+		class IndexedIterators {
+		public:
+			/// Creates indexed iterators for the range starting at \a begin and ending at \a end.
+			IndexedIterators(TIterator begin, TIterator) : m_begin(begin)
+			{}
+
+		public:
+			/// Gets an iterator pointing to the item at \a index.
+			TIterator operator[](size_t index) const {
+				return m_begin + static_cast<typename std::iterator_traits<TIterator>::difference_type>(index);
+			}
+
+		private:
+			TIterator m_begin;
+		};
+
+		/// Provides indexed access to the items of a container without random access iterators.
+		template<typename TIterator>
+		class IndexedIterators<TIterator, false> {
+		public:
+			/// Creates indexed iterators for the range starting at \a begin and ending at \a end.
+			IndexedIterators(TIterator begin, TIterator end) {
+				for (auto iter = begin; end != iter; ++iter)
+					m_iterators.push_back(iter);
+			}
+
+		public:
+			/// Gets an iterator pointing to the item at \a index.
+			TIterator operator[](size_t index) const {
+				return m_iterators[index];
+			}
+
+		private:
+			std::vector<TIterator> m_iterators;
+		};
+	}
+
+	/// Uses \a service to process \a items in \a numPartitions work stealing batches and calls \a callback for each item.
+	/// A future is returned that is resolved with work distribution statistics when all items have been processed.
+	/// \note When \a callback returns \c false, the remaining items of the calling partition are not processed.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<ParallelForStatistics> ParallelForWithStatistics(
+			boost::asio::io_service& service,
+			TItems& items,
+			size_t numPartitions,
+			TWorkCallback callback) {
+		using IteratorType = decltype(items.begin());
+		using IteratorCategory = typename std::iterator_traits<IteratorType>::iterator_category;
+		using IndexedIteratorsType = detail::IndexedIterators<
+				IteratorType,
+				std::is_base_of<std::random_access_iterator_tag, IteratorCategory>::value>;
+
+		// region ParallelContext
+
+		class ParallelContext {
+		public:
+			ParallelContext(TItems& items, size_t numPartitions)
+					: m_iterators(items.begin(), items.end())
+					, m_partitions(items.size(), numPartitions)
+					, m_numOutstandingOperations(1) // note that the work partitioning is the initial operation
+			{}
+
+		public:
+			auto& partitions() {
+				return m_partitions;
+			}
+
+			auto future() {
+				return m_promise.get_future();
+			}
+
+		public:
+			void process(size_t partitionIndex, const TWorkCallback& callback) {
+				size_t itemIndex;
+				while (m_partitions.next(partitionIndex, itemIndex)) {
+					if (!callback(*m_iterators[itemIndex], itemIndex)) {
+						m_partitions.abandon(partitionIndex);
+						break;
+					}
+				}
+			}
+
+		public:
+			void incrementOutstandingOperations() {
+				++m_numOutstandingOperations;
+			}
+
+			void decrementOutstandingOperations() {
+				if (0 != --m_numOutstandingOperations)
+					return;
+
+				m_promise.set_value(m_partitions.statistics());
+			}
+
+		private:
+			IndexedIteratorsType m_iterators;
+			detail::WorkStealingPartitions m_partitions;
+			std::atomic<size_t> m_numOutstandingOperations;
+			thread::promise<ParallelForStatistics> m_promise;
+		};
+
+		// endregion
+
+		// region DecrementGuard
+
+		class DecrementGuard {
+		public:
+			explicit DecrementGuard(ParallelContext& context) : m_context(context)
+			{}
+
+			~DecrementGuard() {
+				m_context.decrementOutstandingOperations();
+			}
+
+		private:
+			ParallelContext& m_context;
+		};
+
+		// endregion
+
+		auto pParallelContext = std::make_shared<ParallelContext>(items, numPartitions);
+		DecrementGuard mainOperationGuard(*pParallelContext);
+
+		for (auto i = 0u; i < pParallelContext->partitions().size(); ++i) {
+			// each thread captures pParallelContext by value, which keeps that object alive
+			pParallelContext->incrementOutstandingOperations();
+			service.post([callback, pParallelContext, partitionIndex = i]() {
+				DecrementGuard threadOperationGuard(*pParallelContext);
+				pParallelContext->process(partitionIndex, callback);
+			});
+		}
+
+		return pParallelContext->future();
+	}
+
+	/// Uses \a service to process \a items in \a numPartitions work stealing batches and calls \a callback for each item.
 	/// A future is returned that is resolved when all items have been processed.
+	/// \note When \a callback returns \c false, the remaining items of the calling partition are not processed.
 	template<typename TItems, typename TWorkCallback>
 	thread::future<bool> ParallelFor(boost::asio::io_service& service, TItems& items, size_t numPartitions, TWorkCallback callback) {
-		return ParallelForPartition(service, items, numPartitions, [callback](auto itBegin, auto itEnd, auto startIndex, auto) {
-			auto i = 0u;
-			std::all_of(itBegin, itEnd, [callback, startIndex, &i](auto& item) {
-				return callback(item, startIndex + i++);
-			});
+		return thread::compose(ParallelForWithStatistics(service, items, numPartitions, callback), [](auto&& statisticsFuture) {
+			statisticsFuture.get();
+			return thread::make_ready_future(true);
 		});
 	}
 }}
@@ -19,6 +19,7 @@
 **/
 
 #include "ThreadInfo.h"
+#include "catapult/utils/CpuSet.h"
 #include "catapult/utils/Logging.h"
 #ifdef _WIN32
 #include <windows.h>
@@ -77,4 +78,26 @@ namespace catapult { namespace thread {
 		pthread_getname_np(pthread_self(), &name[0], name.size());
 		return name.substr(0, name.find_first_of('\0'));
 	}
+
+	bool SetThreadAffinity(const utils::CpuSet& cpuSet) {
+		if (cpuSet.empty())
+			return true;
+
+#if defined(_WIN32) || defined(__APPLE__)
+		// thread affinity is only supported on linux
+		return false;
+#else
+		cpu_set_t nativeCpuSet;
+		CPU_ZERO(&nativeCpuSet);
+		for (auto cpuId : cpuSet.cpuIds()) {
+			if (cpuId >= CPU_SETSIZE)
+				return false;
+
+			CPU_SET(cpuId, &nativeCpuSet);
+		}
+
+		// since pinned threads allocate memory on first touch, this also keeps their allocations local to the numa node of cpuSet
+		return 0 == pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &nativeCpuSet);
+#endif
+	}
 }}
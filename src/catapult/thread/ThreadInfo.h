@@ -21,6 +21,8 @@
 #pragma once
 #include <string>
 
+namespace catapult { namespace utils { class CpuSet; } }
+
 namespace catapult { namespace thread {
 
 	/// Gets the maximum supported thread name length (excluding NUL-terminator).
@@ -32,4 +34,9 @@ namespace catapult { namespace thread {
 
 	/// Gets a thread name in a platform-dependent way.
 	std::string GetThreadName();
+
+	/// Pins the current thread to the cpus in \a cpuSet in a platform-dependent way.
+	/// Returns \c false if the thread could not be pinned (or pinning is not supported on the current platform).
+	/// \note An empty \a cpuSet is ignored and leaves the current thread affinity unchanged.
+	bool SetThreadAffinity(const utils::CpuSet& cpuSet);
 }}
@@ -20,6 +20,7 @@
 
 #include "ConfigurationValueParsers.h"
 #include "BlockSpan.h"
+#include "CpuSet.h"
 #include "FileSize.h"
 #include "HexParser.h"
 #include "TimeSpan.h"
@@ -283,4 +284,43 @@ namespace catapult { namespace utils {
 	}
 
 	// endregion
+
+	// region cpu set
+
+	namespace {
+		bool TryParseCpuIdRange(const std::string& str, uint32_t& rangeStart, uint32_t& rangeEnd) {
+			auto separatorIndex = str.find('-');
+			if (std::string::npos == separatorIndex)
+				return TryParseValue(str, rangeStart) && TryParseValue(str, rangeEnd);
+
+			return TryParseValue(str.substr(0, separatorIndex), rangeStart)
+					&& TryParseValue(str.substr(separatorIndex + 1), rangeEnd)
+					&& rangeStart <= rangeEnd;
+		}
+	}
+
+	bool TryParseValue(const std::string& str, CpuSet& parsedValue) {
+		std::unordered_set<std::string> parts;
+		if (!TryParseValue(str, parts))
+			return false;
+
+		std::set<uint32_t> cpuIds;
+		for (const auto& part : parts) {
+			uint32_t rangeStart;
+			uint32_t rangeEnd;
+			if (!TryParseCpuIdRange(part, rangeStart, rangeEnd) || rangeEnd >= CpuSet::Max_Cpu_Id)
+				return false;
+
+			// don't allow overlapping values
+			for (auto cpuId = rangeStart; cpuId <= rangeEnd; ++cpuId) {
+				if (!cpuIds.insert(cpuId).second)
+					return false;
+			}
+		}
+
+		parsedValue = CpuSet(std::move(cpuIds));
+		return true;
+	}
+
+	// endregion
 }}
@@ -27,6 +27,7 @@
 namespace catapult {
 	namespace utils {
 		class BlockSpan;
+		class CpuSet;
 		class FileSize;
 		class TimeSpan;
 	}
@@ -81,6 +82,10 @@ namespace catapult { namespace utils {
 	/// \note \a str is expected to be comma separated
 	bool TryParseValue(const std::string& str, std::unordered_set<std::string>& parsedValue);
 
+	/// Tries to parse \a str into a cpu set (\a parsedValue).
+	/// \note \a str is expected to be comma separated cpu identifiers or inclusive ranges of cpu identifiers (e.g. 0-3,8).
+	bool TryParseValue(const std::string& str, CpuSet& parsedValue);
+
 	/// Tries to parse \a str into an enum value (\a parsedValue) given a mapping of strings to values (\a stringToValueMapping).
 	template<typename T, size_t N>
 	bool TryParseEnumValue(const std::array<std::pair<const char*, T>, N>& stringToValueMapping, const std::string& str, T& parsedValue) {
@@ -0,0 +1,48 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CpuSet.h"
+#include <iostream>
+
+namespace catapult { namespace utils {
+
+	std::ostream& operator<<(std::ostream& out, const CpuSet& cpuSet) {
+		// output contiguous cpus as ranges (e.g. 0-3,8)
+		const auto& cpuIds = cpuSet.cpuIds();
+		auto hasOutput = false;
+		for (auto iter = cpuIds.cbegin(); cpuIds.cend() != iter;) {
+			auto rangeStart = *iter;
+			auto rangeEnd = rangeStart;
+			while (cpuIds.cend() != ++iter && rangeEnd + 1 == *iter)
+				++rangeEnd;
+
+			if (hasOutput)
+				out << ",";
+
+			out << rangeStart;
+			if (rangeStart != rangeEnd)
+				out << "-" << rangeEnd;
+
+			hasOutput = true;
+		}
+
+		return out;
+	}
+}}
@@ -0,0 +1,80 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <iosfwd>
+#include <set>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Represents a set of logical cpu identifiers that threads can be pinned to.
+	/// \note An empty set indicates that threads are allowed to run on any cpu.
+	class CpuSet final {
+	public:
+		/// Maximum (exclusive) supported cpu identifier.
+		static constexpr uint32_t Max_Cpu_Id = 1024;
+
+	public:
+		/// Creates an empty cpu set.
+		CpuSet() = default;
+
+		/// Creates a cpu set around \a cpuIds.
+		CpuSet(std::initializer_list<uint32_t> cpuIds) : m_cpuIds(cpuIds)
+		{}
+
+		/// Creates a cpu set around \a cpuIds.
+		explicit CpuSet(std::set<uint32_t>&& cpuIds) : m_cpuIds(std::move(cpuIds))
+		{}
+
+	public:
+		/// Returns \c true if no cpus are contained in this set.
+		bool empty() const {
+			return m_cpuIds.empty();
+		}
+
+		/// Gets the number of cpus contained in this set.
+		size_t size() const {
+			return m_cpuIds.size();
+		}
+
+		/// Gets the (ordered) cpu identifiers contained in this set.
+		const std::set<uint32_t>& cpuIds() const {
+			return m_cpuIds;
+		}
+
+	public:
+		/// Returns \c true if this cpu set is equal to \a rhs.
+		bool operator==(const CpuSet& rhs) const {
+			return m_cpuIds == rhs.m_cpuIds;
+		}
+
+		/// Returns \c true if this cpu set is not equal to \a rhs.
+		bool operator!=(const CpuSet& rhs) const {
+			return !(*this == rhs);
+		}
+
+	private:
+		std::set<uint32_t> m_cpuIds;
+	};
+
+	/// Insertion operator for outputting \a cpuSet to \a out.
+	std::ostream& operator<<(std::ostream& out, const CpuSet& cpuSet);
+}}
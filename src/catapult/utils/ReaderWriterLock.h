@@ -0,0 +1,382 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/exceptions.h"
+#include "catapult/preprocessor.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace catapult { namespace utils {
+
+	/// Reader writer lock contention statistics.
+	struct ReaderWriterLockStatistics {
+		/// Number of times a reader had to wait.
+		uint64_t NumReaderWaits;
+
+		/// Number of times a writer had to wait.
+		uint64_t NumWriterWaits;
+
+		/// Number of spins performed by waiting threads.
+		uint64_t NumSpins;
+
+		/// Number of times a waiting thread was parked.
+		uint64_t NumParks;
+
+		/// Total time spent waiting (in microseconds).
+		uint64_t TotalWaitMicroseconds;
+
+		/// Maximum time spent in a single wait (in microseconds).
+		uint64_t MaxWaitMicroseconds;
+	};
+
+	/// Custom reader writer lock that allows multiple readers and a single writer and prefers writers.
+	/// \note
+	/// - readers are counted in striped counters in order to avoid contention on a single cache line
+	/// - waiting threads spin briefly and are then parked until they are woken
+	/// - writer lock must be acquired via a reader lock promotion
+	template<typename TReaderNotificationPolicy>
+	class BasicReaderWriterLock : private TReaderNotificationPolicy {
+	public:
+		/// Number of reader counter stripes.
+		static constexpr size_t Num_Reader_Slots = 16;
+
+		/// Maximum number of spins before a waiting thread is parked.
+		static constexpr uint32_t Max_Spins = 64;
+
+	private:
+		// 0[active writer]|1234567...[total writers]
+		static constexpr uint32_t Active_Writer_Flag = 0x8000'0000;
+		static constexpr uint32_t Pending_Writer_Mask = 0x7FFF'FFFF;
+		static constexpr uint32_t Pending_Writer_Increment = 0x0000'0001;
+
+		// pad each reader counter so that it occupies its own cache line
+		struct ReaderCounter {
+			std::atomic<uint32_t> Value;
+			uint8_t Padding[64 - sizeof(std::atomic<uint32_t>)];
+		};
+
+	private:
+#pragma push_macro("Yield")
+#undef Yield
+		static void Yield() {
+			std::this_thread::yield();
+		}
+#pragma pop_macro("Yield")
+
+		static size_t GetReaderSlot() {
+			// assign reader slots to threads round robin so that (up to Num_Reader_Slots) threads use distinct counters
+			static std::atomic<size_t> nextSlot(0);
+			static thread_local size_t slot = nextSlot++ % Num_Reader_Slots;
+			return slot;
+		}
+
+	public:
+		/// A writer lock guard.
+		class WriterLockGuard {
+		public:
+			/// Creates a guard around \a lock for a writer promoted from a reader in \a slot with promotion flag \a isActive.
+			WriterLockGuard(BasicReaderWriterLock& lock, size_t slot, bool& isActive)
+					: m_pLock(&lock)
+					, m_slot(slot)
+					, m_pIsActive(&isActive)
+			{}
+
+			/// Move constructor.
+			WriterLockGuard(WriterLockGuard&& rhs) : m_pLock(rhs.m_pLock), m_slot(rhs.m_slot), m_pIsActive(rhs.m_pIsActive) {
+				rhs.m_pLock = nullptr;
+			}
+
+			/// Releases the writer lock.
+			~WriterLockGuard() {
+				if (!m_pLock)
+					return;
+
+				m_pLock->releaseWriter(m_slot);
+				*m_pIsActive = false;
+			}
+
+		private:
+			BasicReaderWriterLock* m_pLock;
+			size_t m_slot;
+			bool* m_pIsActive;
+		};
+
+		/// A reader lock guard.
+		class ReaderLockGuard {
+		public:
+			/// Creates a guard around \a lock for a reader in \a slot.
+			ReaderLockGuard(BasicReaderWriterLock& lock, size_t slot)
+					: m_pLock(&lock)
+					, m_slot(slot)
+					, m_isWriterActive(false)
+			{}
+
+			/// Move constructor.
+			ReaderLockGuard(ReaderLockGuard&& rhs)
+					: m_pLock(rhs.m_pLock)
+					, m_slot(rhs.m_slot)
+					, m_isWriterActive(rhs.m_isWriterActive) {
+				rhs.m_pLock = nullptr;
+			}
+
+			/// Releases the reader lock.
+			~ReaderLockGuard() {
+				if (!m_pLock)
+					return;
+
+				m_pLock->releaseReader(m_slot);
+			}
+
+		public:
+			/// Blocks until the reader lock can be promoted to a writer lock.
+			WriterLockGuard promoteToWriter() {
+				markActiveWriter();
+
+				m_pLock->acquireWriter(m_slot);
+				return WriterLockGuard(*m_pLock, m_slot, m_isWriterActive);
+			}
+
+		private:
+			void markActiveWriter() {
+				if (m_isWriterActive)
+					CATAPULT_THROW_RUNTIME_ERROR("reader lock has already been promoted");
+
+				m_isWriterActive = true;
+			}
+
+		private:
+			BasicReaderWriterLock* m_pLock;
+			size_t m_slot;
+			bool m_isWriterActive;
+		};
+
+	public:
+		/// Creates an unlocked lock.
+		BasicReaderWriterLock()
+				: m_writerState(0)
+				, m_numParkedThreads(0)
+				, m_numReaderWaits(0)
+				, m_numWriterWaits(0)
+				, m_numSpins(0)
+				, m_numParks(0)
+				, m_totalWaitMicroseconds(0)
+				, m_maxWaitMicroseconds(0) {
+			for (auto& counter : m_readerCounters)
+				counter.Value = 0;
+		}
+
+	public:
+		/// Blocks until a reader lock can be acquired.
+		ReaderLockGuard acquireReader() {
+			// notify before blocking so that reentrant readers are detected instead of deadlocking
+			TReaderNotificationPolicy::readerAcquired();
+
+			auto slot = GetReaderSlot();
+			auto& counter = m_readerCounters[slot].Value;
+			for (;;) {
+				// wait for any pending writes to complete
+				waitUntil(m_numReaderWaits, [this]() { return 0 == m_writerState; });
+
+				// optimistically register the reader and confirm that no writer became pending in the meantime
+				++counter;
+				if (0 == m_writerState)
+					break;
+
+				// back off in favor of the pending writer, which might be waiting for this reader to drain
+				--counter;
+				wakeParkedThreads();
+			}
+
+			return ReaderLockGuard(*this, slot);
+		}
+
+	public:
+		/// Returns \c true if there is a pending (or active) writer.
+		CATAPULT_INLINE
+		bool isWriterPending() const {
+			return 0 != (m_writerState & Pending_Writer_Mask);
+		}
+
+		/// Returns \c true if there is an active writer.
+		CATAPULT_INLINE
+		bool isWriterActive() const {
+			return 0 != (m_writerState & Active_Writer_Flag);
+		}
+
+		/// Returns \c true if there is an active reader.
+		bool isReaderActive() const {
+			for (const auto& counter : m_readerCounters) {
+				if (0 != counter.Value)
+					return true;
+			}
+
+			return false;
+		}
+
+		/// Gets the contention statistics.
+		ReaderWriterLockStatistics statistics() const {
+			ReaderWriterLockStatistics statistics;
+			statistics.NumReaderWaits = m_numReaderWaits.load(std::memory_order_relaxed);
+			statistics.NumWriterWaits = m_numWriterWaits.load(std::memory_order_relaxed);
+			statistics.NumSpins = m_numSpins.load(std::memory_order_relaxed);
+			statistics.NumParks = m_numParks.load(std::memory_order_relaxed);
+			statistics.TotalWaitMicroseconds = m_totalWaitMicroseconds.load(std::memory_order_relaxed);
+			statistics.MaxWaitMicroseconds = m_maxWaitMicroseconds.load(std::memory_order_relaxed);
+			return statistics;
+		}
+
+	private:
+		void acquireWriter(size_t slot) {
+			// mark a pending write by changing the reader to a writer
+			m_writerState += Pending_Writer_Increment;
+			--m_readerCounters[slot].Value;
+			wakeParkedThreads();
+
+			// wait for exclusive access (when there is no active writer and no readers)
+			for (;;) {
+				waitUntil(m_numWriterWaits, [this]() { return !isWriterActive() && !isReaderActive(); });
+
+				uint32_t expected = m_writerState & Pending_Writer_Mask;
+				if (m_writerState.compare_exchange_strong(expected, expected | Active_Writer_Flag))
+					break;
+			}
+		}
+
+		void releaseWriter(size_t slot) {
+			// change the writer back to a reader and unset the active writer flag
+			++m_readerCounters[slot].Value;
+			m_writerState -= Active_Writer_Flag + Pending_Writer_Increment;
+			wakeParkedThreads();
+		}
+
+		void releaseReader(size_t slot) {
+			--m_readerCounters[slot].Value;
+			TReaderNotificationPolicy::readerReleased();
+			wakeParkedThreads();
+		}
+
+	private:
+		template<typename TPredicate>
+		void waitUntil(std::atomic<uint64_t>& numWaits, TPredicate predicate) {
+			if (predicate())
+				return;
+
+			numWaits.fetch_add(1, std::memory_order_relaxed);
+			auto startTime = std::chrono::steady_clock::now();
+
+			uint32_t numSpins = 0;
+			while (!predicate()) {
+				if (Max_Spins == numSpins) {
+					park(predicate);
+					break;
+				}
+
+				++numSpins;
+				Yield();
+			}
+
+			m_numSpins.fetch_add(numSpins, std::memory_order_relaxed);
+			recordWaitTime(std::chrono::steady_clock::now() - startTime);
+		}
+
+		template<typename TPredicate>
+		void park(TPredicate predicate) {
+			m_numParks.fetch_add(1, std::memory_order_relaxed);
+
+			// parked count is incremented before the predicate is checked (under the mutex), so any state change that the predicate
+			// misses is guaranteed to be followed by a wake up
+			std::unique_lock<std::mutex> lock(m_parkMutex);
+			++m_numParkedThreads;
+			m_parkCondition.wait(lock, predicate);
+			--m_numParkedThreads;
+		}
+
+		void wakeParkedThreads() {
+			if (0 == m_numParkedThreads)
+				return;
+
+			// acquire the mutex in order to synchronize with threads that are in the process of parking
+			{
+				std::lock_guard<std::mutex> lock(m_parkMutex);
+			}
+
+			m_parkCondition.notify_all();
+		}
+
+		void recordWaitTime(std::chrono::steady_clock::duration elapsedTime) {
+			auto elapsedMicroseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsedTime).count());
+			m_totalWaitMicroseconds.fetch_add(elapsedMicroseconds, std::memory_order_relaxed);
+
+			auto maxWaitMicroseconds = m_maxWaitMicroseconds.load(std::memory_order_relaxed);
+			while (maxWaitMicroseconds < elapsedMicroseconds) {
+				if (m_maxWaitMicroseconds.compare_exchange_weak(maxWaitMicroseconds, elapsedMicroseconds, std::memory_order_relaxed))
+					break;
+			}
+		}
+
+	private:
+		std::array<ReaderCounter, Num_Reader_Slots> m_readerCounters;
+		std::atomic<uint32_t> m_writerState;
+
+		std::mutex m_parkMutex;
+		std::condition_variable m_parkCondition;
+		std::atomic<uint32_t> m_numParkedThreads;
+
+		std::atomic<uint64_t> m_numReaderWaits;
+		std::atomic<uint64_t> m_numWriterWaits;
+		std::atomic<uint64_t> m_numSpins;
+		std::atomic<uint64_t> m_numParks;
+		std::atomic<uint64_t> m_totalWaitMicroseconds;
+		std::atomic<uint64_t> m_maxWaitMicroseconds;
+	};
+
+	/// A no-op reader notification policy.
+	struct NoOpReaderNotificationPolicy {
+		/// A reader was acquried by the current thread.
+		CPP14_CONSTEXPR
+		void readerAcquired()
+		{}
+
+		/// A reader was released by the current thread.
+		CPP14_CONSTEXPR
+		void readerReleased()
+		{}
+	};
+}}
+
+#ifdef ENABLE_CATAPULT_DIAGNOSTICS
+#include "ReentrancyCheckReaderNotificationPolicy.h"
+#endif
+
+namespace catapult { namespace utils {
+#ifdef ENABLE_CATAPULT_DIAGNOSTICS
+	using DefaultReaderNotificationPolicy = ReentrancyCheckReaderNotificationPolicy;
+#else
+	using DefaultReaderNotificationPolicy = NoOpReaderNotificationPolicy;
+#endif
+
+	/// A default reader writer lock.
+	using ReaderWriterLock = BasicReaderWriterLock<DefaultReaderNotificationPolicy>;
+}}
@@ -0,0 +1,97 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ShortHashBloomFilter.h"
+#include <algorithm>
+#include <cstring>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr size_t Bits_Per_Block = 256;
+
+		// odd salts used to derive one bit per block word (same constants as the parquet split block bloom filter)
+		constexpr uint32_t Salts[] = { 0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du, 0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u };
+
+		// short hashes are only 32 bits, so spread them over 64 bits before splitting them into block selector and bit pattern
+		uint64_t Mix(ShortHash shortHash) {
+			auto value = static_cast<uint64_t>(shortHash.unwrap()) + 0x9E3779B97F4A7C15ull;
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+			return value ^ (value >> 31);
+		}
+
+		size_t CalculateNumBlocks(size_t capacity) {
+			auto numBits = std::max<size_t>(1, capacity) * ShortHashBloomFilter::Bits_Per_Element;
+			return (numBits + Bits_Per_Block - 1) / Bits_Per_Block;
+		}
+
+		size_t SelectBlock(uint64_t mixed, size_t numBlocks) {
+			return static_cast<size_t>(((mixed >> 32) * numBlocks) >> 32);
+		}
+
+		uint32_t SelectBit(uint64_t mixed, size_t wordIndex) {
+			return 1u << ((static_cast<uint32_t>(mixed) * Salts[wordIndex]) >> 27);
+		}
+	}
+
+	ShortHashBloomFilter::ShortHashBloomFilter(size_t capacity)
+			: m_capacity(capacity)
+			, m_size(0)
+			, m_blocks(CalculateNumBlocks(capacity))
+	{}
+
+	size_t ShortHashBloomFilter::capacity() const {
+		return m_capacity;
+	}
+
+	size_t ShortHashBloomFilter::size() const {
+		return m_size;
+	}
+
+	size_t ShortHashBloomFilter::memorySize() const {
+		return m_blocks.size() * sizeof(Block);
+	}
+
+	bool ShortHashBloomFilter::maybeContains(ShortHash shortHash) const {
+		auto mixed = Mix(shortHash);
+		const auto& block = m_blocks[SelectBlock(mixed, m_blocks.size())];
+		for (auto i = 0u; i < CountOf(block.Words); ++i) {
+			if (0 == (block.Words[i] & SelectBit(mixed, i)))
+				return false;
+		}
+
+		return true;
+	}
+
+	void ShortHashBloomFilter::insert(ShortHash shortHash) {
+		auto mixed = Mix(shortHash);
+		auto& block = m_blocks[SelectBlock(mixed, m_blocks.size())];
+		for (auto i = 0u; i < CountOf(block.Words); ++i)
+			block.Words[i] |= SelectBit(mixed, i);
+
+		++m_size;
+	}
+
+	void ShortHashBloomFilter::clear() {
+		std::memset(m_blocks.data(), 0, memorySize());
+		m_size = 0;
+	}
+}}
@@ -0,0 +1,68 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ShortHash.h"
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Split block bloom filter over short hashes.
+	/// \note Each short hash maps to a single 256-bit block, so every query touches exactly one cache line.
+	class ShortHashBloomFilter {
+	public:
+		/// Number of bits reserved per expected element.
+		static constexpr size_t Bits_Per_Element = 16;
+
+	public:
+		/// Creates a filter that is sized to hold \a capacity short hashes at its nominal false positive rate.
+		explicit ShortHashBloomFilter(size_t capacity);
+
+	public:
+		/// Gets the number of short hashes the filter was sized for.
+		size_t capacity() const;
+
+		/// Gets the number of short hashes inserted into the filter.
+		size_t size() const;
+
+		/// Gets the number of bytes used by the filter.
+		size_t memorySize() const;
+
+	public:
+		/// Returns \c false if \a shortHash was definitely never inserted into the filter.
+		bool maybeContains(ShortHash shortHash) const;
+
+		/// Inserts \a shortHash into the filter.
+		void insert(ShortHash shortHash);
+
+		/// Removes all short hashes from the filter.
+		void clear();
+
+	private:
+		struct Block {
+			uint32_t Words[8];
+		};
+
+	private:
+		size_t m_capacity;
+		size_t m_size;
+		std::vector<Block> m_blocks;
+	};
+}}
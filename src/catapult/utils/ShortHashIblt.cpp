@@ -0,0 +1,153 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ShortHashIblt.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr auto Num_Hash_Functions = ShortHashIblt::Num_Hash_Functions;
+
+		// salts used to derive independent cell indexes and the check hash from a single short hash
+		constexpr uint64_t Index_Salts[] = { 0x9E3779B97F4A7C15ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull };
+		constexpr uint64_t Check_Salt = 0xD6E8FEB86659FD93ull;
+
+		uint64_t Mix(ShortHash shortHash, uint64_t salt) {
+			auto value = static_cast<uint64_t>(shortHash.unwrap()) + salt;
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+			return value ^ (value >> 31);
+		}
+
+		size_t CalculateCellIndex(ShortHash shortHash, size_t hashFunctionIndex, size_t subtableSize) {
+			auto mixed = Mix(shortHash, Index_Salts[hashFunctionIndex]);
+			return hashFunctionIndex * subtableSize + static_cast<size_t>(((mixed >> 32) * subtableSize) >> 32);
+		}
+
+		uint32_t CalculateCheckSum(ShortHash shortHash) {
+			return static_cast<uint32_t>(Mix(shortHash, Check_Salt));
+		}
+
+		void UpdateCell(ShortHashIbltCell& cell, ShortHash shortHash, int32_t delta) {
+			cell.Count += delta;
+			cell.KeySum = ShortHash(cell.KeySum.unwrap() ^ shortHash.unwrap());
+			cell.CheckSum ^= CalculateCheckSum(shortHash);
+		}
+
+		bool IsPure(const ShortHashIbltCell& cell) {
+			return (1 == cell.Count || -1 == cell.Count) && CalculateCheckSum(cell.KeySum) == cell.CheckSum;
+		}
+
+		bool IsEmpty(const ShortHashIbltCell& cell) {
+			return 0 == cell.Count && ShortHash() == cell.KeySum && 0 == cell.CheckSum;
+		}
+
+		size_t RoundUpToMultiple(size_t value, size_t multiple) {
+			return (value + multiple - 1) / multiple * multiple;
+		}
+	}
+
+	ShortHashIblt::ShortHashIblt(size_t numCells)
+			: m_cells(RoundUpToMultiple(std::max<size_t>(1, numCells), Num_Hash_Functions), ShortHashIbltCell())
+	{}
+
+	ShortHashIblt::ShortHashIblt(std::vector<ShortHashIbltCell>&& cells) : m_cells(std::move(cells)) {
+		if (!IsValidNumCells(m_cells.size()))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("number of iblt cells is invalid", m_cells.size());
+	}
+
+	size_t ShortHashIblt::CalculateNumCells(size_t maxDifference) {
+		// peeling small tables fails relatively often, so reserve a fixed number of cells in addition to two cells per short hash
+		return RoundUpToMultiple(2 * maxDifference + 10 * Num_Hash_Functions, Num_Hash_Functions);
+	}
+
+	bool ShortHashIblt::IsValidNumCells(size_t numCells) {
+		return 0 != numCells && 0 == numCells % Num_Hash_Functions;
+	}
+
+	size_t ShortHashIblt::numCells() const {
+		return m_cells.size();
+	}
+
+	const std::vector<ShortHashIbltCell>& ShortHashIblt::cells() const {
+		return m_cells;
+	}
+
+	void ShortHashIblt::insert(ShortHash shortHash) {
+		update(shortHash, 1);
+	}
+
+	void ShortHashIblt::erase(ShortHash shortHash) {
+		update(shortHash, -1);
+	}
+
+	void ShortHashIblt::subtract(const ShortHashIblt& other) {
+		if (m_cells.size() != other.m_cells.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_2("cannot subtract iblts with different sizes", m_cells.size(), other.m_cells.size());
+
+		for (auto i = 0u; i < m_cells.size(); ++i) {
+			const auto& otherCell = other.m_cells[i];
+			auto& cell = m_cells[i];
+			cell.Count -= otherCell.Count;
+			cell.KeySum = ShortHash(cell.KeySum.unwrap() ^ otherCell.KeySum.unwrap());
+			cell.CheckSum ^= otherCell.CheckSum;
+		}
+	}
+
+	bool ShortHashIblt::decode(std::vector<ShortHash>& positiveShortHashes, std::vector<ShortHash>& negativeShortHashes) const {
+		auto cells = m_cells;
+		auto subtableSize = cells.size() / Num_Hash_Functions;
+
+		std::vector<size_t> pureCellIndexes;
+		for (auto i = 0u; i < cells.size(); ++i) {
+			if (IsPure(cells[i]))
+				pureCellIndexes.push_back(i);
+		}
+
+		// repeatedly peel short hashes out of pure cells, which might turn other cells pure
+		while (!pureCellIndexes.empty()) {
+			const auto& pureCell = cells[pureCellIndexes.back()];
+			pureCellIndexes.pop_back();
+			if (!IsPure(pureCell))
+				continue;
+
+			auto shortHash = pureCell.KeySum;
+			auto count = pureCell.Count;
+			(1 == count ? positiveShortHashes : negativeShortHashes).push_back(shortHash);
+
+			for (auto i = 0u; i < Num_Hash_Functions; ++i) {
+				auto cellIndex = CalculateCellIndex(shortHash, i, subtableSize);
+				UpdateCell(cells[cellIndex], shortHash, -count);
+				if (IsPure(cells[cellIndex]))
+					pureCellIndexes.push_back(cellIndex);
+			}
+		}
+
+		return std::all_of(cells.cbegin(), cells.cend(), IsEmpty);
+	}
+
+	void ShortHashIblt::update(ShortHash shortHash, int32_t delta) {
+		auto subtableSize = m_cells.size() / Num_Hash_Functions;
+		for (auto i = 0u; i < Num_Hash_Functions; ++i)
+			UpdateCell(m_cells[CalculateCellIndex(shortHash, i, subtableSize)], shortHash, delta);
+	}
+}}
@@ -0,0 +1,94 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ShortHash.h"
+#include <vector>
+
+namespace catapult { namespace utils {
+
+#pragma pack(push, 1)
+
+	/// A cell of a short hash invertible bloom lookup table.
+	struct ShortHashIbltCell {
+		/// Signed number of short hashes mapped to the cell.
+		int32_t Count;
+
+		/// Xor of all short hashes mapped to the cell.
+		ShortHash KeySum;
+
+		/// Xor of the check hashes of all short hashes mapped to the cell.
+		uint32_t CheckSum;
+	};
+
+#pragma pack(pop)
+
+	/// Invertible bloom lookup table over short hashes that can be used to reconcile two sets of short hashes.
+	/// \note Each short hash is mapped to exactly one cell in each of Num_Hash_Functions equally sized subtables.
+	class ShortHashIblt {
+	public:
+		/// Number of cells each short hash is mapped to.
+		static constexpr size_t Num_Hash_Functions = 3;
+
+	public:
+		/// Creates an empty table with at least \a numCells cells.
+		explicit ShortHashIblt(size_t numCells);
+
+		/// Creates a table around \a cells.
+		explicit ShortHashIblt(std::vector<ShortHashIbltCell>&& cells);
+
+	public:
+		/// Calculates the number of cells needed to decode set differences containing up to \a maxDifference short hashes.
+		/// \note Decoding can still fail occasionally, so callers are expected to have a fallback.
+		static size_t CalculateNumCells(size_t maxDifference);
+
+		/// Returns \c true if a table can be composed of \a numCells cells.
+		static bool IsValidNumCells(size_t numCells);
+
+	public:
+		/// Gets the number of cells.
+		size_t numCells() const;
+
+		/// Gets the cells.
+		const std::vector<ShortHashIbltCell>& cells() const;
+
+	public:
+		/// Inserts \a shortHash into the table.
+		void insert(ShortHash shortHash);
+
+		/// Erases \a shortHash from the table.
+		void erase(ShortHash shortHash);
+
+		/// Subtracts all short hashes in \a other from the table.
+		/// \note Both tables must have the same number of cells.
+		void subtract(const ShortHashIblt& other);
+
+		/// Decodes the table into short hashes with positive counts (\a positiveShortHashes)
+		/// and short hashes with negative counts (\a negativeShortHashes).
+		/// Returns \c false if the table could not be completely decoded.
+		bool decode(std::vector<ShortHash>& positiveShortHashes, std::vector<ShortHash>& negativeShortHashes) const;
+
+	private:
+		void update(ShortHash shortHash, int32_t delta);
+
+	private:
+		std::vector<ShortHashIbltCell> m_cells;
+	};
+}}
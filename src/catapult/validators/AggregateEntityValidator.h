@@ -75,8 +75,8 @@ namespace catapult { namespace validators {
 			validationFunctions.reserve(m_validators.size());
 			auto forwardedArgs = std::make_tuple(std::forward<TCurryArgs>(args)...);
 			for (const auto& pValidator : m_validators) {
-				validationFunctions.emplace_back([&pValidator, forwardedArgs](const auto& entityInfo) {
-					return pValidator->validate(entityInfo, std::get<TArgs>(forwardedArgs)...);
+				validationFunctions.emplace_back([&pValidator, forwardedArgs](const auto& entityInfo, const auto& cancellationToken) {
+					return pValidator->validate(entityInfo, cancellationToken, std::get<TArgs>(forwardedArgs)...);
 				});
 			}
 
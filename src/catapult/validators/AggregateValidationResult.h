@@ -29,4 +29,30 @@ namespace catapult { namespace validators {
 
 	/// Aggregates \a result into \a aggregate.
 	void AggregateValidationResult(ValidationResult& aggregate, ValidationResult value);
+
+	/// Aggregates the results of calling \a validate with all \a validators, ignoring failures for which \a isSuppressedFailure
+	/// returns \c true.
+	/// \note Validation stops at the first failure that is not suppressed.
+	template<typename TValidators, typename TIsSuppressedFailure, typename TValidate>
+	ValidationResult AggregateValidationResults(
+			const TValidators& validators,
+			const TIsSuppressedFailure& isSuppressedFailure,
+			TValidate validate) {
+		auto aggregateResult = ValidationResult::Success;
+		for (const auto& pValidator : validators) {
+			auto result = validate(*pValidator);
+
+			// ignore suppressed failures
+			if (isSuppressedFailure(result))
+				continue;
+
+			// exit on other failures
+			if (IsValidationResultFailure(result))
+				return result;
+
+			AggregateValidationResult(aggregateResult, result);
+		}
+
+		return aggregateResult;
+	}
 }}
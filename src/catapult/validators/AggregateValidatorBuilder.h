@@ -67,22 +67,9 @@ namespace catapult { namespace validators {
 			}
 
 			ValidationResult validate(const TNotification& notification, TArgs&&... args) const override {
-				auto aggregateResult = ValidationResult::Success;
-				for (const auto& pValidator : m_validators) {
-					auto result = pValidator->validate(notification, std::forward<TArgs>(args)...);
-
-					// ignore suppressed failures
-					if (m_isSuppressedFailure(result))
-						continue;
-
-					// exit on other failures
-					if (IsValidationResultFailure(result))
-						return result;
-
-					AggregateValidationResult(aggregateResult, result);
-				}
-
-				return aggregateResult;
+				return AggregateValidationResults(m_validators, m_isSuppressedFailure, [&notification, &args...](const auto& validator) {
+					return validator.validate(notification, std::forward<TArgs>(args)...);
+				});
 			}
 
 		private:
@@ -0,0 +1,47 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <atomic>
+
+namespace catapult { namespace validators {
+
+	/// Token that can be polled by long running validations in order to stop early.
+	/// \note The owner of the cancellation flag must keep it alive for the lifetime of the token.
+	class CancellationToken {
+	public:
+		/// Creates a token that is never cancelled.
+		CancellationToken() : m_pIsCancelled(nullptr)
+		{}
+
+		/// Creates a token that is cancelled when \a isCancelled is set.
+		explicit CancellationToken(const std::atomic<bool>& isCancelled) : m_pIsCancelled(&isCancelled)
+		{}
+
+	public:
+		/// Returns \c true if cancellation has been requested and validation can be stopped.
+		bool isCancelled() const {
+			return m_pIsCancelled && m_pIsCancelled->load(std::memory_order_relaxed);
+		}
+
+	private:
+		const std::atomic<bool>* m_pIsCancelled;
+	};
+}}
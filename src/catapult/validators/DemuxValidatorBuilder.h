@@ -19,20 +19,26 @@
 **/
 
 #pragma once
-#include "AggregateValidatorBuilder.h"
+#include "AggregateNotificationValidator.h"
+#include "AggregateValidationResult.h"
 #include "ValidatorTypes.h"
-#include <functional>
+#include "catapult/model/NotificationDispatchTable.h"
+#include "catapult/utils/NamedObject.h"
 #include <vector>
 
 namespace catapult { namespace validators {
 
 	/// A demultiplexing validator builder.
+	/// \note Validators are grouped by notification type when they are added so that each notification is only forwarded
+	///        to the validators that are registered for its type.
 	template<typename... TArgs>
 	class DemuxValidatorBuilderT {
 	private:
 		template<typename TNotification>
 		using NotificationValidatorPointerT = std::unique_ptr<const NotificationValidatorT<TNotification, TArgs...>>;
-		using NotificationValidatorPredicate = predicate<const model::Notification&>;
+		using NotificationValidator = NotificationValidatorT<model::Notification, TArgs...>;
+		using NotificationValidatorPointerVector = std::vector<NotificationValidatorPointerT<model::Notification>>;
+		using NotificationValidatorDispatchTable = model::NotificationDispatchTable<NotificationValidator>;
 		using AggregateValidatorPointer = std::unique_ptr<const AggregateNotificationValidatorT<model::Notification, TArgs...>>;
 
 	public:
@@ -41,33 +47,31 @@ namespace catapult { namespace validators {
 				typename TNotification,
 				typename X = typename std::enable_if<!std::is_same<model::Notification, TNotification>::value>::type>
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<TNotification>&& pValidator) {
-			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-				return model::AreEqualExcludingChannel(type, notification.Type);
-			};
-			m_builder.add(std::make_unique<ConditionalValidator<TNotification>>(std::move(pValidator), predicate));
+			m_validators.push_back(std::make_unique<TypedValidator<TNotification>>(std::move(pValidator)));
+			m_dispatchTable.add(TNotification::Notification_Type, *m_validators.back());
 			return *this;
 		}
 
 		/// Adds a validator (\a pValidator) to the builder that is always invoked.
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<model::Notification>&& pValidator) {
-			m_builder.add(std::move(pValidator));
+			m_validators.push_back(std::move(pValidator));
+			m_dispatchTable.add(*m_validators.back());
 			return *this;
 		}
 
 		/// Builds a demultiplexing validator that ignores suppressed failures according to \a isSuppressedFailure.
 		AggregateValidatorPointer build(const ValidationResultPredicate& isSuppressedFailure) {
-			return m_builder.build(isSuppressedFailure);
+			return std::make_unique<DemuxAggregateNotificationValidator>(
+					std::move(m_validators),
+					std::move(m_dispatchTable),
+					isSuppressedFailure);
 		}
 
 	private:
 		template<typename TNotification>
-		class ConditionalValidator : public NotificationValidatorT<model::Notification, TArgs...> {
+		class TypedValidator : public NotificationValidator {
 		public:
-			ConditionalValidator(
-					NotificationValidatorPointerT<TNotification>&& pValidator,
-					const NotificationValidatorPredicate& predicate)
-					: m_pValidator(std::move(pValidator))
-					, m_predicate(predicate)
+			explicit TypedValidator(NotificationValidatorPointerT<TNotification>&& pValidator) : m_pValidator(std::move(pValidator))
 			{}
 
 		public:
@@ -76,18 +80,51 @@ namespace catapult { namespace validators {
 			}
 
 			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
-				if (!m_predicate(notification))
-					return ValidationResult::Success;
-
+				// notification type has already been checked by dispatch table
 				return m_pValidator->validate(static_cast<const TNotification&>(notification), std::forward<TArgs>(args)...);
 			}
 
 		private:
 			NotificationValidatorPointerT<TNotification> m_pValidator;
-			NotificationValidatorPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationValidator : public AggregateNotificationValidatorT<model::Notification, TArgs...> {
+		public:
+			DemuxAggregateNotificationValidator(
+					NotificationValidatorPointerVector&& validators,
+					NotificationValidatorDispatchTable&& dispatchTable,
+					const ValidationResultPredicate& isSuppressedFailure)
+					: m_validators(std::move(validators))
+					, m_dispatchTable(std::move(dispatchTable))
+					, m_isSuppressedFailure(isSuppressedFailure)
+					, m_name(utils::ReduceNames(utils::ExtractNames(m_validators)))
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return utils::ExtractNames(m_validators);
+			}
+
+			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
+				const auto& validators = m_dispatchTable.handlers(notification.Type);
+				return AggregateValidationResults(validators, m_isSuppressedFailure, [&notification, &args...](const auto& validator) {
+					return validator.validate(notification, std::forward<TArgs>(args)...);
+				});
+			}
+
+		private:
+			NotificationValidatorPointerVector m_validators;
+			NotificationValidatorDispatchTable m_dispatchTable;
+			ValidationResultPredicate m_isSuppressedFailure;
+			std::string m_name;
 		};
 
 	private:
-		AggregateValidatorBuilder<model::Notification, TArgs...> m_builder;
+		NotificationValidatorPointerVector m_validators;
+		NotificationValidatorDispatchTable m_dispatchTable;
 	};
 }}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "CancellationToken.h"
 #include "ValidationResult.h"
 #include "catapult/model/WeakEntityInfo.h"
 #include <string>
@@ -37,6 +38,10 @@ namespace catapult { namespace validators {
 		virtual const std::string& name() const = 0;
 
 		/// Validates a single \a entityInfo with contextual information \a args.
-		virtual ValidationResult validate(const model::WeakEntityInfo& entityInfo, TArgs&&... args) const = 0;
+		/// \note Long running validations can poll \a cancellationToken and stop early when it is cancelled.
+		virtual ValidationResult validate(
+				const model::WeakEntityInfo& entityInfo,
+				const CancellationToken& cancellationToken,
+				TArgs&&... args) const = 0;
 	};
 }}
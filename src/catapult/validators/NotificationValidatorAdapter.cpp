@@ -35,8 +35,10 @@ namespace catapult { namespace validators {
 		return m_pValidator->name();
 	}
 
-	ValidationResult NotificationValidatorAdapter::validate(const model::WeakEntityInfo& entityInfo) const {
-		ValidatingNotificationSubscriber sub(*m_pValidator);
+	ValidationResult NotificationValidatorAdapter::validate(
+			const model::WeakEntityInfo& entityInfo,
+			const CancellationToken& cancellationToken) const {
+		ValidatingNotificationSubscriber sub(*m_pValidator, cancellationToken);
 		m_pPublisher->publish(entityInfo, sub);
 		return sub.result();
 	}
@@ -40,7 +40,7 @@ namespace catapult { namespace validators {
 	public:
 		const std::string& name() const override;
 
-		ValidationResult validate(const model::WeakEntityInfo& entityInfo) const override;
+		ValidationResult validate(const model::WeakEntityInfo& entityInfo, const CancellationToken& cancellationToken) const override;
 
 	private:
 		NotificationValidatorPointer m_pValidator;
@@ -39,7 +39,9 @@ namespace catapult { namespace validators {
 			static constexpr bool IsEntityShortCircuitAllowed = true;
 
 		public:
-			explicit ShortCircuitTraits(size_t) : m_aggregateResult(ValidationResult::Success)
+			explicit ShortCircuitTraits(size_t)
+					: m_aggregateResult(ValidationResult::Success)
+					, m_isCancelled(false)
 			{}
 
 		public:
@@ -47,8 +49,12 @@ namespace catapult { namespace validators {
 				if (IsValidationResultFailure(m_aggregateResult))
 					return false;
 
-				auto result = validationFunction(entityInfo);
+				// after the first failure, validations running on other threads are cancelled because their results are irrelevant
+				auto result = validationFunction(entityInfo, CancellationToken(m_isCancelled));
 				AggregateValidationResult(m_aggregateResult, result);
+				if (IsValidationResultFailure(result))
+					m_isCancelled = true;
+
 				return true;
 			}
 
@@ -58,6 +64,7 @@ namespace catapult { namespace validators {
 
 		private:
 			std::atomic<ValidationResult> m_aggregateResult;
+			std::atomic<bool> m_isCancelled;
 		};
 
 		// endregion
@@ -76,7 +83,7 @@ namespace catapult { namespace validators {
 
 		public:
 			bool validateEntity(const model::WeakEntityInfo& entityInfo, const ValidationFunction& validationFunction, size_t index) {
-				auto result = validationFunction(entityInfo);
+				auto result = validationFunction(entityInfo, CancellationToken());
 				AggregateValidationResult(m_results[index], result);
 				return !IsValidationResultFailure(m_results[index]);
 			}
@@ -91,6 +98,13 @@ namespace catapult { namespace validators {
 
 		// endregion
 
+		void LogStatistics(const thread::ParallelForStatistics& statistics) {
+			CATAPULT_LOG(trace)
+					<< "validated " << statistics.NumItems << " entities using " << statistics.NumPartitions << " partitions"
+					<< " (partition items min " << statistics.MinPartitionItems << ", max " << statistics.MaxPartitionItems
+					<< ", steals " << statistics.NumSteals << ", stolen items " << statistics.NumStolenItems << ")";
+		}
+
 		template<typename TTraits>
 		class ValidationWork {
 		public:
@@ -157,12 +171,13 @@ namespace catapult { namespace validators {
 			auto validateT(const model::WeakEntityInfos& entityInfos, const ValidationFunctions& validationFunctions) const {
 				auto pWork = std::make_shared<ValidationWork<TTraits>>(shared_from_this(), validationFunctions, entityInfos);
 				return thread::compose(
-						thread::ParallelFor(m_service, pWork->entityInfos(), m_pPool->numWorkerThreads(), [pWork](
+						thread::ParallelForWithStatistics(m_service, pWork->entityInfos(), m_pPool->numWorkerThreads(), [pWork](
 								const auto& entityInfo,
 								auto index) {
 							return pWork->validateEntity(entityInfo, index);
 						}),
-						[pWork](const auto&) {
+						[pWork](auto&& statisticsFuture) {
+							LogStatistics(statisticsFuture.get());
 							pWork->complete();
 							return pWork->future();
 						});
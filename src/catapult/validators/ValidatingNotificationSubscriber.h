@@ -20,6 +20,7 @@
 
 #pragma once
 #include "AggregateValidationResult.h"
+#include "CancellationToken.h"
 #include "ValidatorTypes.h"
 #include "catapult/model/NotificationSubscriber.h"
 
@@ -30,7 +31,15 @@ namespace catapult { namespace validators {
 	public:
 		/// Creates a validating notification subscriber around \a validator.
 		explicit ValidatingNotificationSubscriber(const stateless::NotificationValidator& validator)
+				: ValidatingNotificationSubscriber(validator, CancellationToken())
+		{}
+
+		/// Creates a validating notification subscriber around \a validator that stops validating notifications
+		/// when \a cancellationToken is cancelled.
+		/// \note The result of a cancelled validation is incomplete and should be ignored.
+		ValidatingNotificationSubscriber(const stateless::NotificationValidator& validator, const CancellationToken& cancellationToken)
 				: m_validator(validator)
+				, m_cancellationToken(cancellationToken)
 				, m_result(ValidationResult::Success)
 		{}
 
@@ -45,7 +54,7 @@ namespace catapult { namespace validators {
 			if (!IsSet(notification.Type, model::NotificationChannel::Validator))
 				return;
 
-			if (IsValidationResultFailure(m_result))
+			if (IsValidationResultFailure(m_result) || m_cancellationToken.isCancelled())
 				return;
 
 			auto result = m_validator.validate(notification);
@@ -54,6 +63,7 @@ namespace catapult { namespace validators {
 
 	private:
 		const stateless::NotificationValidator& m_validator;
+		CancellationToken m_cancellationToken;
 		ValidationResult m_result;
 	};
 }}
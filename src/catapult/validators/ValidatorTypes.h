@@ -46,7 +46,7 @@ namespace catapult { namespace validators {
 	using ValidatorVectorT = std::vector<std::unique_ptr<const EntityValidatorT<TArgs...>>>;
 
 	/// A validation function.
-	using ValidationFunction = std::function<ValidationResult (const model::WeakEntityInfo&)>;
+	using ValidationFunction = std::function<ValidationResult (const model::WeakEntityInfo&, const CancellationToken&)>;
 
 	/// A vector of validation functions.
 	using ValidationFunctions = std::vector<ValidationFunction>;
@@ -66,6 +66,12 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct BlockHeadersFromTraits {
+			static auto Invoke(ChainApi& api, Height height) {
+				return api.blockHeadersFrom(height, 5);
+			}
+		};
+
 		template<typename TTraits>
 		void AssertApiErrorForHeight(uint32_t numBlocks, Height requestHeight) {
 			// Arrange:
@@ -81,6 +87,7 @@ namespace catapult { namespace api {
 #define CHAIN_API_HEIGHT_ERROR_TRAITS_BASED_TEST(TEST_NAME) \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, TEST_NAME##_HashesFrom) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<HashesFromTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_BlockHeadersFrom) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockHeadersFromTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	CHAIN_API_HEIGHT_ERROR_TRAITS_BASED_TEST(RequestAtHeightZeroFails) {
@@ -144,4 +151,101 @@ namespace catapult { namespace api {
 	}
 
 	// endregion
+
+	// region hashesAt
+
+	namespace {
+		void AssertCanRetrieveHashesAt(
+				uint32_t maxHashes,
+				const std::vector<Height>& requestHeights,
+				const std::vector<Height>& expectedHeights) {
+			// Arrange:
+			auto pStorage = mocks::CreateMemoryBasedStorageCache(12);
+			auto pApi = CreateLocalChainApi(*pStorage, maxHashes);
+			auto heights = model::HeightRange::CopyFixed(reinterpret_cast<const uint8_t*>(requestHeights.data()), requestHeights.size());
+
+			// Act:
+			auto hashes = pApi->hashesAt(std::move(heights)).get();
+
+			// Assert:
+			ASSERT_EQ(expectedHeights.size(), hashes.size());
+
+			auto i = 0u;
+			auto storageView = pStorage->view();
+			for (const auto& hash : hashes) {
+				auto pBlock = storageView.loadBlock(expectedHeights[i]);
+				auto expectedHash = CalculateHash(*pBlock);
+
+				EXPECT_EQ(expectedHash, hash) << "comparing hashes at " << i;
+				++i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanRetrieveHashesAtAllRequestHeights) {
+		// Assert:
+		AssertCanRetrieveHashesAt(10, { Height(1), Height(4), Height(9), Height(12) }, { Height(1), Height(4), Height(9), Height(12) });
+	}
+
+	TEST(TEST_CLASS, CanRetrieveAtMostMaxHashesAtRequestHeights) {
+		// Assert:
+		AssertCanRetrieveHashesAt(3, { Height(1), Height(4), Height(9), Height(12) }, { Height(1), Height(4), Height(9) });
+	}
+
+	TEST(TEST_CLASS, RetrievedHashesAtRequestHeightsAreBoundedByFirstInvalidHeight) {
+		// Assert:
+		AssertCanRetrieveHashesAt(10, { Height(4), Height(9), Height(13) }, { Height(4), Height(9) });
+		AssertCanRetrieveHashesAt(10, { Height(4), Height(9), Height(9) }, { Height(4), Height(9) });
+		AssertCanRetrieveHashesAt(10, { Height(0), Height(9) }, {});
+	}
+
+	// endregion
+
+	// region blockHeadersFrom
+
+	namespace {
+		void AssertCanRetrieveBlockHeaders(
+				uint32_t numBlocks,
+				uint32_t maxBlockHeaders,
+				Height requestHeight,
+				const std::vector<Height>& expectedHeights) {
+			// Arrange:
+			auto pStorage = mocks::CreateMemoryBasedStorageCache(numBlocks);
+			auto pApi = CreateLocalChainApi(*pStorage, 100);
+
+			// Act:
+			auto headers = pApi->blockHeadersFrom(requestHeight, maxBlockHeaders).get();
+
+			// Assert:
+			ASSERT_EQ(expectedHeights.size(), headers.size());
+
+			auto i = 0u;
+			auto storageView = pStorage->view();
+			for (const auto& header : headers) {
+				auto pBlock = storageView.loadBlock(expectedHeights[i]);
+
+				EXPECT_EQ(expectedHeights[i], header.Height) << "comparing headers at " << i << " from " << requestHeight;
+				EXPECT_TRUE(0 == std::memcmp(pBlock.get(), &header, sizeof(model::BlockHeader)))
+						<< "comparing headers at " << i << " from " << requestHeight;
+				++i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanRetrieveAtMostMaxBlockHeaders) {
+		// Assert:
+		AssertCanRetrieveBlockHeaders(12, 5, Height(3), { Height(3), Height(4), Height(5), Height(6), Height(7) });
+	}
+
+	TEST(TEST_CLASS, RetrievedBlockHeadersAreBoundedByLastBlock) {
+		// Assert:
+		AssertCanRetrieveBlockHeaders(12, 10, Height(10), { Height(10), Height(11), Height(12) });
+	}
+
+	TEST(TEST_CLASS, CanRetrieveLastBlockHeader) {
+		// Assert:
+		AssertCanRetrieveBlockHeaders(12, 5, Height(12), { Height(12) });
+	}
+
+	// endregion
 }}
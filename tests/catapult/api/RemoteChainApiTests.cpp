@@ -19,7 +19,7 @@
 **/
 
 #include "catapult/api/RemoteChainApi.h"
-#include "catapult/api/ChainPackets.h"
+#include "catapult/ionet/ChainPackets.h"
 #include "catapult/model/TransactionPlugin.h"
 #include "tests/test/other/RemoteApiFactory.h"
 #include "tests/test/other/RemoteApiTestUtils.h"
@@ -50,7 +50,7 @@ namespace catapult { namespace api {
 			}
 
 			static auto CreateValidResponsePacket() {
-				auto pResponsePacket = ionet::CreateSharedPacket<ChainInfoResponse>();
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::ChainInfoResponse>();
 				pResponsePacket->Height = Height(625);
 				pResponsePacket->ScoreHigh = 0x1234567812345678;
 				pResponsePacket->ScoreLow = 0xABCDABCDABCDABCD;
@@ -65,7 +65,7 @@ namespace catapult { namespace api {
 			}
 
 			static void ValidateRequest(const ionet::Packet& packet) {
-				EXPECT_TRUE(ionet::IsPacketValid(packet, ChainInfoResponse::Packet_Type));
+				EXPECT_TRUE(ionet::IsPacketValid(packet, ionet::ChainInfoResponse::Packet_Type));
 			}
 
 			static void ValidateResponse(const ionet::Packet&, const ChainInfo& info) {
@@ -97,7 +97,7 @@ namespace catapult { namespace api {
 			}
 
 			static void ValidateRequest(const ionet::Packet& packet) {
-				const auto* pRequest = ionet::CoercePacket<BlockHashesRequest>(&packet);
+				const auto* pRequest = ionet::CoercePacket<ionet::BlockHashesRequest>(&packet);
 				ASSERT_TRUE(!!pRequest);
 				EXPECT_EQ(RequestHeight(), pRequest->Height);
 			}
@@ -116,6 +116,79 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct HashesAtTraits {
+			static std::vector<Height> RequestHeights() { return { Height(521), Height(600), Height(617) }; }
+
+			static auto Invoke(const ChainApi& api) {
+				auto heights = RequestHeights();
+				auto heightsRange = model::HeightRange::CopyFixed(reinterpret_cast<const uint8_t*>(heights.data()), heights.size());
+				return api.hashesAt(std::move(heightsRange));
+			}
+
+			static auto CreateValidResponsePacket(uint32_t payloadSize = 3u * sizeof(Hash256)) {
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Block_Hashes_At;
+				test::FillWithRandomData({ pResponsePacket->Data(), payloadSize });
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial hash
+				return CreateValidResponsePacket(3 * sizeof(Hash256) / 2);
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				auto expectedHeights = RequestHeights();
+				auto expectedPayloadSize = static_cast<uint32_t>(expectedHeights.size() * sizeof(Height));
+				ASSERT_EQ(sizeof(ionet::PacketHeader) + expectedPayloadSize, packet.Size);
+				EXPECT_EQ(ionet::PacketType::Block_Hashes_At, packet.Type);
+				EXPECT_TRUE(0 == std::memcmp(expectedHeights.data(), packet.Data(), expectedPayloadSize));
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const model::HashRange& hashes) {
+				HashesFromTraits::ValidateResponse(response, hashes);
+			}
+		};
+
+		struct BlockHeadersFromTraits {
+			static constexpr Height RequestHeight() { return Height(617); }
+
+			static auto Invoke(const ChainApi& api) {
+				return api.blockHeadersFrom(RequestHeight(), 200);
+			}
+
+			static auto CreateValidResponsePacket(uint32_t payloadSize = 3u * sizeof(model::BlockHeader)) {
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Pull_Block_Headers;
+				test::FillWithRandomData({ pResponsePacket->Data(), payloadSize });
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial block header
+				return CreateValidResponsePacket(3 * sizeof(model::BlockHeader) / 2);
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				const auto* pRequest = ionet::CoercePacket<ionet::PullBlockHeadersRequest>(&packet);
+				ASSERT_TRUE(!!pRequest);
+				EXPECT_EQ(RequestHeight(), pRequest->Height);
+				EXPECT_EQ(200u, pRequest->NumBlockHeaders);
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const model::BlockHeaderRange& headers) {
+				ASSERT_EQ(3u, headers.size());
+
+				auto iter = headers.cbegin();
+				for (auto i = 0u; i < headers.size(); ++i) {
+					auto pExpectedHeader = response.Data() + i * sizeof(model::BlockHeader);
+					EXPECT_TRUE(0 == std::memcmp(pExpectedHeader, &*iter, sizeof(model::BlockHeader)))
+							<< "comparing block headers at " << i;
+					++iter;
+				}
+			}
+		};
+
 		struct BlockLastInvoker {
 			static constexpr Height RequestHeight() { return Height(0); }
 
@@ -146,7 +219,7 @@ namespace catapult { namespace api {
 			}
 
 			static void ValidateRequest(const ionet::Packet& packet) {
-				const auto* pRequest = ionet::CoercePacket<PullBlockRequest>(&packet);
+				const auto* pRequest = ionet::CoercePacket<ionet::PullBlockRequest>(&packet);
 				ASSERT_TRUE(!!pRequest);
 				EXPECT_EQ(TInvoker::RequestHeight(), pRequest->Height);
 			}
@@ -183,7 +256,7 @@ namespace catapult { namespace api {
 			}
 
 			static void ValidateRequest(const ionet::Packet& packet) {
-				const auto* pRequest = ionet::CoercePacket<PullBlocksRequest>(&packet);
+				const auto* pRequest = ionet::CoercePacket<ionet::PullBlocksRequest>(&packet);
 				ASSERT_TRUE(!!pRequest);
 				EXPECT_EQ(RequestHeight(), pRequest->Height);
 				EXPECT_EQ(200u, pRequest->NumBlocks);
@@ -223,9 +296,13 @@ namespace catapult { namespace api {
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApiBlockless, ChainInfo)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApiBlockless, HashesFrom)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteChainApiBlockless, HashesAt)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteChainApiBlockless, BlockHeadersFrom)
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApi, ChainInfo)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApi, HashesFrom)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteChainApi, HashesAt)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteChainApi, BlockHeadersFrom)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApi, BlockLast)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteChainApi, BlockAt)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteChainApi, BlocksFrom)
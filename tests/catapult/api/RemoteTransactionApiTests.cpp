@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/ionet/TransactionPackets.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/other/RemoteApiFactory.h"
 #include "tests/test/other/RemoteApiTestUtils.h"
@@ -100,6 +101,78 @@ namespace catapult { namespace api {
 			}
 		};
 
+		constexpr auto Response_Header_Size = sizeof(ionet::PullTransactionsReconciliationResponseHeader);
+
+		struct UtReconciliationTraits {
+			static constexpr uint32_t Num_Cells = 6;
+			static constexpr uint32_t Request_Data_Size = Num_Cells * sizeof(utils::ShortHashIbltCell);
+
+			static std::vector<utils::ShortHashIbltCell> KnownCells() {
+				std::vector<utils::ShortHashIbltCell> cells(Num_Cells);
+				for (auto i = 0u; i < Num_Cells; ++i) {
+					cells[i].Count = static_cast<int32_t>(i);
+					cells[i].KeySum = utils::ShortHash(100 + i);
+					cells[i].CheckSum = 200 + i;
+				}
+
+				return cells;
+			}
+
+			static model::ShortHashIbltCellRange KnownShortHashesIbltCells() {
+				return model::ShortHashIbltCellRange::CopyFixed(reinterpret_cast<const uint8_t*>(KnownCells().data()), Num_Cells);
+			}
+
+			static auto Invoke(const RemoteTransactionApi& api) {
+				return api.reconcileUnconfirmedTransactions(KnownShortHashesIbltCells());
+			}
+
+			static auto CreateResponsePacket(uint8_t isDecoded, uint16_t numTransactions) {
+				// prepend a response header to a transactions packet
+				auto pTransactionsPacket = CreatePacketWithTransactions(numTransactions);
+				auto transactionsSize = pTransactionsPacket->Size - sizeof(ionet::PacketHeader);
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(Response_Header_Size + transactionsSize);
+				pResponsePacket->Type = ionet::PacketType::Pull_Transactions_Reconciliation;
+				pResponsePacket->Data()[0] = isDecoded;
+				std::memcpy(pResponsePacket->Data() + Response_Header_Size, pTransactionsPacket->Data(), transactionsSize);
+				return pResponsePacket;
+			}
+
+			static auto CreateValidResponsePacket() {
+				return CreateResponsePacket(1, 3);
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Pull_Transactions_Reconciliation, packet.Type);
+				EXPECT_EQ(sizeof(ionet::Packet) + Request_Data_Size, packet.Size);
+				EXPECT_TRUE(0 == std::memcmp(packet.Data(), KnownCells().data(), Request_Data_Size));
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const UnconfirmedTransactionsReconciliationResult& result) {
+				EXPECT_TRUE(result.IsDecoded);
+				ASSERT_EQ(3u, result.Transactions.size());
+
+				auto pExpectedData = response.Data() + Response_Header_Size;
+				auto parsedIter = result.Transactions.cbegin();
+				for (auto i = 0u; i < result.Transactions.size(); ++i) {
+					std::string message = "comparing transactions at " + std::to_string(i);
+					const auto& expectedTransaction = reinterpret_cast<const TransactionType&>(*pExpectedData);
+					const auto& actualTransaction = *parsedIter;
+					ASSERT_EQ(expectedTransaction.Size, actualTransaction.Size) << message;
+					EXPECT_EQ(Timestamp(5 * i), actualTransaction.Deadline) << message;
+					EXPECT_EQ(expectedTransaction, actualTransaction) << message;
+					++parsedIter;
+					pExpectedData += expectedTransaction.Size;
+				}
+			}
+		};
+
 		struct RemoteTransactionApiTraits {
 			static auto Create(const std::shared_ptr<ionet::PacketIo>& pPacketIo) {
 				return test::CreateLifetimeExtendedApi(CreateRemoteTransactionApi, *pPacketIo, mocks::CreateDefaultTransactionRegistry());
@@ -108,4 +181,54 @@ namespace catapult { namespace api {
 	}
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, Ut)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteTransactionApi, UtReconciliation)
+
+	namespace {
+		template<typename TAction>
+		void RunReconciliationResponseTest(const std::shared_ptr<ionet::Packet>& pResponsePacket, TAction action) {
+			// Arrange:
+			auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+			pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+			pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pResponsePacket](const auto*) { return pResponsePacket; });
+			auto pApi = RemoteTransactionApiTraits::Create(pPacketIo);
+
+			// Act:
+			auto resultFuture = UtReconciliationTraits::Invoke(*pApi);
+
+			// Assert:
+			action(resultFuture);
+			EXPECT_EQ(1u, pPacketIo->numWrites());
+			EXPECT_EQ(1u, pPacketIo->numReads());
+		}
+	}
+
+	TEST(RemoteTransactionApiTests, ReconcileUnconfirmedTransactionsAcceptsDecodedResponseWithoutTransactions) {
+		// Arrange:
+		RunReconciliationResponseTest(UtReconciliationTraits::CreateResponsePacket(1, 0), [](auto& resultFuture) {
+			auto result = resultFuture.get();
+
+			// Assert:
+			EXPECT_TRUE(result.IsDecoded);
+			EXPECT_TRUE(result.Transactions.empty());
+		});
+	}
+
+	TEST(RemoteTransactionApiTests, ReconcileUnconfirmedTransactionsAcceptsUndecodedResponseWithoutTransactions) {
+		// Arrange:
+		RunReconciliationResponseTest(UtReconciliationTraits::CreateResponsePacket(0, 0), [](auto& resultFuture) {
+			auto result = resultFuture.get();
+
+			// Assert:
+			EXPECT_FALSE(result.IsDecoded);
+			EXPECT_TRUE(result.Transactions.empty());
+		});
+	}
+
+	TEST(RemoteTransactionApiTests, ReconcileUnconfirmedTransactionsRejectsUndecodedResponseWithTransactions) {
+		// Arrange:
+		RunReconciliationResponseTest(UtReconciliationTraits::CreateResponsePacket(0, 3), [](auto& resultFuture) {
+			// Assert:
+			EXPECT_THROW(resultFuture.get(), catapult_api_error);
+		});
+	}
 }}
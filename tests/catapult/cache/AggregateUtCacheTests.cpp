@@ -51,6 +51,10 @@ namespace catapult { namespace cache {
 			std::vector<model::TransactionInfo> removeAll() override {
 				CATAPULT_THROW_RUNTIME_ERROR("removeAll - not supported in mock");
 			}
+
+			std::vector<model::TransactionInfo> prune(const predicate<const model::TransactionInfo&>&) override {
+				CATAPULT_THROW_RUNTIME_ERROR("prune - not supported in mock");
+			}
 		};
 
 		template<typename TUtCacheModifier>
@@ -240,4 +244,82 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region prune
+
+	namespace {
+		class MockPruneUtCacheModifier : public UnsupportedUtCacheModifier {
+		public:
+			explicit MockPruneUtCacheModifier(size_t& numPruneCalls, std::vector<model::TransactionInfo>&& transactionInfos)
+					: m_numPruneCalls(numPruneCalls)
+					, m_transactionInfos(std::move(transactionInfos)) {
+				m_numPruneCalls = 0;
+			}
+
+		public:
+			std::vector<model::TransactionInfo> prune(const predicate<const model::TransactionInfo&>& transactionInfoPredicate) override {
+				++m_numPruneCalls;
+
+				std::vector<model::TransactionInfo> prunedInfos;
+				for (const auto& transactionInfo : m_transactionInfos) {
+					if (transactionInfoPredicate(transactionInfo))
+						prunedInfos.push_back(transactionInfo.copy());
+				}
+
+				return prunedInfos;
+			}
+
+		private:
+			size_t& m_numPruneCalls;
+			std::vector<model::TransactionInfo> m_transactionInfos;
+		};
+	}
+
+	TEST(TEST_CLASS, PruneDelegatesToCacheOnlyWhenNoTransactionsArePruned) {
+		// Arrange:
+		size_t numPruneCalls;
+		TestContext<MockPruneUtCacheModifier> context(numPruneCalls, test::CreateTransactionInfos(5));
+
+		// Act:
+		auto prunedInfos = context.aggregate().modifier().prune([](const auto&) { return false; });
+
+		// Assert:
+		EXPECT_TRUE(prunedInfos.empty());
+
+		// - check ut cache modifier was called as expected
+		EXPECT_EQ(1u, numPruneCalls);
+
+		// - check subscriber
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(FlushInfo({ 0u, 0u }), context.subscriber().flushInfos()[0]);
+	}
+
+	TEST(TEST_CLASS, PruneDelegatesToCacheAndSubscriberWhenTransactionsArePruned) {
+		// Arrange:
+		size_t numPruneCalls;
+		auto utInfos = test::CreateTransactionInfos(5);
+		TestContext<MockPruneUtCacheModifier> context(numPruneCalls, test::CopyTransactionInfos(utInfos));
+
+		// Act: prune transactions with odd deadlines
+		auto prunedInfos = context.aggregate().modifier().prune([](const auto& transactionInfo) {
+			return 1 == transactionInfo.pEntity->Deadline.unwrap() % 2;
+		});
+
+		// Assert:
+		ASSERT_EQ(3u, prunedInfos.size());
+		for (auto i = 0u; i < prunedInfos.size(); ++i)
+			test::AssertEqual(utInfos[2 * i], prunedInfos[i], "info from prune " + std::to_string(i));
+
+		// - check ut cache modifier was called as expected
+		EXPECT_EQ(1u, numPruneCalls);
+
+		// - check subscriber
+		ASSERT_EQ(3u, context.subscriber().removedInfos().size());
+		test::AssertEquivalent(prunedInfos, context.subscriber().removedInfos(), "subscriber infos");
+
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(FlushInfo({ 0u, 3u }), context.subscriber().flushInfos()[0]);
+	}
+
+	// endregion
 }}
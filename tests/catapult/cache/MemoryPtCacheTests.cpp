@@ -916,6 +916,214 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region shortHashesIblt
+
+	namespace {
+		constexpr size_t Num_Iblt_Cells = 300;
+
+		std::vector<utils::ShortHash> DecodeShortHashes(const utils::ShortHashIblt& shortHashesIblt) {
+			std::vector<utils::ShortHash> positiveShortHashes;
+			std::vector<utils::ShortHash> negativeShortHashes;
+			auto isDecoded = shortHashesIblt.decode(positiveShortHashes, negativeShortHashes);
+
+			// Sanity:
+			EXPECT_TRUE(isDecoded);
+			EXPECT_TRUE(negativeShortHashes.empty());
+			return positiveShortHashes;
+		}
+	}
+
+	TEST(TEST_CLASS, ShortHashesIbltContainsShortHashesOfAllTransactionsAndCosignatures) {
+		// Arrange:
+		MemoryPtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(2);
+		AddAll(cache, transactionInfos);
+		AddAll(cache, transactionInfos[0], test::GenerateRandomDataVector<model::Cosignature>(3));
+
+		// Act:
+		auto shortHashes = DecodeShortHashes(cache.view().shortHashesIblt(Num_Iblt_Cells));
+
+		// Assert: one short hash per transaction and per cosignature
+		utils::ShortHashesSet shortHashesSet(shortHashes.cbegin(), shortHashes.cend());
+		EXPECT_EQ(5u, shortHashesSet.size());
+		for (const auto& transactionInfo : transactionInfos)
+			EXPECT_EQ(1u, shortHashesSet.count(utils::ToShortHash(transactionInfo.EntityHash)));
+	}
+
+	TEST(TEST_CLASS, ShortHashesIbltContainsDistinctShortHashesForCosignaturesBySameSignerOfDifferentTransactions) {
+		// Arrange: add the same cosignature to two transactions
+		MemoryPtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(2);
+		auto cosignatures = test::GenerateRandomDataVector<model::Cosignature>(1);
+		AddAll(cache, transactionInfos);
+		AddAll(cache, transactionInfos[0], cosignatures);
+		AddAll(cache, transactionInfos[1], cosignatures);
+
+		// Act:
+		auto shortHashes = DecodeShortHashes(cache.view().shortHashesIblt(Num_Iblt_Cells));
+
+		// Assert:
+		utils::ShortHashesSet shortHashesSet(shortHashes.cbegin(), shortHashes.cend());
+		EXPECT_EQ(4u, shortHashesSet.size());
+	}
+
+	TEST(TEST_CLASS, ShortHashesIbltIsIndependentOfCosignaturesOrder) {
+		// Arrange: add the same cosignatures in different orders to two caches
+		MemoryPtCache cache1(Default_Options);
+		MemoryPtCache cache2(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(1);
+		auto cosignatures = test::GenerateRandomDataVector<model::Cosignature>(5);
+		AddAll(cache1, transactionInfos);
+		AddAll(cache2, transactionInfos);
+		AddAll(cache1, transactionInfos[0], cosignatures);
+		AddAll(cache2, transactionInfos[0], { cosignatures.crbegin(), cosignatures.crend() });
+
+		// Act:
+		auto shortHashesIblt1 = cache1.view().shortHashesIblt(Num_Iblt_Cells);
+		auto shortHashesIblt2 = cache2.view().shortHashesIblt(Num_Iblt_Cells);
+
+		// Assert:
+		const auto& cells1 = shortHashesIblt1.cells();
+		const auto& cells2 = shortHashesIblt2.cells();
+		ASSERT_EQ(cells1.size(), cells2.size());
+		EXPECT_TRUE(0 == std::memcmp(cells1.data(), cells2.data(), cells1.size() * sizeof(utils::ShortHashIbltCell)));
+	}
+
+	// endregion
+
+	// region tryGetUnknownTransactions
+
+	namespace {
+		bool TryGetUnknownTransactions(
+				const MemoryPtCache& cache,
+				const MemoryPtCache& remoteCache,
+				UnknownTransactionInfos& unknownInfos,
+				size_t numCells = Num_Iblt_Cells) {
+			return cache.view().tryGetUnknownTransactions(remoteCache.view().shortHashesIblt(numCells), unknownInfos);
+		}
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsReturnsNothingIfCachesAreEqual) {
+		// Arrange:
+		MemoryPtCache cache(Default_Options);
+		MemoryPtCache remoteCache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		auto cosignatures = test::GenerateRandomDataVector<model::Cosignature>(5);
+		for (auto* pCache : { &cache, &remoteCache }) {
+			AddAll(*pCache, transactionInfos);
+			AddAll(*pCache, transactionInfos[1], cosignatures);
+		}
+
+		// Act:
+		UnknownTransactionInfos unknownInfos;
+		auto isDecoded = TryGetUnknownTransactions(cache, remoteCache, unknownInfos);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		EXPECT_TRUE(unknownInfos.empty());
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsReturnsTransactionAndCosignaturesIfTransactionIsUnknown) {
+		// Arrange: remote cache is missing a transaction
+		MemoryPtCache cache(Default_Options);
+		MemoryPtCache remoteCache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(2);
+		auto unknownTransactionInfo = test::CreateRandomTransactionInfo();
+		auto cosignatures = Sort(test::GenerateRandomDataVector<model::Cosignature>(5));
+		AddAll(cache, transactionInfos);
+		AddAll(remoteCache, transactionInfos);
+		cache.modifier().add(unknownTransactionInfo);
+		AddAll(cache, unknownTransactionInfo, cosignatures);
+
+		// Act:
+		UnknownTransactionInfos unknownInfos;
+		auto isDecoded = TryGetUnknownTransactions(cache, remoteCache, unknownInfos);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		ASSERT_EQ(1u, unknownInfos.size());
+		EXPECT_EQ(unknownTransactionInfo.EntityHash, unknownInfos[0].EntityHash);
+		EXPECT_EQ(unknownTransactionInfo.pEntity, unknownInfos[0].pTransaction);
+		AssertCosignatures(cosignatures, unknownInfos[0].Cosignatures);
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsReturnsOnlyUnknownCosignaturesIfTransactionIsKnown) {
+		// Arrange: remote cache is missing three cosignatures
+		MemoryPtCache cache(Default_Options);
+		MemoryPtCache remoteCache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(1);
+		auto cosignatures = Sort(test::GenerateRandomDataVector<model::Cosignature>(5));
+		AddAll(cache, transactionInfos);
+		AddAll(cache, transactionInfos[0], cosignatures);
+		AddAll(remoteCache, transactionInfos);
+		AddAll(remoteCache, transactionInfos[0], { cosignatures[1], cosignatures[3] });
+
+		// Act:
+		UnknownTransactionInfos unknownInfos;
+		auto isDecoded = TryGetUnknownTransactions(cache, remoteCache, unknownInfos);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		ASSERT_EQ(1u, unknownInfos.size());
+		EXPECT_EQ(transactionInfos[0].EntityHash, unknownInfos[0].EntityHash);
+		EXPECT_FALSE(!!unknownInfos[0].pTransaction);
+		AssertCosignatures({ cosignatures[0], cosignatures[2], cosignatures[4] }, unknownInfos[0].Cosignatures);
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsIgnoresTransactionsAndCosignaturesOnlyKnownToRemote) {
+		// Arrange: remote cache has an additional transaction and additional cosignatures
+		MemoryPtCache cache(Default_Options);
+		MemoryPtCache remoteCache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(2);
+		auto cosignatures = test::GenerateRandomDataVector<model::Cosignature>(3);
+		cache.modifier().add(transactionInfos[0]);
+		AddAll(cache, transactionInfos[0], { cosignatures[0] });
+		AddAll(remoteCache, transactionInfos);
+		AddAll(remoteCache, transactionInfos[0], cosignatures);
+
+		// Act:
+		UnknownTransactionInfos unknownInfos;
+		auto isDecoded = TryGetUnknownTransactions(cache, remoteCache, unknownInfos);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		EXPECT_TRUE(unknownInfos.empty());
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsFailsIfDifferenceCannotBeDecoded) {
+		// Arrange: a table with a single cell per hash function cannot decode more than one short hash
+		MemoryPtCache cache(Default_Options);
+		MemoryPtCache remoteCache(Default_Options);
+		AddAll(cache, test::CreateTransactionInfos(5));
+
+		// Act:
+		UnknownTransactionInfos unknownInfos;
+		auto isDecoded = TryGetUnknownTransactions(cache, remoteCache, unknownInfos, utils::ShortHashIblt::Num_Hash_Functions);
+
+		// Assert:
+		EXPECT_FALSE(isDecoded);
+		EXPECT_TRUE(unknownInfos.empty());
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsReturnsTransactionsWithTotalSizeOfAtMostMaxResponseSize) {
+		// Arrange:
+		auto maxResponseSize = 3 * (sizeof(Hash256) + GetTransactionSize());
+		MemoryPtCache cache(MemoryCacheOptions(maxResponseSize, 1000));
+		MemoryPtCache remoteCache(Default_Options);
+		AddAll(cache, test::CreateTransactionInfos(5));
+
+		// Act:
+		UnknownTransactionInfos unknownInfos;
+		auto isDecoded = TryGetUnknownTransactions(cache, remoteCache, unknownInfos);
+
+		// Assert: notice that no ordering is guaranteed
+		EXPECT_TRUE(isDecoded);
+		EXPECT_EQ(3u, unknownInfos.size());
+		EXPECT_GE(maxResponseSize, TotalSize(unknownInfos));
+	}
+
+	// endregion
+
 	// region max size
 
 	TEST(TEST_CLASS, CacheCanContainMaxTransactions) {
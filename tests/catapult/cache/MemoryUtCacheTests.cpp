@@ -20,6 +20,7 @@
 
 #include "catapult/cache/MemoryUtCache.h"
 #include "catapult/utils/ShortHash.h"
+#include "catapult/utils/ShortHashIblt.h"
 #include "tests/catapult/cache/test/TransactionCacheTests.h"
 #include "tests/test/cache/UtTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
@@ -302,6 +303,34 @@ namespace catapult { namespace cache {
 		test::AssertDeadlines(*pCache, { 2, 4, 6, 8, 10, 1, 2, 3, 4, 5 });
 	}
 
+	TEST(TEST_CLASS, CanReuseStorageOfRemovedTransactionInfos) {
+		// Arrange: use enough transactions to require multiple internal storage blocks
+		auto pCache = PrepareCache(2500, MemoryCacheOptions(1024, 3000));
+		auto hashes = ExtractEverySecondHash(*pCache);
+		test::RemoveAll(*pCache, hashes);
+
+		// Sanity:
+		AssertCacheSize(*pCache, 1250);
+
+		// Act:
+		auto newTransactionInfos = test::CreateTransactionInfos(1750, [](auto i) { return Timestamp(10'000 + i); });
+		test::AddAll(*pCache, newTransactionInfos);
+
+		// Assert:
+		AssertCacheSize(*pCache, 3000);
+		test::AssertContainsNone(*pCache, hashes);
+		test::AssertContainsAll(*pCache, newTransactionInfos);
+
+		std::vector<Timestamp::ValueType> expectedDeadlines;
+		for (auto i = 0u; i < 1250; ++i)
+			expectedDeadlines.push_back(2 * i + 2);
+
+		for (auto i = 0u; i < 1750; ++i)
+			expectedDeadlines.push_back(10'000 + i);
+
+		test::AssertDeadlines(*pCache, expectedDeadlines);
+	}
+
 	// endregion
 
 	// region count
@@ -442,6 +471,80 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region prune
+
+	TEST(TEST_CLASS, PruneVisitsAllTransactionsInInsertionOrder) {
+		// Arrange:
+		auto pCache = PrepareCache(10);
+		test::RemoveAll(*pCache, ExtractEverySecondHash(*pCache));
+		test::AddAll(*pCache, test::CreateTransactionInfos(2));
+
+		// Act:
+		std::vector<Timestamp::ValueType> rawDeadlines;
+		auto prunedInfos = pCache->modifier().prune([&rawDeadlines](const auto& transactionInfo) {
+			rawDeadlines.push_back(transactionInfo.pEntity->Deadline.unwrap());
+			return false;
+		});
+
+		// Assert:
+		EXPECT_TRUE(prunedInfos.empty());
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 4, 6, 8, 10, 1, 2 }), rawDeadlines);
+		AssertCacheSize(*pCache, 7);
+	}
+
+	TEST(TEST_CLASS, PruneRemovesAllTransactionsMatchingPredicate) {
+		// Arrange:
+		auto pCache = PrepareCache(10);
+
+		// Act: prune all transactions with deadlines divisible by three
+		auto prunedInfos = pCache->modifier().prune([](const auto& transactionInfo) {
+			return 0 == transactionInfo.pEntity->Deadline.unwrap() % 3;
+		});
+
+		// Assert:
+		AssertCacheSize(*pCache, 7);
+		test::AssertDeadlines(*pCache, { 1, 2, 4, 5, 7, 8, 10 });
+		test::AssertContainsNone(*pCache, prunedInfos);
+		AssertDeadlines(prunedInfos, { 3, 6, 9 });
+	}
+
+	TEST(TEST_CLASS, PruneUpdatesCounters) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto initializationResult = DefaultInitializeCache(cache);
+		const auto& sameSigner = initializationResult.SameSigner;
+		auto modifier = cache.modifier();
+
+		// Act: prune all transactions signed by same signer and one other transaction
+		const auto& otherSigner = initializationResult.TransactionInfos[3].pEntity->Signer;
+		modifier.prune([&sameSigner, &otherSigner](const auto& transactionInfo) {
+			return sameSigner == transactionInfo.pEntity->Signer || otherSigner == transactionInfo.pEntity->Signer;
+		});
+
+		// Assert:
+		EXPECT_EQ(7u, modifier.size());
+		EXPECT_EQ(0u, modifier.count(sameSigner));
+		for (const auto& transactionsInfo : initializationResult.TransactionInfos)
+			EXPECT_EQ(otherSigner == transactionsInfo.pEntity->Signer ? 0u : 1u, modifier.count(transactionsInfo.pEntity->Signer));
+	}
+
+	TEST(TEST_CLASS, CanAddTransactionsAfterPruning) {
+		// Arrange:
+		auto pCache = PrepareCache(5);
+		pCache->modifier().prune([](const auto& transactionInfo) {
+			return 0 != transactionInfo.pEntity->Deadline.unwrap() % 2;
+		});
+
+		// Act:
+		test::AddAll(*pCache, test::CreateTransactionInfos(3));
+
+		// Assert: new transactions are added at the end
+		AssertCacheSize(*pCache, 5);
+		test::AssertDeadlines(*pCache, { 2, 4, 1, 2, 3 });
+	}
+
+	// endregion
+
 	// region contains
 
 	TEST(TEST_CLASS, ContainsReturnsTrueIfTransactionInfoIsContainedInCache) {
@@ -611,6 +714,212 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region tryGetUnknownTransactions
+
+	namespace {
+		// use a table that is large enough for decoding failures to be very unlikely
+		constexpr size_t Num_Iblt_Cells = 300;
+
+		utils::ShortHashIblt CreateShortHashesIblt(
+				const std::vector<model::TransactionInfo>& transactionInfos,
+				const std::vector<size_t>& indexes,
+				size_t numCells = Num_Iblt_Cells) {
+			utils::ShortHashIblt iblt(numCells);
+			for (auto index : indexes)
+				iblt.insert(utils::ToShortHash(transactionInfos[index].EntityHash));
+
+			return iblt;
+		}
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsReturnsAllTransactionsWhenNoShortHashesAreKnown) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		UnknownTransactions transactions;
+		auto isDecoded = cache.view().tryGetUnknownTransactions(CreateShortHashesIblt(transactionInfos, {}), transactions);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		AssertDeadlines(transactions, { 1, 2, 3, 4, 5 });
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsReturnsOnlyTransactionsWithUnknownShortHashes) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		// - add some short hashes that are not in the cache
+		auto knownShortHashesIblt = CreateShortHashesIblt(transactionInfos, { 0, 2, 4 });
+		for (auto i = 0u; i < 3; ++i)
+			knownShortHashesIblt.insert(test::GenerateRandomValue<utils::ShortHash>());
+
+		// Act:
+		UnknownTransactions transactions;
+		auto isDecoded = cache.view().tryGetUnknownTransactions(knownShortHashesIblt, transactions);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		AssertDeadlines(transactions, { 2, 4 });
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsReturnsNoTransactionsWhenAllShortHashesAreKnown) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		UnknownTransactions transactions;
+		auto isDecoded = cache.view().tryGetUnknownTransactions(CreateShortHashesIblt(transactionInfos, { 0, 1, 2, 3, 4 }), transactions);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		EXPECT_TRUE(transactions.empty());
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsFailsWhenShortHashesDifferenceCannotBeDecoded) {
+		// Arrange: the difference is larger than the number of cells
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(50);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		UnknownTransactions transactions;
+		auto isDecoded = cache.view().tryGetUnknownTransactions(CreateShortHashesIblt(transactionInfos, {}, 30), transactions);
+
+		// Assert:
+		EXPECT_FALSE(isDecoded);
+		EXPECT_TRUE(transactions.empty());
+	}
+
+	TEST(TEST_CLASS, TryGetUnknownTransactionsReturnsTransactionsWithTotalSizeOfAtMostMaxResponseSize) {
+		// Arrange:
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		auto transactionSize = transactionInfos[0].pEntity->Size;
+		MemoryUtCache cache(MemoryCacheOptions(3 * transactionSize, 1000));
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		UnknownTransactions transactions;
+		auto isDecoded = cache.view().tryGetUnknownTransactions(CreateShortHashesIblt(transactionInfos, { 1 }), transactions);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		AssertDeadlines(transactions, { 1, 3, 4 });
+	}
+
+	// endregion
+
+	// region transactionInfos
+
+	TEST(TEST_CLASS, TransactionInfosReturnsNoInfosWhenNoShortHashesAreRequested) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, test::CreateTransactionInfos(5));
+
+		// Act:
+		auto transactionInfos = cache.view().transactionInfos({});
+
+		// Assert:
+		EXPECT_TRUE(transactionInfos.empty());
+	}
+
+	TEST(TEST_CLASS, TransactionInfosReturnsInfosInRequestedOrder) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto originalTransactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, originalTransactionInfos);
+
+		std::vector<utils::ShortHash> shortHashes;
+		for (auto index : { 3u, 0u, 4u })
+			shortHashes.push_back(utils::ToShortHash(originalTransactionInfos[index].EntityHash));
+
+		// Act:
+		auto transactionInfos = cache.view().transactionInfos(shortHashes);
+
+		// Assert:
+		ASSERT_EQ(3u, transactionInfos.size());
+		AssertDeadlines(transactionInfos, { 4, 1, 5 });
+
+		auto i = 0u;
+		for (auto index : { 3u, 0u, 4u }) {
+			EXPECT_EQ(originalTransactionInfos[index].EntityHash, transactionInfos[i].EntityHash) << "at index " << i;
+			EXPECT_EQ(originalTransactionInfos[index].MerkleComponentHash, transactionInfos[i].MerkleComponentHash) << "at index " << i;
+			++i;
+		}
+	}
+
+	TEST(TEST_CLASS, TransactionInfosReturnsEmptyInfosForUnknownShortHashes) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto originalTransactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, originalTransactionInfos);
+
+		std::vector<utils::ShortHash> shortHashes{
+			utils::ToShortHash(originalTransactionInfos[1].EntityHash),
+			test::GenerateRandomValue<utils::ShortHash>(),
+			utils::ToShortHash(originalTransactionInfos[2].EntityHash)
+		};
+
+		// Act:
+		auto transactionInfos = cache.view().transactionInfos(shortHashes);
+
+		// Assert:
+		ASSERT_EQ(3u, transactionInfos.size());
+		EXPECT_EQ(originalTransactionInfos[1].EntityHash, transactionInfos[0].EntityHash);
+		EXPECT_FALSE(!!transactionInfos[1]);
+		EXPECT_EQ(originalTransactionInfos[2].EntityHash, transactionInfos[2].EntityHash);
+	}
+
+	TEST(TEST_CLASS, TransactionInfosReturnsEmptyInfosForRemovedTransactions) {
+		// Arrange: remove one transaction by hash and prune another one
+		MemoryUtCache cache(Default_Options);
+		auto originalTransactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, originalTransactionInfos);
+		{
+			auto modifier = cache.modifier();
+			modifier.remove(originalTransactionInfos[1].EntityHash);
+			modifier.prune([&hash = originalTransactionInfos[3].EntityHash](const auto& transactionInfo) {
+				return hash == transactionInfo.EntityHash;
+			});
+		}
+
+		std::vector<utils::ShortHash> shortHashes;
+		for (auto index : { 1u, 2u, 3u })
+			shortHashes.push_back(utils::ToShortHash(originalTransactionInfos[index].EntityHash));
+
+		// Act:
+		auto transactionInfos = cache.view().transactionInfos(shortHashes);
+
+		// Assert:
+		ASSERT_EQ(3u, transactionInfos.size());
+		EXPECT_FALSE(!!transactionInfos[0]);
+		EXPECT_EQ(originalTransactionInfos[2].EntityHash, transactionInfos[1].EntityHash);
+		EXPECT_FALSE(!!transactionInfos[2]);
+	}
+
+	TEST(TEST_CLASS, TransactionInfosReturnsEmptyInfosAfterRemoveAll) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto originalTransactionInfos = test::CreateTransactionInfos(3);
+		test::AddAll(cache, originalTransactionInfos);
+		cache.modifier().removeAll();
+
+		// Act:
+		auto transactionInfos = cache.view().transactionInfos({ utils::ToShortHash(originalTransactionInfos[1].EntityHash) });
+
+		// Assert:
+		ASSERT_EQ(1u, transactionInfos.size());
+		EXPECT_FALSE(!!transactionInfos[0]);
+	}
+
+	// endregion
+
 	// region max size
 
 	namespace {
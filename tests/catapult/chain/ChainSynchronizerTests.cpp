@@ -23,6 +23,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/model/EntityRange.h"
 #include "tests/catapult/chain/test/MockChainApi.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -58,6 +59,8 @@ namespace catapult { namespace chain {
 			config.MaxBlocksPerSyncAttempt = 4 * 100;
 			config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512).bytes32();
 			config.MaxRollbackBlocks = 360;
+			config.ShouldSyncBlockHeadersFirst = false;
+			config.ShouldSampleChainHashes = false;
 			return config;
 		}
 
@@ -93,19 +96,25 @@ namespace catapult { namespace chain {
 			std::shared_ptr<MockPacketIo> pIo;
 			std::shared_ptr<MockChainApi> pChainApi;
 			size_t BlockRangeConsumerCalls;
+			std::vector<Height> BlockRangeConsumerHeights;
+			BlockHeaderRange LocalBlockHeaders;
 			ChainSynchronizerConfiguration Config;
 			disruptor::ProcessingCompleteFunc ProcessingComplete;
 		};
 
 		enum class ConsumerMode { Normal, Full };
 
-		RemoteNodeSynchronizer<api::RemoteChainApi> CreateSynchronizer(TestContext& context, ConsumerMode mode = ConsumerMode::Normal) {
+		MultiRemoteNodeSynchronizer<api::RemoteChainApi> CreateSynchronizer(
+				TestContext& context,
+				ConsumerMode mode = ConsumerMode::Normal) {
 			auto pVerifiableBlock = test::GenerateVerifiableBlockAtHeight(Default_Height);
 			auto pLocal = std::make_shared<MockChainApi>(context.LocalScore, std::move(pVerifiableBlock), context.LocalHashes);
+			pLocal->setBlockHeaders(context.LocalBlockHeaders);
 
 			auto& blockConsumerCalls = context.BlockRangeConsumerCalls;
-			auto blockRangeConsumer = [mode, &blockConsumerCalls, &context](const auto&, const auto& processingComplete) {
+			auto blockRangeConsumer = [mode, &blockConsumerCalls, &context](const auto& range, const auto& processingComplete) {
 				++blockConsumerCalls;
+				context.BlockRangeConsumerHeights.push_back(range.cbegin()->Height);
 				context.ProcessingComplete = processingComplete;
 				return ConsumerMode::Normal == mode ? blockConsumerCalls : 0;
 			};
@@ -127,7 +136,7 @@ namespace catapult { namespace chain {
 			auto synchronizer = CreateSynchronizer(context);
 
 			// Act:
-			auto result = synchronizer(*context.pChainApi).get();
+			auto result = synchronizer({ context.pChainApi.get() }).get();
 
 			// Assert:
 			EXPECT_EQ(NodeInteractionResult::Neutral, result);
@@ -151,7 +160,7 @@ namespace catapult { namespace chain {
 		auto synchronizer = CreateSynchronizer(context);
 
 		// Act:
-		auto result = synchronizer(*context.pChainApi).get();
+		auto result = synchronizer({ context.pChainApi.get() }).get();
 
 		// Assert:
 		EXPECT_EQ(NodeInteractionResult::Failure, result);
@@ -165,7 +174,7 @@ namespace catapult { namespace chain {
 		auto synchronizer = CreateSynchronizer(context);
 
 		// Act:
-		auto result = synchronizer(*context.pChainApi).get();
+		auto result = synchronizer({ context.pChainApi.get() }).get();
 
 		// Assert:
 		EXPECT_EQ(NodeInteractionResult::Failure, result);
@@ -219,7 +228,7 @@ namespace catapult { namespace chain {
 		auto synchronizer = CreateSynchronizer(context);
 
 		// Act:
-		auto result = synchronizer(*context.pChainApi).get();
+		auto result = synchronizer({ context.pChainApi.get() }).get();
 
 		// Assert:
 		EXPECT_EQ(NodeInteractionResult::Success, result);
@@ -233,7 +242,7 @@ namespace catapult { namespace chain {
 		auto synchronizer = CreateSynchronizer(context, ConsumerMode::Full);
 
 		// Act:
-		auto result = synchronizer(*context.pChainApi).get();
+		auto result = synchronizer({ context.pChainApi.get() }).get();
 
 		// Assert: neutral because blocks could not be processed, so chain is unchanged
 		EXPECT_EQ(NodeInteractionResult::Neutral, result);
@@ -250,7 +259,7 @@ namespace catapult { namespace chain {
 		auto synchronizer = CreateSynchronizer(context);
 
 		// Act:
-		auto result = synchronizer(*context.pChainApi).get();
+		auto result = synchronizer({ context.pChainApi.get() }).get();
 
 		// Assert:
 		EXPECT_EQ(NodeInteractionResult::Success, result);
@@ -265,7 +274,7 @@ namespace catapult { namespace chain {
 		auto synchronizer = CreateSynchronizer(context);
 
 		// Act:
-		auto result = synchronizer(*context.pChainApi).get();
+		auto result = synchronizer({ context.pChainApi.get() }).get();
 
 		// Assert:
 		EXPECT_EQ(NodeInteractionResult::Neutral, result);
@@ -284,7 +293,7 @@ namespace catapult { namespace chain {
 		auto synchronizer = CreateSynchronizer(context);
 
 		// Act:
-		auto result = synchronizer(*context.pChainApi).get();
+		auto result = synchronizer({ context.pChainApi.get() }).get();
 
 		// Assert:
 		EXPECT_EQ(NodeInteractionResult::Success, result);
@@ -299,7 +308,7 @@ namespace catapult { namespace chain {
 		auto synchronizer = CreateSynchronizer(context);
 
 		// Act:
-		auto result = synchronizer(*context.pChainApi).get();
+		auto result = synchronizer({ context.pChainApi.get() }).get();
 
 		// Assert:
 		EXPECT_EQ(NodeInteractionResult::Failure, result);
@@ -314,7 +323,7 @@ namespace catapult { namespace chain {
 		auto synchronizer = CreateSynchronizer(context);
 
 		// Act:
-		auto future = synchronizer(*context.pChainApi);
+		auto future = synchronizer({ context.pChainApi.get() });
 
 		// Assert:
 		EXPECT_FALSE(future.is_ready());
@@ -325,6 +334,515 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region parallel pulls
+
+	namespace {
+		constexpr uint32_t Blocks_Per_Chunk = 9;
+
+		// remotes are tall enough to supply four full chunks by default
+		constexpr Height Remote_Chain_Height(Default_Height.unwrap() + 4 * Blocks_Per_Chunk - 1);
+
+		// generates linked blocks at heights [Default_Height, Remote_Chain_Height]
+		std::vector<std::unique_ptr<Block>> GenerateLinkedBlocks() {
+			std::vector<std::unique_ptr<Block>> blocks;
+			for (auto height = Default_Height; height <= Remote_Chain_Height; height = height + Height(1)) {
+				auto pBlock = test::GenerateVerifiableBlockAtHeight(height);
+				if (!blocks.empty())
+					pBlock->PreviousBlockHash = CalculateHash(*blocks.back());
+
+				blocks.push_back(std::move(pBlock));
+			}
+
+			return blocks;
+		}
+
+		struct ParallelTestContext {
+		public:
+			ParallelTestContext(size_t numRemotes, size_t forkDepth = 0)
+					: RemoteHashes(test::GenerateRandomHashes(10))
+					, RemoteBlocks(GenerateLinkedBlocks())
+					, Context(
+							ChainScore(10),
+							ChainScore(11),
+							test::ConcatHashes(test::GenerateRandomHashesSubset(RemoteHashes, 9), test::GenerateRandomHashes(forkDepth)),
+							RemoteHashes,
+							test::GenerateVerifiableBlockAtHeight(Remote_Chain_Height)) {
+				Context.Config.MaxRollbackBlocks = Blocks_Per_Chunk;
+				Context.pChainApi->setNumBlocksPerBlocksFromRequest({ Blocks_Per_Chunk });
+				addRemoteBlocks(*Context.pChainApi);
+				ChainApis.push_back(Context.pChainApi);
+
+				for (auto i = 1u; i < numRemotes; ++i)
+					addRemote(ChainScore(11));
+			}
+
+		public:
+			void addRemoteBlocks(MockChainApi& chainApi) const {
+				for (const auto& pBlock : RemoteBlocks)
+					chainApi.addBlock(test::CopyBlock(*pBlock));
+			}
+
+			std::shared_ptr<MockChainApi> addRemote(const ChainScore& remoteScore, Height remoteChainHeight = Remote_Chain_Height) {
+				auto pChainApi = addForkRemote(remoteScore, remoteChainHeight);
+				addRemoteBlocks(*pChainApi);
+				return pChainApi;
+			}
+
+			// adds a remote that reports the same chain info but whose blocks do not link to the blocks of the other remotes
+			std::shared_ptr<MockChainApi> addForkRemote(const ChainScore& remoteScore, Height remoteChainHeight = Remote_Chain_Height) {
+				auto pVerifiableBlock = test::GenerateVerifiableBlockAtHeight(remoteChainHeight);
+				auto pChainApi = std::make_shared<MockChainApi>(remoteScore, std::move(pVerifiableBlock), RemoteHashes);
+				pChainApi->setNumBlocksPerBlocksFromRequest({ Blocks_Per_Chunk });
+				ChainApis.push_back(pChainApi);
+				return pChainApi;
+			}
+
+			NodeInteractionResult sync() {
+				std::vector<const api::RemoteChainApi*> remoteChainApis;
+				for (const auto& pChainApi : ChainApis)
+					remoteChainApis.push_back(pChainApi.get());
+
+				auto synchronizer = CreateSynchronizer(Context);
+				return synchronizer(remoteChainApis).get();
+			}
+
+		public:
+			HashRange RemoteHashes;
+			std::vector<std::unique_ptr<Block>> RemoteBlocks;
+			TestContext Context;
+			std::vector<std::shared_ptr<MockChainApi>> ChainApis;
+		};
+
+		void AssertSingleRequest(const MockChainApi& chainApi, Height expectedHeight, uint32_t expectedNumBlocks = Blocks_Per_Chunk) {
+			ASSERT_EQ(1u, chainApi.blocksFromRequests().size());
+			const auto& params = chainApi.blocksFromRequests()[0];
+			EXPECT_EQ(expectedHeight, params.first);
+			EXPECT_EQ(expectedNumBlocks, params.second.NumBlocks);
+		}
+
+		Height ChunkHeight(uint32_t index) {
+			return Default_Height + Height(index * Blocks_Per_Chunk);
+		}
+	}
+
+	TEST(TEST_CLASS, BlocksArePulledInParallelFromRemotesReportingSameChain) {
+		// Arrange:
+		ParallelTestContext context(3);
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: each remote was asked for a different chunk
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		for (auto i = 0u; i < 3; ++i)
+			AssertSingleRequest(*context.ChainApis[i], ChunkHeight(i));
+
+		// - all chunks were forwarded in order
+		AssertSync(context.Context, 3);
+		EXPECT_EQ(std::vector<Height>({ ChunkHeight(0), ChunkHeight(1), ChunkHeight(2) }), context.Context.BlockRangeConsumerHeights);
+	}
+
+	TEST(TEST_CLASS, BlocksPulledInParallelAreForwardedInOrderWhenCompletedOutOfOrder) {
+		// Arrange: delay the first two remotes so that the last chunk completes first
+		ParallelTestContext context(3);
+		context.ChainApis[0]->setDelay(utils::TimeSpan::FromMilliseconds(30));
+		context.ChainApis[1]->setDelay(utils::TimeSpan::FromMilliseconds(15));
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSync(context.Context, 3);
+		EXPECT_EQ(std::vector<Height>({ ChunkHeight(0), ChunkHeight(1), ChunkHeight(2) }), context.Context.BlockRangeConsumerHeights);
+	}
+
+	TEST(TEST_CLASS, BlocksPulledInParallelAfterGapAreDropped) {
+		// Arrange: the second remote returns a partial chunk
+		ParallelTestContext context(4);
+		context.ChainApis[1]->setNumBlocksPerBlocksFromRequest({ Blocks_Per_Chunk - 2 });
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: all chunks were requested
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		for (auto i = 0u; i < 4; ++i)
+			AssertSingleRequest(*context.ChainApis[i], ChunkHeight(i));
+
+		// - but only the chunks before the gap were forwarded
+		AssertSync(context.Context, 2);
+		EXPECT_EQ(std::vector<Height>({ ChunkHeight(0), ChunkHeight(1) }), context.Context.BlockRangeConsumerHeights);
+	}
+
+	TEST(TEST_CLASS, BlocksPulledInParallelAreDroppedWhenFirstChunkFails) {
+		// Arrange:
+		ParallelTestContext context(3);
+		context.ChainApis[0]->setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		for (auto i = 0u; i < 3; ++i)
+			AssertSingleRequest(*context.ChainApis[i], ChunkHeight(i));
+
+		context.Context.assertNoCalls();
+	}
+
+	TEST(TEST_CLASS, BlocksPulledInParallelBeforeFailedChunkAreForwarded) {
+		// Arrange:
+		ParallelTestContext context(3);
+		context.ChainApis[1]->setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSync(context.Context, 1);
+		EXPECT_EQ(std::vector<Height>({ ChunkHeight(0) }), context.Context.BlockRangeConsumerHeights);
+	}
+
+	TEST(TEST_CLASS, BlocksPulledInParallelAreDroppedWhenNotLinkedToPreviousChunk) {
+		// Arrange: the third remote reports the same chain info but is on a different fork above the common block
+		ParallelTestContext context(2);
+		context.addForkRemote(ChainScore(11));
+		context.addRemote(ChainScore(11));
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: all chunks were requested
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		for (auto i = 0u; i < 4; ++i)
+			AssertSingleRequest(*context.ChainApis[i], ChunkHeight(i));
+
+		// - but only the chunks before the unlinked chunk were forwarded
+		AssertSync(context.Context, 2);
+		EXPECT_EQ(std::vector<Height>({ ChunkHeight(0), ChunkHeight(1) }), context.Context.BlockRangeConsumerHeights);
+	}
+
+	TEST(TEST_CLASS, RemotesNotReportingSameChainAreBypassed) {
+		// Arrange: add a remote with an equal score and a remote that fails chain comparison
+		ParallelTestContext context(2);
+		auto pEqualScoreChainApi = context.addRemote(ChainScore(10));
+		auto pFailingChainApi = context.addRemote(ChainScore(11));
+		pFailingChainApi->setError(MockChainApi::EntryPoint::Chain_Info);
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: only the remotes reporting the same chain were used
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSingleRequest(*context.ChainApis[0], ChunkHeight(0));
+		AssertSingleRequest(*context.ChainApis[1], ChunkHeight(1));
+		EXPECT_TRUE(pEqualScoreChainApi->blocksFromRequests().empty());
+		EXPECT_TRUE(pFailingChainApi->blocksFromRequests().empty());
+
+		AssertSync(context.Context, 2);
+	}
+
+	TEST(TEST_CLASS, BlocksArePulledFromFirstRemoteWhenNoOtherRemoteReportsSameChain) {
+		// Arrange:
+		ParallelTestContext context(1);
+		auto pEqualScoreChainApi = context.addRemote(ChainScore(10));
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSingleRequest(*context.ChainApis[0], Default_Height);
+		EXPECT_TRUE(pEqualScoreChainApi->blocksFromRequests().empty());
+
+		AssertSync(context.Context, 1);
+	}
+
+	TEST(TEST_CLASS, BlocksPulledInParallelAreLimitedByRemoteChainHeight) {
+		// Arrange: all remotes can only supply one full chunk followed by a partial chunk of four blocks
+		ParallelTestContext context(1);
+		context.Context.pChainApi = std::make_shared<MockChainApi>(
+				ChainScore(11),
+				test::GenerateVerifiableBlockAtHeight(ChunkHeight(1) + Height(3)),
+				context.RemoteHashes);
+		context.Context.pChainApi->setNumBlocksPerBlocksFromRequest({ Blocks_Per_Chunk });
+		context.addRemoteBlocks(*context.Context.pChainApi);
+		context.ChainApis[0] = context.Context.pChainApi;
+		context.addRemote(ChainScore(11), ChunkHeight(1) + Height(3))->setNumBlocksPerBlocksFromRequest({ 4 });
+		context.addRemote(ChainScore(11), ChunkHeight(1) + Height(3));
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: the partial chunk was limited to the remote chain height and no chunk above it was requested
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSingleRequest(*context.ChainApis[0], ChunkHeight(0));
+		AssertSingleRequest(*context.ChainApis[1], ChunkHeight(1), 4);
+		EXPECT_TRUE(context.ChainApis[2]->blocksFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, BlocksPulledInParallelAreAssignedToRemotesByChainHeight) {
+		// Arrange: the second remote can only supply the first chunk
+		ParallelTestContext context(1);
+		auto pShortChainApi = context.addRemote(ChainScore(11), ChunkHeight(0) + Height(3));
+		auto pTallChainApi = context.addRemote(ChainScore(11));
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: later chunks were assigned to the taller remotes and the short remote was not needed
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSingleRequest(*context.ChainApis[0], ChunkHeight(0));
+		AssertSingleRequest(*pTallChainApi, ChunkHeight(1));
+		EXPECT_TRUE(pShortChainApi->blocksFromRequests().empty());
+
+		AssertSync(context.Context, 2);
+	}
+
+	TEST(TEST_CLASS, BlocksArePulledFromFirstRemoteWhenOtherRemotesAreTooShort) {
+		// Arrange: the primary remote can only supply the first chunk, so other remotes are not needed
+		ParallelTestContext context(1);
+		context.Context.pChainApi = std::make_shared<MockChainApi>(
+				ChainScore(11),
+				test::GenerateVerifiableBlockAtHeight(ChunkHeight(0) + Height(3)),
+				context.RemoteHashes);
+		context.Context.pChainApi->setNumBlocksPerBlocksFromRequest({ Blocks_Per_Chunk });
+		context.addRemoteBlocks(*context.Context.pChainApi);
+		context.ChainApis[0] = context.Context.pChainApi;
+		auto pShortChainApi = context.addRemote(ChainScore(11), ChunkHeight(0) + Height(3));
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSingleRequest(*context.ChainApis[0], Default_Height, Blocks_Per_Chunk);
+		EXPECT_TRUE(pShortChainApi->blocksFromRequests().empty());
+
+		AssertSync(context.Context, 1);
+	}
+
+	TEST(TEST_CLASS, ForkIsResolvedByFirstRemoteOnly) {
+		// Arrange: the local chain has a fork of depth 2
+		ParallelTestContext context(3, 2);
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSingleRequest(*context.ChainApis[0], Default_Height);
+		EXPECT_TRUE(context.ChainApis[1]->blocksFromRequests().empty());
+		EXPECT_TRUE(context.ChainApis[2]->blocksFromRequests().empty());
+
+		AssertSync(context.Context, 1);
+	}
+
+	TEST(TEST_CLASS, NeutralInteractionWhenNoRemotesAreSpecified) {
+		// Arrange:
+		auto context = CreateDefaultTestContext(9, 10);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto result = synchronizer({}).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Neutral, result);
+		context.assertNoCalls();
+		EXPECT_TRUE(context.pChainApi->blocksFromRequests().empty());
+	}
+
+	// endregion
+
+	// region block headers first
+
+	namespace {
+		constexpr Height Fork_Common_Height(14);
+
+		auto CreateCommonBlock() {
+			return test::GenerateVerifiableBlockAtHeight(Fork_Common_Height);
+		}
+
+		// creates a chain part composed of commonHeader followed by numBlockHeaders linked and signed block headers
+		BlockHeaderRange CreateBlockHeaders(const BlockHeader& commonHeader, size_t numBlockHeaders, uint64_t difficulty) {
+			auto signer = test::GenerateKeyPair();
+			uint8_t* pRangeData;
+			auto headers = BlockHeaderRange::PrepareFixed(numBlockHeaders + 1, &pRangeData);
+			std::memcpy(pRangeData, &commonHeader, sizeof(BlockHeader));
+
+			auto iter = headers.begin();
+			const auto* pParentHeader = &*iter;
+			for (++iter; headers.end() != iter; ++iter) {
+				auto& header = *iter;
+				std::memcpy(&header, pParentHeader, sizeof(BlockHeader));
+				header.Signer = signer.publicKey();
+				header.PreviousBlockHash = CalculateHash(*pParentHeader);
+				header.Height = pParentHeader->Height + Height(1);
+				header.Timestamp = pParentHeader->Timestamp + Timestamp(utils::TimeSpan::FromSeconds(60).millis());
+				header.Difficulty = Difficulty::Min() + Difficulty::Unclamped(difficulty);
+				SignBlockHeader(signer, header);
+				pParentHeader = &header;
+			}
+
+			return headers;
+		}
+
+		auto CreateHeadersFirstTestContext(uint64_t localDifficulty, uint64_t remoteDifficulty) {
+			// - last block has height 20, rewrite limit is 9
+			// - common block has height 14 = 20 - 9 + 4 - 1 (fork depth 6)
+			auto context = CreateDefaultTestContext(4, 10, 6);
+			context.Config.ShouldSyncBlockHeadersFirst = true;
+
+			auto pCommonBlock = CreateCommonBlock();
+			context.LocalBlockHeaders = CreateBlockHeaders(*pCommonBlock, 6, localDifficulty);
+			context.pChainApi->setBlockHeaders(CreateBlockHeaders(*pCommonBlock, 7, remoteDifficulty));
+			return context;
+		}
+
+		void AssertNoBlocksPulledAfterBlockHeaders(TestContext& context, NodeInteractionResult expectedResult) {
+			// Act:
+			auto synchronizer = CreateSynchronizer(context);
+			auto result = synchronizer({ context.pChainApi.get() }).get();
+
+			// Assert:
+			EXPECT_EQ(expectedResult, result);
+			context.assertNoCalls();
+
+			ASSERT_EQ(1u, context.pChainApi->blockHeadersFromRequests().size());
+			EXPECT_EQ(0u, context.pChainApi->blocksFromRequests().size());
+		}
+	}
+
+	TEST(TEST_CLASS, BlocksArePulledAfterValidBetterForkBlockHeaders) {
+		// Arrange: remote fork has one more block with same difficulty
+		auto context = CreateHeadersFirstTestContext(1000, 1000);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto result = synchronizer({ context.pChainApi.get() }).get();
+
+		// Assert: block headers were requested starting at the common block (maxRollback + 1)
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSync(context, 1);
+
+		const auto& headersParams = context.pChainApi->blockHeadersFromRequests();
+		ASSERT_EQ(1u, headersParams.size());
+		EXPECT_EQ(Fork_Common_Height, headersParams[0].first);
+		EXPECT_EQ(10u, headersParams[0].second);
+
+		// - all blocks with validated block headers were pulled (2 blocks at a time)
+		const auto& blocksParams = context.pChainApi->blocksFromRequests();
+		ASSERT_EQ(4u, blocksParams.size());
+		for (auto i = 0u; i < blocksParams.size(); ++i) {
+			EXPECT_EQ(Height(15 + 2 * i), blocksParams[i].first) << "height of request " << i;
+			EXPECT_EQ(7u, blocksParams[i].second.NumBlocks) << "NumBlocks of request " << i;
+			EXPECT_EQ(23u, blocksParams[i].second.NumBytes) << "NumBytes of request " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, BlocksArePulledWithoutBlockHeadersWhenForkDepthIsZero) {
+		// Arrange:
+		auto context = CreateDefaultTestContext(9, 10);
+		context.Config.ShouldSyncBlockHeadersFirst = true;
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto result = synchronizer({ context.pChainApi.get() }).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSync(context, 1);
+		EXPECT_EQ(0u, context.pChainApi->blockHeadersFromRequests().size());
+		AssertDefaultSinglePullRequest(*context.pChainApi);
+	}
+
+	TEST(TEST_CLASS, ForkBlocksArePulledWithoutBlockHeadersWhenDisabled) {
+		// Arrange:
+		auto context = CreateHeadersFirstTestContext(1000, 1000);
+		context.Config.ShouldSyncBlockHeadersFirst = false;
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto result = synchronizer({ context.pChainApi.get() }).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSync(context, 1);
+		EXPECT_EQ(0u, context.pChainApi->blockHeadersFromRequests().size());
+		AssertDefaultMultiplePullRequest(*context.pChainApi, { Height(15), Height(17), Height(19) });
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenForkBlockHeadersDoNotHaveBetterScore) {
+		// Arrange: remote fork has same number of blocks but lower difficulty
+		auto context = CreateHeadersFirstTestContext(1000, 1000);
+		context.pChainApi->setBlockHeaders(CreateBlockHeaders(*context.LocalBlockHeaders.cbegin(), 6, 500));
+
+		// Assert:
+		AssertNoBlocksPulledAfterBlockHeaders(context, NodeInteractionResult::Failure);
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenForkBlockHeadersAreNotLinked) {
+		// Arrange: break the link between the third and fourth fork block headers (and resign the fourth)
+		auto context = CreateHeadersFirstTestContext(1000, 1000);
+		auto remoteHeaders = CreateBlockHeaders(*context.LocalBlockHeaders.cbegin(), 7, 1000);
+		auto& brokenHeader = *std::next(remoteHeaders.begin(), 4);
+		brokenHeader.PreviousBlockHash = test::GenerateRandomData<Hash256_Size>();
+		SignBlockHeader(test::GenerateKeyPair(), brokenHeader);
+		context.pChainApi->setBlockHeaders(remoteHeaders);
+
+		// Assert:
+		AssertNoBlocksPulledAfterBlockHeaders(context, NodeInteractionResult::Failure);
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenForkBlockHeaderHasInvalidSignature) {
+		// Arrange: corrupt the signature of the last fork block header
+		auto context = CreateHeadersFirstTestContext(1000, 1000);
+		auto remoteHeaders = CreateBlockHeaders(*context.LocalBlockHeaders.cbegin(), 7, 1000);
+		(--remoteHeaders.end())->Signature[0] ^= 0xFF;
+		context.pChainApi->setBlockHeaders(remoteHeaders);
+
+		// Assert:
+		AssertNoBlocksPulledAfterBlockHeaders(context, NodeInteractionResult::Failure);
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenForkBlockHeadersDoNotStartAtCommonBlock) {
+		// Arrange: remote fork is built on a different common block
+		auto context = CreateHeadersFirstTestContext(1000, 1000);
+		context.pChainApi->setBlockHeaders(CreateBlockHeaders(*CreateCommonBlock(), 7, 1000));
+
+		// Assert:
+		AssertNoBlocksPulledAfterBlockHeaders(context, NodeInteractionResult::Failure);
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenForkBlockHeadersAreEmpty) {
+		// Arrange:
+		auto context = CreateHeadersFirstTestContext(1000, 1000);
+		context.pChainApi->setBlockHeaders(BlockHeaderRange());
+
+		// Assert:
+		AssertNoBlocksPulledAfterBlockHeaders(context, NodeInteractionResult::Failure);
+	}
+
+	TEST(TEST_CLASS, ForkBlocksArePulledWithoutBlockHeadersWhenBlockHeadersFromReturnsException) {
+		// Arrange: simulate a remote that does not support block headers requests
+		auto context = CreateHeadersFirstTestContext(1000, 1000);
+		context.pChainApi->setError(MockChainApi::EntryPoint::Block_Headers_From);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto result = synchronizer({ context.pChainApi.get() }).get();
+
+		// Assert: fork blocks were pulled as if block headers syncing was disabled
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSync(context, 1);
+		EXPECT_EQ(1u, context.pChainApi->blockHeadersFromRequests().size());
+		AssertDefaultMultiplePullRequest(*context.pChainApi, { Height(15), Height(17), Height(19) });
+	}
+
+	// endregion
+
 	// region unprocessed elements
 
 	namespace {
@@ -369,7 +887,7 @@ namespace catapult { namespace chain {
 
 		// Act:
 		for (auto i = 0u; i < 10; i++)
-			interactionResults.push_back(synchronizer(*context.pChainApi).get());
+			interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 		// Assert:
 		AssertSync(context, 10);
@@ -390,8 +908,8 @@ namespace catapult { namespace chain {
 		auto synchronizer = CreateSynchronizer(context);
 
 		// Act: second call is short circuited since the container is full
-		auto result1 = synchronizer(*context.pChainApi).get();
-		auto result2 = synchronizer(*context.pChainApi).get();
+		auto result1 = synchronizer({ context.pChainApi.get() }).get();
+		auto result2 = synchronizer({ context.pChainApi.get() }).get();
 
 		// Assert:
 		EXPECT_EQ(result1, NodeInteractionResult::Success);
@@ -410,17 +928,17 @@ namespace catapult { namespace chain {
 		std::vector<NodeInteractionResult> interactionResults;
 
 		// - sucessful since container is not full
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 		// - neutral since container is full
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 		// - signal processing for first element has finished
 		context.ProcessingComplete(1, CreateContinueResult());
 
 		// Act: since an unprocessed element was removed, the container is no longer full
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 		// Assert:
 		std::vector<NodeInteractionResult> expectedInteractionResults{
@@ -441,15 +959,15 @@ namespace catapult { namespace chain {
 		auto context = CreateTestContextForUnprocessedElementTests();
 		auto synchronizer = CreateSynchronizer(context);
 		std::vector<NodeInteractionResult> interactionResults;
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 		// - signal processing for first element has finished unsuccessfully making the container dirty
 		context.ProcessingComplete(1, CreateAbortResult());
 
 		// Act: neutral because container is dirty
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 		// Assert:
 		std::vector<NodeInteractionResult> expectedInteractionResults{
@@ -470,20 +988,20 @@ namespace catapult { namespace chain {
 		auto context = CreateTestContextForUnprocessedElementTests();
 		auto synchronizer = CreateSynchronizer(context);
 		std::vector<NodeInteractionResult> interactionResults;
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 		// - signal processing for first element has finished unsuccessfully making the container dirty
 		context.ProcessingComplete(1, CreateAbortResult());
 
 		// - neutral because container is dirty
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 		// - signal processing for second element has finished. The container is empty and thus clean again
 		context.ProcessingComplete(2, CreateAbortResult());
 
 		// Act: successful because container is clean
-		interactionResults.push_back(synchronizer(*context.pChainApi).get());
+		interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 		// Assert:
 		std::vector<NodeInteractionResult> expectedInteractionResults{
@@ -509,11 +1027,11 @@ namespace catapult { namespace chain {
 			std::vector<NodeInteractionResult> interactionResults;
 
 			// Act: start an (immediate) request
-			interactionResults.push_back(synchronizer(*context.pChainApi).get());
+			interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 			// - start a delayed request
 			context.pChainApi->setDelay(utils::TimeSpan::FromMilliseconds(10 * i));
-			auto syncFuture = synchronizer(*context.pChainApi);
+			auto syncFuture = synchronizer({ context.pChainApi.get() });
 
 			// - signal processing for first element has finished unsuccessfully making the container dirty
 			context.ProcessingComplete(1, CreateAbortResult());
@@ -547,8 +1065,8 @@ namespace catapult { namespace chain {
 
 		// Act: start two delayed requests
 		context.pChainApi->setDelay(utils::TimeSpan::FromMilliseconds(10));
-		auto syncFuture1 = synchronizer(*context.pChainApi);
-		auto syncFuture2 = synchronizer(*context.pChainApi);
+		auto syncFuture1 = synchronizer({ context.pChainApi.get() });
+		auto syncFuture2 = synchronizer({ context.pChainApi.get() });
 
 		// - wait for the delayed requests
 		interactionResults.push_back(syncFuture1.get());
@@ -572,7 +1090,7 @@ namespace catapult { namespace chain {
 		// Arrange:
 		auto context = CreateTestContextForUnprocessedElementTests();
 		auto synchronizer = CreateSynchronizer(context);
-		auto resultFuture1 = synchronizer(*context.pChainApi);
+		auto resultFuture1 = synchronizer({ context.pChainApi.get() });
 
 		// Act + Assert: signal processing has finished with unknown element id
 		EXPECT_THROW(context.ProcessingComplete(123, CreateContinueResult()), catapult_invalid_argument);
@@ -593,11 +1111,11 @@ namespace catapult { namespace chain {
 
 			// Act: set an exception and sync
 			context.pChainApi->setError(errorPoint);
-			interactionResults.push_back(synchronizer(*context.pChainApi).get());
+			interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 			// - clear the exception and sync
 			context.pChainApi->setError(MockChainApi::EntryPoint::None);
-			interactionResults.push_back(synchronizer(*context.pChainApi).get());
+			interactionResults.push_back(synchronizer({ context.pChainApi.get() }).get());
 
 			// Assert: the first sync failed but the second succeeded
 			std::vector<NodeInteractionResult> expectedInteractionResults{
@@ -634,7 +1152,7 @@ namespace catapult { namespace chain {
 			auto synchronizer = CreateSynchronizer(context);
 
 			// Act: start synchronizing
-			future = synchronizer(*context.pChainApi);
+			future = synchronizer({ context.pChainApi.get() });
 
 			// - destroy the synchronizer before completion
 			CATAPULT_LOG(debug) << "destroying synchronizer";
@@ -655,7 +1173,7 @@ namespace catapult { namespace chain {
 			auto synchronizer = CreateSynchronizer(context);
 
 			// - add an element to unprocessed elements and capture the completion function
-			synchronizer(*context.pChainApi).get();
+			synchronizer({ context.pChainApi.get() }).get();
 			processingComplete = context.ProcessingComplete;
 
 			// Act: destroy the synchronizer before completion
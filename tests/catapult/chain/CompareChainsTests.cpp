@@ -34,7 +34,9 @@ namespace catapult { namespace chain {
 #define TEST_CLASS CompareChainsTests
 
 	namespace {
-		void AssertLocalChainExceptionPropagation(MockChainApi::EntryPoint entryPoint) {
+		void AssertLocalChainExceptionPropagation(
+				MockChainApi::EntryPoint entryPoint,
+				const CompareChainsOptions& options = CompareChainsOptions(1000, 1000)) {
 			// Arrange:
 			auto commonHashes = test::GenerateRandomHashes(3);
 			auto localHashes = test::ConcatHashes(commonHashes, test::GenerateRandomHashes(1));
@@ -44,10 +46,12 @@ namespace catapult { namespace chain {
 			local.setError(entryPoint);
 
 			// Act + Assert:
-			EXPECT_THROW(CompareChains(local, remote, { 1000, 1000 }).get(), catapult_runtime_error);
+			EXPECT_THROW(CompareChains(local, remote, options).get(), catapult_runtime_error);
 		}
 
-		void AssertRemoteChainExceptionPropagation(MockChainApi::EntryPoint entryPoint) {
+		void AssertRemoteChainExceptionPropagation(
+				MockChainApi::EntryPoint entryPoint,
+				const CompareChainsOptions& options = CompareChainsOptions(1000, 1000)) {
 			// Arrange:
 			auto commonHashes = test::GenerateRandomHashes(3);
 			auto localHashes = test::ConcatHashes(commonHashes, test::GenerateRandomHashes(1));
@@ -57,13 +61,14 @@ namespace catapult { namespace chain {
 			remote.setError(entryPoint);
 
 			// Act + Assert:
-			EXPECT_THROW(CompareChains(local, remote, { 1000, 1000 }).get(), catapult_runtime_error);
+			EXPECT_THROW(CompareChains(local, remote, options).get(), catapult_runtime_error);
 		}
 
 		void AssertDefaultChainInformation(const CompareChainsResult& result) {
 			// Assert:
 			EXPECT_EQ(Height(static_cast<Height::ValueType>(-1)), result.CommonBlockHeight);
 			EXPECT_EQ(0u, result.ForkDepth);
+			EXPECT_EQ(Height(0), result.RemoteChainHeight);
 		}
 
 		bool AreChainsConsistent(size_t numLocalHashes, Height commonBlockHeight, Height hashesFromHeight) {
@@ -74,8 +79,28 @@ namespace catapult { namespace chain {
 			CATAPULT_LOG(debug) << "numLocalHashes = " << numLocalHashes << ", differenceIndex = " << differenceIndex;
 			return numLocalHashes == differenceIndex;
 		}
+
+		struct LegacyTraits {
+			static CompareChainsOptions CreateOptions(uint32_t maxBlocksToAnalyze, uint32_t maxBlocksToRewrite) {
+				return CompareChainsOptions(maxBlocksToAnalyze, maxBlocksToRewrite);
+			}
+		};
+
+		struct SampledTraits {
+			static CompareChainsOptions CreateOptions(uint32_t maxBlocksToAnalyze, uint32_t maxBlocksToRewrite) {
+				CompareChainsOptions options(maxBlocksToAnalyze, maxBlocksToRewrite);
+				options.ShouldSampleHashes = true;
+				return options;
+			}
+		};
 	}
 
+#define HASH_COMPARISON_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Legacy) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<LegacyTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Sampled) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SampledTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
 	// region chain info
 
 	TEST(TEST_CLASS, RemoteReportedLowerChainScoreIfRemoteChainScoreIsLessThanLocalChainScore) {
@@ -183,7 +208,7 @@ namespace catapult { namespace chain {
 		AssertRemoteReturnedTooManyHashes(20, 20, false);
 	}
 
-	TEST(TEST_CLASS, RemoteIsForkedIfTheFirstLocalAndRemoteHashesDoNotMatch) {
+	HASH_COMPARISON_TEST(RemoteIsForkedIfTheFirstLocalAndRemoteHashesDoNotMatch) {
 		// Arrange: Local { A, B, C }, Remote { D, B, C }
 		auto localHashes = test::GenerateRandomHashes(3);
 		auto remoteHashes = test::GenerateRandomHashes(3);
@@ -193,28 +218,28 @@ namespace catapult { namespace chain {
 		MockChainApi remote(ChainScore(11), Height(3), remoteHashes);
 
 		// Act:
-		auto result = CompareChains(local, remote, { 1000, 1000 }).get();
+		auto result = CompareChains(local, remote, TTraits::CreateOptions(1000, 1000)).get();
 
 		// Assert:
 		EXPECT_EQ(ChainComparisonCode::Remote_Is_Forked, result.Code);
 		AssertDefaultChainInformation(result);
 	}
 
-	TEST(TEST_CLASS, RemoteLiedAboutChainScoreIfLocalIsSameSizeAsRemoteChainAndContainsAllHashesInRemoteChain) {
+	HASH_COMPARISON_TEST(RemoteLiedAboutChainScoreIfLocalIsSameSizeAsRemoteChainAndContainsAllHashesInRemoteChain) {
 		// Arrange: Local { A, B, C }, Remote { A, B, C }
 		auto commonHashes = test::GenerateRandomHashes(3);
 		MockChainApi local(ChainScore(10), Height(3), commonHashes);
 		MockChainApi remote(ChainScore(11), Height(3), commonHashes);
 
 		// Act:
-		auto result = CompareChains(local, remote, { 1000, 1000 }).get();
+		auto result = CompareChains(local, remote, TTraits::CreateOptions(1000, 1000)).get();
 
 		// Assert:
 		EXPECT_EQ(ChainComparisonCode::Remote_Lied_About_Chain_Score, result.Code);
 		AssertDefaultChainInformation(result);
 	}
 
-	TEST(TEST_CLASS, RemoteLiedAboutChainScoreIfRemoteChainIsSubsetOfLocalChainButRemoteReportedHigherScore) {
+	HASH_COMPARISON_TEST(RemoteLiedAboutChainScoreIfRemoteChainIsSubsetOfLocalChainButRemoteReportedHigherScore) {
 		// Arrange: Local { A, B, C }, Remote { A, B }
 		auto localHashes = test::GenerateRandomHashes(3);
 		auto remoteHashes = test::GenerateRandomHashesSubset(localHashes, 2);
@@ -222,14 +247,14 @@ namespace catapult { namespace chain {
 		MockChainApi remote(ChainScore(11), Height(2), remoteHashes);
 
 		// Act:
-		auto result = CompareChains(local, remote, { 1000, 1000 }).get();
+		auto result = CompareChains(local, remote, TTraits::CreateOptions(1000, 1000)).get();
 
 		// Assert:
 		EXPECT_EQ(ChainComparisonCode::Remote_Lied_About_Chain_Score, result.Code);
 		AssertDefaultChainInformation(result);
 	}
 
-	TEST(TEST_CLASS, RemoteIsNotSyncedIfLocalIsSmallerThanRemoteChainAndContainsAllHashesInRemoteChain) {
+	HASH_COMPARISON_TEST(RemoteIsNotSyncedIfLocalIsSmallerThanRemoteChainAndContainsAllHashesInRemoteChain) {
 		// Arrange: Local { A, B }, Remote { A, B, C }
 		auto remoteHashes = test::GenerateRandomHashes(3);
 		auto localHashes = test::GenerateRandomHashesSubset(remoteHashes, 2);
@@ -238,12 +263,13 @@ namespace catapult { namespace chain {
 		remote.addBlock(test::GenerateVerifiableBlockAtHeight(Height(3)));
 
 		// Act:
-		auto result = CompareChains(local, remote, { 1000, 1000 }).get();
+		auto result = CompareChains(local, remote, TTraits::CreateOptions(1000, 1000)).get();
 
 		// Assert:
 		EXPECT_EQ(ChainComparisonCode::Remote_Is_Not_Synced, result.Code);
 		EXPECT_EQ(Height(2), result.CommonBlockHeight);
 		EXPECT_EQ(0u, result.ForkDepth);
+		EXPECT_EQ(Height(3), result.RemoteChainHeight);
 		EXPECT_TRUE(AreChainsConsistent(localHashes.size(), result.CommonBlockHeight, Height(1)));
 	}
 
@@ -267,6 +293,7 @@ namespace catapult { namespace chain {
 		EXPECT_EQ(ChainComparisonCode::Remote_Is_Not_Synced, result.Code);
 		EXPECT_EQ(Height(12), result.CommonBlockHeight);
 		EXPECT_EQ(0u, result.ForkDepth);
+		EXPECT_EQ(Height(13), result.RemoteChainHeight);
 		EXPECT_TRUE(AreChainsConsistent(localHashes.size(), result.CommonBlockHeight, Height(1)));
 	}
 
@@ -304,6 +331,8 @@ namespace catapult { namespace chain {
 
 			EXPECT_EQ(std::vector<Height>{ expectedHashesFromHeight }, local.hashesFromRequests());
 			EXPECT_EQ(std::vector<Height>{ expectedHashesFromHeight }, remote.hashesFromRequests());
+			EXPECT_TRUE(local.hashesAtRequests().empty());
+			EXPECT_TRUE(remote.hashesAtRequests().empty());
 		}
 	}
 
@@ -318,4 +347,171 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region sampling
+
+	namespace {
+		// mock chain api that appends extra hashes to all hashes-at responses
+		class ExtraHashesChainApi : public MockChainApi {
+		public:
+			ExtraHashesChainApi(const ChainScore& score, Height height, size_t numHashes, size_t numExtraHashes)
+					: MockChainApi(score, height, numHashes)
+					, m_numExtraHashes(numExtraHashes)
+			{}
+
+		public:
+			thread::future<model::HashRange> hashesAt(model::HeightRange&& heights) const override {
+				auto hashes = MockChainApi::hashesAt(std::move(heights)).get();
+				auto extraHashes = test::GenerateRandomHashes(m_numExtraHashes);
+				return thread::make_ready_future(test::ConcatHashes(hashes, extraHashes));
+			}
+
+		private:
+			size_t m_numExtraHashes;
+		};
+
+		void AssertRemoteReturnedTooManySampledHashes(size_t numExtraHashes, bool expected) {
+			// Arrange: all 7 requested heights { 1, 3, 11, 15, 17, 18, 19 } are present in the remote chain
+			MockChainApi local(ChainScore(10), Height(18), 18);
+			ExtraHashesChainApi remote(ChainScore(11), Height(20), 20, numExtraHashes);
+
+			// Act:
+			auto result = CompareChains(local, remote, SampledTraits::CreateOptions(1000, 1000)).get();
+
+			// Assert:
+			if (expected)
+				EXPECT_EQ(ChainComparisonCode::Remote_Returned_Too_Many_Hashes, result.Code);
+			else
+				EXPECT_NE(ChainComparisonCode::Remote_Returned_Too_Many_Hashes, result.Code);
+
+			AssertDefaultChainInformation(result);
+		}
+	}
+
+	TEST(TEST_CLASS, RemoteReturnedTooManyHashesIfItReturnedMoreHashesThanRequestedHeights) {
+		// Assert:
+		AssertRemoteReturnedTooManySampledHashes(1, true);
+	}
+
+	TEST(TEST_CLASS, RemoteDidNotReturnTooManyHashesIfItReturnedHashesForAllRequestedHeights) {
+		// Assert:
+		AssertRemoteReturnedTooManySampledHashes(0, false);
+	}
+
+	TEST(TEST_CLASS, LocalHashesAtExceptionIsPropagated) {
+		// Assert:
+		AssertLocalChainExceptionPropagation(MockChainApi::EntryPoint::Hashes_At, SampledTraits::CreateOptions(1000, 1000));
+	}
+
+	TEST(TEST_CLASS, RemoteHashesAtExceptionIsPropagated) {
+		// Assert:
+		AssertRemoteChainExceptionPropagation(MockChainApi::EntryPoint::Hashes_At, SampledTraits::CreateOptions(1000, 1000));
+	}
+
+	namespace {
+		void AssertSampledRemoteIsNotSynced(uint32_t rewriteLimit, Height expectedHashesFromHeight, Height expectedCommonBlockHeight) {
+			// Arrange: Local { ..., A, B, C, D }, Remote { ..., A, B, C, E }
+			auto commonHashes = test::GenerateRandomHashes(20 - expectedHashesFromHeight.unwrap());
+			auto localHashes = test::ConcatHashes(commonHashes, test::GenerateRandomHashes(1));
+			auto remoteHashes = test::ConcatHashes(commonHashes, test::GenerateRandomHashes(1));
+			MockChainApi local(ChainScore(10), Height(20), localHashes);
+			MockChainApi remote(ChainScore(11), Height(20), remoteHashes);
+			local.setHashesStartHeight(expectedHashesFromHeight);
+			remote.setHashesStartHeight(expectedHashesFromHeight);
+
+			// Act:
+			auto result = CompareChains(local, remote, SampledTraits::CreateOptions(1000, rewriteLimit)).get();
+
+			// Assert:
+			EXPECT_EQ(ChainComparisonCode::Remote_Is_Not_Synced, result.Code);
+			EXPECT_EQ(expectedCommonBlockHeight, result.CommonBlockHeight);
+			EXPECT_EQ(20u - expectedCommonBlockHeight.unwrap(), result.ForkDepth);
+			EXPECT_FALSE(AreChainsConsistent(localHashes.size(), result.CommonBlockHeight, expectedHashesFromHeight));
+
+			// - the first requested height is the lowest height that can be rewritten
+			ASSERT_EQ(1u, local.hashesAtRequests().size());
+			ASSERT_EQ(1u, remote.hashesAtRequests().size());
+			EXPECT_EQ(expectedHashesFromHeight, local.hashesAtRequests()[0][0]);
+			EXPECT_EQ(local.hashesAtRequests(), remote.hashesAtRequests());
+			EXPECT_TRUE(local.hashesFromRequests().empty());
+			EXPECT_TRUE(remote.hashesFromRequests().empty());
+		}
+	}
+
+	TEST(TEST_CLASS, SampledRemoteIsNotSyncedIfChainsDivergeAndRemoteHasHigherScore) {
+		// Assert: note chain height is 20 < 1000
+		AssertSampledRemoteIsNotSynced(1000, Height(1), Height(19));
+	}
+
+	TEST(TEST_CLASS, SampledCommonBlockHeightIsInfluencedByRewriteLimit) {
+		// Assert: note chain height is 20 > 15
+		AssertSampledRemoteIsNotSynced(5, Height(15), Height(19));
+	}
+
+	TEST(TEST_CLASS, FirstRoundSamplesExponentiallySpacedHeights) {
+		// Arrange: Local { ..., A, B }, Remote { ..., A, C }
+		auto commonHashes = test::GenerateRandomHashes(99);
+		auto localHashes = test::ConcatHashes(commonHashes, test::GenerateRandomHashes(1));
+		auto remoteHashes = test::ConcatHashes(commonHashes, test::GenerateRandomHashes(1));
+		MockChainApi local(ChainScore(10), Height(100), localHashes);
+		MockChainApi remote(ChainScore(11), Height(100), remoteHashes);
+
+		// Act:
+		auto result = CompareChains(local, remote, SampledTraits::CreateOptions(1000, 1000)).get();
+
+		// Assert: the fork point is between the two highest heights, so a single round is sufficient
+		EXPECT_EQ(ChainComparisonCode::Remote_Is_Not_Synced, result.Code);
+		EXPECT_EQ(Height(99), result.CommonBlockHeight);
+		EXPECT_EQ(1u, result.ForkDepth);
+
+		auto expectedHeights = std::vector<Height>{
+			Height(1), Height(37), Height(69), Height(85), Height(93), Height(97), Height(99), Height(100), Height(101)
+		};
+		EXPECT_EQ(std::vector<std::vector<Height>>{ expectedHeights }, local.hashesAtRequests());
+		EXPECT_EQ(std::vector<std::vector<Height>>{ expectedHeights }, remote.hashesAtRequests());
+	}
+
+	namespace {
+		void AssertForkPointIsFoundByNarrowing(uint32_t analyzeLimit, size_t expectedNumRounds) {
+			// Arrange: Local { ..., A, B, ... }, Remote { ..., A, C, ... } with the fork after height 50
+			auto commonHashes = test::GenerateRandomHashes(50);
+			auto localHashes = test::ConcatHashes(commonHashes, test::GenerateRandomHashes(50));
+			auto remoteHashes = test::ConcatHashes(commonHashes, test::GenerateRandomHashes(60));
+			MockChainApi local(ChainScore(10), Height(100), localHashes);
+			MockChainApi remote(ChainScore(11), Height(110), remoteHashes);
+
+			// Act:
+			auto result = CompareChains(local, remote, SampledTraits::CreateOptions(analyzeLimit, 1000)).get();
+
+			// Assert:
+			EXPECT_EQ(ChainComparisonCode::Remote_Is_Not_Synced, result.Code);
+			EXPECT_EQ(Height(50), result.CommonBlockHeight);
+			EXPECT_EQ(50u, result.ForkDepth);
+
+			// - all rounds after the first one request at most analyzeLimit heights
+			const auto& requests = remote.hashesAtRequests();
+			ASSERT_EQ(expectedNumRounds, requests.size());
+			for (auto i = 1u; i < requests.size(); ++i)
+				EXPECT_GE(analyzeLimit, requests[i].size()) << "round " << i;
+
+			EXPECT_EQ(local.hashesAtRequests(), requests);
+		}
+	}
+
+	TEST(TEST_CLASS, ForkPointIsFoundByNarrowingSampledRangeInSingleRound) {
+		// Assert: first round finds the fork point in [37, 69), second round requests the full range [38, 68]
+		AssertForkPointIsFoundByNarrowing(100, 2);
+	}
+
+	TEST(TEST_CLASS, ForkPointIsFoundByNarrowingSampledRangeInMultipleRounds) {
+		// Assert: [37, 69) => 5 samples narrow to [47, 53) => full range narrows to [50, 51)
+		AssertForkPointIsFoundByNarrowing(5, 3);
+	}
+
+	TEST(TEST_CLASS, ForkPointIsFoundByBisectingSampledRange) {
+		// Assert: [37, 69) => [37, 53) => [45, 53) => [49, 53) => [49, 51) => [50, 51)
+		AssertForkPointIsFoundByNarrowing(1, 6);
+	}
+
+	// endregion
 }}
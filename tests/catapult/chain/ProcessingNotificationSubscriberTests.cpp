@@ -51,13 +51,30 @@ namespace catapult { namespace chain {
 					, m_cacheDelta(m_cache.createDelta())
 					, m_validatorContext(test::CreateValidatorContext(Height(123), m_cacheDelta.toReadOnly()))
 					, m_observerContext(m_cacheDelta, m_state, Height(123), executeMode)
-					, m_sub(m_validator, m_validatorContext, m_observer, m_observerContext) {
+					, m_pSub(std::make_unique<ProcessingNotificationSubscriber>(
+							m_validator,
+							m_validatorContext,
+							m_observer,
+							m_observerContext)) {
 				CATAPULT_LOG(debug) << "preparing test context with execute mode " << executeMode;
 			}
 
+			explicit TestContext(model::NotificationBuffer& undoBuffer)
+					: m_cache({})
+					, m_cacheDelta(m_cache.createDelta())
+					, m_validatorContext(test::CreateValidatorContext(Height(123), m_cacheDelta.toReadOnly()))
+					, m_observerContext(m_cacheDelta, m_state, Height(123), observers::NotifyMode::Commit)
+					, m_pSub(std::make_unique<ProcessingNotificationSubscriber>(
+							m_validator,
+							m_validatorContext,
+							m_observer,
+							m_observerContext,
+							undoBuffer))
+			{}
+
 		public:
 			ProcessingNotificationSubscriber& sub() {
-				return m_sub;
+				return *m_pSub;
 			}
 
 			void setValidationResult(ValidationResult result) {
@@ -123,7 +140,7 @@ namespace catapult { namespace chain {
 			validators::ValidatorContext m_validatorContext;
 			observers::ObserverContext m_observerContext;
 
-			ProcessingNotificationSubscriber m_sub;
+			std::unique_ptr<ProcessingNotificationSubscriber> m_pSub;
 		};
 	}
 
@@ -492,4 +509,54 @@ namespace catapult { namespace chain {
 			Notification_Type_All_3, Notification_Type_All_2
 		}, 3);
 	}
+
+	// region external undo buffer
+
+	TEST(TEST_CLASS, CanUndoNotificationsUsingExternalUndoBuffer) {
+		// Arrange:
+		model::NotificationBuffer undoBuffer;
+		TestContext context(undoBuffer);
+		context.sub().enableUndo();
+		auto notification1 = test::CreateNotification(Notification_Type_All);
+		auto notification2 = test::CreateNotification(Notification_Type_All_2);
+
+		// - process notifications
+		context.sub().notify(notification1);
+		context.sub().notify(notification2);
+
+		// Sanity: notifications were stored in external buffer
+		EXPECT_EQ(2u, undoBuffer.size());
+
+		// Act: undo notifications
+		context.sub().undo();
+
+		// Assert:
+		EXPECT_EQ(0u, undoBuffer.size());
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({ Notification_Type_All, Notification_Type_All_2 });
+		context.assertObserverCalls({ Notification_Type_All, Notification_Type_All_2, Notification_Type_All_2, Notification_Type_All }, 2);
+	}
+
+	TEST(TEST_CLASS, ExternalUndoBufferIsClearedWhenSubscriberIsCreated) {
+		// Arrange: add a notification to the undo buffer before creating the subscriber
+		model::NotificationBuffer undoBuffer;
+		undoBuffer.notify(test::CreateNotification(Notification_Type_All_3));
+
+		TestContext context(undoBuffer);
+		context.sub().enableUndo();
+		auto notification = test::CreateNotification(Notification_Type_All);
+
+		// - process notification
+		context.sub().notify(notification);
+
+		// Act: undo notification
+		context.sub().undo();
+
+		// Assert: the preexisting notification is not undone
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({ Notification_Type_All });
+		context.assertObserverCalls({ Notification_Type_All, Notification_Type_All }, 1);
+	}
+
+	// endregion
 }}
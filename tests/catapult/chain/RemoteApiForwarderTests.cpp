@@ -109,4 +109,146 @@ namespace catapult { namespace chain {
 		EXPECT_EQ(1u, capture.NumActionCalls);
 		EXPECT_EQ(Default_Action_Api_Id, capture.ActionApiId);
 	}
+
+	namespace {
+		struct MultiProcessSyncParamsCapture {
+			size_t NumFactoryCalls = 0;
+			size_t NumActionCalls = 0;
+			std::vector<int> ActionApiIds;
+		};
+
+		thread::future<NodeInteractionResult> ProcessMultiSyncAndCapture(
+				RemoteApiForwarder& forwarder,
+				size_t maxPeers,
+				MultiProcessSyncParamsCapture& capture) {
+			return forwarder.processSync(
+				[&capture](const auto& apis) {
+					++capture.NumActionCalls;
+					for (const auto* pApiId : apis)
+						capture.ActionApiIds.push_back(*pApiId);
+
+					return thread::make_ready_future(NodeInteractionResult::Success);
+				},
+				[&capture](const auto&, const auto&) {
+					++capture.NumFactoryCalls;
+					return std::make_unique<int>(Default_Action_Api_Id + static_cast<int>(capture.NumFactoryCalls));
+				},
+				maxPeers);
+		}
+	}
+
+	TEST(TEST_CLASS, MultiActionIsSkippedWhenNoPeerIsAvailable) {
+		// Arrange: create an empty writers
+		mocks::PickOneAwareMockPacketWriters writers;
+
+		// - create the forwarder
+		model::TransactionRegistry registry;
+		RemoteApiForwarder forwarder(writers, registry, utils::TimeSpan::FromSeconds(4), "test");
+
+		// Act:
+		MultiProcessSyncParamsCapture capture;
+		auto result = ProcessMultiSyncAndCapture(forwarder, 3, capture).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::None, result);
+
+		// - pick one was called once because no peer was available
+		ASSERT_EQ(1u, writers.numPickOneCalls());
+		EXPECT_EQ(utils::TimeSpan::FromSeconds(4), writers.pickOneDurations()[0]);
+
+		// - other calls were bypassed
+		EXPECT_EQ(0u, capture.NumFactoryCalls);
+		EXPECT_EQ(0u, capture.NumActionCalls);
+	}
+
+	TEST(TEST_CLASS, MultiActionIsInvokedWithAllAvailablePeers) {
+		// Arrange: create writers with a single available packet io
+		auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+		mocks::PickOneAwareMockPacketWriters writers(mocks::PickOneAwareMockPacketWriters::SetPacketIoBehavior::Use_Once);
+		writers.setPacketIo(pPacketIo);
+
+		// - create the forwarder
+		model::TransactionRegistry registry;
+		RemoteApiForwarder forwarder(writers, registry, utils::TimeSpan::FromSeconds(4), "test");
+
+		// Act:
+		MultiProcessSyncParamsCapture capture;
+		auto result = ProcessMultiSyncAndCapture(forwarder, 3, capture).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+
+		// - pick one was called until no peer was available
+		EXPECT_EQ(2u, writers.numPickOneCalls());
+
+		// - factory and action were called
+		EXPECT_EQ(1u, capture.NumFactoryCalls);
+		EXPECT_EQ(1u, capture.NumActionCalls);
+		EXPECT_EQ(std::vector<int>({ Default_Action_Api_Id + 1 }), capture.ActionApiIds);
+	}
+
+	namespace {
+		std::vector<ionet::Node> CreateNodes(size_t count) {
+			std::vector<ionet::Node> nodes;
+			for (auto i = 0u; i < count; ++i)
+				nodes.push_back(ionet::Node(test::GenerateRandomData<Key_Size>(), ionet::NodeEndpoint(), ionet::NodeMetadata()));
+
+			return nodes;
+		}
+	}
+
+	TEST(TEST_CLASS, MultiActionIsInvokedWithUpToMaxPeers) {
+		// Arrange: create writers with a valid packet io
+		auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+		mocks::PickOneAwareMockPacketWriters writers;
+		writers.setPacketIo(pPacketIo);
+		writers.setNodes(CreateNodes(4));
+
+		// - create the forwarder
+		model::TransactionRegistry registry;
+		RemoteApiForwarder forwarder(writers, registry, utils::TimeSpan::FromSeconds(4), "test");
+
+		// Act:
+		MultiProcessSyncParamsCapture capture;
+		auto result = ProcessMultiSyncAndCapture(forwarder, 3, capture).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+
+		// - pick one was called max peers times
+		EXPECT_EQ(3u, writers.numPickOneCalls());
+
+		// - factory was called for each peer and action was called once with all apis
+		EXPECT_EQ(3u, capture.NumFactoryCalls);
+		EXPECT_EQ(1u, capture.NumActionCalls);
+		auto expectedApiIds = std::vector<int>{ Default_Action_Api_Id + 1, Default_Action_Api_Id + 2, Default_Action_Api_Id + 3 };
+		EXPECT_EQ(expectedApiIds, capture.ActionApiIds);
+	}
+
+	TEST(TEST_CLASS, MultiActionIsInvokedWithDistinctPeers) {
+		// Arrange: create writers that return the same two peers repeatedly (e.g. multiplexed writers)
+		auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+		mocks::PickOneAwareMockPacketWriters writers;
+		writers.setPacketIo(pPacketIo);
+		writers.setNodes(CreateNodes(2));
+
+		// - create the forwarder
+		model::TransactionRegistry registry;
+		RemoteApiForwarder forwarder(writers, registry, utils::TimeSpan::FromSeconds(4), "test");
+
+		// Act:
+		MultiProcessSyncParamsCapture capture;
+		auto result = ProcessMultiSyncAndCapture(forwarder, 3, capture).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+
+		// - pick one was called max peers times
+		EXPECT_EQ(3u, writers.numPickOneCalls());
+
+		// - factory was only called for distinct peers and action was called once with all apis
+		EXPECT_EQ(2u, capture.NumFactoryCalls);
+		EXPECT_EQ(1u, capture.NumActionCalls);
+		EXPECT_EQ(std::vector<int>({ Default_Action_Api_Id + 1, Default_Action_Api_Id + 2 }), capture.ActionApiIds);
+	}
 }}
@@ -44,6 +44,11 @@ namespace catapult { namespace chain {
 				return thread::make_ready_future(NodeInteractionResult::Neutral);
 			}
 
+			thread::future<NodeInteractionResult> operator()(const std::vector<const RemoteApi*>& remoteApis) {
+				m_capturedRemoteApis.insert(m_capturedRemoteApis.end(), remoteApis.cbegin(), remoteApis.cend());
+				return thread::make_ready_future(NodeInteractionResult::Success);
+			}
+
 		private:
 			std::vector<const RemoteApi*> m_capturedRemoteApis;
 		};
@@ -63,4 +68,21 @@ namespace catapult { namespace chain {
 		ASSERT_EQ(1u, pSynchronizer->capturedRemoteApis().size());
 		EXPECT_EQ(&remoteApi, pSynchronizer->capturedRemoteApis()[0]);
 	}
+
+	TEST(TEST_CLASS, MultiFunctionDelegatesToSynchronizer) {
+		// Arrange:
+		auto pSynchronizer = std::make_shared<MockSynchronizer>();
+		auto remoteNodeSynchronizer = CreateMultiRemoteNodeSynchronizer(pSynchronizer);
+
+		// Act:
+		RemoteApi remoteApi1;
+		RemoteApi remoteApi2;
+		auto result = remoteNodeSynchronizer({ &remoteApi1, &remoteApi2 }).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		ASSERT_EQ(2u, pSynchronizer->capturedRemoteApis().size());
+		EXPECT_EQ(&remoteApi1, pSynchronizer->capturedRemoteApis()[0]);
+		EXPECT_EQ(&remoteApi2, pSynchronizer->capturedRemoteApis()[1]);
+	}
 }}
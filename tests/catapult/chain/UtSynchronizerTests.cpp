@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/chain/UtSynchronizer.h"
+#include "catapult/utils/ShortHashIblt.h"
 #include "tests/catapult/chain/test/MockTransactionApi.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/test/other/EntitiesSynchronizerTestUtils.h"
@@ -26,6 +27,8 @@
 
 namespace catapult { namespace chain {
 
+#define TEST_CLASS UtSynchronizerTests
+
 	namespace {
 		using MockRemoteApi = mocks::MockTransactionApi;
 
@@ -88,4 +91,130 @@ namespace catapult { namespace chain {
 	}
 
 	DEFINE_ENTITIES_SYNCHRONIZER_TESTS(UtSynchronizer)
+
+	// region reconciliation
+
+	namespace {
+		// 51 cells * 12 bytes/cell is smaller than 500 short hashes * 4 bytes/short hash but larger than 100 short hashes
+		constexpr uint32_t Max_Reconciliation_Difference = 10;
+		constexpr size_t Num_Reconciliation_Cells = 51;
+
+		struct ReconciliationTestContext {
+		public:
+			ReconciliationTestContext(uint32_t numShortHashes, uint32_t maxReconciliationDifference)
+					: ShortHashes(UtSynchronizerTraits::CreateRequestRange(numShortHashes))
+					, Transactions(test::CreateTransactionEntityRange(3))
+					, RemoteApi(Transactions)
+					, NumConsumerCalls(0) {
+				Synchronizer = CreateUtSynchronizer(
+						[&shortHashes = ShortHashes]() { return model::ShortHashRange::CopyRange(shortHashes); },
+						maxReconciliationDifference,
+						[&numConsumerCalls = NumConsumerCalls, &consumedTransactions = ConsumedTransactions](auto&& range) {
+							++numConsumerCalls;
+							consumedTransactions = std::move(range.Range);
+						});
+			}
+
+		public:
+			model::ShortHashRange ShortHashes;
+			model::TransactionRange Transactions;
+			mocks::MockTransactionApi RemoteApi;
+			RemoteNodeSynchronizer<api::RemoteTransactionApi> Synchronizer;
+
+			size_t NumConsumerCalls;
+			model::TransactionRange ConsumedTransactions;
+		};
+
+		void AssertShortHashesIbltCells(const model::ShortHashRange& shortHashes, const model::ShortHashIbltCellRange& cells) {
+			utils::ShortHashIblt expectedShortHashesIblt(Num_Reconciliation_Cells);
+			for (auto shortHash : shortHashes)
+				expectedShortHashesIblt.insert(shortHash);
+
+			const auto& expectedCells = expectedShortHashesIblt.cells();
+			ASSERT_EQ(expectedCells.size(), cells.size());
+			EXPECT_TRUE(0 == std::memcmp(expectedCells.data(), cells.data(), expectedCells.size() * sizeof(utils::ShortHashIbltCell)));
+		}
+	}
+
+	TEST(TEST_CLASS, SynchronizerReconcilesShortHashesWhenTableIsSmallerThanShortHashes) {
+		// Arrange:
+		ReconciliationTestContext context(500, Max_Reconciliation_Difference);
+
+		// Act:
+		auto result = context.Synchronizer(context.RemoteApi).get();
+
+		// Assert: only a reconciliation request was made
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		ASSERT_EQ(1u, context.RemoteApi.utReconciliationRequests().size());
+		EXPECT_EQ(0u, context.RemoteApi.utRequests().size());
+		AssertShortHashesIbltCells(context.ShortHashes, context.RemoteApi.utReconciliationRequests()[0]);
+
+		EXPECT_EQ(1u, context.NumConsumerCalls);
+		test::AssertEqualRange(context.Transactions, context.ConsumedTransactions, "consumed transactions");
+	}
+
+	TEST(TEST_CLASS, SynchronizerFallsBackToShortHashesWhenReconciliationCannotBeDecoded) {
+		// Arrange:
+		ReconciliationTestContext context(500, Max_Reconciliation_Difference);
+		context.RemoteApi.setReconciliationDecoded(false);
+
+		// Act:
+		auto result = context.Synchronizer(context.RemoteApi).get();
+
+		// Assert: a reconciliation request was followed by a request with all short hashes
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		ASSERT_EQ(1u, context.RemoteApi.utReconciliationRequests().size());
+		ASSERT_EQ(1u, context.RemoteApi.utRequests().size());
+		AssertShortHashesIbltCells(context.ShortHashes, context.RemoteApi.utReconciliationRequests()[0]);
+		test::AssertEqualRange(context.ShortHashes, context.RemoteApi.utRequests()[0], "short hashes");
+
+		EXPECT_EQ(1u, context.NumConsumerCalls);
+		test::AssertEqualRange(context.Transactions, context.ConsumedTransactions, "consumed transactions");
+	}
+
+	TEST(TEST_CLASS, SynchronizerDoesNotFallBackToShortHashesWhenReconciliationFails) {
+		// Arrange:
+		ReconciliationTestContext context(500, Max_Reconciliation_Difference);
+		context.RemoteApi.setError(mocks::MockTransactionApi::EntryPoint::Reconcile_Unconfirmed_Transactions);
+
+		// Act:
+		auto result = context.Synchronizer(context.RemoteApi).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_EQ(1u, context.RemoteApi.utReconciliationRequests().size());
+		EXPECT_EQ(0u, context.RemoteApi.utRequests().size());
+		EXPECT_EQ(0u, context.NumConsumerCalls);
+	}
+
+	namespace {
+		void AssertShortHashesAreNotReconciled(uint32_t numShortHashes, uint32_t maxReconciliationDifference) {
+			// Arrange:
+			ReconciliationTestContext context(numShortHashes, maxReconciliationDifference);
+
+			// Act:
+			auto result = context.Synchronizer(context.RemoteApi).get();
+
+			// Assert: only a request with all short hashes was made
+			EXPECT_EQ(NodeInteractionResult::Success, result);
+			EXPECT_EQ(0u, context.RemoteApi.utReconciliationRequests().size());
+			ASSERT_EQ(1u, context.RemoteApi.utRequests().size());
+			test::AssertEqualRange(context.ShortHashes, context.RemoteApi.utRequests()[0], "short hashes");
+
+			EXPECT_EQ(1u, context.NumConsumerCalls);
+		}
+	}
+
+	TEST(TEST_CLASS, SynchronizerDoesNotReconcileShortHashesWhenTableIsNotSmallerThanShortHashes) {
+		// Assert: 153 short hashes * 4 bytes/short hash is equal to 51 cells * 12 bytes/cell
+		AssertShortHashesAreNotReconciled(100, Max_Reconciliation_Difference);
+		AssertShortHashesAreNotReconciled(153, Max_Reconciliation_Difference);
+	}
+
+	TEST(TEST_CLASS, SynchronizerDoesNotReconcileShortHashesWhenReconciliationIsDisabled) {
+		// Assert:
+		AssertShortHashesAreNotReconciled(500, 0);
+	}
+
+	// endregion
 }}
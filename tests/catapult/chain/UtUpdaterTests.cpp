@@ -115,7 +115,9 @@ namespace catapult { namespace chain {
 
 		class UpdaterTestContext {
 		public:
-			explicit UpdaterTestContext(ThrottleMode throttleMode = ThrottleMode::Off)
+			explicit UpdaterTestContext(
+					ThrottleMode throttleMode = ThrottleMode::Off,
+					UtUpdater::ChainUpdateMode chainUpdateMode = UtUpdater::ChainUpdateMode::Rebuild)
 					: m_cache(CreateCacheWithDefaultHeight())
 					, m_transactionsCache(cache::MemoryCacheOptions(1024, 1000))
 					, m_updater(
@@ -130,7 +132,8 @@ namespace catapult { namespace chain {
 							[this, throttleMode](const auto& transactionInfo, const auto& context) {
 								m_throttleParams.emplace_back(transactionInfo, context);
 								return ThrottleMode::Even == throttleMode && (0 == transactionInfo.pEntity->Deadline.unwrap() % 2);
-							})
+							},
+							chainUpdateMode)
 			{}
 
 		public:
@@ -146,6 +149,10 @@ namespace catapult { namespace chain {
 				m_executionConfig.pValidator->setResult(result, hash, id);
 			}
 
+			void setHeightValidationResult(ValidationResult result, const Hash256& hash, Height height) {
+				m_executionConfig.pValidator->setResult(result, hash, height);
+			}
+
 			void setPartialUndoFailureIndexes(const std::unordered_set<size_t>& partialUndoFailureIndexes) {
 				m_partialUndoFailureIndexes = partialUndoFailureIndexes;
 			}
@@ -172,6 +179,11 @@ namespace catapult { namespace chain {
 				m_cache.commit(Default_Height);
 			}
 
+			void commitCacheHeight(Height height) {
+				auto delta = m_cache.createDelta();
+				m_cache.commit(height);
+			}
+
 			// region assertContexts
 
 		private:
@@ -963,4 +975,257 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region update (block disruptor) - incremental
+
+	namespace {
+		constexpr auto Incremental_Mode = UtUpdater::ChainUpdateMode::Incremental;
+
+		std::vector<UtUpdater::TransactionSource> NoSources() {
+			return std::vector<UtUpdater::TransactionSource>();
+		}
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateRemovesConfirmedTransactionsAndReappliesRemainingTransactionsInPlace) {
+		// Arrange: initialize the UT cache with 6 transactions
+		UpdaterTestContext context(ThrottleMode::Off, Incremental_Mode);
+		auto originalTransactionData = CreateTransactionData(6);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - modify the catapult cache after creating the updater
+		context.seedDifficultyInfos(7);
+
+		// Act:
+		context.updater().update({ &originalHashes[2], &originalHashes[4] }, {});
+
+		// Assert: the cache contains the unconfirmed original transactions in the original order
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 1, 3, 5 }));
+		test::AssertDeadlines(context.transactionsCache(), { 0, 1, 9, 25 });
+
+		// - remaining entities were executed relative to the updated cache without being throttled
+		context.assertContexts(NoSources(), 7);
+		context.assertEntityInfos(Select(originalTransactionData.EntityInfos, { 0, 1, 3, 5 }));
+	}
+
+	NON_SUCCESS_VALIDATION_TRAITS_BASED_TEST(IncrementalUpdateRemovesTransactionsThatFailValidation) {
+		// Arrange: initialize the UT cache with 6 transactions
+		UpdaterTestContext context(ThrottleMode::Off, Incremental_Mode);
+		auto originalTransactionData = CreateTransactionData(6);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - set failures for 2 / 6 original entities
+		context.setValidationResult(TResult, originalHashes[1], 1);
+		context.setValidationResult(Modify(TResult), originalHashes[4], 1);
+
+		// Act:
+		context.updater().update({}, {});
+
+		// Assert:
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 2, 3, 5 }));
+		test::AssertDeadlines(context.transactionsCache(), { 0, 4, 9, 25 });
+
+		// - observer only gets called for entities that pass validation
+		//   E[0] V0,O1,V1,O2; E[1] V2; E[2] V2,O3,V3,O4; E[3] V4,O5,V5,O6; E[4] V6; E[5] V6,O7,V7,O8
+		context.assertContexts(NoSources(), { 0, 1, 2, 2, 3, 4, 5, 6, 6, 7 });
+		context.assertEntityInfos(
+				originalTransactionData.EntityInfos,
+				{ 0, 0, 1, 2, 2, 3, 3, 4, 5, 5 },
+				{ 0, 0, 2, 2, 3, 3, 5, 5 },
+				GetFailedIndexes(TResult, { { 1, TResult }, { 4, Modify(TResult) } }));
+	}
+
+	NON_SUCCESS_VALIDATION_TRAITS_BASED_TEST(IncrementalUpdateUndoesTransactionsThatPartiallyFailValidation) {
+		// Arrange: initialize the UT cache with 6 transactions
+		UpdaterTestContext context(ThrottleMode::Off, Incremental_Mode);
+		auto originalTransactionData = CreateTransactionData(6);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - set failures for 2 / 6 original entities
+		context.setValidationResult(Modify(TResult), originalHashes[1], 2);
+		context.setValidationResult(TResult, originalHashes[4], 2);
+
+		// Act:
+		context.updater().update({}, {});
+
+		// Assert:
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 2, 3, 5 }));
+
+		// - observer (rollback) gets called for entities that fail validation
+		//   E[0] V0,O1,V1,O2; E[1] V2,O3,V3;RO4 E[2] V4,O5,V5,O6; E[3] V6,O7,V7,O8; E[4] V8,O9,V9;RO10 E[5] V10,O11,V11,O12
+		context.setPartialUndoFailureIndexes({ 3, 9 });
+		context.assertContexts(NoSources());
+		context.assertEntityInfos(
+				originalTransactionData.EntityInfos,
+				GetFailedIndexes(TResult, { { 1, Modify(TResult) }, { 4, TResult } }));
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateRebuildsCacheWhenTransactionsAreReverted) {
+		// Arrange: initialize the UT cache with 6 transactions
+		UpdaterTestContext context(ThrottleMode::Off, Incremental_Mode);
+		auto originalTransactionData = CreateTransactionData(6);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - prepare 3 new transactions
+		auto transactionData = CreateTransactionData(3);
+
+		// Act:
+		context.updater().update({ &originalHashes[2], &originalHashes[4] }, transactionData.UtInfos);
+
+		// Assert: reverted transactions were added before the unconfirmed original transactions
+		EXPECT_EQ(7u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 1, 3, 5 }));
+		test::AssertContainsAll(context.transactionsCache(), transactionData.Hashes);
+		test::AssertDeadlines(context.transactionsCache(), { 0, 1, 4, 0, 1, 9, 25 });
+
+		context.assertContexts(CreateRevertedAndExistingSources(3, 4));
+
+		// - validator and observer only get called for entities that pass the filter
+		auto unconfirmedEntityInfos = ConcatContainers(
+				transactionData.EntityInfos,
+				Select(originalTransactionData.EntityInfos, { 0, 1, 3, 5 }));
+		context.assertEntityInfos(unconfirmedEntityInfos);
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateDoesNotAffectNewTransactionsUpdate) {
+		// Arrange: initialize the UT cache with 3 transactions
+		UpdaterTestContext context(ThrottleMode::Off, Incremental_Mode);
+		auto originalTransactionData = CreateTransactionData(3);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - prepare 4 new transactions
+		auto transactionData = CreateTransactionData(4, 3);
+
+		// Act:
+		context.updater().update(transactionData.UtInfos);
+
+		// Assert: only new transactions were executed
+		EXPECT_EQ(7u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+		test::AssertContainsAll(context.transactionsCache(), transactionData.Hashes);
+
+		context.assertContexts(UtUpdater::TransactionSource::New);
+		context.assertEntityInfos(transactionData.EntityInfos);
+	}
+
+	// endregion
+
+	// region update (block disruptor) - incremental revalidation
+
+	TEST(TEST_CLASS, IncrementalUpdateRevalidatesTransactionsThatBecomeInvalidAtNewHeight) {
+		// Arrange: initialize the UT cache with 4 transactions
+		UpdaterTestContext context(ThrottleMode::Off, Incremental_Mode);
+		auto originalTransactionData = CreateTransactionData(4);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - E[2] becomes invalid (e.g. because a mosaic it transfers expires) when validated at or above height 19
+		//   (neutral is used so that no transaction status is raised)
+		context.setHeightValidationResult(ValidationResult::Neutral, originalHashes[2], Default_Height + Height(2));
+
+		// Act: advance the chain by one block that confirms E[0]
+		context.commitCacheHeight(Default_Height + Height(1));
+		context.updater().update({ &originalHashes[0] }, {});
+
+		// Assert: E[2] was revalidated (relative to height 19) and dropped
+		EXPECT_EQ(2u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 1, 3 }));
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateRevalidatesAllTransactionsWhenChainHeightDecreases) {
+		// Arrange: initialize the UT cache with 4 transactions
+		UpdaterTestContext context(ThrottleMode::Off, Incremental_Mode);
+		auto originalTransactionData = CreateTransactionData(4);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - E[2] is invalid at all heights
+		context.setHeightValidationResult(ValidationResult::Neutral, originalHashes[2], Height(1));
+
+		// Act: roll back the chain by one block
+		context.commitCacheHeight(Default_Height - Height(1));
+		context.updater().update({}, {});
+
+		// Assert: E[2] was dropped
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 1, 3 }));
+	}
+
+	// endregion
+
+	// region update (block disruptor) - incremental notification caching
+
+	namespace {
+		void AssertNotificationsAreCached(const cache::MemoryUtCache& transactionsCache, bool expectedAreCached) {
+			auto view = transactionsCache.view();
+			view.forEach([expectedAreCached](const auto& utInfo) {
+				EXPECT_EQ(expectedAreCached, !!utInfo.OptionalNotifications);
+				return true;
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateCachesNotificationsOfAddedTransactions) {
+		// Arrange:
+		UpdaterTestContext context(ThrottleMode::Off, Incremental_Mode);
+		auto transactionData = CreateTransactionData(4);
+
+		// Act:
+		context.updater().update(transactionData.UtInfos);
+
+		// Assert: all transactions were published once and executed
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		context.assertEntityInfos(transactionData.EntityInfos);
+
+		// - notifications were cached with the transactions
+		AssertNotificationsAreCached(context.transactionsCache(), true);
+	}
+
+	TEST(TEST_CLASS, RebuildUpdateDoesNotCacheNotificationsOfAddedTransactions) {
+		// Arrange:
+		UpdaterTestContext context;
+		auto transactionData = CreateTransactionData(4);
+
+		// Act:
+		context.updater().update(transactionData.UtInfos);
+
+		// Assert:
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		context.assertEntityInfos(transactionData.EntityInfos);
+
+		AssertNotificationsAreCached(context.transactionsCache(), false);
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateReplaysCachedNotificationsOfExistingTransactions) {
+		// Arrange: add 4 transactions to the UT cache via the updater so that their notifications are cached
+		UpdaterTestContext context(ThrottleMode::Off, Incremental_Mode);
+		auto transactionData = CreateTransactionData(4);
+		context.updater().update(transactionData.UtInfos);
+
+		// - E[1] fails revalidation
+		context.setValidationResult(ValidationResult::Neutral, transactionData.Hashes[1], 1);
+
+		// Act:
+		context.updater().update({ &transactionData.Hashes[3] }, {});
+
+		// Assert: the confirmed and failed transactions were removed
+		EXPECT_EQ(2u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, { 0, 2 }));
+
+		// - transactions were only published when added but were revalidated and reobserved by replaying their notifications
+		//   add: E[0] V0,O0,V1,O1; E[1] V2,O2,V3,O3; E[2] V4,O4,V5,O5; E[3] V6,O6,V7,O7
+		//   reapply: E[0] V8,O8,V9,O9; E[1] V10; E[2] V11,O10,V12,O11
+		context.assertEntityInfos(
+				transactionData.EntityInfos,
+				{ 0, 0, 1, 1, 2, 2, 3, 3, 0, 0, 1, 2, 2 },
+				{ 0, 0, 1, 1, 2, 2, 3, 3, 0, 0, 2, 2 });
+	}
+
+	// endregion
 }}
@@ -23,6 +23,7 @@
 #include "catapult/utils/TimeSpan.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/HashTestUtils.h"
+#include <iterator>
 #include <map>
 #include <thread>
 
@@ -35,6 +36,8 @@ namespace catapult { namespace mocks {
 		enum class EntryPoint {
 			Chain_Info,
 			Hashes_From,
+			Hashes_At,
+			Block_Headers_From,
 			Last_Block,
 			Block_At,
 			Blocks_From,
@@ -47,6 +50,7 @@ namespace catapult { namespace mocks {
 				: m_score(score)
 				, m_errorEntryPoint(EntryPoint::None)
 				, m_hashes(model::HashRange::CopyRange(hashes))
+				, m_hashesStartHeight(0)
 				, m_numBlocksPerBlocksFromRequest({ 2 }) {
 			m_blocks.emplace(Height(0), std::move(pLastBlock));
 		}
@@ -80,11 +84,24 @@ namespace catapult { namespace mocks {
 		}
 
 		/// Adds a block (\a pBlock) to the block map.
+		/// \note Added blocks are returned by blocks-from requests in place of generated blocks at the same height.
 		void addBlock(std::unique_ptr<model::Block>&& pBlock) {
 			auto height = pBlock->Height;
 			m_blocks.emplace(height, std::move(pBlock));
 		}
 
+		/// Sets the height of the first configured hash to \a height.
+		/// \note This is used to map requested heights to configured hashes in hashes-at requests.
+		///       If unset, the first configured hash is mapped to the first height of the first hashes-at request.
+		void setHashesStartHeight(Height height) {
+			m_hashesStartHeight = height;
+		}
+
+		/// Sets the block \a headers to return from block-headers-from requests.
+		void setBlockHeaders(const model::BlockHeaderRange& headers) {
+			m_blockHeaders = model::BlockHeaderRange::CopyRange(headers);
+		}
+
 		/// Returns the vector of heights that were passed to the block-at requests.
 		const std::vector<Height>& blockAtRequests() const {
 			return m_blockAtRequests;
@@ -95,6 +112,16 @@ namespace catapult { namespace mocks {
 			return m_hashesFromRequests;
 		}
 
+		/// Returns the vector of heights that were passed to the hashes-at requests.
+		const std::vector<std::vector<Height>>& hashesAtRequests() const {
+			return m_hashesAtRequests;
+		}
+
+		/// Returns the vector of height/max-block-headers pairs that were passed to the block-headers-from requests.
+		const std::vector<std::pair<Height, uint32_t>>& blockHeadersFromRequests() const {
+			return m_blockHeadersFromRequests;
+		}
+
 		/// Returns the vector of height/blocks-from-options pairs that were passed to the blocks-from requests.
 		const std::vector<std::pair<Height, const api::BlocksFromOptions>>& blocksFromRequests() const {
 			return m_blocksFromRequests;
@@ -132,6 +159,61 @@ namespace catapult { namespace mocks {
 			return CreateFutureResponse(model::HashRange::CopyRange(m_hashes));
 		}
 
+		/// Returns the configured hashes at \a heights and throws if the error entry point is set to Hashes_At.
+		/// \note The \a heights parameter is captured.
+		thread::future<model::HashRange> hashesAt(model::HeightRange&& heights) const override {
+			m_hashesAtRequests.emplace_back(heights.cbegin(), heights.cend());
+			if (shouldRaiseException(EntryPoint::Hashes_At))
+				return CreateFutureException<model::HashRange>("hashes at error has been set");
+
+			if (Height(0) == m_hashesStartHeight && !heights.empty())
+				m_hashesStartHeight = *heights.cbegin();
+
+			// only return hashes for the longest prefix of increasing heights that have configured hashes
+			std::vector<Hash256> hashes;
+			Height previousHeight;
+			auto endHeight = m_hashesStartHeight + Height(m_hashes.size());
+			for (auto height : heights) {
+				if (height <= previousHeight || height < m_hashesStartHeight || height >= endHeight)
+					break;
+
+				auto hashIter = m_hashes.cbegin();
+				std::advance(hashIter, (height - m_hashesStartHeight).unwrap());
+				hashes.push_back(*hashIter);
+				previousHeight = height;
+			}
+
+			auto range = hashes.empty()
+					? model::HashRange()
+					: model::HashRange::CopyFixed(reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size());
+			return CreateFutureResponse(std::move(range));
+		}
+
+		/// Returns at most \a maxBlockHeaders configured block headers starting at \a height and throws if the error entry point
+		/// is set to Block_Headers_From.
+		/// \note The \a height and \a maxBlockHeaders parameters are captured.
+		thread::future<model::BlockHeaderRange> blockHeadersFrom(Height height, uint32_t maxBlockHeaders) const override {
+			m_blockHeadersFromRequests.push_back(std::make_pair(height, maxBlockHeaders));
+			if (shouldRaiseException(EntryPoint::Block_Headers_From))
+				return CreateFutureException<model::BlockHeaderRange>("block headers from error has been set");
+
+			std::vector<uint8_t> buffer;
+			auto numBlockHeaders = 0u;
+			for (const auto& header : m_blockHeaders) {
+				if (header.Height < height || numBlockHeaders == maxBlockHeaders)
+					continue;
+
+				const auto* pHeaderData = reinterpret_cast<const uint8_t*>(&header);
+				buffer.insert(buffer.end(), pHeaderData, pHeaderData + sizeof(model::BlockHeader));
+				++numBlockHeaders;
+			}
+
+			auto range = 0 == numBlockHeaders
+					? model::BlockHeaderRange()
+					: model::BlockHeaderRange::CopyFixed(buffer.data(), numBlockHeaders);
+			return CreateFutureResponse(std::move(range));
+		}
+
 		/// Returns the configured last block and throws if the error entry point is set to Last_Block.
 		thread::future<std::shared_ptr<const model::Block>> blockLast() const override {
 			if (shouldRaiseException(EntryPoint::Last_Block))
@@ -185,7 +267,9 @@ namespace catapult { namespace mocks {
 			std::vector<std::unique_ptr<const model::Block>> blocks;
 			std::vector<const model::Block*> rawBlocks;
 			for (auto i = 0u; i < numBlocks; ++i) {
-				blocks.push_back(test::GenerateVerifiableBlockAtHeight(startHeight + Height(i)));
+				auto height = startHeight + Height(i);
+				auto iter = m_blocks.find(height);
+				blocks.push_back(m_blocks.cend() == iter ? test::GenerateVerifiableBlockAtHeight(height) : test::CopyBlock(*iter->second));
 				rawBlocks.push_back(blocks[i].get());
 			}
 
@@ -212,10 +296,14 @@ namespace catapult { namespace mocks {
 		model::ChainScore m_score;
 		EntryPoint m_errorEntryPoint;
 		model::HashRange m_hashes;
+		mutable Height m_hashesStartHeight;
 		std::map<Height, std::shared_ptr<model::Block>> m_blocks;
+		model::BlockHeaderRange m_blockHeaders;
 
 		mutable std::vector<Height> m_blockAtRequests;
 		mutable std::vector<Height> m_hashesFromRequests;
+		mutable std::vector<std::vector<Height>> m_hashesAtRequests;
+		mutable std::vector<std::pair<Height, uint32_t>> m_blockHeadersFromRequests;
 		mutable std::vector<std::pair<Height, const api::BlocksFromOptions>> m_blocksFromRequests;
 		mutable std::list<uint32_t> m_numBlocksPerBlocksFromRequest;
 
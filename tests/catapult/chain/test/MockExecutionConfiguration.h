@@ -22,6 +22,7 @@
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache_core/BlockDifficultyCache.h"
 #include "catapult/chain/ExecutionConfiguration.h"
+#include "catapult/model/NotificationBuffer.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/model/NotificationSubscriber.h"
 #include "catapult/utils/Hashers.h"
@@ -66,6 +67,12 @@ namespace catapult { namespace test {
 	class MockNotificationPublisher : public model::NotificationPublisher, public test::ParamsCapture<PublisherParams> {
 	public:
 		void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& subscriber) const override {
+			// replay previously published notifications like the real (PublicationMode::All) publisher
+			if (entityInfo.notifications()) {
+				entityInfo.notifications()->replay(subscriber);
+				return;
+			}
+
 			const_cast<MockNotificationPublisher*>(this)->push(entityInfo);
 			subscriber.notify(MockNotification(entityInfo.hash(), 1));
 			subscriber.notify(MockNotification(entityInfo.hash(), 2));
@@ -175,6 +182,11 @@ namespace catapult { namespace test {
 			// - determine the result based on the call count
 			auto result = ++m_numValidateCalls < m_validateTrigger ? validators::ValidationResult::Success : m_result;
 
+			// - determine the result based on the hash and height
+			auto heightResultIter = m_hashHeightResults.find(mockNotification.Hash);
+			if (m_hashHeightResults.cend() != heightResultIter && context.Height >= heightResultIter->second.first)
+				return heightResultIter->second.second;
+
 			// - determine the result based on the hash
 			auto resultIter = m_hashResults.find(mockNotification.Hash);
 			auto idTriggerIter = m_hashIdTriggers.find(mockNotification.Hash);
@@ -194,6 +206,11 @@ namespace catapult { namespace test {
 			m_hashIdTriggers.emplace(hash, id);
 		}
 
+		/// Sets the result of validate for \a hash at or above \a height to \a result.
+		void setResult(validators::ValidationResult result, const Hash256& hash, Height height) {
+			m_hashHeightResults.emplace(hash, std::make_pair(height, result));
+		}
+
 	private:
 		std::string m_name;
 		validators::ValidationResult m_result;
@@ -201,6 +218,7 @@ namespace catapult { namespace test {
 		size_t m_validateTrigger;
 		std::unordered_map<Hash256, validators::ValidationResult, utils::ArrayHasher<Hash256>> m_hashResults;
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> m_hashIdTriggers;
+		std::unordered_map<Hash256, std::pair<Height, validators::ValidationResult>, utils::ArrayHasher<Hash256>> m_hashHeightResults;
 	};
 
 	// endregion
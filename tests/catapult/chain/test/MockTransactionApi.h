@@ -29,7 +29,8 @@ namespace catapult { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Unconfirmed_Transactions
+			Unconfirmed_Transactions,
+			Reconcile_Unconfirmed_Transactions
 		};
 
 	public:
@@ -37,6 +38,7 @@ namespace catapult { namespace mocks {
 		explicit MockTransactionApi(const model::TransactionRange& transactions)
 				: m_transactions(model::TransactionRange::CopyRange(transactions))
 				, m_errorEntryPoint(EntryPoint::None)
+				, m_isReconciliationDecoded(true)
 		{}
 
 	public:
@@ -45,11 +47,21 @@ namespace catapult { namespace mocks {
 			m_errorEntryPoint = entryPoint;
 		}
 
+		/// Sets the reconciliation decoding result to \a isDecoded.
+		void setReconciliationDecoded(bool isDecoded) {
+			m_isReconciliationDecoded = isDecoded;
+		}
+
 		/// Returns the vector of short hash ranges that were passed to the unconfirmed transactions requests.
 		const std::vector<model::ShortHashRange>& utRequests() const {
 			return m_utRequests;
 		}
 
+		/// Returns the vector of iblt cell ranges that were passed to the reconcile unconfirmed transactions requests.
+		const std::vector<model::ShortHashIbltCellRange>& utReconciliationRequests() const {
+			return m_utReconciliationRequests;
+		}
+
 	public:
 		/// Returns the configured unconfirmed transactions and throws if the error entry point is set to Unconfirmed_Transactions.
 		/// \note The \a knownShortHashes parameter is captured.
@@ -61,6 +73,24 @@ namespace catapult { namespace mocks {
 			return thread::make_ready_future(model::TransactionRange::CopyRange(m_transactions));
 		}
 
+		/// Returns the configured unconfirmed transactions when reconciliation is decoded and throws if the error entry point
+		/// is set to Reconcile_Unconfirmed_Transactions.
+		/// \note The \a knownShortHashesIbltCells parameter is captured.
+		thread::future<api::UnconfirmedTransactionsReconciliationResult> reconcileUnconfirmedTransactions(
+				model::ShortHashIbltCellRange&& knownShortHashesIbltCells) const override {
+			using ResultType = api::UnconfirmedTransactionsReconciliationResult;
+			m_utReconciliationRequests.push_back(std::move(knownShortHashesIbltCells));
+			if (shouldRaiseException(EntryPoint::Reconcile_Unconfirmed_Transactions))
+				return CreateFutureException<ResultType>("reconcile unconfirmed transactions error has been set");
+
+			ResultType result;
+			result.IsDecoded = m_isReconciliationDecoded;
+			if (m_isReconciliationDecoded)
+				result.Transactions = model::TransactionRange::CopyRange(m_transactions);
+
+			return thread::make_ready_future(std::move(result));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -74,6 +104,8 @@ namespace catapult { namespace mocks {
 	private:
 		model::TransactionRange m_transactions;
 		EntryPoint m_errorEntryPoint;
+		bool m_isReconciliationDecoded;
 		mutable std::vector<model::ShortHashRange> m_utRequests;
+		mutable std::vector<model::ShortHashIbltCellRange> m_utReconciliationRequests;
 	};
 }}
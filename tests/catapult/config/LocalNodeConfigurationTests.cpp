@@ -78,6 +78,10 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(400u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(1u, config.MaxPeersPerSyncAttempt);
+			EXPECT_FALSE(config.ShouldSyncBlockHeadersFirst);
+			EXPECT_FALSE(config.ShouldSampleChainHashes);
+			EXPECT_FALSE(config.ShouldPushCompactBlocks);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -86,13 +90,23 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(1'000'000u, config.UnconfirmedTransactionsCacheMaxSize);
+			EXPECT_FALSE(config.ShouldUpdateUnconfirmedTransactionsIncrementally);
+			EXPECT_EQ(0u, config.UnconfirmedTransactionsReconciliationMaxDifference);
 
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
+			EXPECT_EQ(utils::TimeSpan::FromSeconds(0), config.MultiplexedRequestTimeout);
 
 			EXPECT_EQ(utils::FileSize::FromKilobytes(512), config.SocketWorkingBufferSize);
 			EXPECT_EQ(100u, config.SocketWorkingBufferSensitivity);
+			EXPECT_EQ(0u, config.SocketWorkingBufferPoolSize);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(150), config.MaxPacketDataSize);
+			EXPECT_EQ(utils::FileSize::FromBytes(0), config.SocketMaxCoalescedWriteSize);
+			EXPECT_EQ(utils::FileSize::FromBytes(0), config.PacketCompressionThreshold);
+
+			EXPECT_EQ(50'000u, config.BroadcastKnownInventorySize);
+			EXPECT_EQ(0u, config.MaxBroadcastFanout);
+			EXPECT_EQ(utils::TimeSpan::FromMilliseconds(500), config.BroadcastTrickleInterval);
 
 			EXPECT_EQ(4096u, config.BlockDisruptorSize);
 			EXPECT_EQ(1u, config.BlockElementTraceInterval);
@@ -102,6 +116,12 @@ namespace catapult { namespace config {
 			EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 			EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
 			EXPECT_FALSE(config.ShouldPrecomputeTransactionAddresses);
+			EXPECT_FALSE(config.ShouldPrecomputeTransactionNotifications);
+
+			EXPECT_EQ(utils::CpuSet(), config.ThreadPoolCpuAffinity);
+			EXPECT_EQ(utils::CpuSet(), config.ValidatorPoolCpuAffinity);
+			EXPECT_EQ(utils::CpuSet(), config.BlockDispatcherCpuAffinity);
+			EXPECT_EQ(utils::CpuSet(), config.TransactionDispatcherCpuAffinity);
 
 			EXPECT_EQ(ionet::ConnectionSecurityMode::None, config.OutgoingSecurityMode);
 			EXPECT_EQ(ionet::ConnectionSecurityMode::None, config.IncomingSecurityModes);
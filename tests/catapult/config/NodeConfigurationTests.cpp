@@ -44,6 +44,10 @@ namespace catapult { namespace config {
 
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxPeersPerSyncAttempt", "4" },
+							{ "shouldSyncBlockHeadersFirst", "true" },
+							{ "shouldSampleChainHashes", "true" },
+							{ "shouldPushCompactBlocks", "true" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -52,13 +56,23 @@ namespace catapult { namespace config {
 
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98'763" },
+							{ "shouldUpdateUnconfirmedTransactionsIncrementally", "true" },
+							{ "unconfirmedTransactionsReconciliationMaxDifference", "321" },
 
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
+							{ "multiplexedRequestTimeout", "12s" },
 
 							{ "socketWorkingBufferSize", "128KB" },
 							{ "socketWorkingBufferSensitivity", "6225" },
+							{ "socketWorkingBufferPoolSize", "48" },
 							{ "maxPacketDataSize", "10MB" },
+							{ "socketMaxCoalescedWriteSize", "3KB" },
+							{ "packetCompressionThreshold", "7KB" },
+
+							{ "broadcastKnownInventorySize", "1234" },
+							{ "maxBroadcastFanout", "5" },
+							{ "broadcastTrickleInterval", "250ms" },
 
 							{ "blockDisruptorSize", "1000" },
 							{ "blockElementTraceInterval", "34" },
@@ -68,6 +82,12 @@ namespace catapult { namespace config {
 							{ "shouldAbortWhenDispatcherIsFull", "true" },
 							{ "shouldAuditDispatcherInputs", "true" },
 							{ "shouldPrecomputeTransactionAddresses", "true" },
+							{ "shouldPrecomputeTransactionNotifications", "true" },
+
+							{ "threadPoolCpuAffinity", "0-3" },
+							{ "validatorPoolCpuAffinity", "4-5,8" },
+							{ "blockDispatcherCpuAffinity", "6" },
+							{ "transactionDispatcherCpuAffinity", "7,9" },
 
 							{ "outgoingSecurityMode", "Signed" },
 							{ "incomingSecurityModes", "None, Signed" }
@@ -125,6 +145,10 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxPeersPerSyncAttempt);
+				EXPECT_FALSE(config.ShouldSyncBlockHeadersFirst);
+				EXPECT_FALSE(config.ShouldSampleChainHashes);
+				EXPECT_FALSE(config.ShouldPushCompactBlocks);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -133,13 +157,23 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(0u, config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_FALSE(config.ShouldUpdateUnconfirmedTransactionsIncrementally);
+				EXPECT_EQ(0u, config.UnconfirmedTransactionsReconciliationMaxDifference);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
+				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.MultiplexedRequestTimeout);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.SocketWorkingBufferSize);
 				EXPECT_EQ(0u, config.SocketWorkingBufferSensitivity);
+				EXPECT_EQ(0u, config.SocketWorkingBufferPoolSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxPacketDataSize);
+				EXPECT_EQ(utils::FileSize::FromBytes(0), config.SocketMaxCoalescedWriteSize);
+				EXPECT_EQ(utils::FileSize::FromBytes(0), config.PacketCompressionThreshold);
+
+				EXPECT_EQ(0u, config.BroadcastKnownInventorySize);
+				EXPECT_EQ(0u, config.MaxBroadcastFanout);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(0), config.BroadcastTrickleInterval);
 
 				EXPECT_EQ(0u, config.BlockDisruptorSize);
 				EXPECT_EQ(0u, config.BlockElementTraceInterval);
@@ -149,6 +183,12 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
 				EXPECT_FALSE(config.ShouldPrecomputeTransactionAddresses);
+				EXPECT_FALSE(config.ShouldPrecomputeTransactionNotifications);
+
+				EXPECT_EQ(utils::CpuSet(), config.ThreadPoolCpuAffinity);
+				EXPECT_EQ(utils::CpuSet(), config.ValidatorPoolCpuAffinity);
+				EXPECT_EQ(utils::CpuSet(), config.BlockDispatcherCpuAffinity);
+				EXPECT_EQ(utils::CpuSet(), config.TransactionDispatcherCpuAffinity);
 
 				EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(0), config.OutgoingSecurityMode);
 				EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(0), config.IncomingSecurityModes);
@@ -181,6 +221,10 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(4u, config.MaxPeersPerSyncAttempt);
+				EXPECT_TRUE(config.ShouldSyncBlockHeadersFirst);
+				EXPECT_TRUE(config.ShouldSampleChainHashes);
+				EXPECT_TRUE(config.ShouldPushCompactBlocks);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -189,13 +233,23 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(98'763u, config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_TRUE(config.ShouldUpdateUnconfirmedTransactionsIncrementally);
+				EXPECT_EQ(321u, config.UnconfirmedTransactionsReconciliationMaxDifference);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
+				EXPECT_EQ(utils::TimeSpan::FromSeconds(12), config.MultiplexedRequestTimeout);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(128), config.SocketWorkingBufferSize);
 				EXPECT_EQ(6225u, config.SocketWorkingBufferSensitivity);
+				EXPECT_EQ(48u, config.SocketWorkingBufferPoolSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(10), config.MaxPacketDataSize);
+				EXPECT_EQ(utils::FileSize::FromKilobytes(3), config.SocketMaxCoalescedWriteSize);
+				EXPECT_EQ(utils::FileSize::FromKilobytes(7), config.PacketCompressionThreshold);
+
+				EXPECT_EQ(1234u, config.BroadcastKnownInventorySize);
+				EXPECT_EQ(5u, config.MaxBroadcastFanout);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(250), config.BroadcastTrickleInterval);
 
 				EXPECT_EQ(1000u, config.BlockDisruptorSize);
 				EXPECT_EQ(34u, config.BlockElementTraceInterval);
@@ -205,6 +259,12 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_TRUE(config.ShouldAuditDispatcherInputs);
 				EXPECT_TRUE(config.ShouldPrecomputeTransactionAddresses);
+				EXPECT_TRUE(config.ShouldPrecomputeTransactionNotifications);
+
+				EXPECT_EQ(utils::CpuSet({ 0, 1, 2, 3 }), config.ThreadPoolCpuAffinity);
+				EXPECT_EQ(utils::CpuSet({ 4, 5, 8 }), config.ValidatorPoolCpuAffinity);
+				EXPECT_EQ(utils::CpuSet({ 6 }), config.BlockDispatcherCpuAffinity);
+				EXPECT_EQ(utils::CpuSet({ 7, 9 }), config.TransactionDispatcherCpuAffinity);
 
 				EXPECT_EQ(ionet::ConnectionSecurityMode::Signed, config.OutgoingSecurityMode);
 				EXPECT_EQ(ionet::ConnectionSecurityMode::None | ionet::ConnectionSecurityMode::Signed, config.IncomingSecurityModes);
@@ -21,8 +21,10 @@
 #include "catapult/consumers/BlockConsumers.h"
 #include "catapult/consumers/TransactionConsumers.h"
 #include "catapult/model/Address.h"
+#include "catapult/model/NotificationBuffer.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/mocks/MockNotificationPublisher.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/TestHarness.h"
 
@@ -147,5 +149,31 @@ namespace catapult { namespace consumers {
 		AssertTransactionAddressesAreExtractedCorrectly(3);
 	}
 
+	TEST(TRANSACTION_TEST_CLASS, CanProcessEntitiesWithPrecomputedNotifications) {
+		// Arrange:
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto pBasicPublisher = model::CreateNotificationPublisher(registry, model::PublicationMode::Basic);
+		auto input = test::CreateTransactionElements(3);
+		for (auto& transactionElement : input) {
+			transactionElement.OptionalNotifications = std::make_shared<model::TransactionNotifications>(
+					transactionElement.Transaction,
+					transactionElement.EntityHash,
+					*pBasicPublisher);
+		}
+
+		mocks::MockNotificationPublisher publisher;
+
+		// Act:
+		auto result = CreateTransactionAddressExtractionConsumer(publisher)(input);
+
+		// Assert: addresses were extracted from the precomputed notifications without republishing
+		test::AssertContinued(result);
+		EXPECT_EQ(0u, publisher.numPublishCalls());
+
+		auto i = 0u;
+		for (const auto& transactionElement : input)
+			AssertExtractedAddress(transactionElement, i++);
+	}
+
 	// endregion
 }}
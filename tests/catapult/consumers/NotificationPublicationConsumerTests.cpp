@@ -0,0 +1,158 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/consumers/BlockConsumers.h"
+#include "catapult/consumers/TransactionConsumers.h"
+#include "catapult/model/NotificationBuffer.h"
+#include "tests/catapult/consumers/test/ConsumerTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/mocks/MockNotificationSubscriber.h"
+#include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace consumers {
+
+#define BLOCK_TEST_CLASS BlockNotificationPublicationConsumerTests
+#define TRANSACTION_TEST_CLASS TransactionNotificationPublicationConsumerTests
+
+	namespace {
+		void AssertPublishedNotifications(const model::TransactionElement& transactionElement, size_t id) {
+			auto message = "transaction at " + std::to_string(id);
+			const auto& pNotifications = transactionElement.OptionalNotifications;
+			ASSERT_TRUE(!!pNotifications) << message;
+			EXPECT_EQ(&transactionElement.Transaction, &pNotifications->transaction()) << message;
+			EXPECT_EQ(transactionElement.EntityHash, pNotifications->hash()) << message;
+
+			// - basic publisher raises 4 notifications per transaction
+			mocks::MockNotificationSubscriber sub;
+			pNotifications->replay(sub);
+			ASSERT_EQ(4u, sub.numNotifications()) << message;
+			EXPECT_EQ(model::Core_Register_Account_Public_Key_Notification, sub.notificationTypes()[0]) << message;
+			EXPECT_EQ(model::Core_Entity_Notification, sub.notificationTypes()[1]) << message;
+			EXPECT_EQ(model::Core_Transaction_Notification, sub.notificationTypes()[2]) << message;
+			EXPECT_EQ(model::Core_Signature_Notification, sub.notificationTypes()[3]) << message;
+		}
+	}
+
+	// region block
+
+	namespace {
+		void AssertBlockNotificationsArePublishedCorrectly(uint32_t numBlocks, uint32_t numTransactionsPerBlock) {
+			// Arrange:
+			std::vector<std::shared_ptr<const model::Block>> blocks;
+			std::vector<const model::Block*> rawBlocks;
+			for (auto i = 0u; i < numBlocks; ++i) {
+				blocks.push_back(test::GenerateBlockWithTransactionsAtHeight(numTransactionsPerBlock, 10 + i));
+				rawBlocks.push_back(blocks.back().get());
+			}
+
+			auto registry = mocks::CreateDefaultTransactionRegistry();
+			auto pPublisher = model::CreateNotificationPublisher(registry, model::PublicationMode::Basic);
+			auto input = test::CreateBlockElements(rawBlocks);
+
+			// Act:
+			auto result = CreateBlockNotificationPublicationConsumer(*pPublisher)(input);
+
+			// Assert:
+			test::AssertContinued(result);
+
+			auto i = 0u;
+			for (const auto& element : input) {
+				for (const auto& transactionElement : element.Transactions)
+					AssertPublishedNotifications(transactionElement, i++);
+			}
+
+			// Sanity:
+			EXPECT_EQ(numBlocks * numTransactionsPerBlock, i);
+		}
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessZeroEntities) {
+		// Assert:
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto pPublisher = model::CreateNotificationPublisher(registry, model::PublicationMode::Basic);
+		test::AssertPassthroughForEmptyInput(CreateBlockNotificationPublicationConsumer(*pPublisher));
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessSingleEntity) {
+		// Assert:
+		AssertBlockNotificationsArePublishedCorrectly(1, 0);
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessSingleEntityWithTransactions) {
+		// Assert:
+		AssertBlockNotificationsArePublishedCorrectly(1, 3);
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntities) {
+		// Assert:
+		AssertBlockNotificationsArePublishedCorrectly(3, 0);
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntitiesWithTransactions) {
+		// Assert:
+		AssertBlockNotificationsArePublishedCorrectly(3, 4);
+	}
+
+	// endregion
+
+	// region transaction
+
+	namespace {
+		void AssertTransactionNotificationsArePublishedCorrectly(uint32_t numTransactions) {
+			// Arrange:
+			auto registry = mocks::CreateDefaultTransactionRegistry();
+			auto pPublisher = model::CreateNotificationPublisher(registry, model::PublicationMode::Basic);
+			auto input = test::CreateTransactionElements(numTransactions);
+
+			// Act:
+			auto result = CreateTransactionNotificationPublicationConsumer(*pPublisher)(input);
+
+			// Assert:
+			test::AssertContinued(result);
+
+			auto i = 0u;
+			for (const auto& transactionElement : input)
+				AssertPublishedNotifications(transactionElement, i++);
+
+			// Sanity:
+			EXPECT_EQ(numTransactions, i);
+		}
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessZeroEntities) {
+		// Assert:
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto pPublisher = model::CreateNotificationPublisher(registry, model::PublicationMode::Basic);
+		test::AssertPassthroughForEmptyInput(CreateTransactionNotificationPublicationConsumer(*pPublisher));
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessSingleEntity) {
+		// Assert:
+		AssertTransactionNotificationsArePublishedCorrectly(1);
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessMultipleEntities) {
+		// Assert:
+		AssertTransactionNotificationsArePublishedCorrectly(3);
+	}
+
+	// endregion
+}}
@@ -95,7 +95,7 @@ namespace catapult { namespace consumers {
 				// - invoke all sub validators once but ignore their results
 				//   (this emulates the real dispatcher delegating to the validationFunctions)
 				for (const auto& validationFunction : validationFunctions)
-					validationFunction(entityInfos.front());
+					validationFunction(entityInfos.front(), validators::CancellationToken());
 
 				// - determine the result based on the call count
 				auto result = ++m_numValidateCalls < m_validateTrigger ? defaultResult : m_result;
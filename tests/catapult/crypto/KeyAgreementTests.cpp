@@ -0,0 +1,105 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/KeyAgreement.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS KeyAgreementTests
+
+	namespace {
+		KeyPair GenerateKeyPair() {
+			return KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte));
+		}
+
+		void AssertCannotDeriveSharedSecret(const Key& otherPublicKey) {
+			// Arrange:
+			auto keyPair = GenerateKeyPair();
+
+			// Act:
+			Key sharedSecret;
+			auto result = TryDeriveSharedSecret(keyPair, otherPublicKey, sharedSecret);
+
+			// Assert:
+			EXPECT_FALSE(result);
+		}
+	}
+
+	TEST(TEST_CLASS, CanDeriveSharedSecretFromKnownKeys) {
+		// Arrange:
+		auto keyPair = KeyPair::FromString("CBD84EF8F5F38A25C01308785EA99627DE897D151AFDFCDA7AB07EFD8ED98534");
+		auto otherPublicKey = test::ToArray<Key_Size>("FA9E859ECF0A2F1DB4BE02B10A41D8FA79A4B3D626BB52A3129ECF9CA73B18F3");
+
+		// Act:
+		Key sharedSecret;
+		auto result = TryDeriveSharedSecret(keyPair, otherPublicKey, sharedSecret);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(test::ToArray<Key_Size>("69CA736051235D0DE4BBB1A13ED20788623962D6CE50C1DC87242E13D8674A6A"), sharedSecret);
+	}
+
+	TEST(TEST_CLASS, BothPartiesDeriveSameSharedSecret) {
+		// Arrange:
+		auto keyPair1 = GenerateKeyPair();
+		auto keyPair2 = GenerateKeyPair();
+
+		// Act:
+		Key sharedSecret1;
+		auto result1 = TryDeriveSharedSecret(keyPair1, keyPair2.publicKey(), sharedSecret1);
+
+		Key sharedSecret2;
+		auto result2 = TryDeriveSharedSecret(keyPair2, keyPair1.publicKey(), sharedSecret2);
+
+		// Assert:
+		EXPECT_TRUE(result1);
+		EXPECT_TRUE(result2);
+		EXPECT_EQ(sharedSecret1, sharedSecret2);
+	}
+
+	TEST(TEST_CLASS, DifferentPartiesDeriveDifferentSharedSecrets) {
+		// Arrange:
+		auto keyPair = GenerateKeyPair();
+		auto otherKeyPair1 = GenerateKeyPair();
+		auto otherKeyPair2 = GenerateKeyPair();
+
+		// Act:
+		Key sharedSecret1;
+		TryDeriveSharedSecret(keyPair, otherKeyPair1.publicKey(), sharedSecret1);
+
+		Key sharedSecret2;
+		TryDeriveSharedSecret(keyPair, otherKeyPair2.publicKey(), sharedSecret2);
+
+		// Assert:
+		EXPECT_NE(sharedSecret1, sharedSecret2);
+	}
+
+	TEST(TEST_CLASS, CannotDeriveSharedSecretFromPublicKeyNotOnCurve) {
+		// Assert: y = 2 does not correspond to any curve point
+		AssertCannotDeriveSharedSecret(test::ToArray<Key_Size>("0200000000000000000000000000000000000000000000000000000000000000"));
+	}
+
+	TEST(TEST_CLASS, CannotDeriveSharedSecretFromLowOrderPublicKey) {
+		// Assert: neutral element (y = 1) and point of order two (y = -1)
+		AssertCannotDeriveSharedSecret(test::ToArray<Key_Size>("0100000000000000000000000000000000000000000000000000000000000000"));
+		AssertCannotDeriveSharedSecret(test::ToArray<Key_Size>("ECFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7F"));
+	}
+}}
@@ -31,7 +31,7 @@ namespace catapult { namespace disruptor {
 #define TEST_CLASS ConsumerDispatcherTests
 
 	namespace {
-		static constexpr ConsumerDispatcherOptions Test_Dispatcher_Options{ "ConsumerDispatcherTests", 16u * 1024 };
+		const ConsumerDispatcherOptions Test_Dispatcher_Options{ "ConsumerDispatcherTests", 16u * 1024 };
 
 		auto CreateNoOpConsumer() {
 			return [](const auto&) {
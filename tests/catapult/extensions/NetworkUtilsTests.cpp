@@ -35,9 +35,15 @@ namespace catapult { namespace extensions {
 
 			auto nodeConfig = config::NodeConfiguration::Uninitialized();
 			nodeConfig.ConnectTimeout = utils::TimeSpan::FromSeconds(11);
+			nodeConfig.MultiplexedRequestTimeout = utils::TimeSpan::FromSeconds(4);
 			nodeConfig.SocketWorkingBufferSize = utils::FileSize::FromBytes(512);
 			nodeConfig.SocketWorkingBufferSensitivity = 987;
 			nodeConfig.MaxPacketDataSize = utils::FileSize::FromKilobytes(12);
+			nodeConfig.SocketMaxCoalescedWriteSize = utils::FileSize::FromKilobytes(5);
+			nodeConfig.PacketCompressionThreshold = utils::FileSize::FromKilobytes(6);
+			nodeConfig.BroadcastKnownInventorySize = 1234;
+			nodeConfig.MaxBroadcastFanout = 7;
+			nodeConfig.BroadcastTrickleInterval = utils::TimeSpan::FromMilliseconds(250);
 
 			nodeConfig.IncomingConnections.MaxConnections = 17;
 			nodeConfig.IncomingConnections.BacklogSize = 83;
@@ -60,31 +66,55 @@ namespace catapult { namespace extensions {
 		auto config = CreateLocalNodeConfiguration();
 
 		// Act:
-		auto settings = GetConnectionSettings(config);
+		auto settings = GetConnectionSettings(config, nullptr);
 
 		// Assert:
 		EXPECT_EQ(static_cast<model::NetworkIdentifier>(7), settings.NetworkIdentifier);
 		EXPECT_EQ(utils::TimeSpan::FromSeconds(11), settings.Timeout);
+		EXPECT_EQ(utils::TimeSpan::FromSeconds(4), settings.MultiplexedRequestTimeout);
 		EXPECT_EQ(utils::FileSize::FromBytes(512), settings.SocketWorkingBufferSize);
 		EXPECT_EQ(987u, settings.SocketWorkingBufferSensitivity);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(12), settings.MaxPacketDataSize);
+		EXPECT_EQ(utils::FileSize::FromKilobytes(5), settings.SocketMaxCoalescedWriteSize);
+		EXPECT_FALSE(!!settings.SocketWorkingBufferPool);
+		EXPECT_EQ(utils::FileSize::FromKilobytes(6), settings.PacketCompressionThreshold);
+		EXPECT_EQ(1234u, settings.BroadcastKnownInventorySize);
+		EXPECT_EQ(7u, settings.MaxBroadcastFanout);
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(250), settings.BroadcastTrickleInterval);
 
 		EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(8), settings.OutgoingSecurityMode);
 		EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(21), settings.IncomingSecurityModes);
 	}
 
+	TEST(TEST_CLASS, CanExtractConnectionSettingsWithSharedWorkingBufferPoolFromLocalNodeConfiguration) {
+		// Arrange:
+		auto config = CreateLocalNodeConfiguration();
+		auto pPool = std::make_shared<ionet::ByteBufferPool>(512, 44);
+
+		// Act:
+		auto settings1 = GetConnectionSettings(config, pPool);
+		auto settings2 = GetConnectionSettings(config, pPool);
+
+		// Assert: the pool is shared instead of being created per call
+		EXPECT_EQ(pPool, settings1.SocketWorkingBufferPool);
+		EXPECT_EQ(pPool, settings2.SocketWorkingBufferPool);
+	}
+
 	TEST(TEST_CLASS, CanUpdateAsyncTcpServerSettingsFromLocalNodeConfiguration) {
 		// Arrange:
 		auto config = CreateLocalNodeConfiguration();
 		auto settings = net::AsyncTcpServerSettings([](const auto&) {});
+		auto pPool = std::make_shared<ionet::ByteBufferPool>(512, 44);
 
 		// Act:
-		UpdateAsyncTcpServerSettings(settings, config);
+		UpdateAsyncTcpServerSettings(settings, config, pPool);
 
 		// Assert:
 		EXPECT_EQ(512u, settings.PacketSocketOptions.WorkingBufferSize);
 		EXPECT_EQ(987u, settings.PacketSocketOptions.WorkingBufferSensitivity);
 		EXPECT_EQ(12u * 1024, settings.PacketSocketOptions.MaxPacketDataSize);
+		EXPECT_EQ(5u * 1024, settings.PacketSocketOptions.MaxCoalescedWriteSize);
+		EXPECT_EQ(pPool, settings.PacketSocketOptions.WorkingBufferPool);
 
 		EXPECT_EQ(17u, settings.MaxActiveConnections);
 		EXPECT_EQ(83u, settings.MaxPendingConnections);
@@ -142,7 +172,7 @@ namespace catapult { namespace extensions {
 			auto boot() {
 				// Act:
 				auto config = CreateLocalNodeConfiguration();
-				return BootServer(*m_pool.pushServiceGroup("server"), test::Local_Host_Port, config, [&acceptor = m_acceptor](
+				return BootServer(*m_pool.pushServiceGroup("server"), test::Local_Host_Port, config, nullptr, [&acceptor = m_acceptor](
 						const auto& socketInfo,
 						const auto& callback) {
 					acceptor.accept(socketInfo, callback);
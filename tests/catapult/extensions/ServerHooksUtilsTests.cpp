@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/extensions/ServerHooksUtils.h"
+#include "catapult/net/BroadcastInventory.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -68,7 +69,7 @@ namespace catapult { namespace extensions {
 			const auto* pRangeData = range.data();
 
 			// Act:
-			TTraits::CreatePushEntityCallback(hooks)(std::move(range));
+			TTraits::CreatePushEntityCallback(hooks, nullptr)(std::move(range));
 
 			// Assert: consumer should always be created exactly once
 			ASSERT_EQ(1u, sources.size());
@@ -97,5 +98,48 @@ namespace catapult { namespace extensions {
 		AssertPush<TTraits>(false);
 	}
 
+	namespace {
+		template<typename TTraits>
+		void AssertPushAddsKnownInventory(bool isChainSynced) {
+			// Arrange:
+			ServerHooks hooks;
+			hooks.setChainSyncedPredicate([isChainSynced]() { return isChainSynced; });
+			TTraits::SetConsumerFactory(hooks, [](auto) {
+				return [](auto&&) {};
+			});
+
+			auto sourcePublicKey = test::GenerateRandomData<Key_Size>();
+			auto pKnownInventories = std::make_shared<net::PeerKnownInventories>(10);
+			auto pKnownInventory = pKnownInventories->acquire(sourcePublicKey);
+			auto pOtherKnownInventory = pKnownInventories->acquire(test::GenerateRandomData<Key_Size>());
+
+			auto range = TTraits::CreateRange(3);
+			std::vector<utils::ShortHash> expectedInventory;
+			for (const auto& entity : range)
+				expectedInventory.push_back(net::CalculateBroadcastInventoryItem(entity));
+
+			// Act:
+			TTraits::CreatePushEntityCallback(hooks, pKnownInventories)({ std::move(range), sourcePublicKey });
+
+			// Assert: all pushed entities are known to the source peer (even when they are not consumed)
+			EXPECT_EQ(3u, pKnownInventory->size());
+			for (auto shortHash : expectedInventory)
+				EXPECT_TRUE(pKnownInventory->contains(shortHash)) << shortHash;
+
+			// - other peers are not affected
+			EXPECT_EQ(0u, pOtherKnownInventory->size());
+		}
+	}
+
+	PUSH_ENTITY_TEST(PushAddsKnownInventoryOfSourceWhenSynced) {
+		// Assert:
+		AssertPushAddsKnownInventory<TTraits>(true);
+	}
+
+	PUSH_ENTITY_TEST(PushAddsKnownInventoryOfSourceWhenNotSynced) {
+		// Assert:
+		AssertPushAddsKnownInventory<TTraits>(false);
+	}
+
 	// endregion
 }}
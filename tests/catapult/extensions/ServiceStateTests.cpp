@@ -39,6 +39,8 @@ namespace catapult { namespace extensions {
 		// Arrange:
 		auto config = test::CreateUninitializedLocalNodeConfiguration();
 		const_cast<utils::FileSize&>(config.Node.MaxPacketDataSize) = utils::FileSize::FromKilobytes(1234);
+		const_cast<utils::FileSize&>(config.Node.SocketWorkingBufferSize) = utils::FileSize::FromBytes(512);
+		const_cast<uint32_t&>(config.Node.SocketWorkingBufferPoolSize) = 7;
 
 		ionet::NodeContainer nodes;
 		auto catapultCache = cache::CatapultCache({});
@@ -108,5 +110,14 @@ namespace catapult { namespace extensions {
 
 		EXPECT_TRUE(state.hooks().chainSyncedPredicate()); // just check that hooks is valid and default predicate can be called
 		EXPECT_TRUE(state.packetIoPickers().pickMatching(utils::TimeSpan::FromSeconds(1), ionet::NodeRoles::None).empty());
+
+		// - check socket working buffer pool is initialized from config
+		ASSERT_TRUE(!!state.socketWorkingBufferPool());
+		EXPECT_EQ(512u, state.socketWorkingBufferPool()->bufferCapacity());
+		EXPECT_EQ(0u, state.socketWorkingBufferPool()->numPooledBuffers());
+
+		// - check peer known inventories are initially empty
+		ASSERT_TRUE(!!state.peerKnownInventories());
+		EXPECT_EQ(0u, state.peerKnownInventories()->size());
 	}
 }}
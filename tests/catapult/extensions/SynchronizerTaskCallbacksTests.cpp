@@ -198,4 +198,50 @@ namespace catapult { namespace extensions {
 		// Assert:
 		AssertCallbackCallsAction<ChainSyncAwareCallbackTraits>(true);
 	}
+
+	TEST(TEST_CLASS, MultiCallback_ActionIsCalledWithUpToMaxPeers) {
+		// Arrange: create writers with a valid packet
+		test::ServiceTestState testState;
+		const_cast<utils::TimeSpan&>(testState.config().Node.SyncTimeout) = utils::TimeSpan::FromSeconds(Default_Timeout_Seconds);
+
+		auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+		mocks::PickOneAwareMockPacketWriters writers;
+		writers.setPacketIo(pPacketIo);
+		writers.setNodes({
+			ionet::Node(test::GenerateRandomData<Key_Size>(), ionet::NodeEndpoint(), ionet::NodeMetadata()),
+			ionet::Node(test::GenerateRandomData<Key_Size>(), ionet::NodeEndpoint(), ionet::NodeMetadata())
+		});
+
+		size_t numFactoryCalls = 0;
+		std::vector<int> actionApiIds;
+		auto callback = CreateSynchronizerTaskCallback(
+				chain::MultiRemoteNodeSynchronizer<int>([&actionApiIds](const auto& apis) {
+					for (const auto* pApiId : apis)
+						actionApiIds.push_back(*pApiId);
+
+					return thread::make_ready_future(chain::NodeInteractionResult::Success);
+				}),
+				[&numFactoryCalls](const auto&, const auto&) {
+					return std::make_unique<int>(Default_Action_Api_Id + static_cast<int>(numFactoryCalls++));
+				},
+				writers,
+				testState.state(),
+				"test",
+				2);
+
+		// Act:
+		auto result = callback().get();
+
+		// Assert:
+		EXPECT_EQ(thread::TaskResult::Continue, result);
+
+		// - pick one was called max peers times
+		ASSERT_EQ(2u, writers.numPickOneCalls());
+		EXPECT_EQ(Default_Timeout_Seconds, writers.pickOneDurations()[0].seconds());
+		EXPECT_EQ(Default_Timeout_Seconds, writers.pickOneDurations()[1].seconds());
+
+		// - action was called with all apis
+		EXPECT_EQ(2u, numFactoryCalls);
+		EXPECT_EQ(std::vector<int>({ Default_Action_Api_Id, Default_Action_Api_Id + 1 }), actionApiIds);
+	}
 }}
@@ -19,9 +19,11 @@
 **/
 
 #include "catapult/handlers/ChainHandlers.h"
-#include "catapult/api/ChainPackets.h"
+#include "catapult/ionet/ChainPackets.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/model/EntityHasher.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryBasedStorage.h"
@@ -88,6 +90,195 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region PushCompactBlockHandler
+
+	namespace {
+		class CompactBlockTestContext {
+		public:
+			explicit CompactBlockTestContext(size_t numTransactions)
+					: m_registry(mocks::CreateDefaultTransactionRegistry())
+					, m_pBlock(test::GenerateBlockWithTransactions(numTransactions)) {
+				std::vector<const model::TransactionInfo*> transactionInfoPointers;
+				for (const auto& transaction : m_pBlock->Transactions()) {
+					model::TransactionElement transactionElement(transaction);
+					model::UpdateHashes(m_registry, transactionElement);
+
+					auto pTransaction = test::CopyEntity(transaction);
+					m_transactionInfos.emplace_back(std::move(pTransaction), transactionElement.EntityHash);
+					m_transactionInfos.back().MerkleComponentHash = transactionElement.MerkleComponentHash;
+				}
+
+				for (const auto& transactionInfo : m_transactionInfos)
+					transactionInfoPointers.push_back(&transactionInfo);
+
+				model::CalculateBlockTransactionsHash(transactionInfoPointers, m_pBlock->BlockTransactionsHash);
+			}
+
+		public:
+			const model::Block& block() const {
+				return *m_pBlock;
+			}
+
+			void removeKnownTransaction(size_t index) {
+				m_transactionInfos.erase(m_transactionInfos.begin() + static_cast<long>(index));
+			}
+
+			std::shared_ptr<ionet::Packet> createPacket() const {
+				std::vector<utils::ShortHash> shortHashes;
+				for (const auto& transaction : m_pBlock->Transactions()) {
+					const auto& plugin = *m_registry.findPlugin(transaction.Type);
+					shortHashes.push_back(utils::ToShortHash(model::CalculateHash(transaction, plugin.dataBuffer(transaction))));
+				}
+
+				auto shortHashesSize = static_cast<uint32_t>(shortHashes.size() * sizeof(utils::ShortHash));
+				auto packetDataSize = static_cast<uint32_t>(sizeof(model::BlockHeader)) + shortHashesSize;
+				auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(packetDataSize);
+				pPacket->Type = ionet::PacketType::Push_Compact_Block;
+				std::memcpy(pPacket->Data(), m_pBlock.get(), sizeof(model::BlockHeader));
+				std::memcpy(pPacket->Data() + sizeof(model::BlockHeader), shortHashes.data(), shortHashesSize);
+				return pPacket;
+			}
+
+			void process(const ionet::Packet& packet) {
+				ionet::ServerPacketHandlers handlers;
+				RegisterPushCompactBlockHandler(
+						handlers,
+						m_registry,
+						[this](const auto& shortHashes) { return retrieve(shortHashes); },
+						[this](auto&& range) { m_forwardedRanges.push_back(std::move(range)); },
+						[this](const auto& header, const auto& sourcePublicKey) {
+							m_fallbackHeights.push_back(header.Height);
+							m_fallbackSourcePublicKeys.push_back(sourcePublicKey);
+						});
+
+				ionet::ServerPacketHandlerContext context(m_sourcePublicKey, "");
+				EXPECT_TRUE(handlers.process(packet, context));
+			}
+
+		public:
+			void assertNoForwarding() const {
+				EXPECT_TRUE(m_forwardedRanges.empty());
+				EXPECT_TRUE(m_fallbackHeights.empty());
+			}
+
+			void assertForwardedBlock() const {
+				ASSERT_EQ(1u, m_forwardedRanges.size());
+				EXPECT_TRUE(m_fallbackHeights.empty());
+
+				const auto& forwardedRange = m_forwardedRanges[0];
+				ASSERT_EQ(1u, forwardedRange.Range.size());
+				EXPECT_EQ(*m_pBlock, *forwardedRange.Range.cbegin());
+				EXPECT_EQ(m_sourcePublicKey, forwardedRange.SourcePublicKey);
+			}
+
+			void assertFallback() const {
+				EXPECT_TRUE(m_forwardedRanges.empty());
+
+				ASSERT_EQ(1u, m_fallbackHeights.size());
+				EXPECT_EQ(m_pBlock->Height, m_fallbackHeights[0]);
+				EXPECT_EQ(m_sourcePublicKey, m_fallbackSourcePublicKeys[0]);
+			}
+
+		private:
+			std::vector<model::TransactionInfo> retrieve(const std::vector<utils::ShortHash>& shortHashes) const {
+				std::vector<model::TransactionInfo> transactionInfos;
+				for (auto shortHash : shortHashes) {
+					auto iter = std::find_if(m_transactionInfos.cbegin(), m_transactionInfos.cend(), [shortHash](const auto& info) {
+						return shortHash == utils::ToShortHash(info.EntityHash);
+					});
+					transactionInfos.push_back(m_transactionInfos.cend() == iter ? model::TransactionInfo() : iter->copy());
+				}
+
+				return transactionInfos;
+			}
+
+		private:
+			model::TransactionRegistry m_registry;
+			std::unique_ptr<model::Block> m_pBlock;
+			std::vector<model::TransactionInfo> m_transactionInfos;
+			Key m_sourcePublicKey = test::GenerateRandomData<Key_Size>();
+
+			std::vector<model::AnnotatedBlockRange> m_forwardedRanges;
+			std::vector<Height> m_fallbackHeights;
+			std::vector<Key> m_fallbackSourcePublicKeys;
+		};
+	}
+
+	TEST(TEST_CLASS, PushCompactBlockHandler_MalformedPacketIsRejected) {
+		// Arrange:
+		CompactBlockTestContext context(3);
+		auto pPacket = context.createPacket();
+		--pPacket->Size;
+
+		// Act:
+		context.process(*pPacket);
+
+		// Assert:
+		context.assertNoForwarding();
+	}
+
+	TEST(TEST_CLASS, PushCompactBlockHandler_BlockWithoutTransactionsIsForwardedToDisruptor) {
+		// Arrange:
+		CompactBlockTestContext context(0);
+
+		// Act:
+		context.process(*context.createPacket());
+
+		// Assert:
+		context.assertForwardedBlock();
+	}
+
+	TEST(TEST_CLASS, PushCompactBlockHandler_BlockWithKnownTransactionsIsForwardedToDisruptor) {
+		// Arrange:
+		CompactBlockTestContext context(3);
+
+		// Act:
+		context.process(*context.createPacket());
+
+		// Assert:
+		context.assertForwardedBlock();
+	}
+
+	TEST(TEST_CLASS, PushCompactBlockHandler_BlockWithUnknownTransactionIsForwardedToFallback) {
+		// Arrange:
+		CompactBlockTestContext context(3);
+		context.removeKnownTransaction(1);
+
+		// Act:
+		context.process(*context.createPacket());
+
+		// Assert:
+		context.assertFallback();
+	}
+
+	TEST(TEST_CLASS, PushCompactBlockHandler_BlockWithMismatchedTransactionsHashIsForwardedToFallback) {
+		// Arrange:
+		CompactBlockTestContext context(3);
+		auto pPacket = context.createPacket();
+		reinterpret_cast<model::BlockHeader&>(*pPacket->Data()).BlockTransactionsHash[0] ^= 0xFF;
+
+		// Act:
+		context.process(*pPacket);
+
+		// Assert:
+		context.assertFallback();
+	}
+
+	TEST(TEST_CLASS, PushCompactBlockHandler_BlockWithMismatchedSizeIsForwardedToFallback) {
+		// Arrange:
+		CompactBlockTestContext context(3);
+		auto pPacket = context.createPacket();
+		++reinterpret_cast<model::BlockHeader&>(*pPacket->Data()).Size;
+
+		// Act:
+		context.process(*pPacket);
+
+		// Assert:
+		context.assertFallback();
+	}
+
+	// endregion
+
 	namespace {
 		// use variable-sized blocks in tests
 		constexpr uint32_t GetBlockSizeAtHeight(Height height) {
@@ -127,7 +318,7 @@ namespace catapult { namespace handlers {
 			}
 
 			static auto CreateRequestPacket() {
-				return ionet::CreateSharedPacket<api::PullBlockRequest>();
+				return ionet::CreateSharedPacket<ionet::PullBlockRequest>();
 			}
 
 			static void Register(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage) {
@@ -141,7 +332,7 @@ namespace catapult { namespace handlers {
 			}
 
 			static auto CreateRequestPacket() {
-				return ionet::CreateSharedPacket<api::BlockHashesRequest>();
+				return ionet::CreateSharedPacket<ionet::BlockHashesRequest>();
 			}
 
 			static void Register(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage) {
@@ -155,7 +346,7 @@ namespace catapult { namespace handlers {
 			}
 
 			static auto CreateRequestPacket() {
-				auto pRequest = ionet::CreateSharedPacket<api::PullBlocksRequest>();
+				auto pRequest = ionet::CreateSharedPacket<ionet::PullBlocksRequest>();
 				pRequest->NumBlocks = 100;
 				pRequest->NumResponseBytes = 10 * 1024 * 1024;
 				return pRequest;
@@ -169,6 +360,22 @@ namespace catapult { namespace handlers {
 			}
 		};
 
+		struct PullBlockHeadersHandlerTraits {
+			static ionet::PacketType ResponsePacketType() {
+				return ionet::PacketType::Pull_Block_Headers;
+			}
+
+			static auto CreateRequestPacket() {
+				auto pRequest = ionet::CreateSharedPacket<ionet::PullBlockHeadersRequest>();
+				pRequest->NumBlockHeaders = 100;
+				return pRequest;
+			}
+
+			static void Register(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage) {
+				RegisterPullBlockHeadersHandler(handlers, storage, 100);
+			}
+		};
+
 		template<typename TTraits>
 		void AssertWritesEmptyResponse(size_t numBlocks, Height requestHeight) {
 			// Arrange:
@@ -195,6 +402,9 @@ namespace catapult { namespace handlers {
 	TEST(TEST_CLASS, PullBlockHandler_##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PullBlockHandlerTraits>(); } \
 	TEST(TEST_CLASS, BlockHashesHandler_##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockHashesHandlerTraits>(); } \
 	TEST(TEST_CLASS, PullBlocksHandler_##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PullBlocksHandlerTraits>(); } \
+	TEST(TEST_CLASS, PullBlockHeadersHandler_##TEST_NAME) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PullBlockHeadersHandlerTraits>(); \
+	} \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	HEIGHT_REQUEST_TEST(DoesNotRespondToMalformedRequest) {
@@ -231,7 +441,7 @@ namespace catapult { namespace handlers {
 			auto pStorage = CreateStorage(numBlocks);
 			RegisterPullBlockHandler(handlers, *pStorage);
 
-			auto pPacket = ionet::CreateSharedPacket<api::PullBlockRequest>();
+			auto pPacket = ionet::CreateSharedPacket<ionet::PullBlockRequest>();
 			pPacket->Height = requestHeight;
 
 			// Act:
@@ -306,7 +516,7 @@ namespace catapult { namespace handlers {
 		EXPECT_TRUE(handlers.process(*pPacket, context));
 
 		// Assert: chain score is written
-		test::AssertPacketHeader(context, sizeof(api::ChainInfoResponse), ionet::PacketType::Chain_Info);
+		test::AssertPacketHeader(context, sizeof(ionet::ChainInfoResponse), ionet::PacketType::Chain_Info);
 
 		const auto* pResponse = reinterpret_cast<const uint64_t*>(test::GetSingleBufferData(context));
 		EXPECT_EQ(12u, pResponse[0]); // height
@@ -334,7 +544,7 @@ namespace catapult { namespace handlers {
 			auto pStorage = CreateStorage(numBlocks);
 			RegisterBlockHashesHandler(handlers, *pStorage, maxHashes);
 
-			auto pPacket = ionet::CreateSharedPacket<api::BlockHashesRequest>();
+			auto pPacket = ionet::CreateSharedPacket<ionet::BlockHashesRequest>();
 			pPacket->Height = requestHeight;
 
 			// Act:
@@ -378,6 +588,115 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region BlockHashesAtHandler
+
+	namespace {
+		auto CreateBlockHashesAtRequestPacket(const std::vector<Height>& heights) {
+			auto payloadSize = static_cast<uint32_t>(heights.size() * sizeof(Height));
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+			pPacket->Type = ionet::PacketType::Block_Hashes_At;
+			std::memcpy(pPacket->Data(), heights.data(), payloadSize);
+			return pPacket;
+		}
+
+		void AssertCanRetrieveHashesAt(
+				uint32_t maxHashes,
+				const std::vector<Height>& requestHeights,
+				const std::vector<Height>& expectedHeights) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			auto pStorage = CreateStorage(12);
+			RegisterBlockHashesAtHandler(handlers, *pStorage, maxHashes);
+
+			auto pPacket = CreateBlockHashesAtRequestPacket(requestHeights);
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_TRUE(handlers.process(*pPacket, context));
+
+			// Assert:
+			auto expectedSize = sizeof(ionet::PacketHeader) + sizeof(Hash256) * expectedHeights.size();
+			test::AssertPacketHeader(context, expectedSize, ionet::PacketType::Block_Hashes_At);
+			if (expectedHeights.empty()) {
+				EXPECT_TRUE(context.response().buffers().empty());
+				return;
+			}
+
+			auto pData = test::GetSingleBufferData(context);
+			auto storageView = pStorage->view();
+			for (auto i = 0u; i < expectedHeights.size(); ++i) {
+				auto expectedHash = storageView.loadBlockElement(expectedHeights[i])->EntityHash;
+				const auto& hash = reinterpret_cast<const Hash256&>(*pData);
+
+				EXPECT_EQ(expectedHash, hash) << "comparing hashes at " << i;
+				pData += sizeof(Hash256);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, BlockHashesAtHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		auto pStorage = CreateStorage(12);
+		RegisterBlockHashesAtHandler(handlers, *pStorage, 10);
+
+		// - create a malformed request (payload is not a multiple of height size)
+		auto pPacket = CreateBlockHashesAtRequestPacket({ Height(3), Height(7) });
+		--pPacket->Size;
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		EXPECT_TRUE(handlers.process(*pPacket, context));
+
+		// Assert: no response was written because the request was malformed
+		test::AssertNoResponse(context);
+	}
+
+	TEST(TEST_CLASS, BlockHashesAtHandler_DoesNotRespondToRequestWithoutHeights) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		auto pStorage = CreateStorage(12);
+		RegisterBlockHashesAtHandler(handlers, *pStorage, 10);
+
+		auto pPacket = CreateBlockHashesAtRequestPacket({});
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		EXPECT_TRUE(handlers.process(*pPacket, context));
+
+		// Assert:
+		test::AssertNoResponse(context);
+	}
+
+	TEST(TEST_CLASS, BlockHashesAtHandler_WritesEmptyResponseIfFirstRequestHeightIsInvalid) {
+		// Assert:
+		AssertCanRetrieveHashesAt(10, { Height(0), Height(3) }, {});
+		AssertCanRetrieveHashesAt(10, { Height(13), Height(14) }, {});
+	}
+
+	TEST(TEST_CLASS, BlockHashesAtHandler_CanRetrieveHashesAtAllRequestHeights) {
+		// Assert:
+		AssertCanRetrieveHashesAt(10, { Height(1), Height(4), Height(9), Height(12) }, { Height(1), Height(4), Height(9), Height(12) });
+	}
+
+	TEST(TEST_CLASS, BlockHashesAtHandler_WritesAtMostMaxHashes) {
+		// Assert:
+		AssertCanRetrieveHashesAt(2, { Height(1), Height(4), Height(9), Height(12) }, { Height(1), Height(4) });
+	}
+
+	TEST(TEST_CLASS, BlockHashesAtHandler_WritesAreBoundedByLastBlock) {
+		// Assert:
+		AssertCanRetrieveHashesAt(10, { Height(4), Height(9), Height(13), Height(12) }, { Height(4), Height(9) });
+	}
+
+	TEST(TEST_CLASS, BlockHashesAtHandler_WritesAreBoundedByFirstNonIncreasingHeight) {
+		// Assert:
+		AssertCanRetrieveHashesAt(10, { Height(4), Height(9), Height(9), Height(12) }, { Height(4), Height(9) });
+		AssertCanRetrieveHashesAt(10, { Height(4), Height(9), Height(5), Height(12) }, { Height(4), Height(9) });
+	}
+
+	// endregion
+
 	// region BlocksHandler
 
 	TEST(TEST_CLASS, PullBlocksHandler_WritesEmptyResponseIfRequestHeightIsZero) {
@@ -388,7 +707,7 @@ namespace catapult { namespace handlers {
 	namespace {
 		void AssertCanRetrieveBlocks(
 				size_t numBlocks,
-				const api::PullBlocksRequest& request,
+				const ionet::PullBlocksRequest& request,
 				const PullBlocksHandlerConfiguration& config,
 				const std::vector<Height>& expectedHeights) {
 			// Arrange:
@@ -427,7 +746,7 @@ namespace catapult { namespace handlers {
 				Height requestHeight,
 				const std::vector<Height>& expectedHeights) {
 			// Arrange: set request NumXyz == config MaxXyz
-			auto pRequest = ionet::CreateSharedPacket<api::PullBlocksRequest>();
+			auto pRequest = ionet::CreateSharedPacket<ionet::PullBlocksRequest>();
 			pRequest->Height = requestHeight;
 			pRequest->NumBlocks = maxBlocks;
 			pRequest->NumResponseBytes = maxResponseBytes;
@@ -485,7 +804,7 @@ namespace catapult { namespace handlers {
 				Height requestHeight,
 				const std::vector<Height>& expectedHeights) {
 			// Arrange:
-			auto pRequest = ionet::CreateSharedPacket<api::PullBlocksRequest>();
+			auto pRequest = ionet::CreateSharedPacket<ionet::PullBlocksRequest>();
 			pRequest->Height = requestHeight;
 			pRequest->NumBlocks = numRequestBlocks;
 			pRequest->NumResponseBytes = 100 * 1024 * 1024;
@@ -523,7 +842,7 @@ namespace catapult { namespace handlers {
 				Height requestHeight,
 				const std::vector<Height>& expectedHeights) {
 			// Arrange:
-			auto pRequest = ionet::CreateSharedPacket<api::PullBlocksRequest>();
+			auto pRequest = ionet::CreateSharedPacket<ionet::PullBlocksRequest>();
 			pRequest->Height = requestHeight;
 			pRequest->NumBlocks = 100;
 			pRequest->NumResponseBytes = numRequestResponseBytes;
@@ -565,4 +884,71 @@ namespace catapult { namespace handlers {
 	}
 
 	// endregion
+
+	// region PullBlockHeadersHandler
+
+	TEST(TEST_CLASS, PullBlockHeadersHandler_WritesEmptyResponseIfRequestHeightIsZero) {
+		// Assert:
+		AssertWritesEmptyResponse<PullBlockHeadersHandlerTraits>(12, Height(0));
+	}
+
+	namespace {
+		void AssertCanRetrieveBlockHeaders(
+				size_t numBlocks,
+				uint32_t numRequestedBlockHeaders,
+				uint32_t maxBlockHeaders,
+				Height requestHeight,
+				const std::vector<Height>& expectedHeights) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			auto pStorage = CreateStorage(numBlocks);
+			RegisterPullBlockHeadersHandler(handlers, *pStorage, maxBlockHeaders);
+
+			auto pPacket = ionet::CreateSharedPacket<ionet::PullBlockHeadersRequest>();
+			pPacket->Height = requestHeight;
+			pPacket->NumBlockHeaders = numRequestedBlockHeaders;
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_TRUE(handlers.process(*pPacket, context));
+
+			// Assert: only block headers (and no transactions) are written
+			auto expectedSize = sizeof(ionet::PacketHeader) + sizeof(model::BlockHeader) * expectedHeights.size();
+			test::AssertPacketHeader(context, expectedSize, ionet::PacketType::Pull_Block_Headers);
+
+			auto pData = test::GetSingleBufferData(context);
+			auto storageView = pStorage->view();
+			for (auto i = 0u; i < expectedHeights.size(); ++i) {
+				auto pExpectedBlock = storageView.loadBlock(expectedHeights[i]);
+				const auto& header = reinterpret_cast<const model::BlockHeader&>(*pData);
+
+				EXPECT_EQ(expectedHeights[i], header.Height) << "header at " << i;
+				EXPECT_EQ(pExpectedBlock->Size, header.Size) << "header at " << i;
+				EXPECT_TRUE(0 == std::memcmp(pExpectedBlock.get(), &header, sizeof(model::BlockHeader))) << "header at " << i;
+				pData += sizeof(model::BlockHeader);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, PullBlockHeadersHandler_WritesAtMostMaxBlockHeaders) {
+		// Assert:
+		AssertCanRetrieveBlockHeaders(12, 10, 3, Height(3), { Height(3), Height(4), Height(5) });
+	}
+
+	TEST(TEST_CLASS, PullBlockHeadersHandler_WritesAtMostRequestedBlockHeaders) {
+		// Assert:
+		AssertCanRetrieveBlockHeaders(12, 2, 10, Height(3), { Height(3), Height(4) });
+	}
+
+	TEST(TEST_CLASS, PullBlockHeadersHandler_WritesAreBoundedByLastBlock) {
+		// Assert:
+		AssertCanRetrieveBlockHeaders(12, 10, 10, Height(10), { Height(10), Height(11), Height(12) });
+	}
+
+	TEST(TEST_CLASS, PullBlockHeadersHandler_CanRetrieveLastBlockHeader) {
+		// Assert:
+		AssertCanRetrieveBlockHeaders(12, 5, 5, Height(12), { Height(12) });
+	}
+
+	// endregion
 }}
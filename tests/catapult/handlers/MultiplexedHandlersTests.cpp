@@ -0,0 +1,187 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/handlers/MultiplexedHandlers.h"
+#include "catapult/ionet/MultiplexedPacketIo.h"
+#include "tests/test/core/PacketPayloadTestUtils.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace handlers {
+
+#define TEST_CLASS MultiplexedHandlersTests
+
+	namespace {
+		constexpr uint32_t Request_Id = 0x2468ACE1;
+
+		std::shared_ptr<ionet::Packet> CreateMultiplexedRequest(uint32_t requestId, const ionet::Packet& childPacket) {
+			auto pPacket = ionet::CreateSharedPacket<ionet::MultiplexedPacket>(childPacket.Size);
+			pPacket->RequestId = requestId;
+			std::memcpy(static_cast<void*>(pPacket.get() + 1), &childPacket, childPacket.Size);
+			return pPacket;
+		}
+
+		struct HandlerCapture {
+			size_t NumCalls = 0;
+			ionet::ByteBuffer RequestBuffer;
+			Key ClientKey;
+			std::string ClientHost;
+		};
+
+		void RegisterCapturingHandler(
+				ionet::ServerPacketHandlers& handlers,
+				HandlerCapture& capture,
+				const std::shared_ptr<ionet::Packet>& pResponsePacket) {
+			test::RegisterDefaultHandler(handlers, [&capture, pResponsePacket](const auto& packet, auto& context) {
+				++capture.NumCalls;
+				capture.RequestBuffer = test::CopyPacketToBuffer(packet);
+				capture.ClientKey = context.key();
+				capture.ClientHost = context.host();
+
+				if (pResponsePacket)
+					context.response(ionet::PacketPayload(pResponsePacket));
+			});
+		}
+
+		void AssertNoResponseToMultiplexedRequest(const ionet::Packet& packet, size_t expectedNumChildCalls) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			RegisterMultiplexedRequestHandler(handlers);
+
+			HandlerCapture capture;
+			RegisterCapturingHandler(handlers, capture, test::CreateRandomPacket(40, test::Default_Packet_Type));
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_TRUE(handlers.process(packet, context));
+
+			// Assert:
+			test::AssertNoResponse(context);
+			EXPECT_EQ(expectedNumChildCalls, capture.NumCalls);
+		}
+	}
+
+	TEST(TEST_CLASS, MultiplexedRequestHandlerIsRegistered) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+
+		// Act:
+		RegisterMultiplexedRequestHandler(handlers);
+
+		// Assert:
+		EXPECT_EQ(1u, handlers.size());
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Multiplexed));
+	}
+
+	TEST(TEST_CLASS, MultiplexedRequestHandler_DoesNotRespondToRequestWithoutRequestId) {
+		// Arrange:
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+		pPacket->Type = ionet::PacketType::Multiplexed;
+
+		// Act + Assert:
+		AssertNoResponseToMultiplexedRequest(*pPacket, 0);
+	}
+
+	TEST(TEST_CLASS, MultiplexedRequestHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange: malform the child packet size
+		auto pPacket = CreateMultiplexedRequest(Request_Id, *test::CreateRandomPacket(20, test::Default_Packet_Type));
+		++reinterpret_cast<ionet::Packet&>(*(pPacket->Data() + sizeof(uint32_t))).Size;
+
+		// Act + Assert:
+		AssertNoResponseToMultiplexedRequest(*pPacket, 0);
+	}
+
+	TEST(TEST_CLASS, MultiplexedRequestHandler_DoesNotRespondToNestedRequest) {
+		// Arrange:
+		auto pChildPacket = CreateMultiplexedRequest(Request_Id + 1, *test::CreateRandomPacket(20, test::Default_Packet_Type));
+		auto pPacket = CreateMultiplexedRequest(Request_Id, *pChildPacket);
+
+		// Act + Assert:
+		AssertNoResponseToMultiplexedRequest(*pPacket, 0);
+	}
+
+	TEST(TEST_CLASS, MultiplexedRequestHandler_DoesNotRespondToRequestWithUnknownChildType) {
+		// Arrange:
+		auto pPacket = CreateMultiplexedRequest(Request_Id, *test::CreateRandomPacket(20, ionet::PacketType::Chain_Info));
+
+		// Act + Assert:
+		AssertNoResponseToMultiplexedRequest(*pPacket, 0);
+	}
+
+	TEST(TEST_CLASS, MultiplexedRequestHandler_DoesNotRespondWhenChildHandlerDoesNotRespond) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		RegisterMultiplexedRequestHandler(handlers);
+
+		HandlerCapture capture;
+		RegisterCapturingHandler(handlers, capture, nullptr);
+
+		auto pPacket = CreateMultiplexedRequest(Request_Id, *test::CreateRandomPacket(20, test::Default_Packet_Type));
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		EXPECT_TRUE(handlers.process(*pPacket, context));
+
+		// Assert:
+		test::AssertNoResponse(context);
+		EXPECT_EQ(1u, capture.NumCalls);
+	}
+
+	TEST(TEST_CLASS, MultiplexedRequestHandler_RespondsWithMultiplexedChildResponse) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		RegisterMultiplexedRequestHandler(handlers);
+
+		HandlerCapture capture;
+		auto pResponsePacket = test::CreateRandomPacket(40, ionet::PacketType::Chain_Info);
+		RegisterCapturingHandler(handlers, capture, pResponsePacket);
+
+		auto pChildPacket = test::CreateRandomPacket(20, test::Default_Packet_Type);
+		auto pPacket = CreateMultiplexedRequest(Request_Id, *pChildPacket);
+
+		// Act:
+		auto clientKey = test::GenerateRandomData<Key_Size>();
+		std::string clientHost("alice.com");
+		ionet::ServerPacketHandlerContext context(clientKey, clientHost);
+		EXPECT_TRUE(handlers.process(*pPacket, context));
+
+		// Assert: the child packet was forwarded to the child handler along with the client information
+		EXPECT_EQ(1u, capture.NumCalls);
+		EXPECT_EQ(test::CopyPacketToBuffer(*pChildPacket), capture.RequestBuffer);
+		EXPECT_EQ(clientKey, capture.ClientKey);
+		EXPECT_EQ(clientHost, capture.ClientHost);
+
+		// - the child response was wrapped with the original request id
+		auto expectedSize = sizeof(ionet::MultiplexedPacket) + pResponsePacket->Size;
+		test::AssertPacketHeader(context, expectedSize, ionet::PacketType::Multiplexed);
+
+		const auto& buffers = context.response().buffers();
+		ASSERT_EQ(3u, buffers.size());
+		ASSERT_EQ(sizeof(uint32_t), buffers[0].Size);
+		EXPECT_EQ(Request_Id, reinterpret_cast<const uint32_t&>(*buffers[0].pData));
+
+		ASSERT_EQ(sizeof(ionet::PacketHeader), buffers[1].Size);
+		EXPECT_TRUE(0 == std::memcmp(pResponsePacket.get(), buffers[1].pData, sizeof(ionet::PacketHeader)));
+
+		ASSERT_EQ(pResponsePacket->Size - sizeof(ionet::PacketHeader), buffers[2].Size);
+		EXPECT_TRUE(0 == std::memcmp(pResponsePacket->Data(), buffers[2].pData, buffers[2].Size));
+	}
+}}
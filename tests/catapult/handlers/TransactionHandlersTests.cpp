@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/handlers/TransactionHandlers.h"
+#include "catapult/ionet/TransactionPackets.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
@@ -125,4 +126,120 @@ namespace catapult { namespace handlers {
 	DEFINE_PULL_HANDLER_TESTS(TEST_CLASS, PullTransactions)
 
 	// endregion
+
+	// region PullTransactionsReconciliationHandler
+
+	namespace {
+		constexpr auto Reconciliation_Packet_Type = ionet::PacketType::Pull_Transactions_Reconciliation;
+		constexpr auto Reconciliation_Header_Size = sizeof(ionet::PullTransactionsReconciliationResponseHeader);
+
+		struct ReconciliationRetrieverParams {
+			size_t NumCalls = 0;
+			std::vector<utils::ShortHashIbltCell> Cells;
+		};
+
+		void RegisterReconciliationHandler(
+				ionet::ServerPacketHandlers& handlers,
+				ReconciliationRetrieverParams& params,
+				bool isDecoded,
+				const UnconfirmedTransactions& transactions) {
+			RegisterPullTransactionsReconciliationHandler(handlers, [&params, isDecoded, transactions](
+					const auto& shortHashesIblt,
+					auto& unknownTransactions) {
+				++params.NumCalls;
+				params.Cells = shortHashesIblt.cells();
+				unknownTransactions = transactions;
+				return isDecoded;
+			});
+		}
+
+		void AssertReconciliationPacketIsRejected(uint32_t payloadSize, ionet::PacketType type, bool expectedCanProcessPacketType = true) {
+			// Arrange:
+			ReconciliationRetrieverParams params;
+			ionet::ServerPacketHandlers handlers;
+			RegisterReconciliationHandler(handlers, params, true, {});
+
+			auto pPacket = test::CreateRandomPacket(payloadSize, type);
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_EQ(expectedCanProcessPacketType, handlers.process(*pPacket, context));
+
+			// Assert:
+			EXPECT_EQ(0u, params.NumCalls);
+			test::AssertNoResponse(context);
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsReconciliationHandler_PacketWithWrongTypeIsRejected) {
+		// Assert:
+		AssertReconciliationPacketIsRejected(3 * sizeof(utils::ShortHashIbltCell), ionet::PacketType::Chain_Info, false);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsReconciliationHandler_PacketWithInvalidNumberOfCellsIsRejected) {
+		// Assert: empty table, number of cells not divisible by number of hash functions and partial cell
+		constexpr auto Cell_Size = static_cast<uint32_t>(sizeof(utils::ShortHashIbltCell));
+		for (auto payloadSize : { 0u, 4 * Cell_Size, 3 * Cell_Size + Cell_Size / 2 })
+			AssertReconciliationPacketIsRejected(payloadSize, Reconciliation_Packet_Type);
+	}
+
+	namespace {
+		void AssertReconciliationResponse(bool isDecoded, uint16_t numTransactions, uint16_t numExpectedTransactions) {
+			// Arrange:
+			UnconfirmedTransactions transactions;
+			for (uint16_t i = 0u; i < numTransactions; ++i)
+				transactions.push_back(mocks::CreateMockTransaction(i + 1));
+
+			ReconciliationRetrieverParams params;
+			ionet::ServerPacketHandlers handlers;
+			RegisterReconciliationHandler(handlers, params, isDecoded, transactions);
+
+			auto pPacket = test::CreateRandomPacket(6 * sizeof(utils::ShortHashIbltCell), Reconciliation_Packet_Type);
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_TRUE(handlers.process(*pPacket, context));
+
+			// Assert: the table was passed to the retriever
+			EXPECT_EQ(1u, params.NumCalls);
+			ASSERT_EQ(6u, params.Cells.size());
+			EXPECT_TRUE(0 == std::memcmp(pPacket->Data(), params.Cells.data(), 6 * sizeof(utils::ShortHashIbltCell)));
+
+			// - the response starts with the header and is followed by the expected transactions
+			ASSERT_TRUE(context.hasResponse());
+			auto expectedTransactionsSize = test::TotalSize(UnconfirmedTransactions(
+					transactions.cbegin(),
+					transactions.cbegin() + numExpectedTransactions));
+			auto expectedSize = sizeof(ionet::PacketHeader) + Reconciliation_Header_Size + expectedTransactionsSize;
+			test::AssertPacketHeader(context, expectedSize, Reconciliation_Packet_Type);
+
+			const auto& buffers = context.response().buffers();
+			ASSERT_EQ(1u + numExpectedTransactions, buffers.size());
+			ASSERT_EQ(Reconciliation_Header_Size, buffers[0].Size);
+			const auto& header = reinterpret_cast<const ionet::PullTransactionsReconciliationResponseHeader&>(*buffers[0].pData);
+			EXPECT_EQ(isDecoded ? 1u : 0u, header.IsDecoded);
+
+			for (auto i = 0u; i < numExpectedTransactions; ++i) {
+				const auto& transaction = reinterpret_cast<const mocks::MockTransaction&>(*buffers[1 + i].pData);
+				EXPECT_EQ(*transactions[i], transaction) << "transaction at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsReconciliationHandler_ResponseContainsUnknownTransactionsWhenDecoded) {
+		// Assert:
+		AssertReconciliationResponse(true, 3, 3);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsReconciliationHandler_ResponseContainsOnlyHeaderWhenDecodedAndAllTransactionsAreKnown) {
+		// Assert:
+		AssertReconciliationResponse(true, 0, 0);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsReconciliationHandler_ResponseContainsOnlyHeaderWhenNotDecoded) {
+		// Assert: any transactions returned by the retriever are dropped
+		AssertReconciliationResponse(false, 3, 0);
+	}
+
+	// endregion
 }}
@@ -202,6 +202,50 @@ namespace catapult { namespace io {
 		}
 	}
 
+	namespace {
+		void AssertLoadHashesAt(
+				size_t maxHashes,
+				const std::vector<Height>& requestHeights,
+				const std::vector<Height>& expectedHeights) {
+			// Arrange:
+			auto pStorage = mocks::CreateMemoryBasedStorage(Delegation_Chain_Size);
+			auto pStorageRaw = pStorage.get();
+			BlockStorageCache cache(std::move(pStorage));
+			auto heights = model::HeightRange::CopyFixed(reinterpret_cast<const uint8_t*>(requestHeights.data()), requestHeights.size());
+
+			// Act:
+			auto cacheHashes = cache.view().loadHashesAt(heights, maxHashes);
+
+			// Assert:
+			ASSERT_EQ(expectedHeights.size(), cacheHashes.size());
+
+			auto cacheIter = cacheHashes.cbegin();
+			for (auto height : expectedHeights) {
+				auto storageHashes = pStorageRaw->loadHashesFrom(height, 1);
+				EXPECT_EQ(*storageHashes.cbegin(), *cacheIter) << "at height " << height;
+				++cacheIter;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, LoadHashesAtDelegatesToStorage_AllHeights) {
+		// Assert:
+		AssertLoadHashesAt(10, { Height(1), Height(2), Height(7), Height(15) }, { Height(1), Height(2), Height(7), Height(15) });
+	}
+
+	TEST(TEST_CLASS, LoadHashesAtIsBoundedByMaxHashes) {
+		// Assert:
+		AssertLoadHashesAt(2, { Height(1), Height(2), Height(7), Height(15) }, { Height(1), Height(2) });
+	}
+
+	TEST(TEST_CLASS, LoadHashesAtStopsAtFirstInvalidHeight) {
+		// Assert:
+		AssertLoadHashesAt(10, { Height(0), Height(2) }, {});
+		AssertLoadHashesAt(10, { Height(1), Height(7), Height(7), Height(15) }, { Height(1), Height(7) });
+		AssertLoadHashesAt(10, { Height(1), Height(7), Height(2), Height(15) }, { Height(1), Height(7) });
+		AssertLoadHashesAt(10, { Height(1), Height(7), Height(16), Height(15) }, { Height(1), Height(7) });
+	}
+
 	// endregion
 
 	// region saveBlock(s)
@@ -332,5 +376,20 @@ namespace catapult { namespace io {
 
 	DEFINE_LOCK_PROVIDER_TESTS(TEST_CLASS)
 
+	TEST(TEST_CLASS, LockStatisticsAreInitiallyZero) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(7));
+
+		// Act:
+		cache.view();
+		cache.modifier();
+
+		// Assert: uncontended accesses do not wait
+		auto statistics = cache.lockStatistics();
+		EXPECT_EQ(0u, statistics.NumReaderWaits);
+		EXPECT_EQ(0u, statistics.NumWriterWaits);
+		EXPECT_EQ(0u, statistics.TotalWaitMicroseconds);
+	}
+
 	// endregion
 }}
@@ -19,9 +19,11 @@
 **/
 
 #include "catapult/ionet/BroadcastUtils.h"
+#include "catapult/model/EntityHasher.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace ionet {
@@ -62,6 +64,46 @@ namespace catapult { namespace ionet {
 		AssertCanCreateSingleEntityBroadcastPayload(pBlock, pBlock, PacketType::Push_Block);
 	}
 
+	namespace {
+		void AssertCanCreateCompactBroadcastPayload(size_t numTransactions) {
+			// Arrange:
+			auto registry = mocks::CreateDefaultTransactionRegistry();
+			auto pBlock = test::GenerateBlockWithTransactions(numTransactions);
+
+			std::vector<utils::ShortHash> expectedShortHashes;
+			for (const auto& transaction : pBlock->Transactions()) {
+				const auto& plugin = *registry.findPlugin(transaction.Type);
+				expectedShortHashes.push_back(utils::ToShortHash(model::CalculateHash(transaction, plugin.dataBuffer(transaction))));
+			}
+
+			// Act:
+			auto payload = CreateCompactBroadcastPayload(*pBlock, registry);
+
+			// Assert:
+			auto expectedDataSize = sizeof(model::BlockHeader) + numTransactions * sizeof(utils::ShortHash);
+			test::AssertPacketHeader(payload, sizeof(PacketHeader) + expectedDataSize, PacketType::Push_Compact_Block);
+			ASSERT_EQ(1u, payload.buffers().size());
+
+			// - the buffer contains the block header followed by the transaction short hashes
+			const auto& buffer = payload.buffers()[0];
+			ASSERT_EQ(expectedDataSize, buffer.Size);
+			EXPECT_TRUE(0 == std::memcmp(pBlock.get(), buffer.pData, sizeof(model::BlockHeader)));
+
+			const auto* pShortHashes = reinterpret_cast<const utils::ShortHash*>(buffer.pData + sizeof(model::BlockHeader));
+			EXPECT_EQ(expectedShortHashes, std::vector<utils::ShortHash>(pShortHashes, pShortHashes + numTransactions));
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateCompactBroadcastPayload_Block_WithoutTransactions) {
+		// Assert:
+		AssertCanCreateCompactBroadcastPayload(0);
+	}
+
+	TEST(TEST_CLASS, CanCreateCompactBroadcastPayload_Block_WithTransactions) {
+		// Assert:
+		AssertCanCreateCompactBroadcastPayload(3);
+	}
+
 	// endregion
 
 	// region transaction infos
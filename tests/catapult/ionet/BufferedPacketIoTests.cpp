@@ -20,7 +20,12 @@
 
 #include "catapult/ionet/BufferedPacketIo.h"
 #include "catapult/ionet/PacketSocket.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/net/ClientSocket.h"
 #include "tests/test/net/SocketTestUtils.h"
+#include "tests/test/nodeps/Waits.h"
+#include <mutex>
 
 namespace catapult { namespace ionet {
 
@@ -51,4 +56,354 @@ namespace catapult { namespace ionet {
 		// Assert:
 		test::AssertReadCanReadMultipleSimultaneousPayloadsWithoutInterleaving(Transform);
 	}
+
+	// region write coalescing (deferred io)
+
+	namespace {
+		constexpr size_t Max_Batch_Write_Size = 200;
+
+		struct WriteOperation {
+			bool IsBatch;
+			PacketPayloadWrites Writes;
+		};
+
+		// packet io that defers completion of all writes until they are explicitly completed
+		class DeferredWritePacketIo : public PacketIo {
+		public:
+			void read(const ReadCallback&) override {
+				CATAPULT_THROW_RUNTIME_ERROR("read - not supported in mock");
+			}
+
+			void write(const PacketPayload& payload, const WriteCallback& callback) override {
+				addWriteOperation(false, { std::make_pair(payload, callback) });
+			}
+
+			void writeBatch(const PacketPayloadWrites& writes) {
+				addWriteOperation(true, writes);
+			}
+
+		public:
+			size_t numWriteOperations() const {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				return m_writeOperations.size();
+			}
+
+			std::vector<WriteOperation> writeOperations() const {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				return m_writeOperations;
+			}
+
+			void complete(size_t index, const std::vector<SocketOperationCode>& codes) {
+				auto writes = writeOperations()[index].Writes;
+				for (auto i = 0u; i < writes.size(); ++i)
+					writes[i].second(codes[i]);
+			}
+
+		private:
+			void addWriteOperation(bool isBatch, const PacketPayloadWrites& writes) {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_writeOperations.push_back({ isBatch, writes });
+			}
+
+		private:
+			mutable std::mutex m_mutex;
+			std::vector<WriteOperation> m_writeOperations;
+		};
+
+		class CoalescingTestContext {
+		public:
+			explicit CoalescingTestContext(size_t maxBatchWriteSize)
+					: m_pPool(test::CreateStartedIoServiceThreadPool(1))
+					, m_strand(m_pPool->service())
+					, m_pDeferredIo(std::make_shared<DeferredWritePacketIo>())
+					, m_pIo(CreateBufferedPacketIo(m_pDeferredIo, m_strand, createBatchWriter(), maxBatchWriteSize))
+					, m_numWrites(0)
+			{}
+
+			~CoalescingTestContext() {
+				m_pPool->join();
+			}
+
+		public:
+			DeferredWritePacketIo& deferredIo() {
+				return *m_pDeferredIo;
+			}
+
+			std::vector<std::pair<size_t, SocketOperationCode>> completions() const {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				return m_completions;
+			}
+
+		public:
+			void write(const std::vector<uint32_t>& payloadSizes) {
+				for (auto payloadSize : payloadSizes) {
+					auto id = m_numWrites++;
+					m_pIo->write(test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(payloadSize)), [this, id](auto code) {
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_completions.emplace_back(id, code);
+					});
+				}
+			}
+
+			void completeAndWait(size_t index, const std::vector<SocketOperationCode>& codes, size_t numExpectedWriteOperations) {
+				m_pDeferredIo->complete(index, codes);
+				WAIT_FOR_VALUE_EXPR(numExpectedWriteOperations, m_pDeferredIo->numWriteOperations());
+			}
+
+		private:
+			BatchPacketWriter createBatchWriter() {
+				return [pDeferredIo = m_pDeferredIo](const auto& writes) {
+					pDeferredIo->writeBatch(writes);
+				};
+			}
+
+		private:
+			std::unique_ptr<thread::IoServiceThreadPool> m_pPool;
+			boost::asio::strand m_strand;
+			std::shared_ptr<DeferredWritePacketIo> m_pDeferredIo;
+			std::shared_ptr<PacketIo> m_pIo;
+
+			size_t m_numWrites;
+			mutable std::mutex m_mutex;
+			std::vector<std::pair<size_t, SocketOperationCode>> m_completions;
+		};
+
+		void AssertWriteOperation(
+				const WriteOperation& writeOperation,
+				bool expectedIsBatch,
+				const std::vector<uint32_t>& expectedPayloadSizes,
+				const std::string& message) {
+			EXPECT_EQ(expectedIsBatch, writeOperation.IsBatch) << message;
+			ASSERT_EQ(expectedPayloadSizes.size(), writeOperation.Writes.size()) << message;
+
+			for (auto i = 0u; i < expectedPayloadSizes.size(); ++i)
+				EXPECT_EQ(expectedPayloadSizes[i], writeOperation.Writes[i].first.header().Size) << message << " payload " << i;
+		}
+
+		void AssertCompletions(
+				const std::vector<std::pair<size_t, SocketOperationCode>>& expectedCompletions,
+				const CoalescingTestContext& context) {
+			// wait for all completion callbacks, which are invoked on the strand
+			WAIT_FOR_VALUE_EXPR(expectedCompletions.size(), context.completions().size());
+
+			auto completions = context.completions();
+			for (auto i = 0u; i < expectedCompletions.size(); ++i) {
+				EXPECT_EQ(expectedCompletions[i].first, completions[i].first) << "completion " << i;
+				EXPECT_EQ(expectedCompletions[i].second, completions[i].second) << "completion " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, WriteCoalescesQueuedWritesThatFitIntoBatchWrite) {
+		// Arrange:
+		CoalescingTestContext context(Max_Batch_Write_Size);
+
+		// Act: first write is started immediately and all other writes are queued behind it
+		context.write({ 50, 50, 60, 40, 70 });
+		WAIT_FOR_ONE_EXPR(context.deferredIo().numWriteOperations());
+
+		context.completeAndWait(0, { SocketOperationCode::Success }, 2);
+		context.completeAndWait(1, std::vector<SocketOperationCode>(3, SocketOperationCode::Success), 3);
+		context.deferredIo().complete(2, { SocketOperationCode::Success });
+
+		// Assert: queued writes were coalesced as long as they did not exceed max batch write size (50 + 60 + 40 + 70 > 200)
+		auto writeOperations = context.deferredIo().writeOperations();
+		ASSERT_EQ(3u, writeOperations.size());
+		AssertWriteOperation(writeOperations[0], false, { 50 }, "operation 0");
+		AssertWriteOperation(writeOperations[1], true, { 50, 60, 40 }, "operation 1");
+		AssertWriteOperation(writeOperations[2], false, { 70 }, "operation 2");
+
+		// - all callbacks were invoked in order
+		AssertCompletions({
+			{ 0, SocketOperationCode::Success },
+			{ 1, SocketOperationCode::Success },
+			{ 2, SocketOperationCode::Success },
+			{ 3, SocketOperationCode::Success },
+			{ 4, SocketOperationCode::Success }
+		}, context);
+	}
+
+	TEST(TEST_CLASS, WriteDoesNotCoalesceQueuedWritesWhenMaxBatchWriteSizeIsZero) {
+		// Arrange:
+		CoalescingTestContext context(0);
+
+		// Act:
+		context.write({ 50, 50, 60 });
+		WAIT_FOR_ONE_EXPR(context.deferredIo().numWriteOperations());
+
+		context.completeAndWait(0, { SocketOperationCode::Success }, 2);
+		context.completeAndWait(1, { SocketOperationCode::Success }, 3);
+		context.deferredIo().complete(2, { SocketOperationCode::Success });
+
+		// Assert: all writes were forwarded individually
+		auto writeOperations = context.deferredIo().writeOperations();
+		ASSERT_EQ(3u, writeOperations.size());
+		AssertWriteOperation(writeOperations[0], false, { 50 }, "operation 0");
+		AssertWriteOperation(writeOperations[1], false, { 50 }, "operation 1");
+		AssertWriteOperation(writeOperations[2], false, { 60 }, "operation 2");
+
+		AssertCompletions({
+			{ 0, SocketOperationCode::Success },
+			{ 1, SocketOperationCode::Success },
+			{ 2, SocketOperationCode::Success }
+		}, context);
+	}
+
+	TEST(TEST_CLASS, WriteForwardsPerPayloadResultsOfBatchWrite) {
+		// Arrange:
+		CoalescingTestContext context(Max_Batch_Write_Size);
+
+		// Act:
+		context.write({ 50, 50, 60, 40 });
+		WAIT_FOR_ONE_EXPR(context.deferredIo().numWriteOperations());
+
+		context.completeAndWait(0, { SocketOperationCode::Success }, 2);
+		context.deferredIo().complete(1, {
+			SocketOperationCode::Success,
+			SocketOperationCode::Malformed_Data,
+			SocketOperationCode::Write_Error
+		});
+
+		// Assert:
+		auto writeOperations = context.deferredIo().writeOperations();
+		ASSERT_EQ(2u, writeOperations.size());
+		AssertWriteOperation(writeOperations[0], false, { 50 }, "operation 0");
+		AssertWriteOperation(writeOperations[1], true, { 50, 60, 40 }, "operation 1");
+
+		AssertCompletions({
+			{ 0, SocketOperationCode::Success },
+			{ 1, SocketOperationCode::Success },
+			{ 2, SocketOperationCode::Malformed_Data },
+			{ 3, SocketOperationCode::Write_Error }
+		}, context);
+	}
+
+	// endregion
+
+	// region write coalescing (socket)
+
+	namespace {
+		constexpr size_t Max_Coalesced_Write_Size = 200;
+
+		struct CoalescedWritesResult {
+			std::vector<SocketOperationCode> WriteCodes;
+			std::vector<size_t> CompletionIndexes;
+			ByteBuffer ReceivedBuffer;
+		};
+
+		CoalescedWritesResult WriteSimultaneouslyWithCoalescing(
+				const std::vector<ByteBuffer>& packetBuffers,
+				const PacketSocketOptions& options,
+				size_t numExpectedReceivedBytes,
+				bool closeBeforeWrite) {
+			// Arrange: set up payloads
+			std::vector<PacketPayload> payloads;
+			for (const auto& packetBuffer : packetBuffers)
+				payloads.push_back(test::BufferToPacketPayload(packetBuffer));
+
+			CoalescedWritesResult result;
+			result.ReceivedBuffer.resize(numExpectedReceivedBytes);
+
+			// Act: "server" - starts multiple concurrent async write operations on a buffered io
+			//      "client" - reads all payloads from the socket
+			auto pPool = test::CreateStartedIoServiceThreadPool();
+			test::SpawnPacketServerWork(pPool->service(), options, [&payloads, closeBeforeWrite, &result](const auto& pServerSocket) {
+				if (closeBeforeWrite)
+					pServerSocket->close();
+
+				auto pIo = pServerSocket->buffered();
+				for (auto i = 0u; i < payloads.size(); ++i) {
+					pIo->write(payloads[i], [i, &result](auto code) {
+						// callbacks are serialized by the socket strand
+						result.WriteCodes.push_back(code);
+						result.CompletionIndexes.push_back(i);
+					});
+				}
+			});
+			test::AddClientReadBufferTask(pPool->service(), result.ReceivedBuffer);
+			pPool->join();
+			return result;
+		}
+
+		PacketSocketOptions CreateCoalescingPacketSocketOptions() {
+			auto options = test::CreatePacketSocketOptions();
+			options.MaxCoalescedWriteSize = Max_Coalesced_Write_Size;
+			return options;
+		}
+
+		ByteBuffer Concatenate(const std::vector<ByteBuffer>& packetBuffers) {
+			ByteBuffer buffer;
+			for (const auto& packetBuffer : packetBuffers)
+				buffer.insert(buffer.end(), packetBuffer.cbegin(), packetBuffer.cend());
+
+			return buffer;
+		}
+
+		void AssertCoalescedWritesSuccess(const std::vector<ByteBuffer>& packetBuffers) {
+			// Act:
+			auto expectedBuffer = Concatenate(packetBuffers);
+			auto options = CreateCoalescingPacketSocketOptions();
+			auto result = WriteSimultaneouslyWithCoalescing(packetBuffers, options, expectedBuffer.size(), false);
+
+			// Assert: all writes succeeded and completed in order
+			ASSERT_EQ(packetBuffers.size(), result.WriteCodes.size());
+			for (auto i = 0u; i < packetBuffers.size(); ++i) {
+				EXPECT_EQ(SocketOperationCode::Success, result.WriteCodes[i]) << "write " << i;
+				EXPECT_EQ(i, result.CompletionIndexes[i]) << "write " << i;
+			}
+
+			// - all data was read from the socket in order
+			EXPECT_EQ(test::ToHexString(expectedBuffer), test::ToHexString(result.ReceivedBuffer));
+		}
+	}
+
+	TEST(TEST_CLASS, WriteCoalescingCanWriteMultipleSimultaneousSmallPayloads) {
+		// Arrange: set up payloads that can be coalesced
+		auto packetBuffers = test::GenerateRandomPacketBuffers({ 50, 50, 60, 40, 50, 50, 70, 30, 100, 100 });
+
+		// Assert:
+		AssertCoalescedWritesSuccess(packetBuffers);
+	}
+
+	TEST(TEST_CLASS, WriteCoalescingCanWriteMultipleSimultaneousPayloadsLargerThanMaxCoalescedWriteSize) {
+		// Arrange: set up payloads that cannot be coalesced
+		auto packetBuffers = test::GenerateRandomPacketBuffers({ 300, 50, 201, 250, 50 });
+
+		// Assert:
+		AssertCoalescedWritesSuccess(packetBuffers);
+	}
+
+	TEST(TEST_CLASS, WriteCoalescingBypassesMalformedPayloads) {
+		// Arrange: second payload is too large
+		auto packetBuffers = test::GenerateRandomPacketBuffers({ 50, 120, 60 });
+		auto options = CreateCoalescingPacketSocketOptions();
+		options.MaxPacketDataSize = 100;
+
+		// Act:
+		auto result = WriteSimultaneouslyWithCoalescing(packetBuffers, options, 110, false);
+
+		// Assert: only the malformed payload was not written
+		ASSERT_EQ(3u, result.WriteCodes.size());
+		EXPECT_EQ(SocketOperationCode::Success, result.WriteCodes[0]);
+		EXPECT_EQ(SocketOperationCode::Malformed_Data, result.WriteCodes[1]);
+		EXPECT_EQ(SocketOperationCode::Success, result.WriteCodes[2]);
+
+		auto expectedBuffer = Concatenate({ packetBuffers[0], packetBuffers[2] });
+		EXPECT_EQ(test::ToHexString(expectedBuffer), test::ToHexString(result.ReceivedBuffer));
+	}
+
+	TEST(TEST_CLASS, WriteCoalescingFailsAllPendingWritesWhenSocketWriteFails) {
+		// Arrange:
+		auto packetBuffers = test::GenerateRandomPacketBuffers({ 50, 60, 70 });
+
+		// Act:
+		auto result = WriteSimultaneouslyWithCoalescing(packetBuffers, CreateCoalescingPacketSocketOptions(), 180, true);
+
+		// Assert: all writes failed
+		ASSERT_EQ(3u, result.WriteCodes.size());
+		for (auto i = 0u; i < result.WriteCodes.size(); ++i)
+			EXPECT_EQ(SocketOperationCode::Write_Error, result.WriteCodes[i]) << "write " << i;
+	}
+
+	// endregion
 }}
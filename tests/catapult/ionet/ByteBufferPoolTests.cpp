@@ -0,0 +1,123 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/ByteBufferPool.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS ByteBufferPoolTests
+
+	TEST(TEST_CLASS, CanCreatePool) {
+		// Act:
+		ByteBufferPool pool(123, 5);
+
+		// Assert:
+		EXPECT_EQ(123u, pool.bufferCapacity());
+		EXPECT_EQ(0u, pool.numPooledBuffers());
+	}
+
+	TEST(TEST_CLASS, CanAcquireBufferFromEmptyPool) {
+		// Arrange:
+		ByteBufferPool pool(123, 5);
+
+		// Act:
+		auto buffer = pool.acquire();
+
+		// Assert:
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_EQ(123u, buffer.capacity());
+		EXPECT_EQ(0u, pool.numPooledBuffers());
+	}
+
+	TEST(TEST_CLASS, ReleasedBufferIsClearedAndReused) {
+		// Arrange:
+		ByteBufferPool pool(123, 5);
+		auto buffer = pool.acquire();
+		buffer.resize(100);
+		const auto* pBufferData = buffer.data();
+
+		// Act:
+		pool.release(std::move(buffer));
+		auto reacquiredBuffer = pool.acquire();
+
+		// Assert:
+		EXPECT_EQ(0u, reacquiredBuffer.size());
+		EXPECT_EQ(123u, reacquiredBuffer.capacity());
+		EXPECT_EQ(pBufferData, reacquiredBuffer.data());
+		EXPECT_EQ(0u, pool.numPooledBuffers());
+	}
+
+	TEST(TEST_CLASS, ReleasedBuffersAreRetainedUpToPoolSize) {
+		// Arrange:
+		ByteBufferPool pool(123, 3);
+		std::vector<ByteBuffer> buffers;
+		for (auto i = 0u; i < 5; ++i)
+			buffers.push_back(pool.acquire());
+
+		// Act:
+		for (auto& buffer : buffers)
+			pool.release(std::move(buffer));
+
+		// Assert:
+		EXPECT_EQ(3u, pool.numPooledBuffers());
+	}
+
+	TEST(TEST_CLASS, ReleasedBufferWithDifferentCapacityIsDiscarded) {
+		// Arrange:
+		ByteBufferPool pool(123, 5);
+		auto grownBuffer = pool.acquire();
+		grownBuffer.resize(1000);
+
+		ByteBuffer foreignBuffer;
+		foreignBuffer.reserve(100);
+
+		// Act:
+		pool.release(std::move(grownBuffer));
+		pool.release(std::move(foreignBuffer));
+
+		// Assert:
+		EXPECT_EQ(0u, pool.numPooledBuffers());
+	}
+
+	TEST(TEST_CLASS, PoolIsThreadSafe) {
+		// Arrange:
+		ByteBufferPool pool(123, 10);
+
+		// Act: acquire and release buffers from multiple threads
+		boost::thread_group threads;
+		for (auto i = 0u; i < test::GetNumDefaultPoolThreads(); ++i) {
+			threads.create_thread([&pool]() {
+				for (auto j = 0u; j < 1000; ++j) {
+					auto buffer = pool.acquire();
+					buffer.push_back(static_cast<uint8_t>(j));
+					pool.release(std::move(buffer));
+				}
+			});
+		}
+
+		threads.join_all();
+
+		// Assert: buffers were returned to the pool
+		EXPECT_GE(10u, pool.numPooledBuffers());
+		EXPECT_LT(0u, pool.numPooledBuffers());
+	}
+}}
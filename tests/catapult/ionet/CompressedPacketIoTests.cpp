@@ -0,0 +1,384 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/CompressedPacketIo.h"
+#include "tests/test/core/PacketIoTestUtils.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
+#include "tests/TestHarness.h"
+#include <sstream>
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS CompressedPacketIoTests
+
+	namespace {
+		constexpr uint32_t Compression_Threshold = 200;
+		constexpr uint32_t Max_Packet_Data_Size = 10'000;
+		constexpr auto Compressed_Header_Size = sizeof(PacketHeader) + sizeof(uint32_t);
+
+		struct TestContext {
+		public:
+			explicit TestContext(uint32_t compressionThreshold = Compression_Threshold)
+					: pMockPacketIo(std::make_shared<mocks::MockPacketIo>())
+					, pStatistics(std::make_shared<PacketCompressionStatistics>())
+					, pCompressedIo(CreateCompressedPacketIo(pMockPacketIo, compressionThreshold, Max_Packet_Data_Size, pStatistics))
+					, pCompressedBatchReader(CreateCompressedBatchPacketReader(pMockPacketIo, Max_Packet_Data_Size, pStatistics))
+			{}
+
+		public:
+			std::shared_ptr<mocks::MockPacketIo> pMockPacketIo;
+			std::shared_ptr<PacketCompressionStatistics> pStatistics;
+			std::shared_ptr<PacketIo> pCompressedIo;
+			std::shared_ptr<BatchPacketReader> pCompressedBatchReader;
+		};
+
+		std::shared_ptr<Packet> CreateCompressiblePacket(uint32_t payloadSize) {
+			auto pPacket = CreateSharedPacket<Packet>(payloadSize);
+			pPacket->Type = PacketType::Push_Transactions;
+			for (auto i = 0u; i < payloadSize; ++i)
+				pPacket->Data()[i] = static_cast<uint8_t>(i % 8);
+
+			return pPacket;
+		}
+
+		SocketOperationCode Write(const TestContext& context, const PacketPayload& payload) {
+			SocketOperationCode writeCode;
+			context.pCompressedIo->write(payload, [&writeCode](auto code) {
+				writeCode = code;
+			});
+			return writeCode;
+		}
+
+		std::shared_ptr<Packet> CompressPacket(const std::shared_ptr<Packet>& pPacket) {
+			TestContext context;
+			context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+			Write(context, PacketPayload(pPacket));
+
+			const auto& writtenPacket = context.pMockPacketIo->writtenPacketAt<Packet>(0);
+			auto pCompressedPacket = CreateSharedPacket<Packet>(writtenPacket.Size - sizeof(PacketHeader));
+			std::memcpy(static_cast<void*>(pCompressedPacket.get()), &writtenPacket, writtenPacket.Size);
+			return pCompressedPacket;
+		}
+	}
+
+	// region PacketCompressionStatistics
+
+	TEST(TEST_CLASS, CanOutputStatistics) {
+		// Arrange:
+		PacketCompressionStatistics statistics;
+		statistics.NumCompressedPackets = 3;
+		statistics.NumUncompressedBytes = 1200;
+		statistics.NumCompressedBytes = 400;
+		statistics.NumDecompressedPackets = 5;
+
+		// Act:
+		std::ostringstream out;
+		out << statistics;
+
+		// Assert:
+		EXPECT_EQ("compressed 3 packets (1200 -> 400 bytes), decompressed 5 packets", out.str());
+	}
+
+	// endregion
+
+	// region PacketIo - write
+
+	namespace {
+		void AssertWriteForwardsPacketUncompressed(
+				const std::shared_ptr<Packet>& pPacket,
+				uint32_t compressionThreshold = Compression_Threshold) {
+			// Arrange:
+			TestContext context(compressionThreshold);
+			context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+			// Act:
+			auto writeCode = Write(context, PacketPayload(pPacket));
+			const auto& writtenPacket = context.pMockPacketIo->writtenPacketAt<Packet>(0);
+
+			// Assert:
+			EXPECT_EQ(SocketOperationCode::Success, writeCode);
+			ASSERT_EQ(pPacket->Size, writtenPacket.Size);
+			EXPECT_EQ(pPacket->Type, writtenPacket.Type);
+			EXPECT_TRUE(0 == std::memcmp(pPacket.get(), &writtenPacket, pPacket->Size));
+
+			EXPECT_EQ(0u, context.pStatistics->NumCompressedPackets);
+		}
+	}
+
+	TEST(TEST_CLASS, WriteDoesNotCompressPacketBelowThreshold) {
+		// Assert:
+		AssertWriteForwardsPacketUncompressed(CreateCompressiblePacket(Compression_Threshold - sizeof(PacketHeader) - 1));
+	}
+
+	TEST(TEST_CLASS, WriteDoesNotCompressPacketWhenThresholdIsZero) {
+		// Assert: zero threshold disables compression of written packets
+		AssertWriteForwardsPacketUncompressed(CreateCompressiblePacket(Compression_Threshold), 0);
+	}
+
+	TEST(TEST_CLASS, WriteDoesNotCompressIncompressiblePacket) {
+		// Assert: random data cannot be compressed
+		AssertWriteForwardsPacketUncompressed(test::CreateRandomPacket(500, PacketType::Push_Transactions));
+	}
+
+	TEST(TEST_CLASS, WriteCompressesCompressiblePacketAtThreshold) {
+		// Arrange:
+		TestContext context;
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+		auto pPacket = CreateCompressiblePacket(Compression_Threshold - sizeof(PacketHeader));
+
+		// Act:
+		auto writeCode = Write(context, PacketPayload(pPacket));
+		const auto& writtenPacket = context.pMockPacketIo->writtenPacketAt<Packet>(0);
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Success, writeCode);
+		EXPECT_EQ(PacketType::Compressed, writtenPacket.Type);
+		EXPECT_GT(pPacket->Size, writtenPacket.Size);
+		EXPECT_EQ(Compression_Threshold, reinterpret_cast<const uint32_t&>(*writtenPacket.Data()));
+
+		EXPECT_EQ(1u, context.pStatistics->NumCompressedPackets);
+		EXPECT_EQ(Compression_Threshold, context.pStatistics->NumUncompressedBytes);
+		EXPECT_EQ(writtenPacket.Size, context.pStatistics->NumCompressedBytes);
+		EXPECT_EQ(0u, context.pStatistics->NumDecompressedPackets);
+	}
+
+	TEST(TEST_CLASS, WriteCompressesEachPacketIndependently) {
+		// Arrange:
+		TestContext context;
+		for (auto i = 0u; i < 3; ++i)
+			context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+		auto pPacket = CreateCompressiblePacket(Compression_Threshold);
+		auto pIncompressiblePacket = test::CreateRandomPacket(500, PacketType::Push_Transactions);
+
+		// Act: write a compressible packet before and after a packet that cannot be compressed
+		Write(context, PacketPayload(pPacket));
+		Write(context, PacketPayload(pIncompressiblePacket));
+		Write(context, PacketPayload(pPacket));
+
+		const auto& writtenPacket1 = context.pMockPacketIo->writtenPacketAt<Packet>(0);
+		const auto& writtenPacket2 = context.pMockPacketIo->writtenPacketAt<Packet>(2);
+
+		// Assert: the (reused) deflate stream is reset for every packet, so the same packet is always compressed identically
+		EXPECT_EQ(PacketType::Compressed, writtenPacket1.Type);
+		ASSERT_EQ(writtenPacket1.Size, writtenPacket2.Size);
+		EXPECT_TRUE(0 == std::memcmp(&writtenPacket1, &writtenPacket2, writtenPacket1.Size));
+
+		EXPECT_EQ(2u, context.pStatistics->NumCompressedPackets);
+	}
+
+	TEST(TEST_CLASS, WriteForwardsInnerWriteError) {
+		// Arrange:
+		TestContext context;
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Write_Error);
+
+		// Act:
+		auto writeCode = Write(context, PacketPayload(CreateCompressiblePacket(1000)));
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Write_Error, writeCode);
+		EXPECT_EQ(1u, context.pMockPacketIo->numWrites());
+	}
+
+	// endregion
+
+	// region PacketIo - read, BatchPacketReader - readMultiple (single packet)
+
+	namespace {
+		struct ReadCallbackParams {
+			bool IsPacketValid;
+			SocketOperationCode ReadCode;
+			std::vector<uint8_t> ReadPacketBytes;
+		};
+
+		PacketIo::ReadCallback CreateReadCaptureCallback(ReadCallbackParams& capture) {
+			return [&capture](auto code, const auto* pReadPacket) {
+				capture.ReadCode = code;
+				capture.IsPacketValid = !!pReadPacket;
+				if (capture.IsPacketValid)
+					capture.ReadPacketBytes = test::CopyPacketToBuffer(*pReadPacket);
+			};
+		}
+
+		struct PacketIoReadTraits {
+			static void Read(const TestContext& context, const PacketIo::ReadCallback& callback) {
+				context.pCompressedIo->read(callback);
+			}
+		};
+
+		struct BatchPacketReaderReadTraits {
+			static void Read(const TestContext& context, const PacketIo::ReadCallback& callback) {
+				context.pCompressedBatchReader->readMultiple(callback);
+			}
+		};
+
+		template<typename TReadTraits>
+		ReadCallbackParams Read(const TestContext& context, const std::shared_ptr<Packet>& pPacket) {
+			context.pMockPacketIo->queueRead(SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+
+			ReadCallbackParams capture;
+			TReadTraits::Read(context, CreateReadCaptureCallback(capture));
+			return capture;
+		}
+
+		template<typename TReadTraits, typename TMutator>
+		void RunFailedReadTest(TMutator mutator) {
+			// Arrange: create a compressed packet and mutate it
+			TestContext context;
+			auto pPacket = CompressPacket(CreateCompressiblePacket(1000));
+			mutator(*pPacket);
+
+			// Act:
+			auto capture = Read<TReadTraits>(context, pPacket);
+
+			// Assert:
+			EXPECT_EQ(SocketOperationCode::Malformed_Data, capture.ReadCode);
+			EXPECT_FALSE(capture.IsPacketValid);
+			EXPECT_EQ(0u, context.pStatistics->NumDecompressedPackets);
+		}
+
+		uint32_t& GetUncompressedSize(Packet& packet) {
+			return reinterpret_cast<uint32_t&>(*packet.Data());
+		}
+	}
+
+#define READ_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PacketIoReadTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_BatchReader) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BatchPacketReaderReadTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	READ_TRAITS_BASED_TEST(ReadForwardsInnerReadError) {
+		// Arrange:
+		TestContext context;
+		context.pMockPacketIo->queueRead(SocketOperationCode::Read_Error, nullptr);
+
+		// Act:
+		ReadCallbackParams capture;
+		TTraits::Read(context, CreateReadCaptureCallback(capture));
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Read_Error, capture.ReadCode);
+		EXPECT_FALSE(capture.IsPacketValid);
+	}
+
+	READ_TRAITS_BASED_TEST(ReadForwardsUncompressedPacket) {
+		// Arrange:
+		TestContext context;
+		auto pPacket = test::CreateRandomPacket(500, PacketType::Push_Transactions);
+
+		// Act:
+		auto capture = Read<TTraits>(context, pPacket);
+
+		// Assert:
+		ASSERT_EQ(SocketOperationCode::Success, capture.ReadCode);
+		ASSERT_EQ(pPacket->Size, capture.ReadPacketBytes.size());
+		EXPECT_TRUE(0 == std::memcmp(pPacket.get(), capture.ReadPacketBytes.data(), pPacket->Size));
+		EXPECT_EQ(0u, context.pStatistics->NumDecompressedPackets);
+	}
+
+	READ_TRAITS_BASED_TEST(ReadDecompressesCompressedPacket) {
+		// Arrange:
+		TestContext context;
+		auto pPacket = CreateCompressiblePacket(1000);
+
+		// Act:
+		auto capture = Read<TTraits>(context, CompressPacket(pPacket));
+
+		// Assert:
+		ASSERT_EQ(SocketOperationCode::Success, capture.ReadCode);
+		ASSERT_EQ(pPacket->Size, capture.ReadPacketBytes.size());
+		EXPECT_TRUE(0 == std::memcmp(pPacket.get(), capture.ReadPacketBytes.data(), pPacket->Size));
+		EXPECT_EQ(1u, context.pStatistics->NumDecompressedPackets);
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenCompressedPacketSizeIsTooSmall) {
+		// Assert:
+		RunFailedReadTest<TTraits>([](auto& packet) {
+			packet.Size = static_cast<uint32_t>(Compressed_Header_Size - 1);
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenUncompressedSizeIsTooSmall) {
+		// Assert:
+		RunFailedReadTest<TTraits>([](auto& packet) {
+			GetUncompressedSize(packet) = sizeof(PacketHeader) - 1;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenUncompressedSizeExceedsMaxPacketDataSize) {
+		// Assert:
+		RunFailedReadTest<TTraits>([](auto& packet) {
+			GetUncompressedSize(packet) = sizeof(PacketHeader) + Max_Packet_Data_Size + 1;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenUncompressedSizeDoesNotMatchDecompressedSize) {
+		// Assert:
+		RunFailedReadTest<TTraits>([](auto& packet) { --GetUncompressedSize(packet); });
+		RunFailedReadTest<TTraits>([](auto& packet) { ++GetUncompressedSize(packet); });
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenCompressedDataIsCorrupt) {
+		// Assert:
+		RunFailedReadTest<TTraits>([](auto& packet) {
+			auto* pCompressedData = reinterpret_cast<uint8_t*>(&packet) + Compressed_Header_Size;
+			std::memset(pCompressedData, 0xFF, packet.Size - Compressed_Header_Size);
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenChildPacketIsCompressed) {
+		// Arrange: compress a (compressible) packet with a compressed packet type
+		TestContext context;
+		auto pNestedPacket = CreateSharedPacket<Packet>(1000);
+		pNestedPacket->Type = PacketType::Compressed;
+		GetUncompressedSize(*pNestedPacket) = 0;
+
+		// Act:
+		auto capture = Read<TTraits>(context, CompressPacket(pNestedPacket));
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Malformed_Data, capture.ReadCode);
+		EXPECT_FALSE(capture.IsPacketValid);
+	}
+
+	// endregion
+
+	// region PacketIo - round trip
+
+	TEST(TEST_CLASS, CanRoundtripWriteAndRead) {
+		// Arrange:
+		TestContext context;
+
+		// Act + Assert:
+		test::AssertCanRoundtripPackets(*context.pMockPacketIo, *context.pCompressedIo);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripWriteAndReadMultiple) {
+		// Arrange:
+		TestContext context;
+
+		// Act + Assert:
+		test::AssertCanRoundtripPackets(*context.pMockPacketIo, *context.pCompressedIo, *context.pCompressedBatchReader);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,563 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/MultiplexedPacketIo.h"
+#include "catapult/ionet/PacketIo.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS MultiplexedPacketIoTests
+
+	namespace {
+		const auto Default_Request_Timeout = utils::TimeSpan::FromMinutes(1);
+
+		// region ManualPacketIo
+
+		/// Packet io that completes writes immediately and completes reads on demand.
+		class ManualPacketIo : public PacketIo {
+		public:
+			ManualPacketIo() : m_numReads(0), m_writeCode(SocketOperationCode::Success)
+			{}
+
+		public:
+			size_t numReads() const {
+				return m_numReads;
+			}
+
+			bool hasPendingRead() const {
+				return !!m_readCallback;
+			}
+
+			const std::vector<ByteBuffer>& writtenBuffers() const {
+				return m_writtenBuffers;
+			}
+
+			void setWriteCode(SocketOperationCode code) {
+				m_writeCode = code;
+			}
+
+		public:
+			void read(const ReadCallback& callback) override {
+				++m_numReads;
+				m_readCallback = callback;
+			}
+
+			void write(const PacketPayload& payload, const WriteCallback& callback) override {
+				ByteBuffer buffer(payload.header().Size);
+				std::memcpy(buffer.data(), &payload.header(), sizeof(PacketHeader));
+
+				auto offset = sizeof(PacketHeader);
+				for (const auto& payloadBuffer : payload.buffers()) {
+					std::memcpy(buffer.data() + offset, payloadBuffer.pData, payloadBuffer.Size);
+					offset += payloadBuffer.Size;
+				}
+
+				m_writtenBuffers.push_back(buffer);
+				callback(m_writeCode);
+			}
+
+		public:
+			void completeRead(SocketOperationCode code, const Packet* pPacket) {
+				auto callback = m_readCallback;
+				m_readCallback = ReadCallback();
+				callback(code, pPacket);
+			}
+
+		private:
+			size_t m_numReads;
+			SocketOperationCode m_writeCode;
+			ReadCallback m_readCallback;
+			std::vector<ByteBuffer> m_writtenBuffers;
+		};
+
+		// endregion
+
+		// region test utils
+
+		std::shared_ptr<Packet> CreateMultiplexedPacket(uint32_t requestId, const ByteBuffer& childBuffer) {
+			auto pPacket = CreateSharedPacket<MultiplexedPacket>(static_cast<uint32_t>(childBuffer.size()));
+			pPacket->RequestId = requestId;
+			std::memcpy(static_cast<void*>(pPacket.get() + 1), childBuffer.data(), childBuffer.size());
+			return pPacket;
+		}
+
+		struct ReadResult {
+		public:
+			ReadResult() : NumCallbacks(0), Code(SocketOperationCode::Success)
+			{}
+
+		public:
+			std::atomic<size_t> NumCallbacks;
+			SocketOperationCode Code;
+			ByteBuffer Buffer;
+		};
+
+		class TestContext {
+		public:
+			explicit TestContext(const utils::TimeSpan& requestTimeout = Default_Request_Timeout)
+					: m_pPool(test::CreateStartedIoServiceThreadPool())
+					, pIo(std::make_shared<ManualPacketIo>())
+					, pMultiplexer(CreatePacketMultiplexer(pIo, m_pPool->service(), requestTimeout))
+			{}
+
+			~TestContext() {
+				pMultiplexer.reset();
+				m_pPool->join();
+			}
+
+		private:
+			std::unique_ptr<thread::IoServiceThreadPool> m_pPool;
+
+		public:
+			std::shared_ptr<ManualPacketIo> pIo;
+			std::shared_ptr<PacketMultiplexer> pMultiplexer;
+
+		public:
+			SocketOperationCode write(PacketIo& channel, const ByteBuffer& buffer) {
+				SocketOperationCode writeCode;
+				channel.write(test::BufferToPacketPayload(buffer), [&writeCode](auto code) {
+					writeCode = code;
+				});
+				return writeCode;
+			}
+
+			void read(PacketIo& channel, ReadResult& result) {
+				channel.read([&result](auto code, const auto* pPacket) {
+					result.Code = code;
+					if (pPacket)
+						result.Buffer = test::CopyPacketToBuffer(*pPacket);
+
+					++result.NumCallbacks;
+				});
+			}
+
+			void respond(uint32_t requestId, const ByteBuffer& childBuffer) {
+				auto pPacket = CreateMultiplexedPacket(requestId, childBuffer);
+				pIo->completeRead(SocketOperationCode::Success, pPacket.get());
+			}
+		};
+
+		void AssertReadResult(const ReadResult& result, SocketOperationCode expectedCode, const ByteBuffer& expectedBuffer) {
+			WAIT_FOR_ONE(result.NumCallbacks);
+			EXPECT_EQ(expectedCode, result.Code);
+			EXPECT_EQ(expectedBuffer, result.Buffer);
+		}
+
+		// endregion
+	}
+
+	// region GetMultiplexedChildPacket
+
+	namespace {
+		const Packet* GetChildPacket(const std::shared_ptr<Packet>& pPacket) {
+			return GetMultiplexedChildPacket(static_cast<const MultiplexedPacket&>(*pPacket));
+		}
+
+		Packet& GetChildPacketUnchecked(Packet& packet) {
+			return reinterpret_cast<Packet&>(*(packet.Data() + sizeof(uint32_t)));
+		}
+	}
+
+	TEST(TEST_CLASS, CanGetChildPacketFromWellFormedPacket) {
+		// Arrange:
+		auto childBuffer = test::GenerateRandomPacketBuffer(50);
+		auto pPacket = CreateMultiplexedPacket(7, childBuffer);
+
+		// Act:
+		const auto* pChildPacket = GetChildPacket(pPacket);
+
+		// Assert:
+		ASSERT_TRUE(!!pChildPacket);
+		EXPECT_EQ(&GetChildPacketUnchecked(*pPacket), pChildPacket);
+		EXPECT_EQ(childBuffer, test::CopyPacketToBuffer(*pChildPacket));
+	}
+
+	TEST(TEST_CLASS, CannotGetChildPacketFromPacketWithoutChildHeader) {
+		// Arrange:
+		auto pPacket = CreateSharedPacket<MultiplexedPacket>(sizeof(PacketHeader) - 1);
+
+		// Act + Assert:
+		EXPECT_FALSE(!!GetChildPacket(pPacket));
+	}
+
+	TEST(TEST_CLASS, CannotGetChildPacketFromPacketWithChildSizeMismatch) {
+		// Arrange:
+		auto childBuffer = test::GenerateRandomPacketBuffer(50);
+		for (auto sizeDelta : { -1, 1 }) {
+			auto pPacket = CreateMultiplexedPacket(7, childBuffer);
+			GetChildPacketUnchecked(*pPacket).Size = static_cast<uint32_t>(50 + sizeDelta);
+
+			// Act + Assert:
+			EXPECT_FALSE(!!GetChildPacket(pPacket)) << "size delta " << sizeDelta;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotGetChildPacketFromPacketWithMultiplexedChild) {
+		// Arrange:
+		auto childBuffer = test::GenerateRandomPacketBuffer(50);
+		auto pPacket = CreateMultiplexedPacket(7, childBuffer);
+		GetChildPacketUnchecked(*pPacket).Type = PacketType::Multiplexed;
+
+		// Act + Assert:
+		EXPECT_FALSE(!!GetChildPacket(pPacket));
+	}
+
+	// endregion
+
+	// region write
+
+	TEST(TEST_CLASS, WriteWrapsPayloadInMultiplexedPacket) {
+		// Arrange:
+		TestContext context;
+		auto pChannel = context.pMultiplexer->createChannel();
+		auto buffer = test::GenerateRandomPacketBuffer(50);
+
+		// Act:
+		auto writeCode = context.write(*pChannel, buffer);
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Success, writeCode);
+		ASSERT_EQ(1u, context.pIo->writtenBuffers().size());
+		EXPECT_EQ(CreateMultiplexedPacket(1, buffer)->Size, context.pIo->writtenBuffers()[0].size());
+		EXPECT_EQ(test::CopyPacketToBuffer(*CreateMultiplexedPacket(1, buffer)), context.pIo->writtenBuffers()[0]);
+		EXPECT_EQ(1u, context.pMultiplexer->numPendingRequests());
+	}
+
+	TEST(TEST_CLASS, WriteAssignsUniqueRequestIdsAcrossChannels) {
+		// Arrange:
+		TestContext context;
+		auto pChannel1 = context.pMultiplexer->createChannel();
+		auto pChannel2 = context.pMultiplexer->createChannel();
+		auto buffers = test::GenerateRandomPacketBuffers({ 50, 60, 70 });
+
+		// Act:
+		context.write(*pChannel1, buffers[0]);
+		context.write(*pChannel2, buffers[1]);
+		context.write(*pChannel1, buffers[2]);
+
+		// Assert:
+		const auto& writtenBuffers = context.pIo->writtenBuffers();
+		ASSERT_EQ(3u, writtenBuffers.size());
+		for (auto i = 0u; i < writtenBuffers.size(); ++i)
+			EXPECT_EQ(test::CopyPacketToBuffer(*CreateMultiplexedPacket(i + 1, buffers[i])), writtenBuffers[i]) << "request " << i;
+
+		EXPECT_EQ(3u, context.pMultiplexer->numPendingRequests());
+	}
+
+	TEST(TEST_CLASS, WriteStartsReadingResponses) {
+		// Arrange:
+		TestContext context;
+		auto pChannel1 = context.pMultiplexer->createChannel();
+		auto pChannel2 = context.pMultiplexer->createChannel();
+
+		// Sanity:
+		EXPECT_EQ(0u, context.pIo->numReads());
+
+		// Act:
+		context.write(*pChannel1, test::GenerateRandomPacketBuffer(50));
+		context.write(*pChannel2, test::GenerateRandomPacketBuffer(50));
+
+		// Assert: a single read is shared by all outstanding requests
+		EXPECT_EQ(1u, context.pIo->numReads());
+		EXPECT_TRUE(context.pIo->hasPendingRead());
+	}
+
+	TEST(TEST_CLASS, WriteErrorCompletesRequest) {
+		// Arrange:
+		TestContext context;
+		context.pIo->setWriteCode(SocketOperationCode::Write_Error);
+		auto pChannel = context.pMultiplexer->createChannel();
+
+		// Act:
+		auto writeCode = context.write(*pChannel, test::GenerateRandomPacketBuffer(50));
+
+		ReadResult result;
+		context.read(*pChannel, result);
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Write_Error, writeCode);
+		AssertReadResult(result, SocketOperationCode::Write_Error, ByteBuffer());
+		EXPECT_EQ(0u, context.pIo->numReads());
+		EXPECT_EQ(0u, context.pMultiplexer->numPendingRequests());
+	}
+
+	// endregion
+
+	// region read
+
+	TEST(TEST_CLASS, ReadWithoutRequestFails) {
+		// Arrange:
+		TestContext context;
+		auto pChannel = context.pMultiplexer->createChannel();
+
+		// Act:
+		ReadResult result;
+		context.read(*pChannel, result);
+
+		// Assert:
+		AssertReadResult(result, SocketOperationCode::Read_Error, ByteBuffer());
+		EXPECT_EQ(0u, context.pIo->numReads());
+	}
+
+	TEST(TEST_CLASS, ReadReturnsResponseReceivedAfterRead) {
+		// Arrange:
+		TestContext context;
+		auto pChannel = context.pMultiplexer->createChannel();
+		auto responseBuffer = test::GenerateRandomPacketBuffer(80);
+		context.write(*pChannel, test::GenerateRandomPacketBuffer(50));
+
+		// Act:
+		ReadResult result;
+		context.read(*pChannel, result);
+		context.respond(1, responseBuffer);
+
+		// Assert:
+		AssertReadResult(result, SocketOperationCode::Success, responseBuffer);
+		EXPECT_EQ(0u, context.pMultiplexer->numPendingRequests());
+	}
+
+	TEST(TEST_CLASS, ReadReturnsResponseReceivedBeforeRead) {
+		// Arrange:
+		TestContext context;
+		auto pChannel = context.pMultiplexer->createChannel();
+		auto responseBuffer = test::GenerateRandomPacketBuffer(80);
+		context.write(*pChannel, test::GenerateRandomPacketBuffer(50));
+		context.respond(1, responseBuffer);
+
+		// Act:
+		ReadResult result;
+		context.read(*pChannel, result);
+
+		// Assert:
+		AssertReadResult(result, SocketOperationCode::Success, responseBuffer);
+		EXPECT_EQ(0u, context.pMultiplexer->numPendingRequests());
+	}
+
+	TEST(TEST_CLASS, ResponsesAreMatchedToRequestsAcrossChannels) {
+		// Arrange:
+		TestContext context;
+		auto pChannel1 = context.pMultiplexer->createChannel();
+		auto pChannel2 = context.pMultiplexer->createChannel();
+		auto responseBuffers = test::GenerateRandomPacketBuffers({ 80, 90 });
+		context.write(*pChannel1, test::GenerateRandomPacketBuffer(50));
+		context.write(*pChannel2, test::GenerateRandomPacketBuffer(60));
+
+		// Act: respond out of order
+		ReadResult result1;
+		ReadResult result2;
+		context.read(*pChannel1, result1);
+		context.read(*pChannel2, result2);
+		context.respond(2, responseBuffers[1]);
+		context.respond(1, responseBuffers[0]);
+
+		// Assert:
+		AssertReadResult(result1, SocketOperationCode::Success, responseBuffers[0]);
+		AssertReadResult(result2, SocketOperationCode::Success, responseBuffers[1]);
+		EXPECT_EQ(0u, context.pMultiplexer->numPendingRequests());
+	}
+
+	TEST(TEST_CLASS, ChannelReadsResponsesInRequestOrder) {
+		// Arrange:
+		TestContext context;
+		auto pChannel = context.pMultiplexer->createChannel();
+		auto responseBuffers = test::GenerateRandomPacketBuffers({ 80, 90 });
+		context.write(*pChannel, test::GenerateRandomPacketBuffer(50));
+		context.write(*pChannel, test::GenerateRandomPacketBuffer(60));
+
+		// Act: respond out of order
+		context.respond(2, responseBuffers[1]);
+		context.respond(1, responseBuffers[0]);
+
+		ReadResult result1;
+		ReadResult result2;
+		context.read(*pChannel, result1);
+		AssertReadResult(result1, SocketOperationCode::Success, responseBuffers[0]);
+		context.read(*pChannel, result2);
+
+		// Assert:
+		AssertReadResult(result2, SocketOperationCode::Success, responseBuffers[1]);
+	}
+
+	TEST(TEST_CLASS, ReadingStopsWhenNoRequestsAreAwaitingResponses) {
+		// Arrange:
+		TestContext context;
+		auto pChannel = context.pMultiplexer->createChannel();
+		context.write(*pChannel, test::GenerateRandomPacketBuffer(50));
+		context.write(*pChannel, test::GenerateRandomPacketBuffer(60));
+
+		// Act:
+		context.respond(1, test::GenerateRandomPacketBuffer(80));
+		auto hasPendingReadAfterFirstResponse = context.pIo->hasPendingRead();
+		context.respond(2, test::GenerateRandomPacketBuffer(90));
+
+		// Assert:
+		EXPECT_TRUE(hasPendingReadAfterFirstResponse);
+		EXPECT_FALSE(context.pIo->hasPendingRead());
+		EXPECT_EQ(2u, context.pIo->numReads());
+	}
+
+	TEST(TEST_CLASS, ResponseToUnknownRequestIsDropped) {
+		// Arrange:
+		TestContext context;
+		auto pChannel = context.pMultiplexer->createChannel();
+		auto responseBuffer = test::GenerateRandomPacketBuffer(80);
+		context.write(*pChannel, test::GenerateRandomPacketBuffer(50));
+
+		// Act:
+		ReadResult result;
+		context.read(*pChannel, result);
+		context.respond(99, test::GenerateRandomPacketBuffer(90));
+		context.respond(1, responseBuffer);
+
+		// Assert:
+		AssertReadResult(result, SocketOperationCode::Success, responseBuffer);
+		EXPECT_EQ(2u, context.pIo->numReads());
+	}
+
+	// endregion
+
+	// region errors
+
+	namespace {
+		template<typename TAction>
+		void AssertAllRequestsFail(SocketOperationCode expectedCode, TAction action) {
+			// Arrange:
+			TestContext context;
+			auto pChannel1 = context.pMultiplexer->createChannel();
+			auto pChannel2 = context.pMultiplexer->createChannel();
+			context.write(*pChannel1, test::GenerateRandomPacketBuffer(50));
+			context.write(*pChannel2, test::GenerateRandomPacketBuffer(60));
+
+			// Act:
+			ReadResult result1;
+			ReadResult result2;
+			context.read(*pChannel1, result1);
+			action(*context.pIo);
+			context.read(*pChannel2, result2);
+
+			// Assert:
+			AssertReadResult(result1, expectedCode, ByteBuffer());
+			AssertReadResult(result2, expectedCode, ByteBuffer());
+			EXPECT_FALSE(context.pIo->hasPendingRead());
+			EXPECT_EQ(0u, context.pMultiplexer->numPendingRequests());
+		}
+	}
+
+	TEST(TEST_CLASS, ReadErrorFailsAllRequests) {
+		// Assert:
+		AssertAllRequestsFail(SocketOperationCode::Read_Error, [](auto& io) {
+			io.completeRead(SocketOperationCode::Read_Error, nullptr);
+		});
+	}
+
+	TEST(TEST_CLASS, NonMultiplexedResponseFailsAllRequests) {
+		// Assert:
+		AssertAllRequestsFail(SocketOperationCode::Malformed_Data, [](auto& io) {
+			auto pPacket = test::BufferToPacket(test::GenerateRandomPacketBuffer(50));
+			io.completeRead(SocketOperationCode::Success, pPacket.get());
+		});
+	}
+
+	TEST(TEST_CLASS, MalformedMultiplexedResponseFailsAllRequests) {
+		// Assert:
+		AssertAllRequestsFail(SocketOperationCode::Malformed_Data, [](auto& io) {
+			auto pPacket = CreateMultiplexedPacket(1, test::GenerateRandomPacketBuffer(50));
+			GetChildPacketUnchecked(*pPacket).Size = 49;
+			io.completeRead(SocketOperationCode::Success, pPacket.get());
+		});
+	}
+
+	// endregion
+
+	// region timeout
+
+	TEST(TEST_CLASS, RequestWithoutResponseTimesOut) {
+		// Arrange:
+		TestContext context(utils::TimeSpan::FromMilliseconds(10));
+		auto pChannel = context.pMultiplexer->createChannel();
+		context.write(*pChannel, test::GenerateRandomPacketBuffer(50));
+
+		// Act:
+		ReadResult result;
+		context.read(*pChannel, result);
+
+		// Assert:
+		AssertReadResult(result, SocketOperationCode::Timed_Out, ByteBuffer());
+		EXPECT_EQ(0u, context.pMultiplexer->numPendingRequests());
+
+		// - a late response is dropped
+		context.respond(1, test::GenerateRandomPacketBuffer(80));
+		EXPECT_FALSE(context.pIo->hasPendingRead());
+		EXPECT_EQ(1u, result.NumCallbacks);
+	}
+
+	TEST(TEST_CLASS, TimeoutDoesNotAffectOtherRequests) {
+		// Arrange:
+		TestContext context(utils::TimeSpan::FromMilliseconds(50));
+		auto pChannel1 = context.pMultiplexer->createChannel();
+		auto pChannel2 = context.pMultiplexer->createChannel();
+		auto responseBuffer = test::GenerateRandomPacketBuffer(80);
+		context.write(*pChannel1, test::GenerateRandomPacketBuffer(50));
+
+		ReadResult result1;
+		context.read(*pChannel1, result1);
+		AssertReadResult(result1, SocketOperationCode::Timed_Out, ByteBuffer());
+
+		// Act:
+		context.write(*pChannel2, test::GenerateRandomPacketBuffer(60));
+
+		ReadResult result2;
+		context.read(*pChannel2, result2);
+		context.respond(2, responseBuffer);
+
+		// Assert:
+		AssertReadResult(result2, SocketOperationCode::Success, responseBuffer);
+	}
+
+	// endregion
+
+	// region channel lifetime
+
+	TEST(TEST_CLASS, DestroyingChannelReleasesUnreadRequests) {
+		// Arrange:
+		TestContext context;
+		auto pChannel1 = context.pMultiplexer->createChannel();
+		auto pChannel2 = context.pMultiplexer->createChannel();
+		context.write(*pChannel1, test::GenerateRandomPacketBuffer(50));
+		context.write(*pChannel1, test::GenerateRandomPacketBuffer(50));
+		context.write(*pChannel2, test::GenerateRandomPacketBuffer(60));
+		context.respond(1, test::GenerateRandomPacketBuffer(80));
+
+		// Sanity:
+		EXPECT_EQ(3u, context.pMultiplexer->numPendingRequests());
+
+		// Act:
+		pChannel1.reset();
+
+		// Assert:
+		EXPECT_EQ(1u, context.pMultiplexer->numPendingRequests());
+	}
+
+	// endregion
+}}
@@ -258,4 +258,94 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region Filter
+
+	namespace {
+		auto CreatePayloadWithEntities(std::vector<std::shared_ptr<model::VerifiableEntity>>& entities) {
+			entities = {
+				test::CreateRandomEntityWithSize<>(126),
+				test::CreateRandomEntityWithSize<>(212),
+				test::CreateRandomEntityWithSize<>(111)
+			};
+			return PacketPayloadFactory::FromEntities(Test_Packet_Type, entities);
+		}
+	}
+
+	TEST(TEST_CLASS, FilteringUnsetPayloadReturnsUnsetPayload) {
+		// Act:
+		auto payload = PacketPayload::Filter(PacketPayload(), [](auto) { return true; });
+
+		// Assert:
+		EXPECT_TRUE(payload.unset());
+	}
+
+	TEST(TEST_CLASS, CanFilterAllBuffersFromPayload) {
+		// Arrange:
+		std::vector<std::shared_ptr<model::VerifiableEntity>> entities;
+		auto originalPayload = CreatePayloadWithEntities(entities);
+
+		// Act:
+		auto payload = PacketPayload::Filter(originalPayload, [](auto) { return false; });
+
+		// Assert:
+		test::AssertPacketHeader(payload, sizeof(PacketHeader), Test_Packet_Type);
+		EXPECT_TRUE(payload.buffers().empty());
+	}
+
+	TEST(TEST_CLASS, CanFilterNoBuffersFromPayload) {
+		// Arrange:
+		std::vector<std::shared_ptr<model::VerifiableEntity>> entities;
+		auto originalPayload = CreatePayloadWithEntities(entities);
+
+		// Act:
+		auto payload = PacketPayload::Filter(originalPayload, [](auto) { return true; });
+
+		// Assert:
+		test::AssertPacketHeader(payload, sizeof(PacketHeader) + 126 + 212 + 111, Test_Packet_Type);
+		ASSERT_EQ(3u, payload.buffers().size());
+		for (auto i = 0u; i < entities.size(); ++i) {
+			EXPECT_EQ(originalPayload.buffers()[i].pData, payload.buffers()[i].pData) << i;
+			EXPECT_EQ(entities[i]->Size, payload.buffers()[i].Size) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanFilterSomeBuffersFromPayload) {
+		// Arrange:
+		std::vector<std::shared_ptr<model::VerifiableEntity>> entities;
+		auto originalPayload = CreatePayloadWithEntities(entities);
+
+		// Act:
+		std::vector<size_t> indexes;
+		auto payload = PacketPayload::Filter(originalPayload, [&indexes](auto index) {
+			indexes.push_back(index);
+			return 1 != index;
+		});
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 0, 1, 2 }), indexes);
+
+		test::AssertPacketHeader(payload, sizeof(PacketHeader) + 126 + 111, Test_Packet_Type);
+		ASSERT_EQ(2u, payload.buffers().size());
+		EXPECT_EQ(originalPayload.buffers()[0].pData, payload.buffers()[0].pData);
+		EXPECT_EQ(originalPayload.buffers()[2].pData, payload.buffers()[1].pData);
+	}
+
+	TEST(TEST_CLASS, FilteredPayloadExtendsLifetimeOfBackingData) {
+		// Arrange:
+		std::vector<std::shared_ptr<model::VerifiableEntity>> entities;
+		auto pOriginalPayload = std::make_unique<PacketPayload>(CreatePayloadWithEntities(entities));
+		auto payload = PacketPayload::Filter(*pOriginalPayload, [](auto index) { return 0 != index; });
+
+		// Act:
+		pOriginalPayload.reset();
+		std::vector<std::weak_ptr<model::VerifiableEntity>> weakEntities(entities.cbegin(), entities.cend());
+		entities.clear();
+
+		// Assert:
+		for (const auto& pWeakEntity : weakEntities)
+			EXPECT_FALSE(pWeakEntity.expired());
+	}
+
+	// endregion
 }}
@@ -120,6 +120,25 @@ namespace catapult { namespace ionet {
 		AssertWriteSuccess(payload, packetBytes);
 	}
 
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayload) {
+		// Arrange: set up payloads
+		auto outerPacketBytes = test::GenerateRandomPacketBuffer(30);
+		auto innerPacketBytes = test::GenerateRandomPacketBuffer(50);
+		auto payload = PacketPayload::Merge(test::BufferToPacket(outerPacketBytes), test::BufferToPacketPayload(innerPacketBytes));
+
+		// - the outer packet size is adjusted to include the inner packet
+		auto expectedPacketBytes = outerPacketBytes;
+		reinterpret_cast<PacketHeader&>(expectedPacketBytes[0]).Size = 80;
+		expectedPacketBytes.insert(expectedPacketBytes.end(), innerPacketBytes.cbegin(), innerPacketBytes.cend());
+
+		// Sanity:
+		EXPECT_EQ(80u, payload.header().Size);
+		EXPECT_EQ(3u, payload.buffers().size());
+
+		// Assert:
+		AssertWriteSuccess(payload, expectedPacketBytes);
+	}
+
 	TEST(TEST_CLASS, WriteFailsWhenSocketWriteFails) {
 		// Arrange: set up payloads
 		auto payload = CreateSmallWritePayload();
@@ -236,13 +255,15 @@ namespace catapult { namespace ionet {
 			});
 		}
 
-		SendBuffersResult SendBuffers(const std::vector<ByteBuffer>& sendBuffers) {
+		SendBuffersResult SendBuffers(
+				const std::vector<ByteBuffer>& sendBuffers,
+				const PacketSocketOptions& options = test::CreatePacketSocketOptions()) {
 			SendBuffersResult result;
 
 			// Act: "server" - reads the next packet(s) from the socket (using read)
 			//      "client" - sends all buffers to the socket
 			auto pPool = test::CreateStartedIoServiceThreadPool();
-			test::SpawnPacketServerWork(pPool->service(), [&result](const auto& pServerSocket) {
+			test::SpawnPacketServerWork(pPool->service(), options, [&result](const auto& pServerSocket) {
 				pServerSocket->read([pServerSocket, &result](auto code, const auto* pPacket) {
 					FillResult(result, pServerSocket, code, pPacket);
 				});
@@ -298,6 +319,45 @@ namespace catapult { namespace ionet {
 		EXPECT_EQ(test::ToHexString(&sendBuffers[2][0], 25), test::ToHexString(&receivedBuffer[100], 25));
 	}
 
+	namespace {
+		PacketSocketOptions CreatePooledPacketSocketOptions() {
+			auto options = test::CreatePacketSocketOptions();
+			options.WorkingBufferPool = std::make_shared<ByteBufferPool>(options.WorkingBufferSize, 1);
+			return options;
+		}
+	}
+
+	TEST(TEST_CLASS, ReadCanProcessSinglePacket_PooledWorkingBuffer) {
+		// Arrange: send a single buffer containing a single packet
+		auto sendBuffer = test::GenerateRandomPacketBuffer(100, { 82 });
+		std::vector<ByteBuffer> sendBuffers{ sendBuffer };
+
+		// Act:
+		auto result = SendBuffers(sendBuffers, CreatePooledPacketSocketOptions());
+		const auto& receivedBuffer = result.ReceivedBuffer;
+
+		// Assert:
+		AssertSendBuffersResult(result, SocketOperationCode::Success, 18);
+		EXPECT_EQUAL_BUFFERS(sendBuffers[0], 0, 82u, receivedBuffer);
+	}
+
+	TEST(TEST_CLASS, ReadCanProcessSinglePacketSpanningReads_PooledWorkingBuffer) {
+		// Arrange: send a packet spanning three buffers
+		auto sendBuffers = test::GenerateRandomPacketBuffers({ 50, 50, 50 });
+		test::SetPacketAt(sendBuffers[0], 0, 125);
+
+		// Act:
+		auto result = SendBuffers(sendBuffers, CreatePooledPacketSocketOptions());
+		const auto& receivedBuffer = result.ReceivedBuffer;
+
+		// Assert:
+		AssertSendBuffersResult(result, SocketOperationCode::Success, 25);
+		EXPECT_EQ(125u, receivedBuffer.size());
+		EXPECT_EQ(test::ToHexString(sendBuffers[0]), test::ToHexString(&receivedBuffer[0], 50));
+		EXPECT_EQ(test::ToHexString(sendBuffers[1]), test::ToHexString(&receivedBuffer[50], 50));
+		EXPECT_EQ(test::ToHexString(&sendBuffers[2][0], 25), test::ToHexString(&receivedBuffer[100], 25));
+	}
+
 	TEST(TEST_CLASS, ReadCanProcessFirstOfMultiplePacketsInSingleRead) {
 		// Arrange: send a buffer containing three packets
 		auto sendBuffer = test::GenerateRandomPacketBuffer(100, { 20, 17, 50 });
@@ -134,7 +134,8 @@ namespace catapult { namespace ionet {
 					: pMockPacketSocket(std::make_shared<MockPacketSocket>())
 					, KeyPair(test::GenerateKeyPair())
 					, RemoteKey(KeyPair.publicKey()) // use same public key so secure packets can be signed and verified
-					, pSecureSocket(Secure(pMockPacketSocket, securityMode, KeyPair, RemoteKey, maxPacketDataSize))
+					, SessionKey(test::GenerateRandomData<Hash256_Size>())
+					, pSecureSocket(Secure(pMockPacketSocket, securityMode, KeyPair, RemoteKey, SessionKey, maxPacketDataSize))
 			{}
 
 		public:
@@ -150,6 +151,7 @@ namespace catapult { namespace ionet {
 			std::shared_ptr<MockPacketSocket> pMockPacketSocket;
 			crypto::KeyPair KeyPair;
 			Key RemoteKey;
+			Hash256 SessionKey;
 			std::shared_ptr<PacketSocket> pSecureSocket;
 		};
 
@@ -192,6 +194,7 @@ namespace catapult { namespace ionet {
 	template<ConnectionSecurityMode SecurityMode> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, SecurityModeNone##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConnectionSecurityMode::None>(); } \
 	TEST(TEST_CLASS, SecurityModeSigned##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConnectionSecurityMode::Signed>(); } \
+	TEST(TEST_CLASS, SecurityModeSession##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConnectionSecurityMode::Session>(); } \
 	template<ConnectionSecurityMode SecurityMode> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	// region ConnectionSecurityMode - common
@@ -326,4 +329,62 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region ConnectionSecurityMode - Session
+
+	TEST(TEST_CLASS, SecurityModeSession_DecoratesSocket) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Session);
+
+		// Act + Assert
+		EXPECT_NE(context.pMockPacketSocket, context.pSecureSocket);
+	}
+
+	TEST(TEST_CLASS, SecurityModeSession_WritesSecurePackets) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Session);
+
+		// Act + Assert:
+		AssertNormalPacketWriteCode(context.normalIoView(), PacketType::Secure_Session, PacketType::Pull_Transactions);
+	}
+
+	TEST(TEST_CLASS, SecurityModeSession_WritesSecureBufferedPackets) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Session);
+
+		// Act + Assert:
+		AssertNormalPacketWriteCode(context.bufferedIoView(), PacketType::Secure_Session, PacketType::Pull_Transactions);
+	}
+
+	TEST(TEST_CLASS, SecurityModeSession_EnforcesMaxPacketDataSizeOnWrite) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Session, 99);
+
+		auto payload = PacketPayload(test::CreateRandomPacket(100, PacketType::Pull_Transactions));
+
+		// Act + Assert:
+		AssertMalformedDataWrite(context.normalIoView(), payload);
+	}
+
+	TEST(TEST_CLASS, SecurityModeSession_SharesSessionAcrossNormalAndBufferedIo) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Session);
+		auto normalIoView = context.normalIoView();
+		auto bufferedIoView = context.bufferedIoView();
+
+		auto payload = PacketPayload(test::CreateRandomPacket(100, PacketType::Pull_Transactions));
+		normalIoView.MockIo.queueWrite(SocketOperationCode::Success);
+
+		// Act: write the same payload via both ios
+		normalIoView.Io.write(payload, [](auto) {});
+		bufferedIoView.Io.write(payload, [](auto) {});
+
+		// Assert: the authentication codes are different because the second write uses the next (shared) sequence number
+		const auto& writtenPacket1 = normalIoView.MockIo.writtenPacketAt<Packet>(0);
+		const auto& writtenPacket2 = bufferedIoView.MockIo.writtenPacketAt<Packet>(0);
+		ASSERT_EQ(writtenPacket1.Size, writtenPacket2.Size);
+		EXPECT_NE(reinterpret_cast<const Hash256&>(*(&writtenPacket1 + 1)), reinterpret_cast<const Hash256&>(*(&writtenPacket2 + 1)));
+	}
+
+	// endregion
 }}
@@ -0,0 +1,605 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/SecureSessionPacketIo.h"
+#include "catapult/ionet/PacketPayloadFactory.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/PacketIoTestUtils.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS SecureSessionPacketIoTests
+
+	namespace {
+		struct TestContext {
+		public:
+			explicit TestContext(uint32_t maxPacketDataSize = std::numeric_limits<uint32_t>::max())
+					: TestContext(test::GenerateRandomData<Key_Size>(), maxPacketDataSize)
+			{}
+
+			TestContext(const Key& remoteKey, uint32_t maxPacketDataSize)
+					: pMockPacketIo(std::make_shared<mocks::MockPacketIo>())
+					, SessionKey(test::GenerateRandomData<Hash256_Size>())
+					, SourceKey(test::GenerateRandomData<Key_Size>())
+					, RemoteKey(remoteKey)
+					, pSession(std::make_shared<SecureSession>(SessionKey, SourceKey, RemoteKey))
+					, pSecureIo(CreateSecureSessionPacketIo(pMockPacketIo, pSession, maxPacketDataSize))
+					, pSecureBatchReader(CreateSecureSessionBatchPacketReader(pMockPacketIo, pSession))
+					, RemoteSession(SessionKey, RemoteKey, SourceKey)
+			{}
+
+		public:
+			std::shared_ptr<mocks::MockPacketIo> pMockPacketIo;
+			Hash256 SessionKey;
+			Key SourceKey;
+			Key RemoteKey;
+			std::shared_ptr<SecureSession> pSession;
+			std::shared_ptr<PacketIo> pSecureIo;
+			std::shared_ptr<BatchPacketReader> pSecureBatchReader;
+
+			// emulates the other end of the session
+			SecureSession RemoteSession;
+		};
+
+		PacketPayload CreateRandomPayload(uint32_t payloadSize) {
+			return PacketPayload(test::CreateRandomPacket(payloadSize, PacketType::Push_Transactions));
+		}
+	}
+
+	// region SecureSession
+
+	TEST(TEST_CLASS, SessionCanVerifyPacketAuthenticatedByRemote) {
+		// Arrange:
+		TestContext context;
+		auto pPacket = test::CreateRandomPacket(123, PacketType::Push_Transactions);
+
+		// Act:
+		auto authenticationCode = context.RemoteSession.authenticate(PacketPayload(pPacket));
+		auto isVerified = context.pSession->verify(*pPacket, authenticationCode);
+
+		// Assert:
+		EXPECT_TRUE(isVerified);
+	}
+
+	TEST(TEST_CLASS, SessionCannotVerifyPacketWithDifferentData) {
+		// Arrange:
+		TestContext context;
+		auto pPacket = test::CreateRandomPacket(123, PacketType::Push_Transactions);
+		auto authenticationCode = context.RemoteSession.authenticate(PacketPayload(pPacket));
+
+		// Act:
+		pPacket->Data()[10] ^= 0xFF;
+		auto isVerified = context.pSession->verify(*pPacket, authenticationCode);
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+	}
+
+	TEST(TEST_CLASS, SessionCannotVerifyPacketAuthenticatedByItself) {
+		// Arrange: each direction uses a different key, so packets cannot be reflected
+		TestContext context;
+		auto pPacket = test::CreateRandomPacket(123, PacketType::Push_Transactions);
+
+		// Act:
+		auto authenticationCode = context.pSession->authenticate(PacketPayload(pPacket));
+		auto isVerified = context.pSession->verify(*pPacket, authenticationCode);
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+	}
+
+	TEST(TEST_CLASS, SessionCannotVerifyReplayedPacket) {
+		// Arrange:
+		TestContext context;
+		auto pPacket = test::CreateRandomPacket(123, PacketType::Push_Transactions);
+		auto authenticationCode = context.RemoteSession.authenticate(PacketPayload(pPacket));
+
+		// Act:
+		auto isVerified1 = context.pSession->verify(*pPacket, authenticationCode);
+		auto isVerified2 = context.pSession->verify(*pPacket, authenticationCode);
+
+		// Assert:
+		EXPECT_TRUE(isVerified1);
+		EXPECT_FALSE(isVerified2);
+	}
+
+	TEST(TEST_CLASS, SessionCannotVerifyReorderedPackets) {
+		// Arrange:
+		TestContext context;
+		auto pPacket1 = test::CreateRandomPacket(123, PacketType::Push_Transactions);
+		auto pPacket2 = test::CreateRandomPacket(123, PacketType::Push_Transactions);
+		auto authenticationCode1 = context.RemoteSession.authenticate(PacketPayload(pPacket1));
+		auto authenticationCode2 = context.RemoteSession.authenticate(PacketPayload(pPacket2));
+
+		// Act:
+		auto isVerified2 = context.pSession->verify(*pPacket2, authenticationCode2);
+		auto isVerified1 = context.pSession->verify(*pPacket1, authenticationCode1);
+
+		// Assert:
+		EXPECT_FALSE(isVerified2);
+		EXPECT_TRUE(isVerified1);
+	}
+
+	TEST(TEST_CLASS, SessionAuthenticatesSamePayloadDifferentlyAtDifferentSequenceNumbers) {
+		// Arrange:
+		TestContext context;
+		auto payload = CreateRandomPayload(123);
+
+		// Act:
+		auto authenticationCode1 = context.pSession->authenticate(payload);
+		auto authenticationCode2 = context.pSession->authenticate(payload);
+
+		// Assert:
+		EXPECT_NE(authenticationCode1, authenticationCode2);
+	}
+
+	// endregion
+
+	// region PacketIo - write
+
+	namespace {
+		template<typename TAction>
+		void RunWritePayloadTest(
+				TestContext&& context,
+				const std::vector<std::shared_ptr<model::VerifiableEntity>>& entities,
+				uint32_t numEntitiesBytes,
+				TAction action) {
+			// Arrange:
+			context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+			auto payload = PacketPayloadFactory::FromEntities(PacketType::Push_Transactions, entities);
+
+			// Act:
+			SocketOperationCode writeCode;
+			context.pSecureIo->write(payload, [&writeCode](auto code) {
+				writeCode = code;
+			});
+
+			const auto& writtenPacket = context.pMockPacketIo->writtenPacketAt<Packet>(0);
+
+			// Assert:
+			EXPECT_EQ(SocketOperationCode::Success, writeCode);
+
+			ASSERT_EQ(sizeof(PacketHeader) + Hash256_Size + sizeof(PacketHeader) + numEntitiesBytes, writtenPacket.Size);
+			EXPECT_EQ(PacketType::Secure_Session, writtenPacket.Type);
+
+			const auto& authenticationCode = reinterpret_cast<const Hash256&>(*(&writtenPacket + 1));
+			const auto* pAuthenticationCodeBytes = reinterpret_cast<const uint8_t*>(&authenticationCode);
+			const auto& childPacket = reinterpret_cast<const Packet&>(*(pAuthenticationCodeBytes + Hash256_Size));
+			ASSERT_EQ(sizeof(PacketHeader) + numEntitiesBytes, childPacket.Size);
+			EXPECT_EQ(PacketType::Push_Transactions, childPacket.Type);
+
+			EXPECT_TRUE(context.RemoteSession.verify(childPacket, authenticationCode));
+
+			action(childPacket);
+		}
+	}
+
+	TEST(TEST_CLASS, WriteAuthenticatesPayloadWithNoBuffers) {
+		// Act:
+		RunWritePayloadTest(TestContext(), {}, 0, [](const auto&) {});
+	}
+
+	TEST(TEST_CLASS, WriteAuthenticatesPayloadWithSingleBuffer) {
+		// Arrange:
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{ test::CreateRandomEntityWithSize<>(126) };
+
+		// Act:
+		RunWritePayloadTest(TestContext(), entities, 126, [&entities](const auto& childPacket) {
+			// Assert:
+			EXPECT_TRUE(0 == std::memcmp(entities[0].get(), childPacket.Data(), entities[0]->Size));
+		});
+	}
+
+	TEST(TEST_CLASS, WriteAuthenticatesPayloadWithMultipleBuffers) {
+		// Arrange:
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{
+			test::CreateRandomEntityWithSize<>(126),
+			test::CreateRandomEntityWithSize<>(212),
+			test::CreateRandomEntityWithSize<>(134),
+		};
+
+		// Act:
+		RunWritePayloadTest(TestContext(), entities, 126 + 212 + 134, [&entities](const auto& childPacket) {
+			// Assert:
+			EXPECT_TRUE(0 == std::memcmp(entities[0].get(), childPacket.Data(), entities[0]->Size));
+			EXPECT_TRUE(0 == std::memcmp(entities[1].get(), childPacket.Data() + 126, entities[1]->Size));
+			EXPECT_TRUE(0 == std::memcmp(entities[2].get(), childPacket.Data() + 126 + 212, entities[2]->Size));
+		});
+	}
+
+	TEST(TEST_CLASS, WriteForwardsInnerWriteError) {
+		// Arrange: set a write error
+		TestContext context;
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Write_Error);
+
+		// Act:
+		SocketOperationCode writeCode;
+		context.pSecureIo->write(CreateRandomPayload(126), [&writeCode](auto code) {
+			writeCode = code;
+		});
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Write_Error, writeCode);
+	}
+
+	namespace {
+		void AssertMalformedDataWrite(TestContext&& context, const PacketPayload& payload) {
+			// Arrange:
+			context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+			// Act:
+			SocketOperationCode writeCode;
+			context.pSecureIo->write(payload, [&writeCode](auto code) {
+				writeCode = code;
+			});
+
+			// Assert:
+			EXPECT_EQ(SocketOperationCode::Malformed_Data, writeCode);
+		}
+	}
+
+	TEST(TEST_CLASS, WriteFailsWhenPacketPayloadIsUnset) {
+		// Arrange:
+		AssertMalformedDataWrite(TestContext(), PacketPayload());
+	}
+
+	TEST(TEST_CLASS, WriteFailsWhenPacketPayloadExceedsMaxPacketDataSize) {
+		// Arrange:
+		AssertMalformedDataWrite(TestContext(126 - 1), CreateRandomPayload(126));
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenPacketPayloadIsExactlyMaxPacketDataSize) {
+		// Arrange: notice that maxPacketDataSize only applies to the inner packet, the outer packet size can exceed it
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{ test::CreateRandomEntityWithSize<>(126) };
+
+		// Act:
+		RunWritePayloadTest(TestContext(126), entities, 126, [](const auto& childPacket) {
+			// Sanity:
+			EXPECT_EQ(sizeof(PacketHeader) + 126, childPacket.Size);
+		});
+	}
+
+	namespace {
+		void AssertWrittenPacketsCanBeVerifiedInOrder(TestContext& context, size_t numExpectedPackets) {
+			ASSERT_EQ(numExpectedPackets, context.pMockPacketIo->numWrites());
+			for (auto i = 0u; i < numExpectedPackets; ++i) {
+				const auto& writtenPacket = context.pMockPacketIo->writtenPacketAt<Packet>(i);
+				const auto& authenticationCode = reinterpret_cast<const Hash256&>(*(&writtenPacket + 1));
+				const auto& childPacket = reinterpret_cast<const Packet&>(*(&authenticationCode + 1));
+				EXPECT_TRUE(context.RemoteSession.verify(childPacket, authenticationCode)) << "packet at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, WriteFromWriteCallbackIsAuthenticatedAfterOuterWrite) {
+		// Arrange:
+		TestContext context;
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+		// Act: mock io completes writes immediately, so the second write is issued while the first one is being forwarded
+		std::vector<SocketOperationCode> writeCodes;
+		auto pSecureIo = context.pSecureIo;
+		pSecureIo->write(CreateRandomPayload(126), [pSecureIo, &writeCodes](auto code) {
+			writeCodes.push_back(code);
+			pSecureIo->write(CreateRandomPayload(212), [&writeCodes](auto innerCode) {
+				writeCodes.push_back(innerCode);
+			});
+		});
+
+		// Assert:
+		EXPECT_EQ(std::vector<SocketOperationCode>(2, SocketOperationCode::Success), writeCodes);
+		AssertWrittenPacketsCanBeVerifiedInOrder(context, 2);
+	}
+
+	TEST(TEST_CLASS, ConcurrentWritesAreForwardedInSequenceNumberOrder) {
+		// Arrange:
+		constexpr auto Num_Writes_Per_Thread = 100u;
+		TestContext context;
+		auto numThreads = test::GetNumDefaultPoolThreads();
+		for (auto i = 0u; i < numThreads * Num_Writes_Per_Thread; ++i)
+			context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+		// Act: write from multiple threads
+		boost::thread_group threads;
+		for (auto i = 0u; i < numThreads; ++i) {
+			threads.create_thread([&context]() {
+				for (auto j = 0u; j < Num_Writes_Per_Thread; ++j)
+					context.pSecureIo->write(CreateRandomPayload(126), [](auto) {});
+			});
+		}
+
+		threads.join_all();
+
+		// Assert: packets were forwarded in the same order as their sequence numbers were assigned
+		AssertWrittenPacketsCanBeVerifiedInOrder(context, numThreads * Num_Writes_Per_Thread);
+	}
+
+	// endregion
+
+	// region PacketIo - read, BatchPacketReader - readMultiple (single packet)
+
+	namespace {
+		// note: GetSecureSession* helpers assume a secure session packet
+
+		Hash256& GetSecureSessionAuthenticationCode(Packet& packet) {
+			return reinterpret_cast<Hash256&>(*(&packet + 1));
+		}
+
+		Packet& GetSecureSessionChildPacket(Packet& packet) {
+			auto& authenticationCode = GetSecureSessionAuthenticationCode(packet);
+			return reinterpret_cast<Packet&>(*(reinterpret_cast<uint8_t*>(&authenticationCode) + Hash256_Size));
+		}
+
+		std::shared_ptr<Packet> CreateSecureSessionPacket(SecureSession& session, uint32_t childPayloadSize) {
+			uint32_t payloadSize = Hash256_Size + sizeof(PacketHeader) + childPayloadSize;
+			auto pPacket = test::CreateRandomPacket(payloadSize, PacketType::Secure_Session);
+
+			auto& childPacket = GetSecureSessionChildPacket(*pPacket);
+			childPacket.Size = sizeof(PacketHeader) + childPayloadSize;
+			childPacket.Type = PacketType::Push_Transactions;
+
+			auto pChildPacket = utils::MakeSharedWithSize<Packet>(childPacket.Size);
+			std::memcpy(pChildPacket.get(), &childPacket, childPacket.Size);
+			GetSecureSessionAuthenticationCode(*pPacket) = session.authenticate(PacketPayload(pChildPacket));
+			return pPacket;
+		}
+
+		struct ReadCallbackParams {
+			bool IsPacketValid;
+			SocketOperationCode ReadCode;
+			std::vector<uint8_t> ReadPacketBytes;
+		};
+
+		PacketIo::ReadCallback CreateReadCaptureCallback(ReadCallbackParams& capture) {
+			return [&capture](auto code, const auto* pReadPacket) {
+				capture.ReadCode = code;
+				capture.IsPacketValid = !!pReadPacket;
+				if (capture.IsPacketValid)
+					capture.ReadPacketBytes = test::CopyPacketToBuffer(*pReadPacket);
+			};
+		}
+
+		struct PacketIoReadTraits {
+			static void Read(const TestContext& context, const PacketIo::ReadCallback& callback) {
+				context.pSecureIo->read(callback);
+			}
+		};
+
+		struct BatchPacketReaderReadTraits {
+			static void Read(const TestContext& context, const PacketIo::ReadCallback& callback) {
+				context.pSecureBatchReader->readMultiple(callback);
+			}
+		};
+	}
+
+#define READ_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PacketIoReadTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_BatchReader) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BatchPacketReaderReadTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	READ_TRAITS_BASED_TEST(ReadForwardsInnerReadError) {
+		// Arrange:
+		TestContext context;
+		context.pMockPacketIo->queueRead(SocketOperationCode::Read_Error, nullptr);
+
+		// Act:
+		ReadCallbackParams capture;
+		TTraits::Read(context, CreateReadCaptureCallback(capture));
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Read_Error, capture.ReadCode);
+		EXPECT_FALSE(capture.IsPacketValid);
+	}
+
+	namespace {
+		template<typename TReadTraits, typename TMutator>
+		void RunFailedReadTest(SocketOperationCode expectedReadCode, uint32_t childPayloadSize, TMutator mutator) {
+			// Arrange: create an (authenticated) packet
+			TestContext context;
+			auto pPacket = CreateSecureSessionPacket(context.RemoteSession, childPayloadSize);
+			auto& authenticationCode = GetSecureSessionAuthenticationCode(*pPacket);
+			auto& childPacket = GetSecureSessionChildPacket(*pPacket);
+
+			// - mutate the packet or its data
+			mutator(*pPacket, childPacket, authenticationCode);
+
+			// - queue the read
+			context.pMockPacketIo->queueRead(SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+
+			// Act:
+			ReadCallbackParams capture;
+			TReadTraits::Read(context, CreateReadCaptureCallback(capture));
+
+			// Assert:
+			EXPECT_EQ(expectedReadCode, capture.ReadCode);
+			EXPECT_FALSE(capture.IsPacketValid);
+		}
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketTypeIsWrong) {
+		// Assert: packet type must be Secure_Session
+		RunFailedReadTest<TTraits>(SocketOperationCode::Malformed_Data, 123, [](auto& packet, const auto&, const auto&) {
+			packet.Type = PacketType::Secure_Signed;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketSizeIsTooSmall) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Malformed_Data, 0, [](auto& packet, auto& childPacket, const auto&) {
+			--packet.Size;
+			--childPacket.Size;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketSizeIsTooLargeRelativeToChildPacketSize) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Malformed_Data, 123, [](const auto&, auto& childPacket, const auto&) {
+			--childPacket.Size;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketSizeIsTooSmallRelativeToChildPacketSize) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Malformed_Data, 123, [](const auto&, auto& childPacket, const auto&) {
+			++childPacket.Size;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketAuthenticationCodeDoesNotVerify) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Security_Error, 123, [](const auto&, const auto&, auto& authenticationCode) {
+			authenticationCode[Hash256_Size / 2] ^= 0xFF;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenChildPacketDataIsModified) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Security_Error, 123, [](const auto&, auto& childPacket, const auto&) {
+			childPacket.Data()[childPacket.Size / 2] ^= 0xFF;
+		});
+	}
+
+	namespace {
+		template<typename TReadTraits, typename TAction>
+		void RunReadSuccessPayloadTest(uint32_t childPayloadSize, TAction action) {
+			// Arrange: create an (authenticated) packet
+			TestContext context;
+			auto pPacket = CreateSecureSessionPacket(context.RemoteSession, childPayloadSize);
+			auto& childPacket = GetSecureSessionChildPacket(*pPacket);
+
+			// - queue the read
+			context.pMockPacketIo->queueRead(SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+
+			// Act:
+			ReadCallbackParams capture;
+			TReadTraits::Read(context, CreateReadCaptureCallback(capture));
+
+			// Assert:
+			ASSERT_EQ(SocketOperationCode::Success, capture.ReadCode);
+
+			const auto& readPacket = reinterpret_cast<const Packet&>(*capture.ReadPacketBytes.data());
+			ASSERT_EQ(sizeof(PacketHeader) + childPayloadSize, readPacket.Size);
+			EXPECT_EQ(PacketType::Push_Transactions, readPacket.Type);
+
+			EXPECT_TRUE(0 == std::memcmp(childPacket.Data(), readPacket.Data(), childPayloadSize));
+			action(readPacket);
+		}
+	}
+
+	READ_TRAITS_BASED_TEST(ReadSucceedsWhenReadingEmptyPacketWithValidAuthenticationCode) {
+		// Assert:
+		RunReadSuccessPayloadTest<TTraits>(0u, [](const auto& readPacket) {
+			// Sanity:
+			EXPECT_FALSE(!!readPacket.Data());
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadSucceedsWhenReadingNonEmptyPacketWithValidAuthenticationCode) {
+		// Assert:
+		RunReadSuccessPayloadTest<TTraits>(234u, [](const auto& readPacket) {
+			// Sanity:
+			EXPECT_TRUE(!!readPacket.Data());
+		});
+	}
+
+	// endregion
+
+	// region PacketIo - round trip
+
+	TEST(TEST_CLASS, CanRoundtripWriteAndRead) {
+		// Arrange: use the source key as the remote key so that keys match for write and read
+		auto sourceKey = test::GenerateRandomData<Key_Size>();
+		TestContext context(sourceKey, std::numeric_limits<uint32_t>::max());
+		context.pSession = std::make_shared<SecureSession>(context.SessionKey, sourceKey, sourceKey);
+		context.pSecureIo = CreateSecureSessionPacketIo(context.pMockPacketIo, context.pSession, std::numeric_limits<uint32_t>::max());
+
+		// Act + Assert:
+		test::AssertCanRoundtripPackets(*context.pMockPacketIo, *context.pSecureIo);
+	}
+
+	// endregion
+
+	// region BatchPacketReader - readMultiple (multiple packets)
+
+	TEST(TEST_CLASS, ReadSuccessWhenReadingMultiplePackets) {
+		// Arrange: create two (authenticated) packets
+		TestContext context;
+
+		constexpr auto Data1_Size = 123u;
+		auto pPacket1 = CreateSecureSessionPacket(context.RemoteSession, Data1_Size);
+		auto& childPacket1 = GetSecureSessionChildPacket(*pPacket1);
+
+		constexpr auto Data2_Size = 222u;
+		auto pPacket2 = CreateSecureSessionPacket(context.RemoteSession, Data2_Size);
+		auto& childPacket2 = GetSecureSessionChildPacket(*pPacket2);
+
+		// - queue the read of both packets
+		context.pMockPacketIo->queueRead(SocketOperationCode::Success, [pPacket1](const auto*) { return pPacket1; });
+		context.pMockPacketIo->queueRead(SocketOperationCode::Success, [pPacket2](const auto*) { return pPacket2; });
+
+		// Act:
+		std::vector<ReadCallbackParams> captures;
+		context.pSecureBatchReader->readMultiple([&captures](auto code, const auto* pReadPacket) {
+			ReadCallbackParams capture;
+			CreateReadCaptureCallback(capture)(code, pReadPacket);
+			captures.push_back(capture);
+		});
+
+		// Assert: both packets were read
+		ASSERT_EQ(2u, captures.size());
+		ASSERT_EQ(SocketOperationCode::Success, captures[0].ReadCode);
+		ASSERT_EQ(SocketOperationCode::Success, captures[1].ReadCode);
+
+		const auto& readPacket1 = reinterpret_cast<const Packet&>(*captures[0].ReadPacketBytes.data());
+		ASSERT_EQ(sizeof(PacketHeader) + Data1_Size, readPacket1.Size);
+		EXPECT_TRUE(0 == std::memcmp(childPacket1.Data(), readPacket1.Data(), Data1_Size));
+
+		const auto& readPacket2 = reinterpret_cast<const Packet&>(*captures[1].ReadPacketBytes.data());
+		ASSERT_EQ(sizeof(PacketHeader) + Data2_Size, readPacket2.Size);
+		EXPECT_TRUE(0 == std::memcmp(childPacket2.Data(), readPacket2.Data(), Data2_Size));
+	}
+
+	TEST(TEST_CLASS, ReadFailsWhenReadingPacketsOutOfOrder) {
+		// Arrange: create two (authenticated) packets but only queue the second one
+		TestContext context;
+		CreateSecureSessionPacket(context.RemoteSession, 123);
+		auto pPacket2 = CreateSecureSessionPacket(context.RemoteSession, 222);
+
+		context.pMockPacketIo->queueRead(SocketOperationCode::Success, [pPacket2](const auto*) { return pPacket2; });
+
+		// Act:
+		ReadCallbackParams capture;
+		context.pSecureIo->read(CreateReadCaptureCallback(capture));
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Security_Error, capture.ReadCode);
+		EXPECT_FALSE(capture.IsPacketValid);
+	}
+
+	// endregion
+}}
@@ -293,4 +293,106 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region pooling
+
+	namespace {
+		WorkingBuffer CreatePooledWorkingBuffer(const std::shared_ptr<ByteBufferPool>& pPool) {
+			PacketSocketOptions options;
+			options.WorkingBufferSize = Default_Capacity;
+			options.WorkingBufferSensitivity = 0;
+			options.MaxPacketDataSize = 15 * 1024;
+			options.WorkingBufferPool = pPool;
+			return WorkingBuffer(options);
+		}
+	}
+
+	TEST(TEST_CLASS, PooledWorkingBufferDoesNotAcquireMemoryOnCreation) {
+		// Arrange:
+		auto pPool = std::make_shared<ByteBufferPool>(Default_Capacity, 5);
+
+		// Act:
+		auto buffer = CreatePooledWorkingBuffer(pPool);
+
+		// Assert:
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_EQ(0u, buffer.capacity());
+	}
+
+	TEST(TEST_CLASS, PooledWorkingBufferAcquiresMemoryOnAppend) {
+		// Arrange:
+		auto pPool = std::make_shared<ByteBufferPool>(Default_Capacity, 5);
+		auto buffer = CreatePooledWorkingBuffer(pPool);
+
+		// Act:
+		auto data = AppendRandomData<10>(buffer);
+
+		// Assert:
+		EXPECT_EQ(10u, buffer.size());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+		AssertEqual(data, buffer);
+	}
+
+	TEST(TEST_CLASS, TryReleaseReturnsEmptyPooledWorkingBufferMemoryToPool) {
+		// Arrange:
+		auto pPool = std::make_shared<ByteBufferPool>(Default_Capacity, 5);
+		auto buffer = CreatePooledWorkingBuffer(pPool);
+		AppendAndConsumeRandomData(buffer, 1);
+
+		// Act:
+		auto result = buffer.tryRelease();
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_EQ(0u, buffer.capacity());
+		EXPECT_EQ(1u, pPool->numPooledBuffers());
+	}
+
+	TEST(TEST_CLASS, TryReleaseDoesNotReleaseNonEmptyPooledWorkingBuffer) {
+		// Arrange:
+		auto pPool = std::make_shared<ByteBufferPool>(Default_Capacity, 5);
+		auto buffer = CreatePooledWorkingBuffer(pPool);
+		auto data = AppendRandomData<10>(buffer);
+
+		// Act:
+		auto result = buffer.tryRelease();
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(10u, buffer.size());
+		EXPECT_EQ(0u, pPool->numPooledBuffers());
+		AssertEqual(data, buffer);
+	}
+
+	TEST(TEST_CLASS, TryReleaseDoesNotReleaseUnpooledWorkingBuffer) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+
+		// Act:
+		auto result = buffer.tryRelease();
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+	}
+
+	TEST(TEST_CLASS, PooledWorkingBufferCanReacquireMemoryAfterRelease) {
+		// Arrange:
+		auto pPool = std::make_shared<ByteBufferPool>(Default_Capacity, 5);
+		auto buffer = CreatePooledWorkingBuffer(pPool);
+		AppendAndConsumeRandomData(buffer, 1);
+		buffer.tryRelease();
+
+		// Act:
+		auto data = AppendRandomData<10>(buffer);
+
+		// Assert: the pooled memory was reused
+		EXPECT_EQ(10u, buffer.size());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+		EXPECT_EQ(0u, pPool->numPooledBuffers());
+		AssertEqual(data, buffer);
+	}
+
+	// endregion
 }}
@@ -19,9 +19,11 @@
 **/
 
 #include "catapult/model/Elements.h"
+#include "catapult/model/NotificationBuffer.h"
 #include "catapult/utils/MemoryUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/core/mocks/MockNotificationPublisher.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace model {
@@ -227,6 +229,29 @@ namespace catapult { namespace model {
 		AssertEqual(element, entityInfos[3], "0");
 	}
 
+	TEST(TEST_CLASS, ExtractEntityInfos_AttachesTransactionNotificationsWhenPresent) {
+		// Arrange: only attach notifications to the second transaction
+		WeakEntityInfos entityInfos;
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(3, 246);
+		auto element = test::BlockToBlockElement(*pBlock);
+
+		auto& transactionElement = element.Transactions[1];
+		transactionElement.OptionalNotifications = std::make_shared<TransactionNotifications>(
+				transactionElement.Transaction,
+				transactionElement.EntityHash,
+				mocks::MockNotificationPublisher());
+
+		// Act:
+		ExtractEntityInfos(element, entityInfos);
+
+		// Assert:
+		ASSERT_EQ(4u, entityInfos.size());
+		EXPECT_FALSE(!!entityInfos[0].notifications());
+		EXPECT_EQ(transactionElement.OptionalNotifications.get(), entityInfos[1].notifications());
+		EXPECT_FALSE(!!entityInfos[2].notifications());
+		EXPECT_FALSE(!!entityInfos[3].notifications());
+	}
+
 	// endregion
 
 	// region ExtractTransactionInfos
@@ -369,17 +394,41 @@ namespace catapult { namespace model {
 		transactionElement.EntityHash = test::GenerateRandomData<Hash256_Size>();
 		transactionElement.MerkleComponentHash = test::GenerateRandomData<Hash256_Size>();
 		transactionElement.OptionalExtractedAddresses = std::make_shared<AddressSet>();
+		transactionElement.OptionalNotifications = std::make_shared<TransactionNotifications>(
+				*pTransaction1,
+				transactionElement.EntityHash,
+				mocks::MockNotificationPublisher());
 
 		auto pTransaction2 = utils::UniqueToShared(test::GenerateRandomTransaction());
 
 		// Act:
 		auto transactionInfo = MakeTransactionInfo(pTransaction2, transactionElement);
 
-		// Assert:
+		// Assert: notifications are not copied because they were published for a different transaction
 		EXPECT_EQ(pTransaction2.get(), transactionInfo.pEntity.get());
 		EXPECT_EQ(transactionElement.EntityHash, transactionInfo.EntityHash);
 		EXPECT_EQ(transactionElement.MerkleComponentHash, transactionInfo.MerkleComponentHash);
 		EXPECT_EQ(transactionElement.OptionalExtractedAddresses.get(), transactionInfo.OptionalExtractedAddresses.get());
+		EXPECT_FALSE(!!transactionInfo.OptionalNotifications);
+	}
+
+	TEST(TEST_CLASS, CanMakeTransactionInfoWithNotificationsFromAliasedTransactionAndTransactionElement) {
+		// Arrange:
+		auto pTransaction = utils::UniqueToShared(test::GenerateRandomTransaction());
+		auto transactionElement = TransactionElement(*pTransaction);
+		transactionElement.EntityHash = test::GenerateRandomData<Hash256_Size>();
+		transactionElement.OptionalNotifications = std::make_shared<TransactionNotifications>(
+				*pTransaction,
+				transactionElement.EntityHash,
+				mocks::MockNotificationPublisher());
+
+		// Act:
+		auto transactionInfo = MakeTransactionInfo(pTransaction, transactionElement);
+
+		// Assert:
+		EXPECT_EQ(pTransaction.get(), transactionInfo.pEntity.get());
+		EXPECT_EQ(transactionElement.EntityHash, transactionInfo.EntityHash);
+		EXPECT_EQ(transactionElement.OptionalNotifications.get(), transactionInfo.OptionalNotifications.get());
 	}
 
 	// endregion
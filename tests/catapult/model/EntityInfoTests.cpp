@@ -19,8 +19,10 @@
 **/
 
 #include "catapult/model/EntityInfo.h"
+#include "catapult/model/NotificationBuffer.h"
 #include "catapult/utils/MemoryUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/mocks/MockNotificationPublisher.h"
 #include "tests/test/nodeps/Equality.h"
 #include "tests/TestHarness.h"
 
@@ -175,6 +177,7 @@ namespace catapult { namespace model {
 		// Assert: notice that hash(es) are not zero-initialized by default constructor
 		EXPECT_FALSE(!!transactionInfo.pEntity);
 		EXPECT_FALSE(!!transactionInfo.OptionalExtractedAddresses);
+		EXPECT_FALSE(!!transactionInfo.OptionalNotifications);
 	}
 
 	TRANSACTION_INFO_TEST(CanCreateTransactionInfoWithoutHash) {
@@ -188,6 +191,7 @@ namespace catapult { namespace model {
 		EXPECT_EQ(pTransaction.get(), transactionInfo.pEntity.get());
 		EXPECT_EQ(Hash256(), transactionInfo.EntityHash);
 		EXPECT_FALSE(!!transactionInfo.OptionalExtractedAddresses);
+		EXPECT_FALSE(!!transactionInfo.OptionalNotifications);
 		TTraits::AssertEmpty(transactionInfo);
 	}
 
@@ -203,6 +207,7 @@ namespace catapult { namespace model {
 		EXPECT_EQ(pTransaction.get(), transactionInfo.pEntity.get());
 		EXPECT_EQ(entityHash, transactionInfo.EntityHash);
 		EXPECT_FALSE(!!transactionInfo.OptionalExtractedAddresses);
+		EXPECT_FALSE(!!transactionInfo.OptionalNotifications);
 		TTraits::AssertEmpty(transactionInfo);
 	}
 
@@ -211,9 +216,11 @@ namespace catapult { namespace model {
 		auto pTransaction = utils::UniqueToShared(test::GenerateRandomTransaction());
 		auto entityHash = test::GenerateRandomData<Hash256_Size>();
 		auto pExtractedAddress = std::make_shared<AddressSet>();
+		auto pNotifications = std::make_shared<TransactionNotifications>(*pTransaction, entityHash, mocks::MockNotificationPublisher());
 
 		DetachedTransactionInfo transactionInfo(pTransaction, entityHash);
 		transactionInfo.OptionalExtractedAddresses = pExtractedAddress;
+		transactionInfo.OptionalNotifications = pNotifications;
 
 		// Act:
 		auto transactionInfoCopy = transactionInfo.copy();
@@ -223,11 +230,13 @@ namespace catapult { namespace model {
 		EXPECT_EQ(pTransaction.get(), transactionInfo.pEntity.get());
 		EXPECT_EQ(entityHash, transactionInfo.EntityHash);
 		EXPECT_EQ(pExtractedAddress.get(), transactionInfo.OptionalExtractedAddresses.get());
+		EXPECT_EQ(pNotifications.get(), transactionInfo.OptionalNotifications.get());
 
 		// - copied info has correct values
 		EXPECT_EQ(pTransaction.get(), transactionInfoCopy.pEntity.get());
 		EXPECT_EQ(entityHash, transactionInfoCopy.EntityHash);
 		EXPECT_EQ(pExtractedAddress.get(), transactionInfoCopy.OptionalExtractedAddresses.get());
+		EXPECT_EQ(pNotifications.get(), transactionInfoCopy.OptionalNotifications.get());
 	}
 
 	TEST(TEST_CLASS, CanCopyTransactionInfo) {
@@ -235,10 +244,12 @@ namespace catapult { namespace model {
 		auto pTransaction = utils::UniqueToShared(test::GenerateRandomTransaction());
 		auto entityHash = test::GenerateRandomData<Hash256_Size>();
 		auto pExtractedAddress = std::make_shared<AddressSet>();
+		auto pNotifications = std::make_shared<TransactionNotifications>(*pTransaction, entityHash, mocks::MockNotificationPublisher());
 		auto merkleComponentHash = test::GenerateRandomData<Hash256_Size>();
 
 		TransactionInfo transactionInfo(pTransaction, entityHash);
 		transactionInfo.OptionalExtractedAddresses = pExtractedAddress;
+		transactionInfo.OptionalNotifications = pNotifications;
 		transactionInfo.MerkleComponentHash = merkleComponentHash;
 
 		// Act:
@@ -249,12 +260,14 @@ namespace catapult { namespace model {
 		EXPECT_EQ(pTransaction.get(), transactionInfo.pEntity.get());
 		EXPECT_EQ(entityHash, transactionInfo.EntityHash);
 		EXPECT_EQ(pExtractedAddress.get(), transactionInfo.OptionalExtractedAddresses.get());
+		EXPECT_EQ(pNotifications.get(), transactionInfo.OptionalNotifications.get());
 		EXPECT_EQ(merkleComponentHash, transactionInfo.MerkleComponentHash);
 
 		// - copied info has correct values
 		EXPECT_EQ(pTransaction.get(), transactionInfoCopy.pEntity.get());
 		EXPECT_EQ(entityHash, transactionInfoCopy.EntityHash);
 		EXPECT_EQ(pExtractedAddress.get(), transactionInfoCopy.OptionalExtractedAddresses.get());
+		EXPECT_EQ(pNotifications.get(), transactionInfoCopy.OptionalNotifications.get());
 		EXPECT_EQ(merkleComponentHash, transactionInfoCopy.MerkleComponentHash);
 	}
 
@@ -0,0 +1,333 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/NotificationBuffer.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/Transaction.h"
+#include "tests/test/core/NotificationTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationBufferTests
+
+	namespace {
+		class HashCapturingNotificationSubscriber : public NotificationSubscriber {
+		public:
+			const auto& types() const {
+				return m_types;
+			}
+
+			const auto& hashes() const {
+				return m_hashes;
+			}
+
+		public:
+			void notify(const Notification& notification) override {
+				m_types.push_back(notification.Type);
+				m_hashes.push_back(test::CalculateNotificationHash(notification));
+			}
+
+		private:
+			std::vector<NotificationType> m_types;
+			std::vector<Hash256> m_hashes;
+		};
+	}
+
+	// region NotificationBuffer
+
+	TEST(TEST_CLASS, BufferIsInitiallyEmpty) {
+		// Act:
+		NotificationBuffer buffer;
+
+		// Assert:
+		EXPECT_EQ(0u, buffer.size());
+	}
+
+	TEST(TEST_CLASS, ReplayingEmptyBufferDoesNotNotifySubscriber) {
+		// Arrange:
+		NotificationBuffer buffer;
+		HashCapturingNotificationSubscriber sub;
+
+		// Act:
+		buffer.replay(sub);
+
+		// Assert:
+		EXPECT_TRUE(sub.types().empty());
+	}
+
+	TEST(TEST_CLASS, CannotBufferNotificationWithIncorrectSize) {
+		// Arrange:
+		NotificationBuffer buffer;
+		auto notification = test::CreateNotification(static_cast<NotificationType>(0x1234));
+		notification.Size = sizeof(Notification) - 1;
+
+		// Act + Assert:
+		EXPECT_THROW(buffer.notify(notification), catapult_invalid_argument);
+		EXPECT_EQ(0u, buffer.size());
+	}
+
+	TEST(TEST_CLASS, CanBufferAndReplaySingleNotification) {
+		// Arrange:
+		NotificationBuffer buffer;
+		HashCapturingNotificationSubscriber sub;
+		auto notification = test::CreateNotification(static_cast<NotificationType>(0x1234));
+
+		// Act:
+		buffer.notify(notification);
+		buffer.replay(sub);
+
+		// Assert:
+		EXPECT_EQ(1u, buffer.size());
+		ASSERT_EQ(1u, sub.types().size());
+		EXPECT_EQ(static_cast<NotificationType>(0x1234), sub.types()[0]);
+		EXPECT_EQ(test::CalculateNotificationHash(notification), sub.hashes()[0]);
+	}
+
+	TEST(TEST_CLASS, CanBufferAndReplayMultipleNotificationsWithDifferentSizes) {
+		// Arrange: use notifications with sizes that are not multiples of the padding
+		NotificationBuffer buffer;
+		HashCapturingNotificationSubscriber sub;
+		auto address = test::GenerateRandomData<Address_Decoded_Size>();
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+		auto notification1 = AccountAddressNotification(address);
+		auto notification2 = test::CreateNotification(static_cast<NotificationType>(0x1234));
+		auto notification3 = AccountPublicKeyNotification(publicKey);
+		auto notification4 = AccountAddressNotification(address);
+
+		// Act:
+		buffer.notify(notification1);
+		buffer.notify(notification2);
+		buffer.notify(notification3);
+		buffer.notify(notification4);
+		buffer.replay(sub);
+
+		// Assert: all notifications were replayed in order
+		EXPECT_EQ(4u, buffer.size());
+		ASSERT_EQ(4u, sub.types().size());
+		EXPECT_EQ(std::vector<NotificationType>({
+			AccountAddressNotification::Notification_Type,
+			static_cast<NotificationType>(0x1234),
+			AccountPublicKeyNotification::Notification_Type,
+			AccountAddressNotification::Notification_Type
+		}), sub.types());
+		EXPECT_EQ(std::vector<Hash256>({
+			test::CalculateNotificationHash(notification1),
+			test::CalculateNotificationHash(notification2),
+			test::CalculateNotificationHash(notification3),
+			test::CalculateNotificationHash(notification4)
+		}), sub.hashes());
+	}
+
+	TEST(TEST_CLASS, CanReplayBufferInReverseOrder) {
+		// Arrange:
+		NotificationBuffer buffer;
+		HashCapturingNotificationSubscriber sub;
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+		auto notification1 = test::CreateNotification(static_cast<NotificationType>(0x1234));
+		auto notification2 = AccountPublicKeyNotification(publicKey);
+		auto notification3 = test::CreateNotification(static_cast<NotificationType>(0x5678));
+
+		buffer.notify(notification1);
+		buffer.notify(notification2);
+		buffer.notify(notification3);
+
+		// Act:
+		buffer.replayReverse(sub);
+
+		// Assert:
+		EXPECT_EQ(std::vector<NotificationType>({
+			static_cast<NotificationType>(0x5678),
+			AccountPublicKeyNotification::Notification_Type,
+			static_cast<NotificationType>(0x1234)
+		}), sub.types());
+		EXPECT_EQ(std::vector<Hash256>({
+			test::CalculateNotificationHash(notification3),
+			test::CalculateNotificationHash(notification2),
+			test::CalculateNotificationHash(notification1)
+		}), sub.hashes());
+	}
+
+	TEST(TEST_CLASS, CanClearBuffer) {
+		// Arrange:
+		NotificationBuffer buffer;
+		HashCapturingNotificationSubscriber sub;
+		buffer.notify(test::CreateNotification(static_cast<NotificationType>(0x1234)));
+		buffer.notify(test::CreateNotification(static_cast<NotificationType>(0x5678)));
+
+		// Act:
+		buffer.clear();
+		buffer.replay(sub);
+
+		// Assert:
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_TRUE(sub.types().empty());
+	}
+
+	TEST(TEST_CLASS, CanReuseBufferAfterClear) {
+		// Arrange:
+		NotificationBuffer buffer;
+		HashCapturingNotificationSubscriber sub;
+		buffer.notify(test::CreateNotification(static_cast<NotificationType>(0x1234)));
+		buffer.clear();
+
+		// Act:
+		buffer.notify(test::CreateNotification(static_cast<NotificationType>(0x5678)));
+		buffer.replay(sub);
+
+		// Assert:
+		EXPECT_EQ(1u, buffer.size());
+		EXPECT_EQ(std::vector<NotificationType>({ static_cast<NotificationType>(0x5678) }), sub.types());
+	}
+
+	TEST(TEST_CLASS, CanReplayBufferMultipleTimes) {
+		// Arrange:
+		NotificationBuffer buffer;
+		HashCapturingNotificationSubscriber sub;
+		buffer.notify(test::CreateNotification(static_cast<NotificationType>(0x1234)));
+		buffer.notify(test::CreateNotification(static_cast<NotificationType>(0x5678)));
+
+		// Act:
+		buffer.replay(sub);
+		buffer.replay(sub);
+
+		// Assert:
+		EXPECT_EQ(2u, buffer.size());
+		EXPECT_EQ(std::vector<NotificationType>({
+			static_cast<NotificationType>(0x1234),
+			static_cast<NotificationType>(0x5678),
+			static_cast<NotificationType>(0x1234),
+			static_cast<NotificationType>(0x5678)
+		}), sub.types());
+	}
+
+	// endregion
+
+	// region TransactionNotifications
+
+	namespace {
+		class TransactionNotificationPublisher : public NotificationPublisher {
+		public:
+			TransactionNotificationPublisher() : m_numPublishCalls(0)
+			{}
+
+		public:
+			size_t numPublishCalls() const {
+				return m_numPublishCalls;
+			}
+
+		public:
+			void publish(const WeakEntityInfo& entityInfo, NotificationSubscriber& sub) const override {
+				++m_numPublishCalls;
+
+				const auto& transaction = entityInfo.cast<Transaction>().entity();
+				sub.notify(AccountPublicKeyNotification(transaction.Signer));
+				sub.notify(TransactionNotification(transaction.Signer, entityInfo.hash(), transaction.Type, transaction.Deadline));
+			}
+
+		private:
+			mutable size_t m_numPublishCalls;
+		};
+
+		class TransactionHashCapturingNotificationSubscriber : public NotificationSubscriber {
+		public:
+			const auto& types() const {
+				return m_types;
+			}
+
+			const auto& transactionHashes() const {
+				return m_transactionHashes;
+			}
+
+		public:
+			void notify(const Notification& notification) override {
+				m_types.push_back(notification.Type);
+				if (Core_Transaction_Notification == notification.Type)
+					m_transactionHashes.push_back(static_cast<const TransactionNotification&>(notification).TransactionHash);
+			}
+
+		private:
+			std::vector<NotificationType> m_types;
+			std::vector<Hash256> m_transactionHashes;
+		};
+	}
+
+	TEST(TEST_CLASS, CanCreateTransactionNotifications) {
+		// Arrange:
+		auto pTransaction = test::GenerateRandomTransaction();
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		TransactionNotificationPublisher publisher;
+
+		// Act:
+		TransactionNotifications notifications(*pTransaction, hash, publisher);
+
+		// Assert: transaction was published once
+		EXPECT_EQ(1u, publisher.numPublishCalls());
+		EXPECT_EQ(2u, notifications.size());
+		EXPECT_EQ(pTransaction.get(), &notifications.transaction());
+		EXPECT_EQ(hash, notifications.hash());
+		EXPECT_NE(&hash, &notifications.hash());
+	}
+
+	TEST(TEST_CLASS, CanReplayTransactionNotificationsWithoutRepublishing) {
+		// Arrange:
+		auto pTransaction = test::GenerateRandomTransaction();
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		TransactionNotificationPublisher publisher;
+		TransactionNotifications notifications(*pTransaction, hash, publisher);
+
+		TransactionHashCapturingNotificationSubscriber sub;
+
+		// Act:
+		notifications.replay(sub);
+		notifications.replay(sub);
+
+		// Assert:
+		EXPECT_EQ(1u, publisher.numPublishCalls());
+		EXPECT_EQ(std::vector<NotificationType>({
+			Core_Register_Account_Public_Key_Notification,
+			Core_Transaction_Notification,
+			Core_Register_Account_Public_Key_Notification,
+			Core_Transaction_Notification
+		}), sub.types());
+		EXPECT_EQ(std::vector<Hash256>({ hash, hash }), sub.transactionHashes());
+	}
+
+	TEST(TEST_CLASS, TransactionNotificationsReferenceOwnedHash) {
+		// Arrange:
+		auto pTransaction = test::GenerateRandomTransaction();
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		auto originalHash = hash;
+		TransactionNotificationPublisher publisher;
+		TransactionNotifications notifications(*pTransaction, hash, publisher);
+
+		TransactionHashCapturingNotificationSubscriber sub;
+
+		// Act: change the source hash before replaying
+		test::FillWithRandomData(hash);
+		notifications.replay(sub);
+
+		// Assert: the original hash is replayed
+		EXPECT_EQ(std::vector<Hash256>({ originalHash }), sub.transactionHashes());
+	}
+
+	// endregion
+}}
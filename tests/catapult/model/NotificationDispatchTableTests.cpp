@@ -0,0 +1,109 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/NotificationDispatchTable.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationDispatchTableTests
+
+	namespace {
+		constexpr auto Notification_Type_1 = MakeNotificationType(NotificationChannel::All, FacilityCode::Core, 0x0001);
+		constexpr auto Notification_Type_2 = MakeNotificationType(NotificationChannel::All, FacilityCode::Core, 0x0002);
+		constexpr auto Notification_Type_3 = MakeNotificationType(NotificationChannel::All, FacilityCode::Core, 0x0003);
+
+		using Handler = int;
+		using DispatchTable = NotificationDispatchTable<Handler>;
+
+		std::vector<Handler> ToValues(const DispatchTable::Handlers& handlers) {
+			std::vector<Handler> values;
+			for (const auto* pHandler : handlers)
+				values.push_back(*pHandler);
+
+			return values;
+		}
+	}
+
+	TEST(TEST_CLASS, EmptyTableHasNoHandlers) {
+		// Arrange:
+		DispatchTable table;
+
+		// Act + Assert:
+		EXPECT_TRUE(table.handlers(Notification_Type_1).empty());
+	}
+
+	TEST(TEST_CLASS, UniversalHandlersHandleAllTypes) {
+		// Arrange:
+		std::vector<Handler> handlers{ 1, 2 };
+		DispatchTable table;
+		table.add(handlers[0]);
+		table.add(handlers[1]);
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Handler>({ 1, 2 }), ToValues(table.handlers(Notification_Type_1)));
+		EXPECT_EQ(std::vector<Handler>({ 1, 2 }), ToValues(table.handlers(Notification_Type_2)));
+	}
+
+	TEST(TEST_CLASS, TypedHandlersOnlyHandleMatchingTypes) {
+		// Arrange:
+		std::vector<Handler> handlers{ 1, 2, 3 };
+		DispatchTable table;
+		table.add(Notification_Type_1, handlers[0]);
+		table.add(Notification_Type_2, handlers[1]);
+		table.add(Notification_Type_1, handlers[2]);
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Handler>({ 1, 3 }), ToValues(table.handlers(Notification_Type_1)));
+		EXPECT_EQ(std::vector<Handler>({ 2 }), ToValues(table.handlers(Notification_Type_2)));
+		EXPECT_TRUE(table.handlers(Notification_Type_3).empty());
+	}
+
+	TEST(TEST_CLASS, HandlersAreReturnedInRegistrationOrder) {
+		// Arrange: interleave universal and typed handlers
+		std::vector<Handler> handlers{ 1, 2, 3, 4, 5, 6 };
+		DispatchTable table;
+		table.add(handlers[0]);
+		table.add(Notification_Type_1, handlers[1]);
+		table.add(handlers[2]);
+		table.add(Notification_Type_2, handlers[3]);
+		table.add(Notification_Type_1, handlers[4]);
+		table.add(handlers[5]);
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Handler>({ 1, 2, 3, 5, 6 }), ToValues(table.handlers(Notification_Type_1)));
+		EXPECT_EQ(std::vector<Handler>({ 1, 3, 4, 6 }), ToValues(table.handlers(Notification_Type_2)));
+		EXPECT_EQ(std::vector<Handler>({ 1, 3, 6 }), ToValues(table.handlers(Notification_Type_3)));
+	}
+
+	TEST(TEST_CLASS, HandlersAreMatchedIgnoringChannel) {
+		// Arrange:
+		std::vector<Handler> handlers{ 1, 2 };
+		DispatchTable table;
+		table.add(Notification_Type_1, handlers[0]);
+		table.add(Notification_Type_2, handlers[1]);
+
+		auto type = Notification_Type_1;
+		SetNotificationChannel(type, NotificationChannel::Observer);
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Handler>({ 1 }), ToValues(table.handlers(type)));
+	}
+}}
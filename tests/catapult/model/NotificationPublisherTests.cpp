@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationBuffer.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
@@ -360,4 +361,53 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region previously published notifications
+
+	namespace {
+		enum class NotificationsMismatch { None, Hash, Transaction };
+
+		void AssertPublishWithNotifications(PublicationMode mode, NotificationsMismatch mismatch, size_t numExpectedNotifications) {
+			// Arrange: prepublish only basic notifications so that replayed notifications can be distinguished
+			auto registry = mocks::CreateDefaultTransactionRegistry(Plugin_Option_Flags);
+			auto pTransaction = mocks::CreateMockTransaction(12);
+			auto pBasicPub = CreateNotificationPublisher(registry, PublicationMode::Basic);
+			TransactionNotifications notifications(*pTransaction, test::GenerateRandomData<Hash256_Size>(), *pBasicPub);
+
+			auto pOtherTransaction = mocks::CreateMockTransaction(12);
+			auto hash = NotificationsMismatch::Hash == mismatch ? test::GenerateRandomData<Hash256_Size>() : notifications.hash();
+			const auto& transaction = NotificationsMismatch::Transaction == mismatch ? *pOtherTransaction : *pTransaction;
+
+			mocks::MockNotificationSubscriber sub;
+			auto pPub = CreateNotificationPublisher(registry, mode);
+
+			// Act:
+			pPub->publish(WeakEntityInfo(transaction, hash, &notifications), sub);
+
+			// Assert:
+			EXPECT_EQ(numExpectedNotifications, sub.numNotifications());
+		}
+	}
+
+	TEST(TEST_CLASS, AllPublisherReplaysMatchingNotifications) {
+		// Act + Assert: 4 prepublished basic notifications were replayed
+		AssertPublishWithNotifications(PublicationMode::All, NotificationsMismatch::None, 4);
+	}
+
+	TEST(TEST_CLASS, AllPublisherRepublishesWhenNotificationsHaveDifferentHash) {
+		// Act + Assert: 4 raised by NotificationPublisher, 8 raised by MockTransaction::publish
+		AssertPublishWithNotifications(PublicationMode::All, NotificationsMismatch::Hash, 4 + 8);
+	}
+
+	TEST(TEST_CLASS, AllPublisherRepublishesWhenNotificationsHaveDifferentTransaction) {
+		// Act + Assert: 4 raised by NotificationPublisher, 8 raised by MockTransaction::publish
+		AssertPublishWithNotifications(PublicationMode::All, NotificationsMismatch::Transaction, 4 + 8);
+	}
+
+	TEST(TEST_CLASS, CustomPublisherIgnoresNotifications) {
+		// Act + Assert: 8 raised by MockTransaction::publish
+		AssertPublishWithNotifications(PublicationMode::Custom, NotificationsMismatch::None, 8);
+	}
+
+	// endregion
 }}
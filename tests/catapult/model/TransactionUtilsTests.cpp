@@ -20,10 +20,12 @@
 
 #include "catapult/model/TransactionUtils.h"
 #include "catapult/model/Address.h"
+#include "catapult/model/NotificationBuffer.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/model/NotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/TestHarness.h"
+#include <list>
 
 namespace catapult { namespace model {
 
@@ -45,10 +47,11 @@ namespace catapult { namespace model {
 				const auto& transaction = entityInfo.cast<mocks::MockTransaction>().entity();
 
 				if (Mode::Address == m_mode) {
-					auto senderAddress = PublicKeyToAddress(transaction.Signer, Network_Identifier);
-					auto recipientAddress = PublicKeyToAddress(transaction.Recipient, Network_Identifier);
-					sub.notify(AccountAddressNotification(senderAddress));
-					sub.notify(AccountAddressNotification(recipientAddress));
+					// notifications reference addresses, so they need to outlive publish when notifications are buffered
+					m_addresses.push_back(PublicKeyToAddress(transaction.Signer, Network_Identifier));
+					sub.notify(AccountAddressNotification(m_addresses.back()));
+					m_addresses.push_back(PublicKeyToAddress(transaction.Recipient, Network_Identifier));
+					sub.notify(AccountAddressNotification(m_addresses.back()));
 				} else if (Mode::Public_Key == m_mode) {
 					sub.notify(AccountPublicKeyNotification(transaction.Signer));
 					sub.notify(AccountPublicKeyNotification(transaction.Recipient));
@@ -59,8 +62,23 @@ namespace catapult { namespace model {
 
 		private:
 			Mode m_mode;
+			mutable std::list<Address> m_addresses;
 		};
 
+		struct PublisherTraits {
+			static AddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher) {
+				return model::ExtractAddresses(transaction, notificationPublisher);
+			}
+		};
+
+		struct NotificationsTraits {
+			static AddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher) {
+				TransactionNotifications notifications(transaction, test::GenerateRandomData<Hash256_Size>(), notificationPublisher);
+				return model::ExtractAddresses(notifications);
+			}
+		};
+
+		template<typename TTraits>
 		void RunExtractAddressesTest(MockNotificationPublisher::Mode mode) {
 			// Arrange:
 			auto pTransaction = mocks::CreateMockTransactionWithSignerAndRecipient(
@@ -72,7 +90,7 @@ namespace catapult { namespace model {
 			MockNotificationPublisher notificationPublisher(mode);
 
 			// Act:
-			auto addresses = ExtractAddresses(*pTransaction, notificationPublisher);
+			auto addresses = TTraits::ExtractAddresses(*pTransaction, notificationPublisher);
 
 			// Assert:
 			EXPECT_EQ(2u, addresses.size());
@@ -81,17 +99,23 @@ namespace catapult { namespace model {
 		}
 	}
 
-	TEST(TEST_CLASS, ExtractAddressesExtractsAddressesFromAddressNotifications) {
+#define EXTRACT_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Publisher) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PublisherTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Notifications) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<NotificationsTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	EXTRACT_TRAITS_BASED_TEST(ExtractAddressesExtractsAddressesFromAddressNotifications) {
 		// Assert:
-		RunExtractAddressesTest(MockNotificationPublisher::Mode::Address);
+		RunExtractAddressesTest<TTraits>(MockNotificationPublisher::Mode::Address);
 	}
 
-	TEST(TEST_CLASS, ExtractAddressesExtractsAddressesFromPublicKeyNotifications) {
+	EXTRACT_TRAITS_BASED_TEST(ExtractAddressesExtractsAddressesFromPublicKeyNotifications) {
 		// Assert:
-		RunExtractAddressesTest(MockNotificationPublisher::Mode::Public_Key);
+		RunExtractAddressesTest<TTraits>(MockNotificationPublisher::Mode::Public_Key);
 	}
 
-	TEST(TEST_CLASS, ExtractAddressesDoesNotExtractAddressesFromOtherNotifications) {
+	EXTRACT_TRAITS_BASED_TEST(ExtractAddressesDoesNotExtractAddressesFromOtherNotifications) {
 		// Arrange:
 		auto pTransaction = mocks::CreateMockTransactionWithSignerAndRecipient(
 				test::GenerateRandomData<Key_Size>(),
@@ -100,7 +124,7 @@ namespace catapult { namespace model {
 		MockNotificationPublisher notificationPublisher(MockNotificationPublisher::Mode::Other);
 
 		// Act:
-		auto addresses = ExtractAddresses(*pTransaction, notificationPublisher);
+		auto addresses = TTraits::ExtractAddresses(*pTransaction, notificationPublisher);
 
 		// Assert:
 		EXPECT_TRUE(addresses.empty());
@@ -20,6 +20,8 @@
 
 #include "catapult/model/WeakEntityInfo.h"
 #include "catapult/model/Block.h"
+#include "catapult/model/NotificationBuffer.h"
+#include "tests/test/core/mocks/MockNotificationPublisher.h"
 #include "tests/test/nodeps/Equality.h"
 #include "tests/TestHarness.h"
 
@@ -46,6 +48,7 @@ namespace catapult { namespace model {
 		// Assert:
 		EXPECT_FALSE(info.isSet());
 		EXPECT_FALSE(info.isHashSet());
+		EXPECT_FALSE(!!info.notifications());
 	}
 
 	TEST(TEST_CLASS, CanCreateWeakEntityInfoWithoutHash) {
@@ -58,6 +61,7 @@ namespace catapult { namespace model {
 		// Assert:
 		EXPECT_TRUE(info.isSet());
 		EXPECT_FALSE(info.isHashSet());
+		EXPECT_FALSE(!!info.notifications());
 	}
 
 	TEST(TEST_CLASS, CanCreateWeakEntityInfo) {
@@ -70,6 +74,21 @@ namespace catapult { namespace model {
 
 		// Assert:
 		AssertAreEqual(info, entity, hash, "info");
+		EXPECT_FALSE(!!info.notifications());
+	}
+
+	TEST(TEST_CLASS, CanCreateWeakEntityInfoWithNotifications) {
+		// Arrange:
+		Transaction transaction;
+		Hash256 hash;
+		TransactionNotifications notifications(transaction, hash, mocks::MockNotificationPublisher());
+
+		// Act:
+		WeakEntityInfo info(transaction, hash, &notifications);
+
+		// Assert:
+		AssertAreEqual(info, transaction, hash, "info");
+		EXPECT_EQ(&notifications, info.notifications());
 	}
 
 	TEST(TEST_CLASS, CanAssignWeakEntityInfo) {
@@ -164,6 +183,21 @@ namespace catapult { namespace model {
 		EXPECT_TRUE(isEntityTyped);
 	}
 
+	TEST(TEST_CLASS, CanConvertToStronglyTypedInfoWithNotifications) {
+		// Arrange:
+		Transaction transaction;
+		Hash256 hash;
+		TransactionNotifications notifications(transaction, hash, mocks::MockNotificationPublisher());
+		WeakEntityInfo info(transaction, hash, &notifications);
+
+		// Act:
+		auto transactionInfo = info.cast<Transaction>();
+
+		// Assert:
+		AssertAreEqual(transactionInfo, transaction, hash, "transactionInfo");
+		EXPECT_EQ(&notifications, transactionInfo.notifications());
+	}
+
 	TEST(TEST_CLASS, CanOutputUnsetEntityInfo) {
 		// Arrange:
 		WeakEntityInfo info;
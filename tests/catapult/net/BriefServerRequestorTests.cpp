@@ -19,8 +19,8 @@
 **/
 
 #include "catapult/net/BriefServerRequestor.h"
-#include "catapult/api/ChainPackets.h"
 #include "catapult/api/RemoteChainApi.h"
+#include "catapult/ionet/ChainPackets.h"
 #include "tests/test/net/BriefServerRequestorTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -73,7 +73,7 @@ namespace catapult { namespace net {
 
 		public:
 			std::shared_ptr<ionet::Packet> createResponsePacket(Height height) const {
-				auto pPacket = ionet::CreateSharedPacket<api::ChainInfoResponse>();
+				auto pPacket = ionet::CreateSharedPacket<ionet::ChainInfoResponse>();
 				pPacket->Height = height;
 				return pPacket;
 			}
@@ -124,7 +124,7 @@ namespace catapult { namespace net {
 		// Arrange: create an invalid packet (no payload)
 		RequestorTestContext<> context;
 		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
-		pPacket->Type = api::ChainInfoResponse::Packet_Type;
+		pPacket->Type = ionet::ChainInfoResponse::Packet_Type;
 
 		// Act:
 		RunConnectedTest<MemberBeginRequestPolicy>(context, pPacket, [](const auto& requestor, auto result, const auto& response) {
@@ -269,7 +269,7 @@ namespace catapult { namespace net {
 		// Arrange: create an invalid packet (no payload)
 		RequestorTestContext<> context;
 		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
-		pPacket->Type = api::ChainInfoResponse::Packet_Type;
+		pPacket->Type = ionet::ChainInfoResponse::Packet_Type;
 
 		// Act:
 		RunConnectedTest<BeginRequestFuturePolicy>(context, pPacket, [](const auto& requestor, auto result, const auto& response) {
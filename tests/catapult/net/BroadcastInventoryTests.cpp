@@ -0,0 +1,334 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/net/BroadcastInventory.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/ionet/BroadcastUtils.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace net {
+
+#define TEST_CLASS BroadcastInventoryTests
+
+	// region CalculateBroadcastInventory
+
+	namespace {
+		ionet::PacketPayload CreatePayload(ionet::PacketType type, const std::vector<Hash256>& values) {
+			ionet::PacketPayloadBuilder builder(type);
+			for (const auto& value : values)
+				builder.appendValue(value);
+
+			return builder.build();
+		}
+
+		utils::ShortHash CalculateExpectedShortHash(const std::vector<Hash256>& values) {
+			Hash256 hash;
+			crypto::Sha3_256_Builder builder;
+			for (const auto& value : values)
+				builder.update({ value.data(), value.size() });
+
+			builder.final(hash);
+			return utils::ToShortHash(hash);
+		}
+
+		void AssertItemPerBufferInventory(ionet::PacketType type) {
+			// Arrange:
+			auto values = test::GenerateRandomDataVector<Hash256>(3);
+			auto payload = CreatePayload(type, values);
+
+			// Act:
+			auto inventory = CalculateBroadcastInventory(payload);
+
+			// Assert:
+			ASSERT_EQ(3u, inventory.size());
+			for (auto i = 0u; i < values.size(); ++i)
+				EXPECT_EQ(CalculateExpectedShortHash({ values[i] }), inventory[i]) << "item " << i;
+		}
+
+		void AssertSingleItemInventory(ionet::PacketType type) {
+			// Arrange:
+			auto values = test::GenerateRandomDataVector<Hash256>(3);
+			auto payload = CreatePayload(type, values);
+
+			// Act:
+			auto inventory = CalculateBroadcastInventory(payload);
+
+			// Assert:
+			ASSERT_EQ(1u, inventory.size());
+			EXPECT_EQ(CalculateExpectedShortHash(values), inventory[0]);
+		}
+	}
+
+	TEST(TEST_CLASS, InventoryOfUnsetPayloadIsEmpty) {
+		// Act:
+		auto inventory = CalculateBroadcastInventory(ionet::PacketPayload());
+
+		// Assert:
+		EXPECT_TRUE(inventory.empty());
+	}
+
+	TEST(TEST_CLASS, InventoryOfPayloadWithoutEntitiesIsEmpty) {
+		// Arrange:
+		auto payload = CreatePayload(ionet::PacketType::Chain_Info, test::GenerateRandomDataVector<Hash256>(3));
+
+		// Act:
+		auto inventory = CalculateBroadcastInventory(payload);
+
+		// Assert:
+		EXPECT_TRUE(inventory.empty());
+	}
+
+	TEST(TEST_CLASS, InventoryOfTransactionsPayloadContainsItemPerBuffer) {
+		// Assert:
+		AssertItemPerBufferInventory(ionet::PacketType::Push_Transactions);
+	}
+
+	TEST(TEST_CLASS, InventoryOfPartialTransactionsPayloadContainsItemPerBuffer) {
+		// Assert:
+		AssertItemPerBufferInventory(ionet::PacketType::Push_Partial_Transactions);
+	}
+
+	TEST(TEST_CLASS, InventoryOfBlockPayloadContainsSingleItemCalculatedFromHeader) {
+		// Arrange:
+		std::shared_ptr<const model::Block> pBlock = test::GenerateBlockWithTransactions(3);
+		auto payload = ionet::CreateBroadcastPayload(pBlock);
+
+		// Act:
+		auto inventory = CalculateBroadcastInventory(payload);
+
+		// Assert: transactions following the block header are ignored
+		Hash256 expectedHash;
+		crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(pBlock.get()), sizeof(model::BlockHeader) }, expectedHash);
+		ASSERT_EQ(1u, inventory.size());
+		EXPECT_EQ(utils::ToShortHash(expectedHash), inventory[0]);
+	}
+
+	TEST(TEST_CLASS, InventoryOfCompactBlockPayloadContainsSameItemAsBlockPayload) {
+		// Arrange:
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		std::shared_ptr<const model::Block> pBlock = test::GenerateBlockWithTransactions(3);
+		auto payload = ionet::CreateCompactBroadcastPayload(*pBlock, registry);
+
+		// Act:
+		auto inventory = CalculateBroadcastInventory(payload);
+
+		// Assert:
+		ASSERT_EQ(1u, inventory.size());
+		EXPECT_EQ(CalculateBroadcastInventory(ionet::CreateBroadcastPayload(pBlock)), inventory);
+	}
+
+	TEST(TEST_CLASS, InventoryOfCosignaturesPayloadContainsSingleItem) {
+		// Assert:
+		AssertSingleItemInventory(ionet::PacketType::Push_Detached_Cosignatures);
+	}
+
+	// endregion
+
+	// region CalculateBroadcastInventoryItem
+
+	TEST(TEST_CLASS, InventoryItemOfBlockMatchesBlockPayloadInventory) {
+		// Arrange:
+		std::shared_ptr<const model::Block> pBlock = test::GenerateBlockWithTransactions(3);
+
+		// Act:
+		auto shortHash = CalculateBroadcastInventoryItem(*pBlock);
+
+		// Assert:
+		EXPECT_EQ(std::vector<utils::ShortHash>{ shortHash }, CalculateBroadcastInventory(ionet::CreateBroadcastPayload(pBlock)));
+	}
+
+	TEST(TEST_CLASS, InventoryItemOfTransactionMatchesTransactionsPayloadInventory) {
+		// Arrange:
+		std::vector<model::TransactionInfo> transactionInfos;
+		transactionInfos.emplace_back(test::GenerateRandomTransaction());
+
+		// Act:
+		auto shortHash = CalculateBroadcastInventoryItem(*transactionInfos[0].pEntity);
+
+		// Assert:
+		EXPECT_EQ(std::vector<utils::ShortHash>{ shortHash }, CalculateBroadcastInventory(ionet::CreateBroadcastPayload(transactionInfos)));
+	}
+
+	// endregion
+
+	// region KnownInventory
+
+	TEST(TEST_CLASS, KnownInventoryIsInitiallyEmpty) {
+		// Act:
+		KnownInventory knownInventory(10);
+
+		// Assert:
+		EXPECT_EQ(0u, knownInventory.size());
+	}
+
+	TEST(TEST_CLASS, CanAddUnknownItemToKnownInventory) {
+		// Arrange:
+		KnownInventory knownInventory(10);
+		auto shortHash = test::GenerateRandomValue<utils::ShortHash>();
+
+		// Act:
+		auto isAdded = knownInventory.add(shortHash);
+
+		// Assert:
+		EXPECT_TRUE(isAdded);
+		EXPECT_EQ(1u, knownInventory.size());
+		EXPECT_TRUE(knownInventory.contains(shortHash));
+	}
+
+	TEST(TEST_CLASS, CannotAddKnownItemToKnownInventory) {
+		// Arrange:
+		KnownInventory knownInventory(10);
+		knownInventory.add(utils::ShortHash(123));
+
+		// Act:
+		auto isAdded = knownInventory.add(utils::ShortHash(123));
+
+		// Assert:
+		EXPECT_FALSE(isAdded);
+		EXPECT_EQ(1u, knownInventory.size());
+		EXPECT_TRUE(knownInventory.contains(utils::ShortHash(123)));
+	}
+
+	TEST(TEST_CLASS, KnownInventoryForgetsOldestItemWhenFull) {
+		// Arrange:
+		KnownInventory knownInventory(3);
+		for (auto i = 1u; i <= 3; ++i)
+			knownInventory.add(utils::ShortHash(i));
+
+		// Act:
+		auto isAdded = knownInventory.add(utils::ShortHash(4));
+
+		// Assert:
+		EXPECT_TRUE(isAdded);
+		EXPECT_EQ(3u, knownInventory.size());
+		EXPECT_FALSE(knownInventory.contains(utils::ShortHash(1)));
+		for (auto i = 2u; i <= 4; ++i)
+			EXPECT_TRUE(knownInventory.contains(utils::ShortHash(i))) << "item " << i;
+
+		// - the forgotten item is unknown again
+		EXPECT_TRUE(knownInventory.add(utils::ShortHash(1)));
+		EXPECT_FALSE(knownInventory.contains(utils::ShortHash(2)));
+	}
+
+	TEST(TEST_CLASS, KnownInventoryWithZeroSizeIsDisabled) {
+		// Arrange:
+		KnownInventory knownInventory(0);
+
+		// Act:
+		auto isAdded1 = knownInventory.add(utils::ShortHash(123));
+		auto isAdded2 = knownInventory.add(utils::ShortHash(123));
+
+		// Assert: items are never remembered
+		EXPECT_TRUE(isAdded1);
+		EXPECT_TRUE(isAdded2);
+		EXPECT_EQ(0u, knownInventory.size());
+		EXPECT_FALSE(knownInventory.contains(utils::ShortHash(123)));
+	}
+
+	// endregion
+
+	// region PeerKnownInventories
+
+	TEST(TEST_CLASS, PeerKnownInventoriesAreInitiallyEmpty) {
+		// Act:
+		PeerKnownInventories knownInventories(10);
+
+		// Assert:
+		EXPECT_EQ(0u, knownInventories.size());
+	}
+
+	TEST(TEST_CLASS, CanAcquireKnownInventoryOfUntrackedPeer) {
+		// Arrange:
+		PeerKnownInventories knownInventories(10);
+
+		// Act:
+		auto pInventory = knownInventories.acquire(test::GenerateRandomData<Key_Size>());
+
+		// Assert:
+		ASSERT_TRUE(!!pInventory);
+		EXPECT_EQ(0u, pInventory->size());
+		EXPECT_EQ(1u, knownInventories.size());
+	}
+
+	TEST(TEST_CLASS, AcquireReturnsSameKnownInventoryForTrackedPeer) {
+		// Arrange:
+		PeerKnownInventories knownInventories(10);
+		auto key = test::GenerateRandomData<Key_Size>();
+		auto pInventory1 = knownInventories.acquire(key);
+
+		// Act:
+		auto pInventory2 = knownInventories.acquire(key);
+
+		// Assert:
+		EXPECT_EQ(pInventory1, pInventory2);
+		EXPECT_EQ(1u, knownInventories.size());
+	}
+
+	TEST(TEST_CLASS, AddUpdatesKnownInventoryOfTrackedPeer) {
+		// Arrange:
+		PeerKnownInventories knownInventories(10);
+		auto key = test::GenerateRandomData<Key_Size>();
+		auto pInventory = knownInventories.acquire(key);
+		auto pOtherInventory = knownInventories.acquire(test::GenerateRandomData<Key_Size>());
+
+		// Act:
+		knownInventories.add(key, { utils::ShortHash(123), utils::ShortHash(234) });
+
+		// Assert: only the known inventory of the specified peer is updated
+		EXPECT_EQ(2u, pInventory->size());
+		EXPECT_TRUE(pInventory->contains(utils::ShortHash(123)));
+		EXPECT_TRUE(pInventory->contains(utils::ShortHash(234)));
+		EXPECT_EQ(0u, pOtherInventory->size());
+	}
+
+	TEST(TEST_CLASS, AddIgnoresUntrackedPeer) {
+		// Arrange:
+		PeerKnownInventories knownInventories(10);
+		auto key = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		knownInventories.add(key, { utils::ShortHash(123) });
+		auto pInventory = knownInventories.acquire(key);
+
+		// Assert:
+		EXPECT_EQ(0u, pInventory->size());
+	}
+
+	TEST(TEST_CLASS, PeerIsUntrackedWhenAllAcquiredKnownInventoriesAreDestroyed) {
+		// Arrange:
+		PeerKnownInventories knownInventories(10);
+		auto key = test::GenerateRandomData<Key_Size>();
+		knownInventories.acquire(key)->add(utils::ShortHash(123));
+
+		// Act:
+		knownInventories.add(key, { utils::ShortHash(234) });
+		auto pInventory = knownInventories.acquire(key);
+
+		// Assert: a new known inventory is created for the untracked peer
+		EXPECT_EQ(1u, knownInventories.size());
+		EXPECT_EQ(0u, pInventory->size());
+	}
+
+	// endregion
+}}
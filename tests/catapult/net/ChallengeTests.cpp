@@ -102,6 +102,44 @@ namespace catapult { namespace net {
 		});
 	}
 
+	TEST(TEST_CLASS, GenerateServerChallengeResponseCanRequestCompression) {
+		// Arrange:
+		auto pRequest = GenerateServerChallengeRequest();
+		auto keyPair = test::GenerateKeyPair();
+
+		// Act:
+		auto pResponse = GenerateServerChallengeResponse(*pRequest, keyPair, ionet::ConnectionSecurityMode::Signed, true);
+
+		// Assert: the request only affects the client challenge
+		EXPECT_EQ(sizeof(ServerChallengeResponse), pResponse->Size);
+		EXPECT_EQ(ionet::ConnectionSecurityMode::Signed, pResponse->SecurityMode);
+		EXPECT_TRUE(VerifyServerChallengeResponse(*pResponse, pRequest->Challenge));
+		EXPECT_TRUE(IsCompressionRequested(*pResponse));
+	}
+
+	TEST(TEST_CLASS, GenerateServerChallengeResponseDoesNotRequestCompressionByDefault) {
+		// Arrange:
+		auto pRequest = GenerateServerChallengeRequest();
+		auto keyPair = test::GenerateKeyPair();
+
+		// Act:
+		auto pResponse1 = GenerateServerChallengeResponse(*pRequest, keyPair, ionet::ConnectionSecurityMode::Signed);
+		auto pResponse2 = GenerateServerChallengeResponse(*pRequest, keyPair, ionet::ConnectionSecurityMode::Signed, false);
+
+		// Assert:
+		EXPECT_FALSE(IsCompressionRequested(*pResponse1));
+		EXPECT_FALSE(IsCompressionRequested(*pResponse2));
+	}
+
+	TEST(TEST_CLASS, CompressionRequestedChallengeIsRandom) {
+		// Assert:
+		AssertRandomChallengeGenerator([]() {
+			auto securityMode = ionet::ConnectionSecurityMode::None;
+			auto pResponse = GenerateServerChallengeResponse(ServerChallengeRequest(), test::GenerateKeyPair(), securityMode, true);
+			return pResponse->Challenge;
+		});
+	}
+
 	// endregion
 
 	// region VerifyServerChallengeResponse
@@ -166,6 +204,22 @@ namespace catapult { namespace net {
 		EXPECT_TRUE(crypto::Verify(keyPair.publicKey(), pRequest->Challenge, pResponse->Signature));
 	}
 
+	TEST(TEST_CLASS, GenerateClientChallengeResponseCanAcceptCompression) {
+		// Arrange:
+		auto pServerRequest = GenerateServerChallengeRequest();
+		auto securityMode = ionet::ConnectionSecurityMode::None;
+		auto pRequest = GenerateServerChallengeResponse(*pServerRequest, test::GenerateKeyPair(), securityMode, true);
+		auto keyPair = test::GenerateKeyPair();
+
+		// Act:
+		auto pResponse = GenerateClientChallengeResponse(*pRequest, keyPair, true);
+
+		// Assert: the packet size is unchanged but the acceptance is signed
+		EXPECT_EQ(sizeof(ClientChallengeResponse), pResponse->Size);
+		EXPECT_EQ(ionet::PacketType::Client_Challenge, pResponse->Type);
+		EXPECT_FALSE(crypto::Verify(keyPair.publicKey(), pRequest->Challenge, pResponse->Signature));
+	}
+
 	// endregion
 
 	// region VerifyClientChallengeResponse
@@ -199,5 +253,116 @@ namespace catapult { namespace net {
 		EXPECT_FALSE(isVerified);
 	}
 
+	namespace {
+		void AssertVerifyClientChallengeResponseCompressionAcceptance(bool isCompressionAccepted, bool isAcceptanceExpected) {
+			// Arrange:
+			auto keyPair = test::GenerateKeyPair();
+			auto pServerRequest = GenerateServerChallengeRequest();
+			auto pRequest = GenerateServerChallengeResponse(*pServerRequest, keyPair, ionet::ConnectionSecurityMode::None, true);
+			auto pResponse = GenerateClientChallengeResponse(*pRequest, keyPair, isCompressionAccepted);
+
+			// Act:
+			auto isVerified = VerifyClientChallengeResponse(*pResponse, keyPair.publicKey(), pRequest->Challenge, isAcceptanceExpected);
+
+			// Assert:
+			EXPECT_EQ(isCompressionAccepted == isAcceptanceExpected, isVerified)
+					<< "accepted " << isCompressionAccepted << ", expected " << isAcceptanceExpected;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyClientChallengeResponseReturnsTrueForMatchingCompressionAcceptance) {
+		// Assert:
+		AssertVerifyClientChallengeResponseCompressionAcceptance(true, true);
+		AssertVerifyClientChallengeResponseCompressionAcceptance(false, false);
+	}
+
+	TEST(TEST_CLASS, VerifyClientChallengeResponseReturnsFalseForMismatchedCompressionAcceptance) {
+		// Assert:
+		AssertVerifyClientChallengeResponseCompressionAcceptance(true, false);
+		AssertVerifyClientChallengeResponseCompressionAcceptance(false, true);
+	}
+
+	// endregion
+
+	// region TryCalculateSessionKey
+
+	namespace {
+		struct SessionKeys {
+			bool IsServerKeyCalculated;
+			Hash256 ServerKey;
+			bool IsClientKeyCalculated;
+			Hash256 ClientKey;
+		};
+
+		SessionKeys CalculateSessionKeys(const Challenge& serverChallenge, const Challenge& clientChallenge) {
+			auto serverKeyPair = test::GenerateKeyPair();
+			auto clientKeyPair = test::GenerateKeyPair();
+
+			SessionKeys keys;
+			keys.IsServerKeyCalculated = TryCalculateSessionKey(
+					serverKeyPair,
+					clientKeyPair.publicKey(),
+					serverChallenge,
+					clientChallenge,
+					keys.ServerKey);
+			keys.IsClientKeyCalculated = TryCalculateSessionKey(
+					clientKeyPair,
+					serverKeyPair.publicKey(),
+					serverChallenge,
+					clientChallenge,
+					keys.ClientKey);
+			return keys;
+		}
+	}
+
+	TEST(TEST_CLASS, TryCalculateSessionKeyCalculatesSameKeyForServerAndClient) {
+		// Arrange:
+		auto serverChallenge = test::GenerateRandomData<Challenge().size()>();
+		auto clientChallenge = test::GenerateRandomData<Challenge().size()>();
+
+		// Act:
+		auto keys = CalculateSessionKeys(serverChallenge, clientChallenge);
+
+		// Assert:
+		EXPECT_TRUE(keys.IsServerKeyCalculated);
+		EXPECT_TRUE(keys.IsClientKeyCalculated);
+		EXPECT_EQ(keys.ServerKey, keys.ClientKey);
+	}
+
+	TEST(TEST_CLASS, TryCalculateSessionKeyCalculatesDifferentKeysForDifferentChallenges) {
+		// Arrange:
+		auto keyPair = test::GenerateKeyPair();
+		auto remoteKeyPair = test::GenerateKeyPair();
+		auto challenge1 = test::GenerateRandomData<Challenge().size()>();
+		auto challenge2 = test::GenerateRandomData<Challenge().size()>();
+
+		// Act:
+		Hash256 sessionKey1;
+		Hash256 sessionKey2;
+		Hash256 sessionKey3;
+		TryCalculateSessionKey(keyPair, remoteKeyPair.publicKey(), challenge1, challenge2, sessionKey1);
+		TryCalculateSessionKey(keyPair, remoteKeyPair.publicKey(), challenge2, challenge1, sessionKey2);
+		TryCalculateSessionKey(keyPair, remoteKeyPair.publicKey(), challenge1, challenge1, sessionKey3);
+
+		// Assert:
+		EXPECT_NE(sessionKey1, sessionKey2);
+		EXPECT_NE(sessionKey1, sessionKey3);
+		EXPECT_NE(sessionKey2, sessionKey3);
+	}
+
+	TEST(TEST_CLASS, TryCalculateSessionKeyFailsForInvalidRemoteKey) {
+		// Arrange: use the neutral element as remote key
+		auto keyPair = test::GenerateKeyPair();
+		Key remoteKey{ { 1 } };
+		auto challenge = test::GenerateRandomData<Challenge().size()>();
+
+		// Act:
+		Hash256 sessionKey;
+		auto result = TryCalculateSessionKey(keyPair, remoteKey, challenge, challenge, sessionKey);
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
 	// endregion
 }}
@@ -32,20 +32,50 @@ namespace catapult { namespace net {
 		// Assert:
 		EXPECT_EQ(model::NetworkIdentifier::Zero, settings.NetworkIdentifier);
 		EXPECT_EQ(utils::TimeSpan::FromSeconds(10), settings.Timeout);
+		EXPECT_EQ(utils::TimeSpan::FromSeconds(0), settings.MultiplexedRequestTimeout);
+		EXPECT_FALSE(settings.isMultiplexingEnabled());
 		EXPECT_EQ(utils::FileSize::FromKilobytes(4), settings.SocketWorkingBufferSize);
 		EXPECT_EQ(0u, settings.SocketWorkingBufferSensitivity);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(100), settings.MaxPacketDataSize);
+		EXPECT_EQ(utils::FileSize::FromBytes(0), settings.SocketMaxCoalescedWriteSize);
+		EXPECT_FALSE(!!settings.SocketWorkingBufferPool);
+		EXPECT_EQ(utils::FileSize::FromBytes(0), settings.PacketCompressionThreshold);
+		EXPECT_FALSE(settings.isCompressionEnabled());
+		EXPECT_EQ(0u, settings.BroadcastKnownInventorySize);
+		EXPECT_FALSE(!!settings.BroadcastKnownInventories);
+		EXPECT_EQ(0u, settings.MaxBroadcastFanout);
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(500), settings.BroadcastTrickleInterval);
 
 		EXPECT_EQ(ionet::ConnectionSecurityMode::None, settings.OutgoingSecurityMode);
 		EXPECT_EQ(ionet::ConnectionSecurityMode::None, settings.IncomingSecurityModes);
 	}
 
+	TEST(TEST_CLASS, MultiplexingIsEnabledWhenMultiplexedRequestTimeoutIsNonzero) {
+		// Arrange:
+		auto settings = ConnectionSettings();
+		settings.MultiplexedRequestTimeout = utils::TimeSpan::FromMilliseconds(1);
+
+		// Act + Assert:
+		EXPECT_TRUE(settings.isMultiplexingEnabled());
+	}
+
+	TEST(TEST_CLASS, CompressionIsEnabledWhenPacketCompressionThresholdIsNonzero) {
+		// Arrange:
+		auto settings = ConnectionSettings();
+		settings.PacketCompressionThreshold = utils::FileSize::FromBytes(1);
+
+		// Act + Assert:
+		EXPECT_TRUE(settings.isCompressionEnabled());
+	}
+
 	TEST(TEST_CLASS, CanConvertToPacketSocketOptions) {
 		// Arrange:
 		auto settings = ConnectionSettings();
 		settings.SocketWorkingBufferSize = utils::FileSize::FromKilobytes(54);
 		settings.SocketWorkingBufferSensitivity = 123;
 		settings.MaxPacketDataSize = utils::FileSize::FromMegabytes(2);
+		settings.SocketMaxCoalescedWriteSize = utils::FileSize::FromKilobytes(3);
+		settings.SocketWorkingBufferPool = std::make_shared<ionet::ByteBufferPool>(100, 10);
 
 		// Act:
 		auto options = settings.toSocketOptions();
@@ -54,5 +84,7 @@ namespace catapult { namespace net {
 		EXPECT_EQ(54u * 1024, options.WorkingBufferSize);
 		EXPECT_EQ(123u, options.WorkingBufferSensitivity);
 		EXPECT_EQ(2u * 1024 * 1024, options.MaxPacketDataSize);
+		EXPECT_EQ(3u * 1024, options.MaxCoalescedWriteSize);
+		EXPECT_EQ(settings.SocketWorkingBufferPool, options.WorkingBufferPool);
 	}
 }}
@@ -19,7 +19,9 @@
 **/
 
 #include "catapult/net/PacketWriters.h"
+#include "catapult/net/BroadcastInventory.h"
 #include "catapult/crypto/KeyPair.h"
+#include "catapult/ionet/BroadcastUtils.h"
 #include "catapult/ionet/BufferedPacketIo.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/PacketSocket.h"
@@ -29,6 +31,7 @@
 #include "tests/test/core/AddressTestUtils.h"
 #include "tests/test/core/KeyPairTestUtils.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
 #include "tests/test/net/NodeTestUtils.h"
 #include "tests/test/net/SocketTestUtils.h"
 
@@ -53,11 +56,11 @@ namespace catapult { namespace net {
 
 		struct PacketWritersTestContext {
 		public:
-			PacketWritersTestContext(size_t numClientKeyPairs = 1)
+			PacketWritersTestContext(size_t numClientKeyPairs = 1, const ConnectionSettings& settings = ConnectionSettings())
 					: ServerKeyPair(test::GenerateKeyPair())
 					, pPool(test::CreateStartedIoServiceThreadPool())
 					, Service(pPool->service())
-					, pWriters(CreatePacketWriters(pPool, ServerKeyPair, ConnectionSettings())) {
+					, pWriters(CreatePacketWriters(pPool, ServerKeyPair, settings)) {
 				for (auto i = 0u; i < numClientKeyPairs; ++i)
 					ClientKeyPairs.push_back(test::GenerateKeyPair());
 			}
@@ -711,6 +714,253 @@ namespace catapult { namespace net {
 
 	// endregion
 
+	// region broadcast (deduplication)
+
+	namespace {
+		ConnectionSettings CreateDeduplicatingSettings() {
+			auto settings = ConnectionSettings();
+			settings.BroadcastKnownInventorySize = 10;
+			return settings;
+		}
+
+		std::vector<model::TransactionInfo> CreateTransactionInfos(const std::vector<std::shared_ptr<model::Transaction>>& transactions) {
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (const auto& pTransaction : transactions)
+				transactionInfos.push_back(model::TransactionInfo(pTransaction));
+
+			return transactionInfos;
+		}
+
+		void BroadcastTransactions(PacketWriters& writers, const std::vector<std::shared_ptr<model::Transaction>>& transactions) {
+			writers.broadcast(ionet::CreateBroadcastPayload(CreateTransactionInfos(transactions)));
+		}
+
+		ionet::ByteBuffer ReadNextPacket(ionet::PacketSocket& socket) {
+			std::atomic<size_t> numReads(0);
+			ionet::ByteBuffer packetBuffer;
+			socket.read([&numReads, &packetBuffer](auto code, const auto* pPacket) {
+				EXPECT_EQ(ionet::SocketOperationCode::Success, code);
+				if (pPacket)
+					packetBuffer = test::CopyPacketToBuffer(*pPacket);
+
+				++numReads;
+			});
+
+			WAIT_FOR_ONE(numReads);
+			return packetBuffer;
+		}
+
+		void AssertTransactionsPacket(
+				const std::vector<std::shared_ptr<model::Transaction>>& expectedTransactions,
+				const ionet::ByteBuffer& packetBuffer) {
+			// Assert: the packet contains exactly the expected transactions
+			const auto& packet = reinterpret_cast<const ionet::Packet&>(packetBuffer[0]);
+			auto expectedSize = sizeof(ionet::PacketHeader);
+			for (const auto& pTransaction : expectedTransactions)
+				expectedSize += pTransaction->Size;
+
+			ASSERT_EQ(expectedSize, packet.Size);
+			EXPECT_EQ(ionet::PacketType::Push_Transactions, packet.Type);
+
+			const auto* pData = packet.Data();
+			for (const auto& pTransaction : expectedTransactions) {
+				EXPECT_EQ(*pTransaction, reinterpret_cast<const model::Transaction&>(*pData));
+				pData += pTransaction->Size;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, BroadcastSkipsTransactionsAlreadySentToPeer) {
+		// Arrange:
+		PacketWritersTestContext context(1, CreateDeduplicatingSettings());
+		auto state = SetupMultiConnectionTest(context);
+		MultiConnectionStateGuard stateGuard(*context.pWriters, state);
+
+		std::shared_ptr<model::Transaction> pTransaction1 = test::GenerateRandomTransaction();
+		std::shared_ptr<model::Transaction> pTransaction2 = test::GenerateRandomTransaction();
+
+		// Act: broadcast the first transaction and then both transactions
+		BroadcastTransactions(*context.pWriters, { pTransaction1 });
+		BroadcastTransactions(*context.pWriters, { pTransaction1, pTransaction2 });
+
+		// Assert: the first transaction was only sent once
+		auto packetBuffer1 = ReadNextPacket(*state.ServerSockets[0]);
+		auto packetBuffer2 = ReadNextPacket(*state.ServerSockets[0]);
+		AssertTransactionsPacket({ pTransaction1 }, packetBuffer1);
+		AssertTransactionsPacket({ pTransaction2 }, packetBuffer2);
+
+		EXPECT_EQ(pTransaction1->Size, context.pWriters->numBroadcastBytesSaved());
+	}
+
+	TEST(TEST_CLASS, BroadcastSkipsPacketWhenAllTransactionsWereAlreadySentToPeer) {
+		// Arrange:
+		PacketWritersTestContext context(1, CreateDeduplicatingSettings());
+		auto state = SetupMultiConnectionTest(context);
+		MultiConnectionStateGuard stateGuard(*context.pWriters, state);
+
+		std::shared_ptr<model::Transaction> pTransaction1 = test::GenerateRandomTransaction();
+		std::shared_ptr<model::Transaction> pTransaction2 = test::GenerateRandomTransaction();
+
+		// Act: broadcast the first transaction twice and then the second transaction
+		BroadcastTransactions(*context.pWriters, { pTransaction1 });
+		BroadcastTransactions(*context.pWriters, { pTransaction1 });
+		BroadcastTransactions(*context.pWriters, { pTransaction2 });
+
+		// Assert: the second (redundant) packet was not sent
+		auto packetBuffer1 = ReadNextPacket(*state.ServerSockets[0]);
+		auto packetBuffer2 = ReadNextPacket(*state.ServerSockets[0]);
+		AssertTransactionsPacket({ pTransaction1 }, packetBuffer1);
+		AssertTransactionsPacket({ pTransaction2 }, packetBuffer2);
+
+		EXPECT_EQ(sizeof(ionet::PacketHeader) + pTransaction1->Size, context.pWriters->numBroadcastBytesSaved());
+	}
+
+	TEST(TEST_CLASS, BroadcastDeduplicatesTransactionsForAllPeers) {
+		// Arrange: connect to multiple peers
+		constexpr auto Num_Connections = 3u;
+		PacketWritersTestContext context(Num_Connections, CreateDeduplicatingSettings());
+		auto state = SetupMultiConnectionTest(context);
+		MultiConnectionStateGuard stateGuard(*context.pWriters, state);
+
+		std::shared_ptr<model::Transaction> pTransaction1 = test::GenerateRandomTransaction();
+		std::shared_ptr<model::Transaction> pTransaction2 = test::GenerateRandomTransaction();
+
+		// Act: broadcast the first transaction twice and then the second transaction
+		BroadcastTransactions(*context.pWriters, { pTransaction1 });
+		BroadcastTransactions(*context.pWriters, { pTransaction1 });
+		BroadcastTransactions(*context.pWriters, { pTransaction2 });
+
+		// Assert: each peer received each transaction once
+		for (const auto& pSocket : state.ServerSockets) {
+			auto packetBuffer1 = ReadNextPacket(*pSocket);
+			auto packetBuffer2 = ReadNextPacket(*pSocket);
+			AssertTransactionsPacket({ pTransaction1 }, packetBuffer1);
+			AssertTransactionsPacket({ pTransaction2 }, packetBuffer2);
+		}
+
+		EXPECT_EQ(Num_Connections * (sizeof(ionet::PacketHeader) + pTransaction1->Size), context.pWriters->numBroadcastBytesSaved());
+	}
+
+	TEST(TEST_CLASS, BroadcastSkipsTransactionsPushedByPeer) {
+		// Arrange: connect to multiple peers that share known inventories with (simulated) push handlers
+		constexpr auto Num_Connections = 2u;
+		auto settings = CreateDeduplicatingSettings();
+		settings.BroadcastKnownInventories = std::make_shared<PeerKnownInventories>(settings.BroadcastKnownInventorySize);
+		PacketWritersTestContext context(Num_Connections, settings);
+		auto state = SetupMultiConnectionTest(context);
+		MultiConnectionStateGuard stateGuard(*context.pWriters, state);
+
+		std::shared_ptr<model::Transaction> pTransaction1 = test::GenerateRandomTransaction();
+		std::shared_ptr<model::Transaction> pTransaction2 = test::GenerateRandomTransaction();
+
+		// - the first peer pushed the first transaction
+		const auto& originKey = context.ClientKeyPairs[0].publicKey();
+		settings.BroadcastKnownInventories->add(originKey, { CalculateBroadcastInventoryItem(*pTransaction1) });
+
+		// Act: broadcast both transactions
+		BroadcastTransactions(*context.pWriters, { pTransaction1, pTransaction2 });
+
+		// Assert: the first transaction was not sent back to its origin
+		auto packetBuffer1 = ReadNextPacket(*state.ServerSockets[0]);
+		auto packetBuffer2 = ReadNextPacket(*state.ServerSockets[1]);
+		AssertTransactionsPacket({ pTransaction2 }, packetBuffer1);
+		AssertTransactionsPacket({ pTransaction1, pTransaction2 }, packetBuffer2);
+
+		EXPECT_EQ(pTransaction1->Size, context.pWriters->numBroadcastBytesSaved());
+	}
+
+	TEST(TEST_CLASS, BroadcastDoesNotDeduplicatePacketsWithoutInventory) {
+		// Arrange:
+		PacketWritersTestContext context(1, CreateDeduplicatingSettings());
+		auto state = SetupMultiConnectionTest(context);
+		MultiConnectionStateGuard stateGuard(*context.pWriters, state);
+
+		auto buffer = test::GenerateRandomPacketBuffer(95);
+		reinterpret_cast<ionet::Packet&>(buffer[0]).Type = ionet::PacketType::Chain_Info;
+
+		// Act: broadcast the same packet twice
+		context.pWriters->broadcast(test::BufferToPacketPayload(buffer));
+		context.pWriters->broadcast(test::BufferToPacketPayload(buffer));
+
+		// Assert: the packet was sent twice
+		EXPECT_EQ(test::ToHexString(buffer), test::ToHexString(ReadNextPacket(*state.ServerSockets[0])));
+		EXPECT_EQ(test::ToHexString(buffer), test::ToHexString(ReadNextPacket(*state.ServerSockets[0])));
+
+		EXPECT_EQ(0u, context.pWriters->numBroadcastBytesSaved());
+	}
+
+	// endregion
+
+	// region broadcast (fanout)
+
+	namespace {
+		ConnectionSettings CreateFanoutSettings(uint32_t maxFanout, const utils::TimeSpan& trickleInterval) {
+			auto settings = ConnectionSettings();
+			settings.MaxBroadcastFanout = maxFanout;
+			settings.BroadcastTrickleInterval = trickleInterval;
+			return settings;
+		}
+
+		auto HandleSocketReadInFanoutTests(const CounterPointer& pCounter, const ionet::ByteBuffer& buffer) {
+			return [pCounter, buffer](auto code, const auto* pPacket) {
+				// ignore reads that are aborted when the writers are shutdown
+				if (ionet::SocketOperationCode::Success != code)
+					return;
+
+				EXPECT_EQ(test::ToHexString(buffer), test::ToHexString(reinterpret_cast<const uint8_t*>(pPacket), pPacket->Size));
+				++*pCounter;
+			};
+		}
+	}
+
+	TEST(TEST_CLASS, BroadcastIsSentImmediatelyToAtMostMaxFanoutPeers) {
+		// Arrange: establish multiple connections and use a long trickle interval
+		constexpr auto Num_Connections = 5u;
+		PacketWritersTestContext context(Num_Connections, CreateFanoutSettings(2, Default_Timeout));
+		auto state = SetupMultiConnectionTest(context);
+		MultiConnectionStateGuard stateGuard(*context.pWriters, state);
+
+		// Act: broadcast a random packet
+		auto buffer = test::GenerateRandomPacketBuffer(95);
+		context.pWriters->broadcast(test::BufferToPacketPayload(buffer));
+
+		auto pNumReads = CreateCounterPointer();
+		for (const auto& pSocket : state.ServerSockets)
+			pSocket->read(HandleSocketReadInFanoutTests(pNumReads, buffer));
+
+		// Assert: the packet was only sent to two peers
+		WAIT_FOR_VALUE(2u, *pNumReads);
+		test::Pause();
+		EXPECT_EQ(2u, *pNumReads);
+
+		// - all connections are still open
+		EXPECT_NUM_ACTIVE_WRITERS(Num_Connections, *context.pWriters);
+	}
+
+	TEST(TEST_CLASS, BroadcastIsEventuallyTrickledToAllPeers) {
+		// Arrange: establish multiple connections and use a short trickle interval
+		constexpr auto Num_Connections = 5u;
+		PacketWritersTestContext context(Num_Connections, CreateFanoutSettings(2, utils::TimeSpan::FromMilliseconds(10)));
+		auto state = SetupMultiConnectionTest(context);
+		MultiConnectionStateGuard stateGuard(*context.pWriters, state);
+
+		// Act: broadcast a random packet
+		auto buffer = test::GenerateRandomPacketBuffer(95);
+		context.pWriters->broadcast(test::BufferToPacketPayload(buffer));
+
+		// Assert: the packet was sent to all connected sockets
+		auto pNumReads = CreateCounterPointer();
+		for (const auto& pSocket : state.ServerSockets)
+			pSocket->read(HandleSocketReadInFanoutTests(pNumReads, buffer));
+
+		WAIT_FOR_VALUE(Num_Connections, *pNumReads);
+
+		// - all connections are still open
+		EXPECT_NUM_ACTIVE_WRITERS(Num_Connections, *context.pWriters);
+	}
+
+	// endregion
+
 	// region pickOne
 
 	TEST(TEST_CLASS, PickOneEvenlyRotatesPeers) {
@@ -1221,6 +1471,70 @@ namespace catapult { namespace net {
 		EXPECT_NUM_ACTIVE_AVAILABLE_WRITERS(2u, 0u, writers);
 	}
 
+	TEST(TEST_CLASS, PickOneSharesSocketsWhenMultiplexingIsEnabled) {
+		// Arrange: connect to 1 node with multiplexing enabled
+		auto settings = ConnectionSettings();
+		settings.MultiplexedRequestTimeout = Default_Timeout;
+		PacketWritersTestContext context(1, settings);
+		auto& writers = *context.pWriters;
+		auto state = SetupMultiConnectionAcceptTest(context);
+		auto sendBuffers = test::GenerateRandomPacketBuffers({ 51, 52 });
+
+		// Act: pick 2 ios
+		auto pIo1 = writers.pickOne(Default_Timeout).io();
+		auto pIo2 = writers.pickOne(Default_Timeout).io();
+
+		// Assert: both ios share the same socket, which is still available
+		ASSERT_TRUE(!!pIo1);
+		ASSERT_TRUE(!!pIo2);
+		EXPECT_NUM_ACTIVE_AVAILABLE_WRITERS(1u, 1u, writers);
+
+		// Act: write a request to each io
+		pIo1->write(test::BufferToPacketPayload(sendBuffers[0]), EmptyWriteCallback);
+		pIo2->write(test::BufferToPacketPayload(sendBuffers[1]), EmptyWriteCallback);
+
+		// - read both (multiplexed) requests from the peer
+		std::vector<ionet::ByteBuffer> requestBuffers;
+		auto pNumReads = CreateCounterPointer();
+		auto readHandler = [&requestBuffers, pNumReads](auto code, const auto* pPacket) {
+			if (ionet::SocketOperationCode::Success == code)
+				requestBuffers.push_back(test::CopyPacketToBuffer(*pPacket));
+
+			++*pNumReads;
+		};
+		const auto& pClientSocket = state.ClientSockets[0];
+		pClientSocket->read(readHandler);
+		WAIT_FOR_ONE(*pNumReads);
+		pClientSocket->read(readHandler);
+		WAIT_FOR_VALUE(2u, *pNumReads);
+
+		// - echo both requests in reverse order
+		ASSERT_EQ(2u, requestBuffers.size());
+		pClientSocket->write(test::BufferToPacketPayload(requestBuffers[1]), EmptyWriteCallback);
+		pClientSocket->write(test::BufferToPacketPayload(requestBuffers[0]), EmptyWriteCallback);
+
+		// - read the responses from both ios
+		std::vector<ionet::ByteBuffer> responseBuffers(2);
+		auto pNumResponses = CreateCounterPointer();
+		for (auto i = 0u; i < 2; ++i) {
+			(0 == i ? pIo1 : pIo2)->read([&responseBuffers, pNumResponses, i](auto code, const auto* pPacket) {
+				if (ionet::SocketOperationCode::Success == code)
+					responseBuffers[i] = test::CopyPacketToBuffer(*pPacket);
+
+				++*pNumResponses;
+			});
+		}
+
+		WAIT_FOR_VALUE(2u, *pNumResponses);
+
+		// Assert: the requests were multiplexed and each io received the response to its own request
+		for (const auto& requestBuffer : requestBuffers)
+			EXPECT_EQ(ionet::PacketType::Multiplexed, reinterpret_cast<const ionet::Packet&>(requestBuffer[0]).Type);
+
+		EXPECT_EQ(sendBuffers, responseBuffers);
+		EXPECT_NUM_ACTIVE_AVAILABLE_WRITERS(1u, 1u, writers);
+	}
+
 	TEST(TEST_CLASS, CanBroadcastPacketOnlyToAvailablePeers) {
 		// Arrange: establish multiple connections
 		constexpr auto Num_Connections = 5u;
@@ -262,6 +262,130 @@ namespace catapult { namespace net {
 		EXPECT_TRUE(crypto::Verify(serverKeyPair.publicKey(), challenge, packet.Signature));
 	}
 
+	namespace {
+		std::pair<VerifyResult, VerifiedPeerInfo> VerifyClient(
+				const std::shared_ptr<MockPacketIo>& pMockIo,
+				const crypto::KeyPair& serverKeyPair,
+				const MockPacketIo::GenerateReadPacket& generateResponse,
+				bool isCompressionSupported) {
+			pMockIo->queueWrite(ionet::SocketOperationCode::Success);
+			pMockIo->queueRead(ionet::SocketOperationCode::Success, generateResponse);
+			pMockIo->queueWrite(ionet::SocketOperationCode::Success);
+
+			std::pair<VerifyResult, VerifiedPeerInfo> resultPair;
+			auto securityModes = Default_Allowed_Security_Mode_Mask;
+			net::VerifyClient(pMockIo, serverKeyPair, securityModes, isCompressionSupported, [&resultPair](
+					auto verifyResult,
+					const auto& peerInfo) {
+				resultPair = std::make_pair(verifyResult, peerInfo);
+			});
+			return resultPair;
+		}
+
+		MockPacketIo::GenerateReadPacket CreateCompressionRequestingResponseGenerator(
+				ionet::ConnectionSecurityMode securityMode,
+				Challenge& challenge) {
+			return [securityMode, &challenge](const auto* pPacket) {
+				auto pRequest = static_cast<const ServerChallengeRequest*>(pPacket);
+				auto keyPair = crypto::KeyPair::FromString(Client_Private_Key);
+				auto pResponse = GenerateServerChallengeResponse(*pRequest, keyPair, securityMode, true);
+				challenge = pResponse->Challenge;
+				return pResponse;
+			};
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyClientSucceedsWhenLegacyClientRespondsToChallenge) {
+		// Arrange: create a response that is formatted and signed exactly like a response from a client without compression support
+		auto clientKeyPair = crypto::KeyPair::FromString(Client_Private_Key);
+		Challenge challenge;
+		auto generateResponse = [&clientKeyPair, &challenge](const auto* pPacket) {
+			auto pRequest = static_cast<const ServerChallengeRequest*>(pPacket);
+			auto pResponse = ionet::CreateSharedPacket<ServerChallengeResponse>();
+			test::FillWithRandomData(pResponse->Challenge);
+			pResponse->PublicKey = clientKeyPair.publicKey();
+			pResponse->SecurityMode = Default_Security_Mode;
+
+			auto securityMode = utils::to_underlying_type(Default_Security_Mode);
+			crypto::Sign(clientKeyPair, { pRequest->Challenge, { &securityMode, sizeof(uint8_t) } }, pResponse->Signature);
+			challenge = pResponse->Challenge;
+			return pResponse;
+		};
+
+		// Act: verify with compression support
+		auto serverKeyPair = test::GenerateKeyPair();
+		auto pMockIo = std::make_shared<MockPacketIo>();
+		auto resultPair = VerifyClient(pMockIo, serverKeyPair, generateResponse, true);
+		const auto& packet = pMockIo->writtenPacketAt<ClientChallengeResponse>(1);
+
+		// Assert: the packet layout is unchanged and compression is not enabled
+		EXPECT_EQ(sizeof(ionet::PacketHeader) + sizeof(Challenge) + Signature_Size + Key_Size + 1, sizeof(ServerChallengeResponse));
+		EXPECT_EQ(VerifyResult::Success, resultPair.first);
+		EXPECT_EQ(clientKeyPair.publicKey(), resultPair.second.PublicKey);
+		EXPECT_EQ(Default_Security_Mode, resultPair.second.SecurityMode);
+		EXPECT_FALSE(resultPair.second.IsCompressionEnabled);
+
+		// - the response is signed exactly like a response from a server without compression support
+		EXPECT_EQ(sizeof(ionet::PacketHeader) + Signature_Size, sizeof(ClientChallengeResponse));
+		EXPECT_TRUE(crypto::Verify(serverKeyPair.publicKey(), challenge, packet.Signature));
+	}
+
+	TEST(TEST_CLASS, VerifyClientAcceptsCompressionWhenRequestedByClientAndSupported) {
+		// Arrange:
+		Challenge challenge;
+		auto generateResponse = CreateCompressionRequestingResponseGenerator(Default_Security_Mode, challenge);
+
+		// Act:
+		auto serverKeyPair = test::GenerateKeyPair();
+		auto pMockIo = std::make_shared<MockPacketIo>();
+		auto resultPair = VerifyClient(pMockIo, serverKeyPair, generateResponse, true);
+		const auto& packet = pMockIo->writtenPacketAt<ClientChallengeResponse>(1);
+
+		// Assert: compression is enabled but is not part of the established security mode
+		EXPECT_EQ(VerifyResult::Success, resultPair.first);
+		EXPECT_EQ(crypto::KeyPair::FromString(Client_Private_Key).publicKey(), resultPair.second.PublicKey);
+		EXPECT_EQ(Default_Security_Mode, resultPair.second.SecurityMode);
+		EXPECT_TRUE(resultPair.second.IsCompressionEnabled);
+
+		// - acceptance is signed
+		EXPECT_EQ(sizeof(ClientChallengeResponse), packet.Size);
+		EXPECT_TRUE(VerifyClientChallengeResponse(packet, serverKeyPair.publicKey(), challenge, true));
+		EXPECT_FALSE(VerifyClientChallengeResponse(packet, serverKeyPair.publicKey(), challenge, false));
+	}
+
+	TEST(TEST_CLASS, VerifyClientIgnoresCompressionRequestWhenCompressionIsNotSupported) {
+		// Arrange:
+		Challenge challenge;
+		auto generateResponse = CreateCompressionRequestingResponseGenerator(Default_Security_Mode, challenge);
+
+		// Act:
+		auto serverKeyPair = test::GenerateKeyPair();
+		auto pMockIo = std::make_shared<MockPacketIo>();
+		auto resultPair = VerifyClient(pMockIo, serverKeyPair, generateResponse, false);
+		const auto& packet = pMockIo->writtenPacketAt<ClientChallengeResponse>(1);
+
+		// Assert:
+		EXPECT_EQ(VerifyResult::Success, resultPair.first);
+		EXPECT_EQ(Default_Security_Mode, resultPair.second.SecurityMode);
+		EXPECT_FALSE(resultPair.second.IsCompressionEnabled);
+
+		// - the response does not accept compression
+		EXPECT_TRUE(VerifyClientChallengeResponse(packet, serverKeyPair.publicKey(), challenge, false));
+		EXPECT_FALSE(VerifyClientChallengeResponse(packet, serverKeyPair.publicKey(), challenge, true));
+	}
+
+	TEST(TEST_CLASS, VerifyClientFailsWhenCompressionIsRequestedWithUnsupportedSecurityMode) {
+		// Arrange: request compression with a disallowed security mode
+		Challenge challenge;
+		auto generateResponse = CreateCompressionRequestingResponseGenerator(ionet::ConnectionSecurityMode::None, challenge);
+
+		// Act:
+		auto resultPair = VerifyClient(std::make_shared<MockPacketIo>(), test::GenerateKeyPair(), generateResponse, true);
+
+		// Assert:
+		EXPECT_EQ(VerifyResult::Failure_Unsupported_Connection, resultPair.first);
+	}
+
 	// endregion
 
 	// region VerifyServer
@@ -487,6 +611,126 @@ namespace catapult { namespace net {
 		EXPECT_TRUE(crypto::Verify(clientKeyPair.publicKey(), signedData, packet.Signature));
 	}
 
+	TEST(TEST_CLASS, VerifyServerSucceedsWhenLegacyServerRespondsToChallenge) {
+		// Arrange: create a response that is formatted and signed exactly like a response from a server without compression support
+		auto serverKeyPair = test::GenerateKeyPair();
+		auto clientKeyPair = test::GenerateKeyPair();
+		auto pMockIo = std::make_shared<MockPacketIo>();
+		pMockIo->queueRead(ionet::SocketOperationCode::Success, CreateServerChallengeRequestGenerator());
+		pMockIo->queueWrite(ionet::SocketOperationCode::Success);
+		pMockIo->queueRead(ionet::SocketOperationCode::Success, [&serverKeyPair](const auto* pPacket) {
+			auto pRequest = static_cast<const ServerChallengeResponse*>(pPacket);
+			auto pResponse = ionet::CreateSharedPacket<ClientChallengeResponse>();
+			crypto::Sign(serverKeyPair, pRequest->Challenge, pResponse->Signature);
+			return pResponse;
+		});
+
+		// Act:
+		auto result = VerifyServer(serverKeyPair, clientKeyPair, pMockIo);
+
+		// Assert: the packet layout is unchanged
+		EXPECT_EQ(sizeof(ionet::PacketHeader) + Signature_Size, sizeof(ClientChallengeResponse));
+		EXPECT_EQ(VerifyResult::Success, result);
+	}
+
+	namespace {
+		struct CompressionVerifyServerResult {
+			VerifyResult Result;
+			VerifiedPeerInfo PeerInfo;
+			Challenge ServerChallenge;
+			std::shared_ptr<MockPacketIo> pMockIo;
+		};
+
+		CompressionVerifyServerResult VerifyServerWithCompression(
+				const crypto::KeyPair& clientKeyPair,
+				bool isCompressionRequested,
+				bool isCompressionAccepted) {
+			CompressionVerifyServerResult result;
+			result.pMockIo = std::make_shared<MockPacketIo>();
+			result.pMockIo->queueRead(ionet::SocketOperationCode::Success, [&result](const auto* pPacket) {
+				auto pRequest = CreateServerChallengeRequestGenerator()(pPacket);
+				result.ServerChallenge = static_cast<const ServerChallengeRequest&>(*pRequest).Challenge;
+				return pRequest;
+			});
+			result.pMockIo->queueWrite(ionet::SocketOperationCode::Success);
+
+			auto serverKeyPair = test::GenerateKeyPair();
+			result.pMockIo->queueRead(ionet::SocketOperationCode::Success, [&serverKeyPair, isCompressionAccepted](const auto* pPacket) {
+				auto pRequest = static_cast<const ServerChallengeResponse*>(pPacket);
+				return GenerateClientChallengeResponse(*pRequest, serverKeyPair, isCompressionAccepted);
+			});
+
+			auto serverPeerInfo = VerifiedPeerInfo{ serverKeyPair.publicKey(), Default_Security_Mode };
+			serverPeerInfo.IsCompressionEnabled = isCompressionRequested;
+			net::VerifyServer(result.pMockIo, serverPeerInfo, clientKeyPair, [&result](auto verifyResult, const auto& peerInfo) {
+				result.Result = verifyResult;
+				result.PeerInfo = peerInfo;
+			});
+			return result;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyServerRequestsCompressionInClientChallenge) {
+		// Arrange:
+		constexpr auto Challenge_Size = std::tuple_size<Challenge>::value;
+		auto clientKeyPair = test::GenerateKeyPair();
+
+		// Act: verify with compression requested
+		auto result = VerifyServerWithCompression(clientKeyPair, true, true);
+		const auto& packet = result.pMockIo->writtenPacketAt<ServerChallengeResponse>(0);
+
+		// - construct expected signed data
+		auto signedData = std::vector<uint8_t>(Challenge_Size + 1);
+		std::memcpy(signedData.data(), result.ServerChallenge.data(), Challenge_Size);
+		signedData[Challenge_Size] = utils::to_underlying_type(Default_Security_Mode);
+
+		// Assert: the request does not change the packet size, security mode or signed data
+		EXPECT_EQ(sizeof(ServerChallengeResponse), packet.Size);
+		EXPECT_EQ(Default_Security_Mode, packet.SecurityMode);
+		EXPECT_TRUE(crypto::Verify(clientKeyPair.publicKey(), signedData, packet.Signature));
+		EXPECT_TRUE(IsCompressionRequested(packet));
+	}
+
+	TEST(TEST_CLASS, VerifyServerDoesNotRequestCompressionWhenDisabled) {
+		// Act:
+		auto result = VerifyServerWithCompression(test::GenerateKeyPair(), false, false);
+		const auto& packet = result.pMockIo->writtenPacketAt<ServerChallengeResponse>(0);
+
+		// Assert:
+		EXPECT_FALSE(IsCompressionRequested(packet));
+		EXPECT_EQ(VerifyResult::Success, result.Result);
+		EXPECT_FALSE(result.PeerInfo.IsCompressionEnabled);
+	}
+
+	TEST(TEST_CLASS, VerifyServerEnablesCompressionWhenAcceptedByServer) {
+		// Act:
+		auto result = VerifyServerWithCompression(test::GenerateKeyPair(), true, true);
+
+		// Assert:
+		EXPECT_EQ(VerifyResult::Success, result.Result);
+		EXPECT_EQ(Default_Security_Mode, result.PeerInfo.SecurityMode);
+		EXPECT_TRUE(result.PeerInfo.IsCompressionEnabled);
+	}
+
+	TEST(TEST_CLASS, VerifyServerDisablesCompressionWhenNotAcceptedByServer) {
+		// Act: server without compression support (or with compression disabled) ignores the request
+		auto result = VerifyServerWithCompression(test::GenerateKeyPair(), true, false);
+
+		// Assert: verification succeeds without compression
+		EXPECT_EQ(VerifyResult::Success, result.Result);
+		EXPECT_EQ(Default_Security_Mode, result.PeerInfo.SecurityMode);
+		EXPECT_FALSE(result.PeerInfo.IsCompressionEnabled);
+	}
+
+	TEST(TEST_CLASS, VerifyServerFailsWhenServerAcceptsUnrequestedCompression) {
+		// Act:
+		auto result = VerifyServerWithCompression(test::GenerateKeyPair(), false, true);
+
+		// Assert:
+		EXPECT_EQ(VerifyResult::Failure_Challenge, result.Result);
+		EXPECT_FALSE(result.PeerInfo.IsCompressionEnabled);
+	}
+
 	// endregion
 
 	// region VerifyClient / VerifyServer Handshake
@@ -494,7 +738,9 @@ namespace catapult { namespace net {
 	namespace {
 		void AssertVerifyClientAndVerifyServerCanMutuallyValidate(
 				ionet::ConnectionSecurityMode securityMode,
-				ionet::ConnectionSecurityMode allowedSecurityModes) {
+				ionet::ConnectionSecurityMode allowedSecurityModes,
+				bool isCompressionRequested = false,
+				bool isCompressionSupported = false) {
 			// Arrange:
 			auto serverKeyPair = test::GenerateKeyPair();
 			auto clientKeyPair = test::GenerateKeyPair();
@@ -506,7 +752,8 @@ namespace catapult { namespace net {
 			VerifyResult serverResult;
 			VerifiedPeerInfo verifiedClientPeerInfo;
 			test::SpawnPacketServerWork(service, [&](const auto& pSocket) {
-				net::VerifyClient(pSocket, serverKeyPair, allowedSecurityModes, [&](auto result, const auto& peerInfo) {
+				auto isSupported = isCompressionSupported;
+				net::VerifyClient(pSocket, serverKeyPair, allowedSecurityModes, isSupported, [&](auto result, const auto& peerInfo) {
 					serverResult = result;
 					verifiedClientPeerInfo = peerInfo;
 					++numResults;
@@ -517,6 +764,7 @@ namespace catapult { namespace net {
 			VerifiedPeerInfo verifiedServerPeerInfo;
 			test::SpawnPacketClientWork(service, [&](const auto& pSocket) {
 				auto severPeerInfo = VerifiedPeerInfo{ serverKeyPair.publicKey(), securityMode };
+				severPeerInfo.IsCompressionEnabled = isCompressionRequested;
 				net::VerifyServer(pSocket, severPeerInfo, clientKeyPair, [&](auto result, const auto& peerInfo) {
 					clientResult = result;
 					verifiedServerPeerInfo = peerInfo;
@@ -527,14 +775,26 @@ namespace catapult { namespace net {
 			// - wait for both verifications to complete
 			WAIT_FOR_VALUE(2u, numResults);
 
-			// Assert: both verifications succeeded
+			// Assert: both verifications succeeded and only enabled compression when requested and supported
+			auto isCompressionEnabled = isCompressionRequested && isCompressionSupported;
 			EXPECT_EQ(VerifyResult::Success, serverResult);
 			EXPECT_EQ(clientKeyPair.publicKey(), verifiedClientPeerInfo.PublicKey);
 			EXPECT_EQ(securityMode, verifiedClientPeerInfo.SecurityMode);
+			EXPECT_EQ(isCompressionEnabled, verifiedClientPeerInfo.IsCompressionEnabled);
 
 			EXPECT_EQ(VerifyResult::Success, clientResult);
 			EXPECT_EQ(serverKeyPair.publicKey(), verifiedServerPeerInfo.PublicKey);
 			EXPECT_EQ(securityMode, verifiedServerPeerInfo.SecurityMode);
+			EXPECT_EQ(isCompressionEnabled, verifiedServerPeerInfo.IsCompressionEnabled);
+
+			// - session keys are only agreed for session connections
+			if (ionet::ConnectionSecurityMode::Session == securityMode) {
+				EXPECT_NE(Hash256(), verifiedClientPeerInfo.SessionKey);
+				EXPECT_EQ(verifiedClientPeerInfo.SessionKey, verifiedServerPeerInfo.SessionKey);
+			} else {
+				EXPECT_EQ(Hash256(), verifiedClientPeerInfo.SessionKey);
+				EXPECT_EQ(Hash256(), verifiedServerPeerInfo.SessionKey);
+			}
 		}
 	}
 
@@ -548,5 +808,38 @@ namespace catapult { namespace net {
 		AssertVerifyClientAndVerifyServerCanMutuallyValidate(ionet::ConnectionSecurityMode::Signed, Default_Allowed_Security_Mode_Mask);
 	}
 
+	TEST(TEST_CLASS, VerifyClientAndVerifyServerCanMutuallyValidate_Session) {
+		// Assert:
+		auto allowedSecurityModes = ionet::ConnectionSecurityMode::None | ionet::ConnectionSecurityMode::Session;
+		AssertVerifyClientAndVerifyServerCanMutuallyValidate(ionet::ConnectionSecurityMode::Session, allowedSecurityModes);
+	}
+
+	TEST(TEST_CLASS, VerifyClientAndVerifyServerCanMutuallyValidate_CompressionRequestedAndSupported) {
+		// Assert:
+		AssertVerifyClientAndVerifyServerCanMutuallyValidate(
+				ionet::ConnectionSecurityMode::Signed,
+				ionet::ConnectionSecurityMode::Signed,
+				true,
+				true);
+	}
+
+	TEST(TEST_CLASS, VerifyClientAndVerifyServerCanMutuallyValidate_CompressionRequestedAndNotSupported) {
+		// Assert:
+		AssertVerifyClientAndVerifyServerCanMutuallyValidate(
+				ionet::ConnectionSecurityMode::Signed,
+				ionet::ConnectionSecurityMode::Signed,
+				true,
+				false);
+	}
+
+	TEST(TEST_CLASS, VerifyClientAndVerifyServerCanMutuallyValidate_CompressionSupportedAndNotRequested) {
+		// Assert:
+		AssertVerifyClientAndVerifyServerCanMutuallyValidate(
+				ionet::ConnectionSecurityMode::Signed,
+				ionet::ConnectionSecurityMode::Signed,
+				false,
+				true);
+	}
+
 	// endregion
 }}
@@ -144,6 +144,17 @@ namespace catapult { namespace thread {
 		EXPECT_THROW(future.then([](const auto&) { return 7; }), std::logic_error);
 	}
 
+	TEST(TEST_CLASS, CannotSetMultipleCompletionContinuations) {
+		// Arrange:
+		promise<int> promise;
+		auto future = promise.get_future();
+		future.on_complete([](const auto&) {});
+
+		// Act + Assert: attempting to set a second continuation throws
+		EXPECT_THROW(future.on_complete([](const auto&) {}), std::logic_error);
+		EXPECT_THROW(future.then([](const auto&) { return 7; }), std::logic_error);
+	}
+
 	TEST(TEST_CLASS, FuturePassedToContinuationHasMovedData) {
 		// Arrange:
 		auto pInt = std::make_unique<int>(7);
@@ -251,6 +262,19 @@ namespace catapult { namespace thread {
 		EXPECT_THROW(finalFuture.get(), std::runtime_error);
 	}
 
+	TEST(TEST_CLASS, CompletionContinuationExceptionPropagatesToCompletingThread) {
+		// Arrange:
+		promise<int> promise;
+		auto future = promise.get_future();
+		future.on_complete([](const auto&) {
+			throw std::runtime_error("future exception");
+		});
+
+		// Act + Assert: the exception is not captured by a result future
+		EXPECT_THROW(promise.set_value(6), std::runtime_error);
+		EXPECT_TRUE(future.is_ready());
+	}
+
 	// endregion
 
 	// region get / set value scenarios
@@ -514,6 +538,55 @@ namespace catapult { namespace thread {
 		AssertContinuationSetAfterValueIsTriggeredImmediately<VoidContinuationTraits<TTraits>>();
 	}
 
+	PROMISE_FUTURE_TRAITS_BASED_TEST(CompletionContinuationSetBeforeValueIsTriggeredWhenValueIsSet) {
+		// Arrange:
+		typename TTraits::PromiseType promise;
+		auto future = promise.get_future();
+		bool isContinuationCalled = false;
+
+		// - set a continuation
+		future.on_complete([&isContinuationCalled](auto&& callbackFuture) {
+			// Assert: the future should be ready immediately
+			EXPECT_TRUE(callbackFuture.is_ready());
+			TTraits::AssertFuture(callbackFuture, 8);
+			isContinuationCalled = true;
+		});
+
+		// Sanity: the future is not ready
+		EXPECT_FALSE(future.is_ready());
+
+		// Act: set the value after the continuation
+		TTraits::SetPromise(promise, 8);
+
+		// Assert: the future is ready and its value was moved into the continuation
+		EXPECT_TRUE(future.is_ready());
+		TTraits::AssertMovedFuture(future, 8);
+		EXPECT_TRUE(isContinuationCalled);
+	}
+
+	PROMISE_FUTURE_TRAITS_BASED_TEST(CompletionContinuationSetAfterValueIsTriggeredImmediately) {
+		// Arrange:
+		typename TTraits::PromiseType promise;
+		auto future = promise.get_future();
+		bool isContinuationCalled = false;
+
+		// - set the value
+		TTraits::SetPromise(promise, 8);
+
+		// Act: set the continuation
+		future.on_complete([&isContinuationCalled](auto&& callbackFuture) {
+			// Assert: the future should be ready immediately
+			EXPECT_TRUE(callbackFuture.is_ready());
+			TTraits::AssertFuture(callbackFuture, 8);
+			isContinuationCalled = true;
+		});
+
+		// Assert: the future is ready and its value was moved into the continuation
+		EXPECT_TRUE(future.is_ready());
+		TTraits::AssertMovedFuture(future, 8);
+		EXPECT_TRUE(isContinuationCalled);
+	}
+
 	// endregion
 
 	TEST(TEST_CLASS, MakeReadyFutureMakesImmediatelyAvailableFutureAroundValue) {
@@ -72,6 +72,15 @@ namespace catapult { namespace thread {
 		EXPECT_EQ(Num_Default_Threads, pPool->numWorkerThreads());
 	}
 
+	TEST(TEST_CLASS, StartSpawnsSpecifiedNumberOfPinnedWorkerThreads) {
+		// Act: set up a pool pinned to a single cpu
+		auto pPool = CreateIoServiceThreadPool(Num_Default_Threads, "pinned", utils::CpuSet{ 0 });
+		pPool->start();
+
+		// Assert: all threads have been spawned
+		EXPECT_EQ(Num_Default_Threads, pPool->numWorkerThreads());
+	}
+
 	TEST(TEST_CLASS, JoinDestroysAllWorkerThreads) {
 		// Arrange: set up a pool
 		auto pPool = CreateDefaultIoServiceThreadPool();
@@ -168,6 +177,23 @@ namespace catapult { namespace thread {
 		EXPECT_EQ(100u, numHandlerCalls);
 	}
 
+	TEST(TEST_CLASS, PinnedPoolCanServeMoreRequestsThanWorkerThreads) {
+		// Arrange: set up a pool pinned to a single cpu
+		auto pPool = CreateIoServiceThreadPool(Num_Default_Threads, "pinned", utils::CpuSet{ 0 });
+		pPool->start();
+
+		// - post 100 work items on the pool
+		std::atomic<uint32_t> numHandlerCalls(0);
+		for (auto i = 0u; i < 100; ++i)
+			pPool->service().post([&]() { ++numHandlerCalls; });
+
+		// Act: stop the pool
+		pPool->join();
+
+		// Assert: the pool should have executed 100 work items
+		EXPECT_EQ(100u, numHandlerCalls);
+	}
+
 #ifdef __clang__
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wused-but-marked-unused"
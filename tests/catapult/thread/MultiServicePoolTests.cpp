@@ -123,6 +123,27 @@ namespace catapult { namespace thread {
 		EXPECT_EQ(0u, pool.numServices());
 	}
 
+	TEST(TEST_CLASS, CanCreatePinnedPoolWithSpecificNumberOfThreads) {
+		// Act:
+		MultiServicePool pool("foo", 3, MultiServicePool::IsolatedPoolMode::Enabled, utils::CpuSet{ 0, 1 });
+
+		// Assert:
+		EXPECT_EQ(3u, pool.numWorkerThreads());
+		EXPECT_EQ(0u, pool.numServiceGroups());
+		EXPECT_EQ(0u, pool.numServices());
+	}
+
+	TEST(TEST_CLASS, CanCreatePinnedPoolWithDefaultNumberOfThreads) {
+		// Act:
+		auto isolatedPoolMode = MultiServicePool::IsolatedPoolMode::Enabled;
+		MultiServicePool pool("foo", MultiServicePool::DefaultPoolConcurrency(), isolatedPoolMode, utils::CpuSet{ 0, 1 });
+
+		// Assert: one thread is spawned per pinned cpu
+		EXPECT_EQ(2u, pool.numWorkerThreads());
+		EXPECT_EQ(0u, pool.numServiceGroups());
+		EXPECT_EQ(0u, pool.numServices());
+	}
+
 	// endregion
 
 	// region pushServiceGroup
@@ -228,6 +249,20 @@ namespace catapult { namespace thread {
 		});
 	}
 
+	TEST(TEST_CLASS, CanAddSinglePinnedIsolatedPoolWithCustomNumberOfThreads) {
+		// Assert:
+		AssertCanAddSingleIsolatedPool(3, [](auto& pool, const auto& name) {
+			return pool.pushIsolatedPool(name, 3, utils::CpuSet{ 0, 1 });
+		});
+	}
+
+	TEST(TEST_CLASS, CanAddSinglePinnedIsolatedPoolWithDefaultNumberOfThreads) {
+		// Assert: one thread is spawned per pinned cpu
+		AssertCanAddSingleIsolatedPool(2, [](auto& pool, const auto& name) {
+			return pool.pushIsolatedPool(name, MultiServicePool::DefaultPoolConcurrency(), utils::CpuSet{ 0, 1 });
+		});
+	}
+
 	namespace {
 		template<typename TCreatePool>
 		void AssertCanAddSingleMergedPool(TCreatePool createIsolatedPool) {
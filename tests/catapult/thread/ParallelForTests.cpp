@@ -343,6 +343,11 @@ namespace catapult { namespace thread {
 		using MultiThreadedState = test::BasicMultiThreadedState<ParallelForTraits>;
 
 		struct DistributeParallelForTraits {
+			// idle threads steal work from busy threads, so only the initial item of each thread is guaranteed
+			static size_t MinWorkPerThread(size_t, size_t) {
+				return 1;
+			}
+
 			static void ParallelFor(
 					boost::asio::io_service& service,
 					const std::vector<ItemType>& items,
@@ -362,6 +367,11 @@ namespace catapult { namespace thread {
 		};
 
 		struct DistributeParallelForPartitionTraits {
+			// a thread can do more than the min amount of work if the number of items is not divisible by the number of threads
+			static size_t MinWorkPerThread(size_t numItems, size_t numThreads) {
+				return numItems / numThreads;
+			}
+
 			static void ParallelFor(
 					boost::asio::io_service& service,
 					const std::vector<ItemType>& items,
@@ -385,8 +395,8 @@ namespace catapult { namespace thread {
 			}
 		};
 
-		template<typename TParallelFunc>
-		void AssertCanDistributeWorkEvenly(size_t multiplier, size_t divisor, TParallelFunc parallelFunc) {
+		template<typename TTraits>
+		void AssertCanDistributeWorkEvenly(size_t multiplier, size_t divisor) {
 			// Arrange:
 			auto pPool = test::CreateStartedIoServiceThreadPool();
 			auto numThreads = pPool->numWorkerThreads();
@@ -398,7 +408,7 @@ namespace catapult { namespace thread {
 
 			// Act:
 			MultiThreadedState state;
-			parallelFunc(pPool->service(), items, numThreads, state);
+			TTraits::ParallelFor(pPool->service(), items, numThreads, state);
 
 			// Assert: all items were processed once
 			EXPECT_EQ(numItems, state.counter());
@@ -408,9 +418,8 @@ namespace catapult { namespace thread {
 			EXPECT_EQ(numThreads, state.threadCounters().size());
 			EXPECT_EQ(numThreads, state.sortedAndReducedThreadIds().size());
 
-			// - the work was distributed evenly across threads
-			//   (a thread can do more than the min amount of work if the number of items is not divisible by the number of threads)
-			auto minWorkPerThread = numItems / numThreads;
+			// - the work was distributed across threads
+			auto minWorkPerThread = TTraits::MinWorkPerThread(numItems, numThreads);
 			for (auto counter : state.threadCounters())
 				EXPECT_LE(minWorkPerThread, counter);
 		}
@@ -424,12 +433,171 @@ namespace catapult { namespace thread {
 
 	DISTRIBUTE_TEST(CanDistributeWorkEvenlyWhenItemsAreMultipleOfThreads) {
 		// Assert:
-		AssertCanDistributeWorkEvenly(20, 1, TTraits::ParallelFor);
+		AssertCanDistributeWorkEvenly<TTraits>(20, 1);
 	}
 
 	DISTRIBUTE_TEST(CanDistributeWorkEvenlyWhenItemsAreNotMultipleOfThreads) {
 		// Assert:
-		AssertCanDistributeWorkEvenly(81, 4, TTraits::ParallelFor);
+		AssertCanDistributeWorkEvenly<TTraits>(81, 4);
+	}
+
+	// endregion
+
+	// region ParallelForWithStatistics
+
+	TEST(TEST_CLASS, ParallelForWithStatisticsReturnsEmptyStatisticsWhenThereAreNoItems) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+		auto items = std::vector<ItemType>();
+
+		// Act:
+		auto statistics = ParallelForWithStatistics(pPool->service(), items, pPool->numWorkerThreads(), [](auto, auto) {
+			return true;
+		}).get();
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.NumPartitions);
+		EXPECT_EQ(0u, statistics.NumItems);
+		EXPECT_EQ(0u, statistics.NumSteals);
+		EXPECT_EQ(0u, statistics.NumStolenItems);
+		EXPECT_EQ(0u, statistics.MinPartitionItems);
+		EXPECT_EQ(0u, statistics.MaxPartitionItems);
+	}
+
+	TEST(TEST_CLASS, ParallelForWithStatisticsUsesAtMostOnePartitionPerItem) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+		auto items = CreateIncrementingValues(1);
+
+		// Act:
+		auto statistics = ParallelForWithStatistics(pPool->service(), items, pPool->numWorkerThreads(), [](auto, auto) {
+			return true;
+		}).get();
+
+		// Assert:
+		EXPECT_EQ(1u, statistics.NumPartitions);
+		EXPECT_EQ(1u, statistics.NumItems);
+		EXPECT_EQ(0u, statistics.NumSteals);
+		EXPECT_EQ(0u, statistics.NumStolenItems);
+		EXPECT_EQ(1u, statistics.MinPartitionItems);
+		EXPECT_EQ(1u, statistics.MaxPartitionItems);
+	}
+
+	TEST(TEST_CLASS, ParallelForWithStatisticsRebalancesSkewedWorkload) {
+		// Arrange: make all items initially assigned to the first partition expensive
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+		auto numThreads = pPool->numWorkerThreads();
+		auto items = CreateIncrementingValues(numThreads * 5);
+
+		// Sanity:
+		ASSERT_LT(1u, numThreads) << "test is not supported on single core system";
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		auto statistics = ParallelForWithStatistics(pPool->service(), items, numThreads, [&sum](auto value, auto index) {
+			if (index < 5)
+				test::Sleep(20);
+
+			sum += value;
+			return true;
+		}).get();
+
+		// Assert: all items were processed
+		EXPECT_EQ(items.size() * (items.size() + 1) / 2, sum);
+		EXPECT_EQ(numThreads, statistics.NumPartitions);
+		EXPECT_EQ(items.size(), statistics.NumItems);
+
+		// - idle partitions stole (some of the) expensive items from the first partition
+		EXPECT_LT(0u, statistics.NumSteals);
+		EXPECT_LT(0u, statistics.NumStolenItems);
+		EXPECT_LE(statistics.MinPartitionItems, statistics.MaxPartitionItems);
+	}
+
+	// endregion
+
+	// region WorkStealingPartitions
+
+	namespace {
+		std::vector<size_t> ClaimAll(detail::WorkStealingPartitions& partitions, size_t partitionIndex) {
+			std::vector<size_t> itemIndexes;
+			size_t itemIndex;
+			while (partitions.next(partitionIndex, itemIndex))
+				itemIndexes.push_back(itemIndex);
+
+			return itemIndexes;
+		}
+	}
+
+	TEST(TEST_CLASS, WorkStealingPartitionsCoverAllItems) {
+		// Arrange:
+		detail::WorkStealingPartitions partitions(11, 3);
+		size_t itemIndex;
+
+		// Act + Assert: the leading partitions get one more item when the items are not divisible by the partitions
+		EXPECT_EQ(3u, partitions.size());
+		EXPECT_TRUE(partitions.next(0, itemIndex));
+		EXPECT_EQ(0u, itemIndex);
+		EXPECT_TRUE(partitions.next(1, itemIndex));
+		EXPECT_EQ(4u, itemIndex);
+		EXPECT_TRUE(partitions.next(2, itemIndex));
+		EXPECT_EQ(8u, itemIndex);
+	}
+
+	TEST(TEST_CLASS, WorkStealingPartitionsAreLimitedByNumberOfItems) {
+		// Act:
+		detail::WorkStealingPartitions partitions(2, 3);
+
+		// Assert:
+		EXPECT_EQ(2u, partitions.size());
+	}
+
+	TEST(TEST_CLASS, WorkStealingPartitionCanStealHalfOfRemainingItemsFromOtherPartition) {
+		// Arrange: partitions { 0 .. 4 }, { 5 .. 9 }
+		detail::WorkStealingPartitions partitions(10, 2);
+		size_t itemIndex;
+		for (auto i = 0u; i < 5; ++i)
+			partitions.next(0, itemIndex);
+
+		// Act: first partition is exhausted and steals the back half of the second partition
+		auto isClaimed = partitions.next(0, itemIndex);
+
+		// Assert: partitions { 8, 9 }, { 5, 6 } remain
+		EXPECT_TRUE(isClaimed);
+		EXPECT_EQ(7u, itemIndex);
+
+		for (auto expectedItemIndex : { 5u, 6u }) {
+			EXPECT_TRUE(partitions.next(1, itemIndex));
+			EXPECT_EQ(expectedItemIndex, itemIndex);
+		}
+
+		EXPECT_EQ(std::vector<size_t>({ 8, 9 }), ClaimAll(partitions, 0));
+		EXPECT_FALSE(partitions.next(1, itemIndex));
+
+		auto statistics = partitions.statistics();
+		EXPECT_EQ(2u, statistics.NumPartitions);
+		EXPECT_EQ(10u, statistics.NumItems);
+		EXPECT_EQ(1u, statistics.NumSteals);
+		EXPECT_EQ(3u, statistics.NumStolenItems);
+		EXPECT_EQ(2u, statistics.MinPartitionItems);
+		EXPECT_EQ(8u, statistics.MaxPartitionItems);
+	}
+
+	TEST(TEST_CLASS, WorkStealingPartitionCanAbandonRemainingItems) {
+		// Arrange: partitions { 0 .. 4 }, { 5 .. 9 }
+		detail::WorkStealingPartitions partitions(10, 2);
+		size_t itemIndex;
+		partitions.next(1, itemIndex);
+
+		// Act:
+		partitions.abandon(1);
+
+		// Assert: abandoned items cannot be stolen
+		EXPECT_EQ(std::vector<size_t>({ 0, 1, 2, 3, 4 }), ClaimAll(partitions, 0));
+		EXPECT_FALSE(partitions.next(1, itemIndex));
+
+		auto statistics = partitions.statistics();
+		EXPECT_EQ(6u, statistics.NumItems);
+		EXPECT_EQ(0u, statistics.NumSteals);
 	}
 
 	// endregion
@@ -19,8 +19,12 @@
 **/
 
 #include "catapult/thread/ThreadInfo.h"
+#include "catapult/utils/CpuSet.h"
 #include "tests/TestHarness.h"
 #include <thread>
+#if !defined(_WIN32) && !defined(__APPLE__)
+#include <sched.h>
+#endif
 
 namespace catapult { namespace thread {
 
@@ -51,4 +55,49 @@ namespace catapult { namespace thread {
 		// Assert: the long thread name is truncated
 		EXPECT_EQ(std::string(GetMaxThreadNameLength(), 'a'), threadName);
 	}
+
+	TEST(TEST_CLASS, CanSetEmptyThreadAffinity) {
+		// Arrange:
+		auto result = false;
+		std::thread([&result] {
+			// Act:
+			result = SetThreadAffinity(utils::CpuSet());
+		}).join();
+
+		// Assert: an empty affinity is always accepted
+		EXPECT_TRUE(result);
+	}
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+
+	TEST(TEST_CLASS, CanSetThreadAffinity) {
+		// Arrange:
+		auto result = false;
+		uint32_t expectedCpuId = 0;
+		int cpuId = -1;
+		std::thread([&result, &expectedCpuId, &cpuId] {
+			// Act: pin the thread to the cpu it is currently running on, which is guaranteed to be allowed
+			expectedCpuId = static_cast<uint32_t>(sched_getcpu());
+			result = SetThreadAffinity(utils::CpuSet{ expectedCpuId });
+			cpuId = sched_getcpu();
+		}).join();
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(static_cast<int>(expectedCpuId), cpuId);
+	}
+
+	TEST(TEST_CLASS, CannotSetThreadAffinityToUnavailableCpu) {
+		// Arrange:
+		auto result = true;
+		std::thread([&result] {
+			// Act:
+			result = SetThreadAffinity(utils::CpuSet{ utils::CpuSet::Max_Cpu_Id - 1 });
+		}).join();
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+#endif
 }}
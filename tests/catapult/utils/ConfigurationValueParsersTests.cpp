@@ -20,6 +20,7 @@
 
 #include "catapult/utils/ConfigurationValueParsers.h"
 #include "catapult/utils/BlockSpan.h"
+#include "catapult/utils/CpuSet.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/utils/TimeSpan.h"
 #include "tests/test/nodeps/ConfigurationTestUtils.h"
@@ -425,4 +426,39 @@ namespace catapult { namespace utils {
 	}
 
 	// endregion
+
+	// region cpu set
+
+	TEST(TEST_CLASS, CanParseValidCpuSet) {
+		// Assert:
+		AssertSuccessfulParse("", CpuSet()); // no values
+		AssertSuccessfulParse("5", CpuSet{ 5 });
+		AssertSuccessfulParse("8,2,5", CpuSet{ 2, 5, 8 });
+		AssertSuccessfulParse("0-3", CpuSet{ 0, 1, 2, 3 });
+		AssertSuccessfulParse("4-4", CpuSet{ 4 });
+		AssertSuccessfulParse(" 0-2 ,\t8, 10-11", CpuSet{ 0, 1, 2, 8, 10, 11 });
+		AssertSuccessfulParse("1023", CpuSet{ 1023 });
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidCpuSet) {
+		// Arrange:
+		CpuSet initialValue{ 7, 9 };
+
+		// Assert
+		AssertFailedParse(",", initialValue); // no values
+		AssertFailedParse("1,,3", initialValue); // empty value
+		AssertFailedParse("1,a,3", initialValue); // non-numeric value
+		AssertFailedParse("-1", initialValue); // negative value
+		AssertFailedParse("1-", initialValue); // incomplete range (end)
+		AssertFailedParse("-1-3", initialValue); // incomplete range (start)
+		AssertFailedParse("3-1", initialValue); // reversed range
+		AssertFailedParse("1-2-3", initialValue); // malformed range
+		AssertFailedParse("1 - 3", initialValue); // whitespace within range
+		AssertFailedParse("1024", initialValue); // value too large
+		AssertFailedParse("1000-1024", initialValue); // range too large
+		AssertFailedParse("1,2,1", initialValue); // duplicate values
+		AssertFailedParse("0-3,2", initialValue); // overlapping values
+	}
+
+	// endregion
 }}
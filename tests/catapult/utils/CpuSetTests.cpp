@@ -0,0 +1,107 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/CpuSet.h"
+#include "tests/test/nodeps/Equality.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS CpuSetTests
+
+	// region creation
+
+	TEST(TEST_CLASS, CanCreateEmptyCpuSet) {
+		// Act:
+		CpuSet cpuSet;
+
+		// Assert:
+		EXPECT_TRUE(cpuSet.empty());
+		EXPECT_EQ(0u, cpuSet.size());
+		EXPECT_TRUE(cpuSet.cpuIds().empty());
+	}
+
+	TEST(TEST_CLASS, CanCreateCpuSetFromInitializerList) {
+		// Act:
+		CpuSet cpuSet{ 7, 2, 4, 2 };
+
+		// Assert:
+		EXPECT_FALSE(cpuSet.empty());
+		EXPECT_EQ(3u, cpuSet.size());
+		EXPECT_EQ(std::set<uint32_t>({ 2, 4, 7 }), cpuSet.cpuIds());
+	}
+
+	TEST(TEST_CLASS, CanCreateCpuSetFromSet) {
+		// Act:
+		CpuSet cpuSet(std::set<uint32_t>{ 7, 2, 4 });
+
+		// Assert:
+		EXPECT_FALSE(cpuSet.empty());
+		EXPECT_EQ(3u, cpuSet.size());
+		EXPECT_EQ(std::set<uint32_t>({ 2, 4, 7 }), cpuSet.cpuIds());
+	}
+
+	// endregion
+
+	// region equality operators
+
+	namespace {
+		std::unordered_set<std::string> GetEqualTags() {
+			return { "0-3", "0-3 (2)" };
+		}
+
+		std::unordered_map<std::string, CpuSet> GenerateEqualityInstanceMap() {
+			return {
+				{ "0-3", CpuSet{ 0, 1, 2, 3 } },
+				{ "0-3 (2)", CpuSet{ 3, 2, 1, 0 } },
+
+				{ "0-2", CpuSet{ 0, 1, 2 } },
+				{ "0-4", CpuSet{ 0, 1, 2, 3, 4 } },
+				{ "1-4", CpuSet{ 1, 2, 3, 4 } },
+				{ "empty", CpuSet() }
+			};
+		}
+	}
+
+	TEST(TEST_CLASS, OperatorEqualReturnsTrueOnlyForEqualValues) {
+		// Assert:
+		test::AssertOperatorEqualReturnsTrueForEqualObjects("0-3", GenerateEqualityInstanceMap(), GetEqualTags());
+	}
+
+	TEST(TEST_CLASS, OperatorNotEqualReturnsTrueOnlyForUnequalValues) {
+		// Assert:
+		test::AssertOperatorNotEqualReturnsTrueForUnequalObjects("0-3", GenerateEqualityInstanceMap(), GetEqualTags());
+	}
+
+	// endregion
+
+	// region to string
+
+	TEST(TEST_CLASS, CanOutputCpuSet) {
+		// Assert:
+		EXPECT_EQ("", test::ToString(CpuSet()));
+		EXPECT_EQ("5", test::ToString(CpuSet{ 5 }));
+		EXPECT_EQ("2,5,9", test::ToString(CpuSet{ 2, 5, 9 }));
+		EXPECT_EQ("0-3", test::ToString(CpuSet{ 0, 1, 2, 3 }));
+		EXPECT_EQ("0-3,8,10-11", test::ToString(CpuSet{ 0, 1, 2, 3, 8, 10, 11 }));
+	}
+
+	// endregion
+}}
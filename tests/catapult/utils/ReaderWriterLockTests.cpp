@@ -18,17 +18,17 @@
 *** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
 **/
 
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ReaderWriterLock.h"
 #include "tests/test/nodeps/LockTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace utils {
 
-#define TEST_CLASS SpinReaderWriterLockTests
+#define TEST_CLASS ReaderWriterLockTests
 
 	TEST(TEST_CLASS, LockIsInitiallyUnlocked) {
 		// Act:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 
 		// Assert:
 		EXPECT_FALSE(lock.isWriterPending());
@@ -38,7 +38,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, CanAcquireReaderLock) {
 		// Act:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		auto readLock = lock.acquireReader();
 
 		// Assert:
@@ -49,7 +49,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, CanReleaseReaderLock) {
 		// Act:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		{
 			auto readLock = lock.acquireReader();
 		}
@@ -62,7 +62,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, CanReleaseReaderLockAfterMove) {
 		// Act:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		{
 			auto readLock = lock.acquireReader();
 			auto readLock2 = std::move(readLock);
@@ -76,7 +76,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, CanPromoteReaderLockToWriterLock) {
 		// Act:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		auto readLock = lock.acquireReader();
 		auto writeLock = readLock.promoteToWriter();
 
@@ -88,7 +88,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, CanDemoteWriterLockToReaderLock) {
 		// Act:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		auto readLock = lock.acquireReader();
 		{
 			auto writeLock = readLock.promoteToWriter();
@@ -102,7 +102,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, CanReleaseWriterLock) {
 		// Act:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		{
 			auto readLock = lock.acquireReader();
 			auto writeLock = readLock.promoteToWriter();
@@ -116,7 +116,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, CanReleaseWriterLockAfterMove) {
 		// Act:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		{
 			auto readLock = lock.acquireReader();
 			auto writeLock = readLock.promoteToWriter();
@@ -131,7 +131,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, CannotPromoteReaderLockToWriterLockMultipleTimes) {
 		// Arrange:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		auto readLock = lock.acquireReader();
 		auto writeLock = readLock.promoteToWriter();
 
@@ -141,7 +141,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, CanPromoteReaderLockToWriterLockAfterDemotion) {
 		// Act: acquire a reader and then promote, demote, promote
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		auto readLock = lock.acquireReader();
 		{
 			auto writeLock = readLock.promoteToWriter();
@@ -156,7 +156,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, MultipleThreadsCanAquireReaderLock) {
 		// Arrange:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		std::atomic<uint32_t> counter(0);
 		test::LockTestState state;
 		test::LockTestGuard testGuard(state);
@@ -183,18 +183,18 @@ namespace catapult { namespace utils {
 	namespace {
 		struct ExclusiveLockGuard {
 		public:
-			explicit ExclusiveLockGuard(SpinReaderWriterLock& lock)
+			explicit ExclusiveLockGuard(ReaderWriterLock& lock)
 					: m_readLock(lock.acquireReader())
 					, m_writeLock(m_readLock.promoteToWriter())
 			{}
 
 		private:
-			SpinReaderWriterLock::ReaderLockGuard m_readLock;
-			SpinReaderWriterLock::WriterLockGuard m_writeLock;
+			ReaderWriterLock::ReaderLockGuard m_readLock;
+			ReaderWriterLock::WriterLockGuard m_writeLock;
 		};
 
 		struct LockPolicy {
-			using LockType = SpinReaderWriterLock;
+			using LockType = ReaderWriterLock;
 
 			static auto ExclusiveLock(LockType& lock) {
 				return ExclusiveLockGuard(lock);
@@ -204,7 +204,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, LockGuaranteesExclusiveWriterAccess) {
 		// Arrange:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 
 		// Assert:
 		test::AssertLockGuaranteesExclusiveAccess<LockPolicy>(lock);
@@ -212,7 +212,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, LockGuaranteesExclusiveWriterAccessAfterLockUnlockCycles) {
 		// Arrange:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 
 		// Assert:
 		test::AssertLockGuaranteesExclusiveAccessAfterLockUnlockCycles<LockPolicy>(lock);
@@ -220,7 +220,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, ReaderBlocksWriter) {
 		// Arrange:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		char value = '\0';
 		test::LockTestState state;
 		test::LockTestGuard testGuard(state);
@@ -252,7 +252,7 @@ namespace catapult { namespace utils {
 
 	TEST(TEST_CLASS, WriterBlocksReader) {
 		// Arrange:
-		SpinReaderWriterLock lock;
+		ReaderWriterLock lock;
 		char value = '\0';
 		test::LockTestState state;
 		test::LockTestGuard testGuard(state);
@@ -285,7 +285,7 @@ namespace catapult { namespace utils {
 	namespace {
 		struct ReaderWriterRaceState : public test::LockTestState {
 		public:
-			SpinReaderWriterLock Lock;
+			ReaderWriterLock Lock;
 			std::atomic<char> ReleasedThreadId;
 			std::atomic<uint32_t> NumWaitingThreads;
 			std::atomic<uint32_t> NumReaderThreads;
@@ -307,7 +307,7 @@ namespace catapult { namespace utils {
 				doWriterWork(acquireReader());
 			}
 
-			void doWriterWork(SpinReaderWriterLock::ReaderLockGuard&& readLock) {
+			void doWriterWork(ReaderWriterLock::ReaderLockGuard&& readLock) {
 				auto writeLock = readLock.promoteToWriter();
 
 				setReleasedThreadId('w');
@@ -412,4 +412,128 @@ namespace catapult { namespace utils {
 		// Assert: the reader was released first (the writer was blocked by the reader)
 		EXPECT_EQ('r', state.ReleasedThreadId);
 	}
+
+	// region striped readers
+
+	TEST(TEST_CLASS, CanAcquireManyReaderLocks) {
+		// Arrange: use the no-op policy to allow reentrant readers
+		BasicReaderWriterLock<NoOpReaderNotificationPolicy> lock;
+		std::vector<BasicReaderWriterLock<NoOpReaderNotificationPolicy>::ReaderLockGuard> readLocks;
+
+		// Act: acquire more readers than can be counted in a single byte
+		for (auto i = 0u; i < 1000; ++i)
+			readLocks.push_back(lock.acquireReader());
+
+		// Assert:
+		EXPECT_FALSE(lock.isWriterPending());
+		EXPECT_TRUE(lock.isReaderActive());
+
+		// Act: release all readers
+		readLocks.clear();
+
+		// Assert:
+		EXPECT_FALSE(lock.isReaderActive());
+	}
+
+	TEST(TEST_CLASS, MovedReaderLockGuardDoesNotReleaseReaderLock) {
+		// Arrange:
+		ReaderWriterLock lock;
+		auto readLock = lock.acquireReader();
+
+		// Act:
+		{
+			auto readLock2 = std::move(readLock);
+		}
+
+		// Assert: the reader lock was released exactly once
+		EXPECT_FALSE(lock.isReaderActive());
+	}
+
+	// endregion
+
+	// region statistics
+
+	TEST(TEST_CLASS, StatisticsAreZeroWhenLockIsUncontended) {
+		// Arrange:
+		ReaderWriterLock lock;
+
+		// Act:
+		{
+			auto readLock = lock.acquireReader();
+			auto writeLock = readLock.promoteToWriter();
+		}
+
+		// Assert:
+		auto statistics = lock.statistics();
+		EXPECT_EQ(0u, statistics.NumReaderWaits);
+		EXPECT_EQ(0u, statistics.NumWriterWaits);
+		EXPECT_EQ(0u, statistics.NumSpins);
+		EXPECT_EQ(0u, statistics.NumParks);
+		EXPECT_EQ(0u, statistics.TotalWaitMicroseconds);
+		EXPECT_EQ(0u, statistics.MaxWaitMicroseconds);
+	}
+
+	TEST(TEST_CLASS, ContendedReaderIsParkedAndRecordsWait) {
+		// Arrange: acquire a writer
+		ReaderWriterLock lock;
+		auto readLock = lock.acquireReader();
+		auto writeLock = std::make_unique<ReaderWriterLock::WriterLockGuard>(readLock.promoteToWriter());
+		std::atomic_bool isReaderAcquired(false);
+		test::LockTestState state;
+		test::LockTestGuard testGuard(state);
+
+		// - spawn a reader that is blocked by the writer
+		testGuard.Threads.create_thread([&] {
+			auto readLock2 = lock.acquireReader();
+			isReaderAcquired = true;
+		});
+
+		// Act: wait for the reader to park and then release the writer
+		WAIT_FOR_ONE_EXPR(lock.statistics().NumParks);
+		test::Pause();
+		writeLock.reset();
+		WAIT_FOR(isReaderAcquired);
+
+		// Assert:
+		auto statistics = lock.statistics();
+		EXPECT_EQ(1u, statistics.NumReaderWaits);
+		EXPECT_EQ(0u, statistics.NumWriterWaits);
+		EXPECT_EQ(static_cast<uint64_t>(ReaderWriterLock::Max_Spins), statistics.NumSpins);
+		EXPECT_EQ(1u, statistics.NumParks);
+		EXPECT_LT(0u, statistics.TotalWaitMicroseconds);
+		EXPECT_EQ(statistics.TotalWaitMicroseconds, statistics.MaxWaitMicroseconds);
+	}
+
+	TEST(TEST_CLASS, ContendedWriterIsParkedAndRecordsWait) {
+		// Arrange: acquire a reader
+		ReaderWriterLock lock;
+		auto readLock = std::make_unique<ReaderWriterLock::ReaderLockGuard>(lock.acquireReader());
+		std::atomic_bool isWriterAcquired(false);
+		test::LockTestState state;
+		test::LockTestGuard testGuard(state);
+
+		// - spawn a writer that is blocked by the reader
+		testGuard.Threads.create_thread([&] {
+			auto readLock2 = lock.acquireReader();
+			auto writeLock2 = readLock2.promoteToWriter();
+			isWriterAcquired = true;
+		});
+
+		// Act: wait for the writer to park and then release the reader
+		WAIT_FOR_ONE_EXPR(lock.statistics().NumParks);
+		test::Pause();
+		readLock.reset();
+		WAIT_FOR(isWriterAcquired);
+
+		// Assert:
+		auto statistics = lock.statistics();
+		EXPECT_EQ(0u, statistics.NumReaderWaits);
+		EXPECT_EQ(1u, statistics.NumWriterWaits);
+		EXPECT_EQ(static_cast<uint64_t>(ReaderWriterLock::Max_Spins), statistics.NumSpins);
+		EXPECT_EQ(1u, statistics.NumParks);
+		EXPECT_LT(0u, statistics.TotalWaitMicroseconds);
+		EXPECT_EQ(statistics.TotalWaitMicroseconds, statistics.MaxWaitMicroseconds);
+	}
+
+	// endregion
 }}
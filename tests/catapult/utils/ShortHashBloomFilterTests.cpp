@@ -0,0 +1,143 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/ShortHashBloomFilter.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS ShortHashBloomFilterTests
+
+	namespace {
+		std::vector<ShortHash> GenerateRandomShortHashes(size_t count) {
+			std::vector<ShortHash> shortHashes;
+			for (auto i = 0u; i < count; ++i)
+				shortHashes.push_back(test::GenerateRandomValue<ShortHash>());
+
+			return shortHashes;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyFilter) {
+		// Act:
+		ShortHashBloomFilter filter(1000);
+
+		// Assert:
+		EXPECT_EQ(1000u, filter.capacity());
+		EXPECT_EQ(0u, filter.size());
+		EXPECT_EQ(2016u, filter.memorySize()); // ceil(1000 * 16 / 256) * 32
+	}
+
+	TEST(TEST_CLASS, CanCreateFilterWithZeroCapacity) {
+		// Act:
+		ShortHashBloomFilter filter(0);
+
+		// Assert:
+		EXPECT_EQ(0u, filter.capacity());
+		EXPECT_EQ(0u, filter.size());
+		EXPECT_EQ(32u, filter.memorySize());
+		EXPECT_FALSE(filter.maybeContains(ShortHash(123)));
+	}
+
+	TEST(TEST_CLASS, EmptyFilterDoesNotContainAnyShortHashes) {
+		// Arrange:
+		ShortHashBloomFilter filter(1000);
+
+		// Act + Assert:
+		for (auto shortHash : GenerateRandomShortHashes(100))
+			EXPECT_FALSE(filter.maybeContains(shortHash)) << shortHash;
+	}
+
+	// endregion
+
+	// region insert
+
+	TEST(TEST_CLASS, FilterContainsAllInsertedShortHashes) {
+		// Arrange:
+		ShortHashBloomFilter filter(1000);
+		auto shortHashes = GenerateRandomShortHashes(1000);
+
+		// Act:
+		for (auto shortHash : shortHashes)
+			filter.insert(shortHash);
+
+		// Assert:
+		EXPECT_EQ(1000u, filter.size());
+		for (auto shortHash : shortHashes)
+			EXPECT_TRUE(filter.maybeContains(shortHash)) << shortHash;
+	}
+
+	TEST(TEST_CLASS, FilterCanContainMoreShortHashesThanCapacity) {
+		// Arrange:
+		ShortHashBloomFilter filter(100);
+		auto shortHashes = GenerateRandomShortHashes(1000);
+
+		// Act:
+		for (auto shortHash : shortHashes)
+			filter.insert(shortHash);
+
+		// Assert: there are no false negatives even when the filter is overfilled
+		EXPECT_EQ(1000u, filter.size());
+		for (auto shortHash : shortHashes)
+			EXPECT_TRUE(filter.maybeContains(shortHash)) << shortHash;
+	}
+
+	TEST(TEST_CLASS, FilterHasLowFalsePositiveRateAtCapacity) {
+		// Arrange:
+		ShortHashBloomFilter filter(10000);
+		for (auto shortHash : GenerateRandomShortHashes(10000))
+			filter.insert(shortHash);
+
+		// Act: consecutive values are (almost certainly) not contained in the filter
+		auto numFalsePositives = 0u;
+		for (auto i = 0u; i < 10000; ++i) {
+			if (filter.maybeContains(ShortHash(i)))
+				++numFalsePositives;
+		}
+
+		// Assert: the nominal false positive rate is well below 1%
+		EXPECT_GT(100u, numFalsePositives);
+	}
+
+	// endregion
+
+	// region clear
+
+	TEST(TEST_CLASS, ClearRemovesAllShortHashes) {
+		// Arrange:
+		ShortHashBloomFilter filter(1000);
+		auto shortHashes = GenerateRandomShortHashes(100);
+		for (auto shortHash : shortHashes)
+			filter.insert(shortHash);
+
+		// Act:
+		filter.clear();
+
+		// Assert:
+		EXPECT_EQ(1000u, filter.capacity());
+		EXPECT_EQ(0u, filter.size());
+		for (auto shortHash : shortHashes)
+			EXPECT_FALSE(filter.maybeContains(shortHash)) << shortHash;
+	}
+
+	// endregion
+}}
@@ -0,0 +1,297 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/ShortHashIblt.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS ShortHashIbltTests
+
+	namespace {
+		// decoding is probabilistic, so use deterministic short hashes in tests that depend on successful decoding
+		std::vector<ShortHash> GenerateSequentialShortHashes(size_t count, uint32_t start) {
+			std::vector<ShortHash> shortHashes;
+			for (auto i = 0u; i < count; ++i)
+				shortHashes.push_back(ShortHash(start + i));
+
+			return shortHashes;
+		}
+
+		std::vector<ShortHash> GenerateRandomShortHashes(size_t count) {
+			std::vector<ShortHash> shortHashes;
+			for (auto i = 0u; i < count; ++i)
+				shortHashes.push_back(test::GenerateRandomValue<ShortHash>());
+
+			return shortHashes;
+		}
+
+		ShortHashIblt CreateIblt(size_t numCells, const std::vector<ShortHash>& shortHashes) {
+			ShortHashIblt iblt(numCells);
+			for (auto shortHash : shortHashes)
+				iblt.insert(shortHash);
+
+			return iblt;
+		}
+
+		bool IsZero(const ShortHashIbltCell& cell) {
+			return 0 == cell.Count && ShortHash() == cell.KeySum && 0 == cell.CheckSum;
+		}
+
+		void AssertAllCellsAreZero(const ShortHashIblt& iblt) {
+			auto i = 0u;
+			for (const auto& cell : iblt.cells())
+				EXPECT_TRUE(IsZero(cell)) << "cell at " << i++;
+		}
+
+		void AssertEqualSets(const std::vector<ShortHash>& expected, const std::vector<ShortHash>& actual) {
+			EXPECT_EQ(ShortHashesSet(expected.cbegin(), expected.cend()), ShortHashesSet(actual.cbegin(), actual.cend()));
+			EXPECT_EQ(expected.size(), actual.size());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyTable) {
+		// Act:
+		ShortHashIblt iblt(30);
+
+		// Assert:
+		EXPECT_EQ(30u, iblt.numCells());
+		EXPECT_EQ(30u, iblt.cells().size());
+		AssertAllCellsAreZero(iblt);
+	}
+
+	TEST(TEST_CLASS, NumCellsIsRoundedUpToMultipleOfNumHashFunctions) {
+		// Act + Assert:
+		EXPECT_EQ(3u, ShortHashIblt(0).numCells());
+		EXPECT_EQ(3u, ShortHashIblt(1).numCells());
+		EXPECT_EQ(12u, ShortHashIblt(10).numCells());
+		EXPECT_EQ(12u, ShortHashIblt(12).numCells());
+	}
+
+	TEST(TEST_CLASS, CanCreateTableAroundValidCells) {
+		// Arrange:
+		std::vector<ShortHashIbltCell> cells(6);
+		cells[2].Count = 1;
+		cells[2].KeySum = ShortHash(123);
+		cells[2].CheckSum = 987;
+
+		// Act:
+		ShortHashIblt iblt(std::move(cells));
+
+		// Assert:
+		ASSERT_EQ(6u, iblt.numCells());
+		EXPECT_EQ(1, iblt.cells()[2].Count);
+		EXPECT_EQ(ShortHash(123), iblt.cells()[2].KeySum);
+		EXPECT_EQ(987u, iblt.cells()[2].CheckSum);
+	}
+
+	TEST(TEST_CLASS, CannotCreateTableAroundInvalidCells) {
+		// Act + Assert:
+		for (auto numCells : { 0u, 1u, 4u, 8u })
+			EXPECT_THROW(ShortHashIblt(std::vector<ShortHashIbltCell>(numCells)), catapult_invalid_argument) << numCells;
+	}
+
+	// endregion
+
+	// region CalculateNumCells / IsValidNumCells
+
+	TEST(TEST_CLASS, CalculateNumCellsReturnsValidNumberOfCellsWithHeadroom) {
+		// Act + Assert:
+		EXPECT_EQ(30u, ShortHashIblt::CalculateNumCells(0));
+		EXPECT_EQ(51u, ShortHashIblt::CalculateNumCells(10));
+		EXPECT_EQ(231u, ShortHashIblt::CalculateNumCells(100));
+		EXPECT_EQ(2031u, ShortHashIblt::CalculateNumCells(1000));
+	}
+
+	TEST(TEST_CLASS, IsValidNumCellsOnlyReturnsTrueForNonzeroMultiplesOfNumHashFunctions) {
+		// Act + Assert:
+		for (auto numCells : { 3u, 6u, 9u, 300u })
+			EXPECT_TRUE(ShortHashIblt::IsValidNumCells(numCells)) << numCells;
+
+		for (auto numCells : { 0u, 1u, 2u, 4u, 299u })
+			EXPECT_FALSE(ShortHashIblt::IsValidNumCells(numCells)) << numCells;
+	}
+
+	// endregion
+
+	// region insert / erase
+
+	TEST(TEST_CLASS, InsertUpdatesOneCellPerHashFunction) {
+		// Arrange:
+		ShortHashIblt iblt(30);
+
+		// Act:
+		iblt.insert(ShortHash(0x12345678));
+
+		// Assert: one cell in each subtable was updated
+		for (auto i = 0u; i < ShortHashIblt::Num_Hash_Functions; ++i) {
+			auto numUpdatedCells = 0u;
+			for (auto j = 0u; j < 10; ++j) {
+				const auto& cell = iblt.cells()[i * 10 + j];
+				if (IsZero(cell))
+					continue;
+
+				EXPECT_EQ(1, cell.Count);
+				EXPECT_EQ(ShortHash(0x12345678), cell.KeySum);
+				++numUpdatedCells;
+			}
+
+			EXPECT_EQ(1u, numUpdatedCells) << "subtable " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, EraseUndoesInsert) {
+		// Arrange:
+		auto shortHashes = GenerateRandomShortHashes(100);
+		auto iblt = CreateIblt(30, shortHashes);
+
+		// Act:
+		for (auto shortHash : shortHashes)
+			iblt.erase(shortHash);
+
+		// Assert:
+		AssertAllCellsAreZero(iblt);
+	}
+
+	// endregion
+
+	// region subtract
+
+	TEST(TEST_CLASS, SubtractingTableFromItselfProducesEmptyTable) {
+		// Arrange:
+		auto shortHashes = GenerateRandomShortHashes(100);
+		auto iblt = CreateIblt(30, shortHashes);
+		auto iblt2 = CreateIblt(30, shortHashes);
+
+		// Act:
+		iblt.subtract(iblt2);
+
+		// Assert:
+		AssertAllCellsAreZero(iblt);
+	}
+
+	TEST(TEST_CLASS, CannotSubtractTablesWithDifferentSizes) {
+		// Arrange:
+		ShortHashIblt iblt(30);
+		ShortHashIblt iblt2(33);
+
+		// Act + Assert:
+		EXPECT_THROW(iblt.subtract(iblt2), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region decode
+
+	TEST(TEST_CLASS, CanDecodeEmptyTable) {
+		// Arrange:
+		ShortHashIblt iblt(30);
+		std::vector<ShortHash> positiveShortHashes;
+		std::vector<ShortHash> negativeShortHashes;
+
+		// Act:
+		auto isDecoded = iblt.decode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		EXPECT_TRUE(positiveShortHashes.empty());
+		EXPECT_TRUE(negativeShortHashes.empty());
+	}
+
+	TEST(TEST_CLASS, CanDecodeInsertedAndErasedShortHashes) {
+		// Arrange:
+		auto insertedShortHashes = GenerateSequentialShortHashes(10, 1000);
+		auto erasedShortHashes = GenerateSequentialShortHashes(5, 2000);
+		auto iblt = CreateIblt(ShortHashIblt::CalculateNumCells(15), insertedShortHashes);
+		for (auto shortHash : erasedShortHashes)
+			iblt.erase(shortHash);
+
+		std::vector<ShortHash> positiveShortHashes;
+		std::vector<ShortHash> negativeShortHashes;
+
+		// Act:
+		auto isDecoded = iblt.decode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		AssertEqualSets(insertedShortHashes, positiveShortHashes);
+		AssertEqualSets(erasedShortHashes, negativeShortHashes);
+	}
+
+	TEST(TEST_CLASS, CanDecodeSetDifferenceOfLargeSets) {
+		// Arrange: create two large sets that share most short hashes (common short hashes cancel out, so they can be random)
+		auto commonShortHashes = GenerateRandomShortHashes(10000);
+		auto shortHashes1 = GenerateSequentialShortHashes(50, 1000);
+		auto shortHashes2 = GenerateSequentialShortHashes(30, 2000);
+
+		auto numCells = ShortHashIblt::CalculateNumCells(80);
+		auto iblt1 = CreateIblt(numCells, commonShortHashes);
+		auto iblt2 = CreateIblt(numCells, commonShortHashes);
+		for (auto shortHash : shortHashes1)
+			iblt1.insert(shortHash);
+
+		for (auto shortHash : shortHashes2)
+			iblt2.insert(shortHash);
+
+		std::vector<ShortHash> positiveShortHashes;
+		std::vector<ShortHash> negativeShortHashes;
+
+		// Act:
+		iblt1.subtract(iblt2);
+		auto isDecoded = iblt1.decode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		AssertEqualSets(shortHashes1, positiveShortHashes);
+		AssertEqualSets(shortHashes2, negativeShortHashes);
+	}
+
+	TEST(TEST_CLASS, CannotDecodeSetDifferenceExceedingCapacity) {
+		// Arrange:
+		auto iblt = CreateIblt(ShortHashIblt::CalculateNumCells(10), GenerateRandomShortHashes(100));
+		std::vector<ShortHash> positiveShortHashes;
+		std::vector<ShortHash> negativeShortHashes;
+
+		// Act:
+		auto isDecoded = iblt.decode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_FALSE(isDecoded);
+	}
+
+	TEST(TEST_CLASS, DecodeDoesNotModifyTable) {
+		// Arrange:
+		auto iblt = CreateIblt(30, GenerateRandomShortHashes(5));
+		auto originalCells = iblt.cells();
+		std::vector<ShortHash> positiveShortHashes;
+		std::vector<ShortHash> negativeShortHashes;
+
+		// Act:
+		iblt.decode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		ASSERT_EQ(originalCells.size(), iblt.numCells());
+		EXPECT_TRUE(0 == std::memcmp(originalCells.data(), iblt.cells().data(), originalCells.size() * sizeof(ShortHashIbltCell)));
+	}
+
+	// endregion
+}}
@@ -43,7 +43,10 @@ namespace catapult { namespace validators {
 				return m_name;
 			}
 
-			ValidationResult validate(const model::WeakEntityInfo&, const ValidatorContext& context) const override {
+			ValidationResult validate(
+					const model::WeakEntityInfo&,
+					const CancellationToken&,
+					const ValidatorContext& context) const override {
 				m_breadcrumbs.push_back(m_name + std::to_string(context.Height.unwrap()));
 				return ValidationResult::Success;
 			}
@@ -69,7 +72,7 @@ namespace catapult { namespace validators {
 				// Act: just invoke every validation function once
 				auto i = 0u;
 				for (const auto& validationFunction : validationFunctions) {
-					auto result = validationFunction(entityInfo);
+					auto result = validationFunction(entityInfo, CancellationToken());
 
 					// Sanity: all functions should succeed
 					EXPECT_EQ(ValidationResult::Success, result) << "validation function at " << i;
@@ -94,4 +94,62 @@ namespace catapult { namespace validators {
 		// - note that FIRST failure has highest precedence
 		EXPECT_EQ(Failure_Result, TTraits::AggregateTwo(Failure_Result, Failure2_Result));
 	}
+
+	// region AggregateValidationResults
+
+	namespace {
+		std::pair<ValidationResult, size_t> AggregateResults(const std::vector<ValidationResult>& results) {
+			// validators are emulated by pointers to results
+			std::vector<const ValidationResult*> validators;
+			for (const auto& result : results)
+				validators.push_back(&result);
+
+			size_t numValidateCalls = 0;
+			auto isSuppressedFailure = [](auto result) { return Failure2_Result == result; };
+			auto aggregateResult = AggregateValidationResults(validators, isSuppressedFailure, [&numValidateCalls](auto result) {
+				++numValidateCalls;
+				return result;
+			});
+
+			return std::make_pair(aggregateResult, numValidateCalls);
+		}
+	}
+
+	TEST(TEST_CLASS, AggregateValidationResultsReturnsSuccessWhenThereAreNoValidators) {
+		// Act:
+		auto resultPair = AggregateResults({});
+
+		// Assert:
+		EXPECT_EQ(Success_Result, resultPair.first);
+		EXPECT_EQ(0u, resultPair.second);
+	}
+
+	TEST(TEST_CLASS, AggregateValidationResultsAggregatesAllNonFailureResults) {
+		// Act:
+		auto resultPair = AggregateResults({ Success_Result, Neutral_Result, Success2_Result });
+
+		// Assert:
+		EXPECT_EQ(Neutral_Result, resultPair.first);
+		EXPECT_EQ(3u, resultPair.second);
+	}
+
+	TEST(TEST_CLASS, AggregateValidationResultsIgnoresSuppressedFailures) {
+		// Act:
+		auto resultPair = AggregateResults({ Success_Result, Failure2_Result, Neutral_Result });
+
+		// Assert:
+		EXPECT_EQ(Neutral_Result, resultPair.first);
+		EXPECT_EQ(3u, resultPair.second);
+	}
+
+	TEST(TEST_CLASS, AggregateValidationResultsStopsAtFirstFailure) {
+		// Act:
+		auto resultPair = AggregateResults({ Neutral_Result, Failure_Result, Success_Result });
+
+		// Assert:
+		EXPECT_EQ(Failure_Result, resultPair.first);
+		EXPECT_EQ(2u, resultPair.second);
+	}
+
+	// endregion
 }}
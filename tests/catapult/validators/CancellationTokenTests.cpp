@@ -0,0 +1,64 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/validators/CancellationToken.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace validators {
+
+#define TEST_CLASS CancellationTokenTests
+
+	TEST(TEST_CLASS, DefaultTokenIsNeverCancelled) {
+		// Act:
+		CancellationToken token;
+
+		// Assert:
+		EXPECT_FALSE(token.isCancelled());
+	}
+
+	TEST(TEST_CLASS, TokenReflectsCancellationFlag) {
+		// Arrange:
+		std::atomic<bool> isCancelled(false);
+		CancellationToken token(isCancelled);
+
+		// Act + Assert:
+		EXPECT_FALSE(token.isCancelled());
+
+		isCancelled = true;
+		EXPECT_TRUE(token.isCancelled());
+
+		isCancelled = false;
+		EXPECT_FALSE(token.isCancelled());
+	}
+
+	TEST(TEST_CLASS, CopiedTokenSharesCancellationFlag) {
+		// Arrange:
+		std::atomic<bool> isCancelled(false);
+		CancellationToken token(isCancelled);
+		auto tokenCopy = token;
+
+		// Act:
+		isCancelled = true;
+
+		// Assert:
+		EXPECT_TRUE(token.isCancelled());
+		EXPECT_TRUE(tokenCopy.isCancelled());
+	}
+}}
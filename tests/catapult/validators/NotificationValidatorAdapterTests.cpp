@@ -31,7 +31,7 @@ namespace catapult { namespace validators {
 	namespace {
 		ValidationResult ValidateEntity(const stateless::EntityValidator& validator, const model::VerifiableEntity& entity) {
 			Hash256 hash;
-			return validator.validate(model::WeakEntityInfo(entity, hash));
+			return validator.validate(model::WeakEntityInfo(entity, hash), CancellationToken());
 		}
 
 		class MockNotificationValidator : public stateless::NotificationValidator {
@@ -157,6 +157,22 @@ namespace catapult { namespace validators {
 		AssertMockTransactionValidation(ValidationResult::Failure, 1);
 	}
 
+	TEST(TEST_CLASS, DoesNotDelegateWhenCancelled) {
+		// Arrange:
+		RunTest(ValidationResult::Success, [](const auto& adapter, const auto& validator) {
+			auto pTransaction = mocks::CreateMockTransaction(0);
+			std::atomic<bool> isCancelled(true);
+
+			// Act:
+			Hash256 hash;
+			auto result = adapter.validate(model::WeakEntityInfo(*pTransaction, hash), CancellationToken(isCancelled));
+
+			// Assert: no notifications should be processed
+			EXPECT_EQ(ValidationResult::Success, result);
+			EXPECT_EQ(0u, validator.numValidateCalls());
+		});
+	}
+
 	TEST(TEST_CLASS, CanSpecifyCustomPublisher) {
 		// Arrange:
 		auto pValidator = std::make_unique<MockNotificationValidator>("alpha", ValidationResult::Failure);
@@ -104,4 +104,22 @@ namespace catapult { namespace validators {
 		EXPECT_EQ(MakeNotificationType(2), validator.notificationTypes()[1]);
 		EXPECT_EQ(MakeNotificationType(3), validator.notificationTypes()[2]);
 	}
+
+	TEST(TEST_CLASS, SubscriberDoesNotForwardNotificationsAfterCancellation) {
+		// Arrange:
+		MockNotificationValidator validator;
+		std::atomic<bool> isCancelled(false);
+		ValidatingNotificationSubscriber subscriber(validator, CancellationToken(isCancelled));
+
+		// Act:
+		subscriber.notify(test::CreateNotification(MakeNotificationType(1)));
+		isCancelled = true;
+		subscriber.notify(test::CreateNotification(MakeNotificationType(2)));
+		auto result = subscriber.result();
+
+		// Assert: only the notification before cancellation was forwarded
+		EXPECT_EQ(ValidationResult::Success, result);
+		ASSERT_EQ(1u, validator.notificationTypes().size());
+		EXPECT_EQ(MakeNotificationType(1), validator.notificationTypes()[0]);
+	}
 }}
@@ -103,6 +103,7 @@ namespace catapult { namespace local {
 		EXPECT_TRUE(test::HasCounter(counters, "TX ELEM TOT")) << "service local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "UNLKED ACCTS")) << "peer local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "UT CACHE")) << "basic local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "STORAGE WAIT")) << "basic local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "MEM CUR RSS")) << "memory counters";
 	}
 
@@ -42,6 +42,9 @@ namespace catapult { namespace test {
 
 			config.MaxBlocksPerSyncAttempt = 4 * 100;
 			config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512);
+			config.MaxPeersPerSyncAttempt = 1;
+			config.ShouldSyncBlockHeadersFirst = false;
+			config.ShouldSampleChainHashes = false;
 
 			config.ShortLivedCacheMaxSize = 10;
 
@@ -86,7 +86,7 @@ namespace catapult { namespace test {
 
 			// Assert:
 			EXPECT_EQ(static_cast<size_t>(Traits::Num_Expected_Services), context.locator().numServices());
-			EXPECT_EQ(1u, context.locator().counters().size());
+			EXPECT_EQ(static_cast<size_t>(Traits::Num_Expected_Counters), context.locator().counters().size());
 
 			EXPECT_TRUE(!!Traits::GetWriters(context.locator()));
 			EXPECT_EQ(0u, context.counter(Traits::Counter_Name));
@@ -102,7 +102,7 @@ namespace catapult { namespace test {
 
 			// Assert:
 			EXPECT_EQ(static_cast<size_t>(Traits::Num_Expected_Services), context.locator().numServices());
-			EXPECT_EQ(1u, context.locator().counters().size());
+			EXPECT_EQ(static_cast<size_t>(Traits::Num_Expected_Counters), context.locator().counters().size());
 
 			EXPECT_FALSE(!!Traits::GetWriters(context.locator()));
 			EXPECT_EQ(static_cast<uint64_t>(extensions::ServiceLocator::Sentinel_Counter_Value), context.counter(Traits::Counter_Name));
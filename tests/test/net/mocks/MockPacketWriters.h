@@ -91,6 +91,10 @@ namespace catapult { namespace mocks {
 			CATAPULT_THROW_RUNTIME_ERROR("not implemented in mock");
 		}
 
+		uint64_t numBroadcastBytesSaved() const override {
+			CATAPULT_THROW_RUNTIME_ERROR("not implemented in mock");
+		}
+
 		void broadcast(const ionet::PacketPayload&) override {
 			CATAPULT_THROW_RUNTIME_ERROR("not implemented in mock");
 		}
@@ -144,6 +148,11 @@ namespace catapult { namespace mocks {
 			m_pPacketIo = pPacketIo;
 		}
 
+		/// Sets the nodes returned (in order and repeatedly) by pickOne to \a nodes.
+		void setNodes(const std::vector<ionet::Node>& nodes) {
+			m_nodes = nodes;
+		}
+
 	public:
 		/// Gets the number of pickOne calls.
 		size_t numPickOneCalls() const {
@@ -158,7 +167,8 @@ namespace catapult { namespace mocks {
 	public:
 		ionet::NodePacketIoPair pickOne(const utils::TimeSpan& ioDuration) override {
 			m_ioDurations.push_back(ioDuration);
-			auto pair = ionet::NodePacketIoPair(ionet::Node(), m_pPacketIo);
+			auto node = m_nodes.empty() ? ionet::Node() : m_nodes[(m_ioDurations.size() - 1) % m_nodes.size()];
+			auto pair = ionet::NodePacketIoPair(node, m_pPacketIo);
 
 			// if the io should only be used once, destroy the reference in writers before returning
 			if (SetPacketIoBehavior::Use_Once == m_setPacketIoBehavior)
@@ -170,6 +180,7 @@ namespace catapult { namespace mocks {
 	private:
 		SetPacketIoBehavior m_setPacketIoBehavior;
 		std::vector<utils::TimeSpan> m_ioDurations;
+		std::vector<ionet::Node> m_nodes;
 		std::shared_ptr<ionet::PacketIo> m_pPacketIo;
 	};
 
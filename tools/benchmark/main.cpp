@@ -54,6 +54,9 @@ namespace catapult { namespace tools { namespace benchmark {
 				optionsBuilder("data size,s",
 						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
 						"the size of the data to generate");
+				optionsBuilder("skew factor,k",
+						OptionsValue<uint32_t>(m_skewFactor)->default_value(8),
+						"the number of verifications per entry in the first partition of the skewed benchmark");
 			}
 
 			int run(const Options&) override {
@@ -64,7 +67,8 @@ namespace catapult { namespace tools { namespace benchmark {
 						<< "num threads (" << m_numThreads
 						<< "), num partitions (" << m_numPartitions
 						<< "), ops / partition (" << m_opsPerPartition
-						<< "), data size (" << m_dataSize << ")";
+						<< "), data size (" << m_dataSize
+						<< "), skew factor (" << m_skewFactor << ")";
 
 				auto keyPair = GenerateRandomKeyPair();
 				auto entries = std::vector<BenchmarkEntry>(m_numPartitions * m_opsPerPartition);
@@ -87,6 +91,15 @@ namespace catapult { namespace tools { namespace benchmark {
 						CATAPULT_LOG(warning) << "could not verify data!";
 				});
 
+				// make the entries initially assigned to the first partition more expensive in order to measure rebalancing
+				auto numSkewedEntries = m_opsPerPartition;
+				RunParallel("Skewed Verify", *pPool, entries, [&keyPair, &entries, numSkewedEntries, skewFactor = m_skewFactor](
+						auto& entry) {
+					auto numVerifications = static_cast<size_t>(&entry - entries.data()) < numSkewedEntries ? skewFactor : 1u;
+					for (auto i = 0u; i < numVerifications; ++i)
+						entry.IsVerified = crypto::Verify(keyPair.publicKey(), entry.Data, entry.Signature);
+				});
+
 				return 0;
 			}
 
@@ -98,7 +111,7 @@ namespace catapult { namespace tools { namespace benchmark {
 					std::vector<BenchmarkEntry>& entries,
 					TAction action) const {
 				utils::StackLogger stopwatch(testName, utils::LogLevel::Info);
-				thread::ParallelFor(pool.service(), entries, m_numPartitions, [action](auto& entry, auto) {
+				auto statistics = thread::ParallelForWithStatistics(pool.service(), entries, m_numPartitions, [action](auto& entry, auto) {
 					action(entry);
 					return true;
 				}).get();
@@ -109,6 +122,9 @@ namespace catapult { namespace tools { namespace benchmark {
 				CATAPULT_LOG(info)
 						<< (0 == opsPerSecond ? "???" : std::to_string(opsPerSecond)) << " ops/s "
 						<< "(elapsed time " << elapsedMillis << "ms, " << elapsedMicrosPerOp << "us/op)";
+				CATAPULT_LOG(info)
+						<< "partition items min " << statistics.MinPartitionItems << ", max " << statistics.MaxPartitionItems
+						<< " (steals " << statistics.NumSteals << ", stolen items " << statistics.NumStolenItems << ")";
 				return elapsedMillis;
 			}
 
@@ -117,6 +133,7 @@ namespace catapult { namespace tools { namespace benchmark {
 			uint32_t m_numPartitions;
 			uint32_t m_opsPerPartition;
 			uint32_t m_dataSize;
+			uint32_t m_skewFactor;
 		};
 	}
 }}}